@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCmdLineApp/Application.h>
+
+#include <djvUI/IconAtlas.h>
+
+#include <djvAV/IOSystem.h>
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/File.h>
+#include <djvSystem/FileInfoFunc.h>
+#include <djvSystem/TextSystem.h>
+#include <djvSystem/TimerFunc.h>
+
+#include <djvCore/ErrorFunc.h>
+#include <djvCore/StringFormat.h>
+
+#include <iostream>
+#include <thread>
+
+using namespace djv;
+
+class Application : public CmdLine::Application
+{
+    DJV_NON_COPYABLE(Application);
+
+protected:
+    void _init(std::list<std::string>& args)
+    {
+        CmdLine::Application::_init(args);
+
+        _parseCmdLine(args);
+    }
+
+    Application()
+    {}
+
+public:
+    static std::shared_ptr<Application> create(std::list<std::string>& args)
+    {
+        auto out = std::shared_ptr<Application>(new Application);
+        out->_init(args);
+        return out;
+    }
+
+    void run() override
+    {
+        auto io = getSystemT<AV::IO::IOSystem>();
+        std::vector<std::pair<std::string, std::shared_ptr<Image::Data> > > icons;
+        for (const auto& i : System::File::directoryList(_input))
+        {
+            const System::File::Path& path = i.getPath();
+            if (System::File::Type::File == i.getType() && ".png" == path.getExtension())
+            {
+                icons.push_back(std::make_pair(path.getBaseName() + path.getNumber(), _read(io, i)));
+            }
+        }
+        UI::IconAtlas::write(_output, icons);
+        std::cout << _output << ": " << icons.size() << std::endl;
+    }
+
+protected:
+    void _parseCmdLine(std::list<std::string>& args) override
+    {
+        CmdLine::Application::_parseCmdLine(args);
+        if (0 == getExitCode())
+        {
+            if (2 == args.size())
+            {
+                _input = System::File::Path(args.front());
+                args.pop_front();
+                _output = System::File::Path(args.front());
+                args.pop_front();
+            }
+            else
+            {
+                _printUsage();
+                exit(1);
+            }
+        }
+    }
+
+    void _printUsage() override
+    {
+        auto textSystem = getSystemT<System::TextSystem>();
+        std::cout << std::endl;
+        std::cout << " " << textSystem->getText(DJV_TEXT("djv_icon_atlas_description")) << std::endl;
+        std::cout << std::endl;
+        std::cout << " " << textSystem->getText(DJV_TEXT("djv_icon_atlas_usage")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_icon_atlas_usage_format")) << std::endl;
+        std::cout << std::endl;
+
+        CmdLine::Application::_printUsage();
+    }
+
+private:
+    std::shared_ptr<Image::Data> _read(
+        const std::shared_ptr<AV::IO::IOSystem>& io,
+        const System::File::Info& fileInfo)
+    {
+        std::shared_ptr<Image::Data> out;
+        auto read = io->read(fileInfo);
+        bool finished = false;
+        while (!out && !finished)
+        {
+            {
+                std::lock_guard<std::mutex> lock(read->getMutex());
+                auto& queue = read->getVideoQueue();
+                if (!queue.isEmpty())
+                {
+                    out = queue.getFrame().data;
+                }
+                else if (queue.isFinished())
+                {
+                    finished = true;
+                }
+            }
+            if (!out && !finished)
+            {
+                std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::VeryFast));
+            }
+        }
+        if (!out)
+        {
+            auto textSystem = getSystemT<System::TextSystem>();
+            throw System::File::Error(Core::String::Format("{0}: {1}").
+                arg(fileInfo.getFileName()).
+                arg(textSystem->getText(DJV_TEXT("error_file_open"))));
+        }
+        return out;
+    }
+
+    System::File::Path _input;
+    System::File::Path _output;
+};
+
+DJV_MAIN()
+{
+    int r = 1;
+    try
+    {
+        auto args = Application::args(argc, argv);
+        auto app = Application::create(args);
+        if (0 == app->getExitCode())
+        {
+            app->run();
+        }
+        r = app->getExitCode();
+    }
+    catch (const std::exception& error)
+    {
+        std::cout << Core::Error::format(error) << std::endl;
+    }
+    return r;
+}
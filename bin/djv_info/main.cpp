@@ -9,6 +9,7 @@
 #include <djvAV/TimeFunc.h>
 
 #include <djvImage/InfoFunc.h>
+#include <djvImage/TypeFunc.h>
 
 #include <djvSystem/Context.h>
 #include <djvSystem/FileInfoFunc.h>
@@ -16,8 +17,14 @@
 #include <djvSystem/TextSystem.h>
 
 #include <djvCore/ErrorFunc.h>
+#include <djvCore/RapidJSONFunc.h>
 #include <djvCore/StringFormat.h>
 
+#include <rapidjson/writer.h>
+
+#include <mutex>
+#include <thread>
+
 using namespace djv;
 
 class Application : public CmdLine::Application
@@ -84,13 +91,36 @@ public:
                 break;
             case System::File::Type::Directory:
             {
-                std::cout << i.getPath() << ":" << std::endl;
                 System::File::DirectoryListOptions options;
                 options.sequences = true;
                 options.sequenceExtensions = io->getSequenceExtensions();
-                for (const auto& j : System::File::directoryList(i.getPath(), options))
+                if (_recursive)
                 {
-                    _print(j, io, avSystem);
+                    // Walk the directories in parallel, the results are
+                    // printed as they are finished.
+                    System::File::directoryWalk(
+                        i.getPath(),
+                        options,
+                        _threadCount,
+                        [this, &io, &avSystem](const System::File::Info& value)
+                        {
+                            _print(value, io, avSystem);
+                        },
+                        [this](const System::File::Path& path, const std::exception& e)
+                        {
+                            _printError(path, e);
+                        });
+                }
+                else
+                {
+                    if (!_json)
+                    {
+                        std::cout << i.getPath() << ":" << std::endl;
+                    }
+                    for (const auto& j : System::File::directoryList(i.getPath(), options))
+                    {
+                        _print(j, io, avSystem);
+                    }
                 }
                 break;
             }
@@ -100,6 +130,47 @@ public:
     }
 
 protected:
+    void _parseCmdLine(std::list<std::string>& args) override
+    {
+        CmdLine::Application::_parseCmdLine(args);
+        auto arg = args.begin();
+        while (arg != args.end())
+        {
+            if ("-recursive" == *arg)
+            {
+                arg = args.erase(arg);
+                _recursive = true;
+            }
+            else if ("-json" == *arg)
+            {
+                arg = args.erase(arg);
+                _json = true;
+            }
+            else if ("-threads" == *arg)
+            {
+                arg = args.erase(arg);
+                int value = 0;
+                if (arg != args.end())
+                {
+                    std::stringstream ss(*arg);
+                    ss >> value;
+                    arg = args.erase(arg);
+                }
+                if (value < 1)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-threads").
+                        arg(_textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                _threadCount = static_cast<size_t>(value);
+            }
+            else
+            {
+                ++arg;
+            }
+        }
+    }
+
     void _printUsage() override
     {
         auto textSystem = getSystemT<System::TextSystem>();
@@ -110,60 +181,154 @@ protected:
         std::cout << std::endl;
         std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_usage_format")) << std::endl;
         std::cout << std::endl;
+        std::cout << " " << textSystem->getText(DJV_TEXT("djv_info_options")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_recursive")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_recursive_description")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_json")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_json_description")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_info_option_threads")) << std::endl;
+        {
+            const std::string s = Core::String::Format(textSystem->getText(DJV_TEXT("djv_info_option_threads_description"))).
+                arg(static_cast<int>(_threadCount));
+            std::cout << "   " << s << std::endl;
+        }
+        std::cout << std::endl;
 
         CmdLine::Application::_printUsage();
     }
 
 private:
-    void _print(const System::File::Info& fileInfo, std::shared_ptr<AV::IO::IOSystem>& io, std::shared_ptr<AV::AVSystem>& avSystem)
+    void _print(const System::File::Info& fileInfo, const std::shared_ptr<AV::IO::IOSystem>& io, const std::shared_ptr<AV::AVSystem>& avSystem)
     {
         if (io->canRead(fileInfo))
         {
+            // Format the output before locking so that the files are
+            // probed in parallel when walking directories.
+            std::string s;
             try
             {
-                const auto read = io->read(fileInfo);
-                const auto info = read->getInfo().get();
-                std::cout << fileInfo << std::endl;
-                std::cout.precision(2);
-                if (info.videoSequence.getFrameCount() > 1)
-                {
-                    std::cout << "    Speed: " << info.videoSpeed.toFloat() << std::endl;
-                    const AV::Time::Units timeUnits = avSystem->observeTimeUnits()->get();
-                    std::cout << "    Duration: " << AV::Time::toString(info.videoSequence.getFrameCount(), info.videoSpeed, timeUnits);
-                    if (AV::Time::Units::Frames == timeUnits)
-                    {
-                        std::cout << " " << "frames";
-                    }
-                    std::cout << std::endl;
-                }
-                for (const auto & video : info.video)
-                {
-                    std::cout << "    " << video.name << std::endl;
-                    std::cout << "        Size: " << video.size << " " << std::fixed << video.getAspectRatio() << std::endl;
-                    std::stringstream ss;
-                    ss << video.type;
-                    std::cout << "        Type: " << _textSystem->getText(ss.str()) << std::endl;
-                }
-                if (info.audio.isValid())
-                {
-                    std::cout << "    " << info.audio.name << std::endl;
-                    std::cout << "        Channels: " << static_cast<int>(info.audio.channelCount) << std::endl;
-                    std::stringstream ss;
-                    ss << info.audio.type;
-                    std::cout << "        Type: " << _textSystem->getText(ss.str()) << std::endl;
-                    std::cout << "        Sample rate: " << info.audio.sampleRate << std::endl;
-                    std::cout << "        Duration: " << (info.audio.sampleRate > 0 ? (info.audioSampleCount / static_cast<float>(info.audio.sampleRate)) : 0.F) << " seconds" << std::endl;
-                }
+                const auto info = io->probe(fileInfo);
+                s = _json ? _toJSON(fileInfo, info) : _toText(fileInfo, info, avSystem);
             }
             catch (const std::exception & e)
             {
-                std::cout << Core::Error::format(e) << std::endl;
+                s = _json ? _errorToJSON(fileInfo, e.what()) : Core::Error::format(e);
             }
+            std::lock_guard<std::mutex> lock(_outputMutex);
+            std::cout << s << std::endl;
         }
     }
 
+    void _printError(const System::File::Path& path, const std::exception& e)
+    {
+        const std::string s = _json ? _errorToJSON(System::File::Info(path), e.what()) : Core::Error::format(e);
+        std::lock_guard<std::mutex> lock(_outputMutex);
+        std::cout << s << std::endl;
+    }
+
+    std::string _toText(const System::File::Info& fileInfo, const AV::IO::Info& info, const std::shared_ptr<AV::AVSystem>& avSystem)
+    {
+        std::stringstream ss;
+        ss << fileInfo << std::endl;
+        ss.precision(2);
+        if (info.videoSequence.getFrameCount() > 1)
+        {
+            ss << "    Speed: " << info.videoSpeed.toFloat() << std::endl;
+            const AV::Time::Units timeUnits = avSystem->observeTimeUnits()->get();
+            ss << "    Duration: " << AV::Time::toString(info.videoSequence.getFrameCount(), info.videoSpeed, timeUnits);
+            if (AV::Time::Units::Frames == timeUnits)
+            {
+                ss << " " << "frames";
+            }
+            ss << std::endl;
+        }
+        for (const auto & video : info.video)
+        {
+            ss << "    " << video.name << std::endl;
+            ss << "        Size: " << video.size << " " << std::fixed << video.getAspectRatio() << std::endl;
+            std::stringstream ss2;
+            ss2 << video.type;
+            ss << "        Type: " << _textSystem->getText(ss2.str()) << std::endl;
+        }
+        if (info.audio.isValid())
+        {
+            ss << "    " << info.audio.name << std::endl;
+            ss << "        Channels: " << static_cast<int>(info.audio.channelCount) << std::endl;
+            std::stringstream ss2;
+            ss2 << info.audio.type;
+            ss << "        Type: " << _textSystem->getText(ss2.str()) << std::endl;
+            ss << "        Sample rate: " << info.audio.sampleRate << std::endl;
+            ss << "        Duration: " << (info.audio.sampleRate > 0 ? (info.audioSampleCount / static_cast<float>(info.audio.sampleRate)) : 0.F) << " seconds" << std::endl;
+        }
+        std::string out = ss.str();
+        if (!out.empty())
+        {
+            out.pop_back();
+        }
+        return out;
+    }
+
+    std::string _toJSON(const System::File::Info& fileInfo, const AV::IO::Info& info)
+    {
+        rapidjson::Document document;
+        document.SetObject();
+        auto& allocator = document.GetAllocator();
+        document.AddMember("file", toJSON(fileInfo.getFileName(), allocator), allocator);
+        document.AddMember("frames", toJSON(info.videoSequence.getFrameCount(), allocator), allocator);
+        document.AddMember("speed", toJSON(info.videoSpeed.toFloat(), allocator), allocator);
+        rapidjson::Value video(rapidjson::kArrayType);
+        for (const auto& i : info.video)
+        {
+            rapidjson::Value object(rapidjson::kObjectType);
+            object.AddMember("name", toJSON(i.name, allocator), allocator);
+            object.AddMember("width", toJSON(static_cast<int>(i.size.w), allocator), allocator);
+            object.AddMember("height", toJSON(static_cast<int>(i.size.h), allocator), allocator);
+            object.AddMember("pixel_aspect_ratio", toJSON(i.pixelAspectRatio, allocator), allocator);
+            object.AddMember("type", toJSON(i.type, allocator), allocator);
+            object.AddMember("codec", toJSON(i.codec, allocator), allocator);
+            video.PushBack(object, allocator);
+        }
+        document.AddMember("video", video, allocator);
+        if (info.audio.isValid())
+        {
+            rapidjson::Value audio(rapidjson::kObjectType);
+            audio.AddMember("name", toJSON(info.audio.name, allocator), allocator);
+            audio.AddMember("channels", toJSON(static_cast<int>(info.audio.channelCount), allocator), allocator);
+            std::stringstream ss;
+            ss << info.audio.type;
+            audio.AddMember("type", toJSON(ss.str(), allocator), allocator);
+            audio.AddMember("sample_rate", toJSON(info.audio.sampleRate, allocator), allocator);
+            audio.AddMember("samples", toJSON(info.audioSampleCount, allocator), allocator);
+            document.AddMember("audio", audio, allocator);
+        }
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        document.Accept(writer);
+        return buffer.GetString();
+    }
+
+    std::string _errorToJSON(const System::File::Info& fileInfo, const std::string& error)
+    {
+        rapidjson::Document document;
+        document.SetObject();
+        auto& allocator = document.GetAllocator();
+        document.AddMember("file", toJSON(fileInfo.getFileName(), allocator), allocator);
+        document.AddMember("error", toJSON(error, allocator), allocator);
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        document.Accept(writer);
+        return buffer.GetString();
+    }
+
     std::shared_ptr<System::TextSystem> _textSystem;
     std::vector<System::File::Info> _inputs;
+    bool _recursive = false;
+    bool _json = false;
+    size_t _threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+    std::mutex _outputMutex;
 };
 
 DJV_MAIN()
@@ -12,8 +12,14 @@
 #include <djvSystem/TextSystem.h>
 
 #include <djvCore/ErrorFunc.h>
+#include <djvCore/RapidJSONFunc.h>
 #include <djvCore/StringFormat.h>
 
+#include <rapidjson/writer.h>
+
+#include <mutex>
+#include <thread>
+
 using namespace djv;
 
 class Application : public CmdLine::Application
@@ -25,6 +31,8 @@ protected:
     {
         CmdLine::Application::_init(args);
 
+        _textSystem = getSystemT<System::TextSystem>();
+
         _parseCmdLine(args);
 
         bool hasInputs = args.size();
@@ -70,17 +78,40 @@ public:
             switch (i.getType())
             {
             case System::File::Type::File:
-                _print(std::string(i));
+                _print(i, std::string(i));
                 break;
             case System::File::Type::Directory:
             {
-                std::cout << i.getPath() << ":" << std::endl;
                 System::File::DirectoryListOptions options;
                 options.sequences = true;
                 options.sequenceExtensions = io->getSequenceExtensions();
-                for (const auto& j : System::File::directoryList(i.getPath(), options))
+                if (_recursive)
+                {
+                    // Walk the directories in parallel, the results are
+                    // printed as they are found.
+                    System::File::directoryWalk(
+                        i.getPath(),
+                        options,
+                        _threadCount,
+                        [this](const System::File::Info& value)
+                        {
+                            _print(value, value.getFileName());
+                        },
+                        [this](const System::File::Path& path, const std::exception& e)
+                        {
+                            _printError(path, e);
+                        });
+                }
+                else
                 {
-                    _print(j.getFileName(Math::Frame::invalid, false));
+                    if (!_json)
+                    {
+                        std::cout << i.getPath() << ":" << std::endl;
+                    }
+                    for (const auto& j : System::File::directoryList(i.getPath(), options))
+                    {
+                        _print(j, j.getFileName(Math::Frame::invalid, false));
+                    }
                 }
                 break;
             }
@@ -90,6 +121,47 @@ public:
     }
 
 protected:
+    void _parseCmdLine(std::list<std::string>& args) override
+    {
+        CmdLine::Application::_parseCmdLine(args);
+        auto arg = args.begin();
+        while (arg != args.end())
+        {
+            if ("-recursive" == *arg)
+            {
+                arg = args.erase(arg);
+                _recursive = true;
+            }
+            else if ("-json" == *arg)
+            {
+                arg = args.erase(arg);
+                _json = true;
+            }
+            else if ("-threads" == *arg)
+            {
+                arg = args.erase(arg);
+                int value = 0;
+                if (arg != args.end())
+                {
+                    std::stringstream ss(*arg);
+                    ss >> value;
+                    arg = args.erase(arg);
+                }
+                if (value < 1)
+                {
+                    throw std::runtime_error(Core::String::Format("{0}: {1}").
+                        arg("-threads").
+                        arg(_textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                }
+                _threadCount = static_cast<size_t>(value);
+            }
+            else
+            {
+                ++arg;
+            }
+        }
+    }
+
     void _printUsage() override
     {
         auto textSystem = getSystemT<System::TextSystem>();
@@ -100,17 +172,68 @@ protected:
         std::cout << std::endl;
         std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_usage_format")) << std::endl;
         std::cout << std::endl;
+        std::cout << " " << textSystem->getText(DJV_TEXT("djv_ls_options")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_option_recursive")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_option_recursive_description")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_option_json")) << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_option_json_description")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_ls_option_threads")) << std::endl;
+        {
+            const std::string s = Core::String::Format(textSystem->getText(DJV_TEXT("djv_ls_option_threads_description"))).
+                arg(static_cast<int>(_threadCount));
+            std::cout << "   " << s << std::endl;
+        }
+        std::cout << std::endl;
 
         CmdLine::Application::_printUsage();
     }
 
-    std::vector<System::File::Info> _inputs;
-
 private:
-    void _print(const std::string & fileName)
+    void _print(const System::File::Info& fileInfo, const std::string& fileName)
+    {
+        std::string s = fileName;
+        if (_json)
+        {
+            rapidjson::Document document;
+            auto& allocator = document.GetAllocator();
+            auto json = toJSON(fileInfo, allocator);
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            json.Accept(writer);
+            s = buffer.GetString();
+        }
+        std::lock_guard<std::mutex> lock(_outputMutex);
+        std::cout << s << std::endl;
+    }
+
+    void _printError(const System::File::Path& path, const std::exception& e)
     {
-        std::cout << fileName << std::endl;
+        std::string s = Core::Error::format(e);
+        if (_json)
+        {
+            rapidjson::Document document;
+            document.SetObject();
+            auto& allocator = document.GetAllocator();
+            document.AddMember("file", toJSON(path.get(), allocator), allocator);
+            document.AddMember("error", toJSON(std::string(e.what()), allocator), allocator);
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            document.Accept(writer);
+            s = buffer.GetString();
+        }
+        std::lock_guard<std::mutex> lock(_outputMutex);
+        std::cout << s << std::endl;
     }
+
+    std::shared_ptr<System::TextSystem> _textSystem;
+    std::vector<System::File::Info> _inputs;
+    bool _recursive = false;
+    bool _json = false;
+    size_t _threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+    std::mutex _outputMutex;
 };
 
 DJV_MAIN()
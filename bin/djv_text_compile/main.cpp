@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCmdLineApp/Application.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileInfoFunc.h>
+#include <djvSystem/TextSystem.h>
+#include <djvSystem/TextTable.h>
+
+#include <djvCore/ErrorFunc.h>
+
+#include <iostream>
+#include <map>
+
+using namespace djv;
+
+class Application : public CmdLine::Application
+{
+    DJV_NON_COPYABLE(Application);
+
+protected:
+    void _init(std::list<std::string>& args)
+    {
+        CmdLine::Application::_init(args);
+
+        _parseCmdLine(args);
+    }
+
+    Application()
+    {}
+
+public:
+    static std::shared_ptr<Application> create(std::list<std::string>& args)
+    {
+        auto out = std::shared_ptr<Application>(new Application);
+        out->_init(args);
+        return out;
+    }
+
+    void run() override
+    {
+        // Merge the .text files for each locale.
+        std::map<std::string, std::map<std::string, std::string> > text;
+        System::File::DirectoryListOptions options;
+        options.filter = "\\.text$";
+        for (const auto& i : System::File::directoryList(_input, options))
+        {
+            const System::File::Path& path = i.getPath();
+            const std::string locale = System::TextTable::getLocale(path);
+            if (locale != "all")
+            {
+                for (const auto& j : System::TextTable::readText(path))
+                {
+                    text[locale][j.first] = j.second;
+                }
+            }
+        }
+
+        // Write a text table for each locale.
+        for (const auto& i : text)
+        {
+            const System::File::Path path(_output, i.first + System::textTableExtension);
+            System::TextTable::write(path, i.second);
+            std::cout << path << ": " << i.second.size() << std::endl;
+        }
+    }
+
+protected:
+    void _parseCmdLine(std::list<std::string>& args) override
+    {
+        CmdLine::Application::_parseCmdLine(args);
+        if (0 == getExitCode())
+        {
+            if (2 == args.size())
+            {
+                _input = System::File::Path(args.front());
+                args.pop_front();
+                _output = System::File::Path(args.front());
+                args.pop_front();
+            }
+            else
+            {
+                _printUsage();
+                exit(1);
+            }
+        }
+    }
+
+    void _printUsage() override
+    {
+        auto textSystem = getSystemT<System::TextSystem>();
+        std::cout << std::endl;
+        std::cout << " " << textSystem->getText(DJV_TEXT("djv_text_compile_description")) << std::endl;
+        std::cout << std::endl;
+        std::cout << " " << textSystem->getText(DJV_TEXT("djv_text_compile_usage")) << std::endl;
+        std::cout << std::endl;
+        std::cout << "   " << textSystem->getText(DJV_TEXT("djv_text_compile_usage_format")) << std::endl;
+        std::cout << std::endl;
+
+        CmdLine::Application::_printUsage();
+    }
+
+private:
+    System::File::Path _input;
+    System::File::Path _output;
+};
+
+DJV_MAIN()
+{
+    int r = 1;
+    try
+    {
+        auto args = Application::args(argc, argv);
+        auto app = Application::create(args);
+        if (0 == app->getExitCode())
+        {
+            app->run();
+        }
+        r = app->getExitCode();
+    }
+    catch (const std::exception& error)
+    {
+        std::cout << Core::Error::format(error) << std::endl;
+    }
+    return r;
+}
@@ -4,9 +4,11 @@
 
 #include <djvAV/AVSystem.h>
 
+#include <djvAV/FilmstripSystem.h>
 #include <djvAV/IOSystem.h>
 #include <djvAV/SpeedFunc.h>
 #include <djvAV/ThumbnailSystem.h>
+#include <djvAV/WaveformSystem.h>
 
 #include <djvOCIO/OCIOSystem.h>
 
@@ -46,12 +48,16 @@ namespace djv
             auto ocioSystem = OCIO::OCIOSystem::create(context);
             auto ioSystem = IO::IOSystem::create(context);
             p.thumbnailSystem = ThumbnailSystem::create(context);
+            auto waveformSystem = WaveformSystem::create(context);
+            auto filmstripSystem = FilmstripSystem::create(context);
             addDependency(audioSystem);
             addDependency(glfwSystem);
             addDependency(shaderSystem);
             addDependency(ocioSystem);
             addDependency(ioSystem);
             addDependency(p.thumbnailSystem);
+            addDependency(waveformSystem);
+            addDependency(filmstripSystem);
 
             _logInitTime();
         }
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/CacheWorker.h>
+
+#include <djvCore/MemoryFunc.h>
+
+#include <iomanip>
+#include <sstream>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        size_t getCacheKey(const System::File::Info& fileInfo)
+        {
+            size_t out = 0;
+            Memory::hashCombine(out, fileInfo.getFileName());
+            Memory::hashCombine(out, fileInfo.getSize());
+            Memory::hashCombine(out, fileInfo.getTime());
+            return out;
+        }
+
+        System::File::Path getCachePath(
+            const System::File::Path& directory,
+            const System::File::Info& fileInfo,
+            const std::string& extension)
+        {
+            std::stringstream ss;
+            ss << std::hex << std::setfill('0') << std::setw(sizeof(size_t) * 2) <<
+                std::hash<std::string>()(fileInfo.getFileName()) << extension;
+            return System::File::Path(directory, ss.str());
+        }
+
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/LogSystem.h>
+#include <djvSystem/PathFunc.h>
+#include <djvSystem/TimerFunc.h>
+
+#include <djvCore/Cache.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <list>
+#include <mutex>
+#include <thread>
+
+namespace djv
+{
+    namespace AV
+    {
+        //! Get the memory cache key for a file.
+        size_t getCacheKey(const System::File::Info&);
+
+        //! Get the path of the item for a file in a cache directory.
+        System::File::Path getCachePath(
+            const System::File::Path& directory,
+            const System::File::Info&,
+            const std::string& extension);
+
+        //! This class provides a background thread that builds items from
+        //! files. The items are kept in a memory cache and stored in a cache
+        //! directory so they are only built once.
+        template<typename T>
+        class CacheWorker
+        {
+            DJV_NON_COPYABLE(CacheWorker);
+
+        public:
+            //! Read an item from the cache directory. The result is null when
+            //! the item does not match the file.
+            typedef std::function<std::shared_ptr<T>(
+                const System::File::Path&,
+                const System::File::Info&)> ReadCallback;
+
+            //! Build an item and write it to the cache directory. The result
+            //! is null when the item cannot be built.
+            typedef std::function<std::shared_ptr<T>(const System::File::Path&)> BuildCallback;
+
+            CacheWorker(
+                const std::string&                        name,
+                const System::File::Path&                 directory,
+                const std::string&                        extension,
+                size_t                                    cacheMax,
+                const ReadCallback&                       read,
+                const std::function<void(void)>&          finished,
+                const std::shared_ptr<System::LogSystem>& logSystem);
+            ~CacheWorker();
+
+            //! Get whether the worker is running, builds should stop when it
+            //! is not.
+            const std::atomic<bool>& isRunning() const;
+
+            //! Request the item for a file.
+            std::future<std::shared_ptr<T> > request(const System::File::Info&, const BuildCallback&);
+
+            //! Clear the memory cache.
+            void clearCache();
+
+        private:
+            struct Request
+            {
+                Request();
+                Request(Request&&) noexcept;
+                Request& operator = (Request&&) noexcept;
+
+                System::File::Info fileInfo;
+                BuildCallback build;
+                std::promise<std::shared_ptr<T> > promise;
+            };
+
+            std::shared_ptr<T> _get(const Request&);
+
+            std::string _name;
+            System::File::Path _directory;
+            std::string _extension;
+            ReadCallback _read;
+            std::function<void(void)> _finished;
+            std::shared_ptr<System::LogSystem> _logSystem;
+
+            std::list<Request> _requests;
+            std::condition_variable _requestCV;
+            std::mutex _requestMutex;
+
+            Core::Memory::Cache<size_t, std::shared_ptr<T> > _cache;
+            std::atomic<bool> _clearCache;
+
+            std::thread _thread;
+            std::atomic<bool> _running;
+        };
+
+    } // namespace AV
+} // namespace djv
+
+#include <djvAV/CacheWorkerInline.h>
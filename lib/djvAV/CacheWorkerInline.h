@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+namespace djv
+{
+    namespace AV
+    {
+        template<typename T>
+        inline CacheWorker<T>::Request::Request()
+        {}
+
+        template<typename T>
+        inline CacheWorker<T>::Request::Request(Request&& other) noexcept :
+            fileInfo(other.fileInfo),
+            build(std::move(other.build)),
+            promise(std::move(other.promise))
+        {}
+
+        template<typename T>
+        inline typename CacheWorker<T>::Request& CacheWorker<T>::Request::operator = (Request&& other) noexcept
+        {
+            if (this != &other)
+            {
+                fileInfo = other.fileInfo;
+                build = std::move(other.build);
+                promise = std::move(other.promise);
+            }
+            return *this;
+        }
+
+        template<typename T>
+        inline CacheWorker<T>::CacheWorker(
+            const std::string&                        name,
+            const System::File::Path&                 directory,
+            const std::string&                        extension,
+            size_t                                    cacheMax,
+            const ReadCallback&                       read,
+            const std::function<void(void)>&          finished,
+            const std::shared_ptr<System::LogSystem>& logSystem) :
+            _name(name),
+            _directory(directory),
+            _extension(extension),
+            _read(read),
+            _finished(finished),
+            _logSystem(logSystem)
+        {
+            _cache.setMax(cacheMax);
+            _clearCache = false;
+            _running = true;
+            _thread = std::thread(
+                [this]
+            {
+                const auto timeout = System::getTimerValue(System::TimerValue::Medium);
+                while (_running)
+                {
+                    if (_clearCache)
+                    {
+                        _clearCache = false;
+                        _cache.clear();
+                    }
+
+                    Request request;
+                    bool hasRequest = false;
+                    {
+                        std::unique_lock<std::mutex> lock(_requestMutex);
+                        if (_requestCV.wait_for(
+                            lock,
+                            std::chrono::milliseconds(timeout),
+                            [this]
+                        {
+                            return _requests.size();
+                        }))
+                        {
+                            request = std::move(_requests.front());
+                            _requests.pop_front();
+                            hasRequest = true;
+                        }
+                    }
+                    if (hasRequest)
+                    {
+                        std::shared_ptr<T> item;
+                        try
+                        {
+                            item = _get(request);
+                        }
+                        catch (const std::exception& e)
+                        {
+                            _logSystem->log(_name, e.what(), System::LogLevel::Error);
+                        }
+                        request.promise.set_value(item);
+                        if (_finished)
+                        {
+                            _finished();
+                        }
+                    }
+                }
+            });
+        }
+
+        template<typename T>
+        inline CacheWorker<T>::~CacheWorker()
+        {
+            _running = false;
+            if (_thread.joinable())
+            {
+                _thread.join();
+            }
+        }
+
+        template<typename T>
+        inline const std::atomic<bool>& CacheWorker<T>::isRunning() const
+        {
+            return _running;
+        }
+
+        template<typename T>
+        inline std::future<std::shared_ptr<T> > CacheWorker<T>::request(
+            const System::File::Info& fileInfo,
+            const BuildCallback& build)
+        {
+            Request request;
+            request.fileInfo = fileInfo;
+            request.build = build;
+            auto future = request.promise.get_future();
+            {
+                std::unique_lock<std::mutex> lock(_requestMutex);
+                _requests.push_back(std::move(request));
+            }
+            _requestCV.notify_one();
+            return future;
+        }
+
+        template<typename T>
+        inline void CacheWorker<T>::clearCache()
+        {
+            _clearCache = true;
+        }
+
+        template<typename T>
+        inline std::shared_ptr<T> CacheWorker<T>::_get(const Request& request)
+        {
+            // Check the memory cache.
+            const size_t key = getCacheKey(request.fileInfo);
+            std::shared_ptr<T> out;
+            if (_cache.get(key, out))
+            {
+                return out;
+            }
+
+            // Read the item from a previous session.
+            const System::File::Path fileName = getCachePath(_directory, request.fileInfo, _extension);
+            try
+            {
+                if (System::File::Info(fileName).doesExist())
+                {
+                    out = _read(fileName, request.fileInfo);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                _logSystem->log(_name, e.what(), System::LogLevel::Warning);
+            }
+
+            // Build the item.
+            if (!out && request.build)
+            {
+                try
+                {
+                    if (!System::File::Info(_directory).doesExist())
+                    {
+                        System::File::mkdir(_directory);
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    _logSystem->log(_name, e.what(), System::LogLevel::Warning);
+                }
+                out = request.build(fileName);
+            }
+
+            if (out)
+            {
+                _cache.add(key, out);
+            }
+            return out;
+        }
+
+    } // namespace AV
+} // namespace djv
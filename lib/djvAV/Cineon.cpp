@@ -43,6 +43,16 @@ namespace djv
                     return Write::create(fileInfo, info, options, _textSystem, _resourceSystem, _logSystem);
                 }
 
+                bool Plugin::_probe(
+                    const std::string& fileName,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    Info& info) const
+                {
+                    info = Read::readInfo(fileName, speed, sequence, _textSystem);
+                    return true;
+                }
+
             } // namespace Cineon
         } // namespace IO
     } // namespace AV
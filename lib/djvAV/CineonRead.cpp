@@ -18,13 +18,7 @@ namespace djv
         {
             namespace Cineon
             {
-                struct Read::Private
-                {
-                    ColorProfile colorProfile = ColorProfile::FilmPrint;
-                };
-
-                Read::Read() :
-                    _p(new Private)
+                Read::Read()
                 {}
 
                 Read::~Read()
@@ -76,30 +70,44 @@ namespace djv
                     return out;
                 }
 
-                Info Read::_readInfo(const std::string& fileName)
+                Info Read::readInfo(
+                    const std::string& fileName,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
                     auto io = System::File::IO::create();
-                    return _open(fileName, io);
+                    return _open(fileName, io, speed, sequence, textSystem);
+                }
+
+                Info Read::_readInfo(const std::string& fileName)
+                {
+                    return readInfo(fileName, _speed, _sequence, _textSystem);
                 }
 
                 std::shared_ptr<Image::Data> Read::_readImage(const std::string& fileName)
                 {
                     auto io = System::File::IO::create();
-                    const auto info = _open(fileName, io);
+                    const auto info = _open(fileName, io, _speed, _sequence, _textSystem);
                     auto out = readImage(info, io);
                     out->setPluginName(pluginName);
                     return out;
                 }
 
-                Info Read::_open(const std::string& fileName, const std::shared_ptr<System::File::IO>& io)
+                Info Read::_open(
+                    const std::string& fileName,
+                    const std::shared_ptr<System::File::IO>& io,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
-                    DJV_PRIVATE_PTR();
                     io->open(fileName, System::File::Mode::Read);
                     Info info;
-                    info.videoSpeed = _speed;
-                    info.videoSequence = _sequence;
+                    info.videoSpeed = speed;
+                    info.videoSequence = sequence;
                     info.video.push_back(Image::Info());
-                    read(io, info, p.colorProfile, _textSystem);
+                    ColorProfile colorProfile = ColorProfile::FilmPrint;
+                    read(io, info, colorProfile, textSystem);
                     return info;
                 }
 
@@ -304,12 +304,27 @@ namespace djv
                         const std::shared_ptr<System::ResourceSystem>&,
                         const std::shared_ptr<System::LogSystem>&);
 
+                    //! Read the file information from the header without creating
+                    //! a reader.
+                    //! Throws:
+                    //! - System::File::Error
+                    static Info readInfo(
+                        const std::string& fileName,
+                        const Math::IntRational& speed,
+                        const Math::Frame::Sequence&,
+                        const std::shared_ptr<System::TextSystem>&);
+
                 protected:
                     Info _readInfo(const std::string&) override;
                     std::shared_ptr<Image::Data> _readImage(const std::string&) override;
 
                 private:
-                    Info _open(const std::string&, const std::shared_ptr<System::File::IO>&);
+                    static Info _open(
+                        const std::string&,
+                        const std::shared_ptr<System::File::IO>&,
+                        const Math::IntRational&,
+                        const Math::Frame::Sequence&,
+                        const std::shared_ptr<System::TextSystem>&);
 
                     DJV_PRIVATE();
                 };
@@ -360,6 +375,13 @@ namespace djv
                     std::shared_ptr<IRead> read(const System::File::Info&, const ReadOptions&) const override;
                     std::shared_ptr<IWrite> write(const System::File::Info&, const Info&, const WriteOptions&) const override;
 
+                protected:
+                    bool _probe(
+                        const std::string&,
+                        const Math::IntRational&,
+                        const Math::Frame::Sequence&,
+                        Info&) const override;
+
                 private:
                     DJV_PRIVATE();
                 };
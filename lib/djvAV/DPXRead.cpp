@@ -21,7 +21,6 @@ namespace djv
             {
                 struct Read::Private
                 {
-                    Transfer transfer = Transfer::FilmPrint;
                     Options options;
                 };
 
@@ -48,30 +47,44 @@ namespace djv
                     return out;
                 }
 
-                Info Read::_readInfo(const std::string& fileName)
+                Info Read::readInfo(
+                    const std::string& fileName,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
                     auto io = System::File::IO::create();
-                    return _open(fileName, io);
+                    return _open(fileName, io, speed, sequence, textSystem);
+                }
+
+                Info Read::_readInfo(const std::string& fileName)
+                {
+                    return readInfo(fileName, _speed, _sequence, _textSystem);
                 }
 
                 std::shared_ptr<Image::Data> Read::_readImage(const std::string& fileName)
                 {
                     auto io = System::File::IO::create();
-                    const auto info = _open(fileName, io);
+                    const auto info = _open(fileName, io, _speed, _sequence, _textSystem);
                     auto out = Cineon::Read::readImage(info, io);
                     out->setPluginName(pluginName);
                     return out;
                 }
 
-                Info Read::_open(const std::string& fileName, const std::shared_ptr<System::File::IO>& io)
+                Info Read::_open(
+                    const std::string& fileName,
+                    const std::shared_ptr<System::File::IO>& io,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
-                    DJV_PRIVATE_PTR();
                     io->open(fileName, System::File::Mode::Read);
                     Info info;
-                    info.videoSpeed = _speed;
-                    info.videoSequence = _sequence;
+                    info.videoSpeed = speed;
+                    info.videoSequence = sequence;
                     info.video.push_back(Image::Info());
-                    DPX::read(io, info, p.transfer, _textSystem);
+                    Transfer transfer = Transfer::FilmPrint;
+                    DPX::read(io, info, transfer, textSystem);
                     return info;
                 }
 
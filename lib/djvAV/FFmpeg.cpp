@@ -97,6 +97,11 @@ namespace djv
                     return Read::create(fileInfo, options, p.options, _textSystem, _resourceSystem, _logSystem);
                 }
 
+                Info Plugin::probe(const System::File::Info& fileInfo) const
+                {
+                    return FFmpeg::probe(fileInfo, _textSystem);
+                }
+
             } // namespace FFmpeg
         } // namespace IO
     } // namespace AV
@@ -86,6 +86,7 @@ namespace djv
                         const std::shared_ptr<System::LogSystem>&);
 
                     bool isRunning() const override;
+                    bool hasCache() const override;
 
                     std::future<Info> getInfo() override;
 
@@ -96,9 +97,19 @@ namespace djv
                     {
                         AVPacket*           packet       = nullptr;
                         Math::Frame::Number seek         = -1;
+                        Math::Frame::Number end          = Math::Frame::invalid;
                         bool                cacheEnabled = false;
                     };
                     int _decodeVideo(const DecodeVideo&, Math::Frame::Number&);
+                    void _startConvert();
+                    void _stopConvert();
+                    void _finishVideo(bool add);
+                    void _addVideo(Math::Frame::Number, const std::shared_ptr<Image::Data>&);
+                    bool _readReverse();
+
+                    void _fillCache();
+                    Math::Frame::Number _getCacheFrame(Math::Frame::Number end) const;
+                    void _cacheInfoUpdate();
 
                     struct DecodeAudio
                     {
@@ -128,6 +139,9 @@ namespace djv
 
                     std::shared_ptr<IRead> read(const System::File::Info&, const ReadOptions&) const override;
 
+                    //! The information is read from the stream headers.
+                    Info probe(const System::File::Info&) const override;
+
                 private:
                     DJV_PRIVATE();
                 };
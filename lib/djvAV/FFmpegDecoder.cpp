@@ -0,0 +1,279 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/FFmpegDecoder.h>
+
+#include <djvAV/FFmpegFunc.h>
+
+#include <djvSystem/File.h>
+
+#include <djvCore/StringFormat.h>
+
+extern "C"
+{
+#include <libavformat/avformat.h>
+#include <libswscale/swscale.h>
+
+} // extern "C"
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace FFmpeg
+            {
+                struct Decoder::Private
+                {
+                    Image::Info info;
+                    AVRational rate;
+                    AVFormatContext* avFormatContext = nullptr;
+                    int avStream = -1;
+                    AVCodecContext* avCodecContext = nullptr;
+                    AVFrame* avFrame = nullptr;
+                    AVFrame* avFrameRgb = nullptr;
+                    AVPixelFormat avPixelFormatRgb = AV_PIX_FMT_NONE;
+                    SwsContext* swsContext = nullptr;
+                    bool eof = false;
+                };
+
+                void Decoder::_init(
+                    const std::string& fileName,
+                    int stream,
+                    const Math::IntRational& speed,
+                    size_t threadCount,
+                    const Image::Size& size,
+                    Image::Type type)
+                {
+                    DJV_PRIVATE_PTR();
+                    p.rate.num = speed.getDen();
+                    p.rate.den = speed.getNum();
+
+                    int r = avformat_open_input(&p.avFormatContext, fileName.c_str(), nullptr, nullptr);
+                    if (r < 0)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(getErrorString(r)));
+                    }
+                    r = avformat_find_stream_info(p.avFormatContext, 0);
+                    if (r < 0)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(getErrorString(r)));
+                    }
+                    if (stream < 0)
+                    {
+                        // Use the first video stream like the reader.
+                        for (unsigned int i = 0; i < p.avFormatContext->nb_streams; ++i)
+                        {
+                            if (p.avFormatContext->streams[i]->codecpar->codec_type == AVMEDIA_TYPE_VIDEO)
+                            {
+                                stream = i;
+                                break;
+                            }
+                        }
+                    }
+                    if (stream < 0 ||
+                        stream >= static_cast<int>(p.avFormatContext->nb_streams) ||
+                        p.avFormatContext->streams[stream]->codecpar->codec_type != AVMEDIA_TYPE_VIDEO)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(getErrorString(AVERROR_STREAM_NOT_FOUND)));
+                    }
+                    p.avStream = stream;
+
+                    const AVCodecParameters* avCodecParameters = p.avFormatContext->streams[stream]->codecpar;
+                    auto avCodec = avcodec_find_decoder(avCodecParameters->codec_id);
+                    if (!avCodec)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(getErrorString(AVERROR_DECODER_NOT_FOUND)));
+                    }
+                    p.avCodecContext = avcodec_alloc_context3(avCodec);
+                    r = avcodec_parameters_to_context(p.avCodecContext, avCodecParameters);
+                    if (r < 0)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(getErrorString(r)));
+                    }
+                    p.avCodecContext->thread_count = threadCount;
+                    p.avCodecContext->thread_type = FF_THREAD_SLICE;
+                    r = avcodec_open2(p.avCodecContext, avCodec, 0);
+                    if (r < 0)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(getErrorString(r)));
+                    }
+
+                    p.avFrame = av_frame_alloc();
+                    p.avFrameRgb = av_frame_alloc();
+
+                    const AVPixelFormat avPixelFormat = static_cast<AVPixelFormat>(avCodecParameters->format);
+                    p.info.size.w = size.isValid() ? size.w : avCodecParameters->width;
+                    p.info.size.h = size.isValid() ? size.h : avCodecParameters->height;
+                    p.info.type = type != Image::Type::None ? type : toImageType(avPixelFormat);
+                    p.info.codec = avCodec->long_name;
+                    p.avPixelFormatRgb = fromImageType(p.info.type);
+                    if (avPixelFormat != p.avPixelFormatRgb ||
+                        p.info.size.w != avCodecParameters->width ||
+                        p.info.size.h != avCodecParameters->height)
+                    {
+                        p.swsContext = sws_getContext(
+                            avCodecParameters->width,
+                            avCodecParameters->height,
+                            avPixelFormat,
+                            p.info.size.w,
+                            p.info.size.h,
+                            p.avPixelFormatRgb,
+                            SWS_BILINEAR,
+                            0,
+                            0,
+                            0);
+                        if (!p.swsContext)
+                        {
+                            throw System::File::Error(String::Format("{0}: {1}").
+                                arg(fileName).
+                                arg(getErrorString(AVERROR(EINVAL))));
+                        }
+                        setColorspaceDetails(p.swsContext, avCodecParameters);
+                    }
+                }
+
+                Decoder::Decoder() :
+                    _p(new Private)
+                {}
+
+                Decoder::~Decoder()
+                {
+                    DJV_PRIVATE_PTR();
+                    if (p.swsContext)
+                    {
+                        sws_freeContext(p.swsContext);
+                    }
+                    if (p.avFrameRgb)
+                    {
+                        av_frame_free(&p.avFrameRgb);
+                    }
+                    if (p.avFrame)
+                    {
+                        av_frame_free(&p.avFrame);
+                    }
+                    if (p.avCodecContext)
+                    {
+                        avcodec_close(p.avCodecContext);
+                        avcodec_free_context(&p.avCodecContext);
+                    }
+                    if (p.avFormatContext)
+                    {
+                        avformat_close_input(&p.avFormatContext);
+                    }
+                }
+
+                std::shared_ptr<Decoder> Decoder::create(
+                    const std::string& fileName,
+                    int stream,
+                    const Math::IntRational& speed,
+                    size_t threadCount,
+                    const Image::Size& size,
+                    Image::Type type)
+                {
+                    auto out = std::shared_ptr<Decoder>(new Decoder);
+                    out->_init(fileName, stream, speed, threadCount, size, type);
+                    return out;
+                }
+
+                const Image::Info& Decoder::getInfo() const
+                {
+                    return _p->info;
+                }
+
+                bool Decoder::seek(Math::Frame::Number value, const std::shared_ptr<Index>& index)
+                {
+                    DJV_PRIVATE_PTR();
+                    const AVRational timeBase = p.avFormatContext->streams[p.avStream]->time_base;
+                    int64_t t = av_rescale_q(value, p.rate, timeBase);
+                    IndexPacket keyframe;
+                    if (index && index->getKeyframe(t, keyframe))
+                    {
+                        t = keyframe.pts;
+                    }
+                    avcodec_flush_buffers(p.avCodecContext);
+                    p.eof = false;
+                    return av_seek_frame(p.avFormatContext, p.avStream, t, AVSEEK_FLAG_BACKWARD) >= 0;
+                }
+
+                bool Decoder::isSameGroup(
+                    Math::Frame::Number a,
+                    Math::Frame::Number b,
+                    const std::shared_ptr<Index>& index) const
+                {
+                    DJV_PRIVATE_PTR();
+                    const AVRational timeBase = p.avFormatContext->streams[p.avStream]->time_base;
+                    return index && index->isSameGroup(
+                        av_rescale_q(a, p.rate, timeBase),
+                        av_rescale_q(b, p.rate, timeBase));
+                }
+
+                bool Decoder::decode(Math::Frame::Number& frame)
+                {
+                    DJV_PRIVATE_PTR();
+                    while (true)
+                    {
+                        int r = avcodec_receive_frame(p.avCodecContext, p.avFrame);
+                        if (0 == r)
+                        {
+                            frame = av_rescale_q(
+                                p.avFrame->pts,
+                                p.avFormatContext->streams[p.avStream]->time_base,
+                                p.rate);
+                            return true;
+                        }
+                        else if (r != AVERROR(EAGAIN) || p.eof)
+                        {
+                            return false;
+                        }
+                        AVPacket packet;
+                        r = av_read_frame(p.avFormatContext, &packet);
+                        if (r < 0)
+                        {
+                            // Drain the frames buffered in the decoder.
+                            p.eof = true;
+                            avcodec_send_packet(p.avCodecContext, nullptr);
+                            continue;
+                        }
+                        if (p.avStream == packet.stream_index)
+                        {
+                            r = avcodec_send_packet(p.avCodecContext, &packet);
+                        }
+                        av_packet_unref(&packet);
+                        if (r < 0)
+                        {
+                            return false;
+                        }
+                    }
+                    return false;
+                }
+
+                std::shared_ptr<Image::Data> Decoder::getImage()
+                {
+                    DJV_PRIVATE_PTR();
+                    auto out = createImage(p.info, p.avFrame);
+                    fillFrame(p.avFrameRgb, p.avPixelFormatRgb, out);
+                    convertFrame(p.avFrame, p.avFrameRgb, p.avPixelFormatRgb, p.swsContext);
+                    return out;
+                }
+
+            } // namespace FFmpeg
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAV/FFmpegIndex.h>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace FFmpeg
+            {
+                //! This class provides a video decoder with its own demuxing
+                //! context. It is used to decode frames in the background without
+                //! disturbing the playback position of the reader. A negative
+                //! stream index uses the first video stream.
+                class Decoder
+                {
+                    DJV_NON_COPYABLE(Decoder);
+
+                protected:
+                    void _init(
+                        const std::string& fileName,
+                        int stream,
+                        const Math::IntRational& speed,
+                        size_t threadCount,
+                        const Image::Size& size,
+                        Image::Type type);
+                    Decoder();
+
+                public:
+                    ~Decoder();
+
+                    //! Create a new decoder. The images are scaled to the given
+                    //! size and converted to the given type when they are valid.
+                    //! Throws:
+                    //! - System::File::Error
+                    static std::shared_ptr<Decoder> create(
+                        const std::string& fileName,
+                        int stream,
+                        const Math::IntRational& speed,
+                        size_t threadCount,
+                        const Image::Size& size = Image::Size(),
+                        Image::Type type = Image::Type::None);
+
+                    //! Get the information for the decoded images.
+                    const Image::Info& getInfo() const;
+
+                    //! Seek to the keyframe at or before the given frame. The index
+                    //! is used to find the keyframe when it is available.
+                    bool seek(Math::Frame::Number, const std::shared_ptr<Index>& = nullptr);
+
+                    //! Get whether two frames are in the same group of pictures.
+                    //! Returns false when the index is not available.
+                    bool isSameGroup(
+                        Math::Frame::Number,
+                        Math::Frame::Number,
+                        const std::shared_ptr<Index>&) const;
+
+                    //! Decode the next frame. Returns false at the end of the stream.
+                    bool decode(Math::Frame::Number&);
+
+                    //! Convert the last decoded frame to an image.
+                    std::shared_ptr<Image::Data> getImage();
+
+                private:
+                    DJV_PRIVATE();
+                };
+
+            } // namespace FFmpeg
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -4,9 +4,30 @@
 
 #include <djvAV/FFmpegFunc.h>
 
+#include <djvAudio/Data.h>
 #include <djvAudio/DataFunc.h>
 
+#include <djvImage/TypeFunc.h>
+
+#include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/TextSystem.h>
+
 #include <djvCore/String.h>
+#include <djvCore/StringFormat.h>
+
+extern "C"
+{
+#include <libavformat/avformat.h>
+#include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
+#include <libswscale/swscale.h>
+
+} // extern "C"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
 
 using namespace djv::Core;
 
@@ -55,6 +76,150 @@ namespace djv
                     return i != data.end() ? i->second : DJV_TEXT("error_unknown");
                 }
 
+                Image::Type toImageType(AVPixelFormat value)
+                {
+                    Image::Type out = Image::Type::RGBA_U8;
+                    if (const AVPixFmtDescriptor* desc = av_pix_fmt_desc_get(value))
+                    {
+                        const bool alpha = desc->flags & AV_PIX_FMT_FLAG_ALPHA;
+                        const bool luminance =
+                            !(desc->flags & AV_PIX_FMT_FLAG_RGB) &&
+                            !(desc->flags & AV_PIX_FMT_FLAG_PAL) &&
+                            desc->nb_components <= (alpha ? 2 : 1);
+                        const uint8_t channelCount = (luminance ? 1 : 3) + (alpha ? 1 : 0);
+                        uint8_t bitDepth = 0;
+                        for (uint8_t i = 0; i < desc->nb_components; ++i)
+                        {
+                            bitDepth = std::max(bitDepth, static_cast<uint8_t>(desc->comp[i].depth));
+                        }
+                        // Colour formats always decode to 8 bits, 16-bit RGB(A)
+                        // would use more memory per cached frame than the source.
+                        // Luminance formats keep the extra precision since L_U16
+                        // and LA_U16 are no larger than RGBA_U8.
+                        out = Image::getIntType(channelCount, luminance && bitDepth > 8 ? 16 : 8);
+                    }
+                    return out;
+                }
+
+                AVPixelFormat fromImageType(Image::Type value)
+                {
+                    AVPixelFormat out = AV_PIX_FMT_NONE;
+                    switch (value)
+                    {
+                    case Image::Type::L_U8:     out = AV_PIX_FMT_GRAY8; break;
+                    case Image::Type::L_U16:    out = AV_PIX_FMT_GRAY16; break;
+                    case Image::Type::LA_U8:    out = AV_PIX_FMT_YA8; break;
+                    case Image::Type::LA_U16:   out = AV_PIX_FMT_YA16; break;
+                    case Image::Type::RGB_U8:   out = AV_PIX_FMT_RGB24; break;
+                    case Image::Type::RGB_U16:  out = AV_PIX_FMT_RGB48; break;
+                    case Image::Type::RGBA_U8:  out = AV_PIX_FMT_RGBA; break;
+                    case Image::Type::RGBA_U16: out = AV_PIX_FMT_RGBA64; break;
+                    default: break;
+                    }
+                    return out;
+                }
+
+                int toSwsColorspace(AVColorSpace value, int height)
+                {
+                    int out = SWS_CS_DEFAULT;
+                    switch (value)
+                    {
+                    case AVCOL_SPC_BT709:      out = SWS_CS_ITU709; break;
+                    case AVCOL_SPC_FCC:        out = SWS_CS_FCC; break;
+                    case AVCOL_SPC_BT470BG:    out = SWS_CS_ITU601; break;
+                    case AVCOL_SPC_SMPTE170M:  out = SWS_CS_SMPTE170M; break;
+                    case AVCOL_SPC_SMPTE240M:  out = SWS_CS_SMPTE240M; break;
+                    case AVCOL_SPC_BT2020_NCL:
+                    case AVCOL_SPC_BT2020_CL:  out = SWS_CS_BT2020; break;
+                    default:
+                        // Unspecified streams follow the usual convention of
+                        // HD and larger using BT.709.
+                        out = height >= 720 ? SWS_CS_ITU709 : SWS_CS_ITU601;
+                        break;
+                    }
+                    return out;
+                }
+
+                void setColorspaceDetails(SwsContext* swsContext, const AVCodecParameters* avCodecParameters)
+                {
+                    int* inTable = nullptr;
+                    int inFull = 0;
+                    int* outTable = nullptr;
+                    int outFull = 0;
+                    int brightness = 0;
+                    int contrast = 0;
+                    int saturation = 0;
+                    sws_getColorspaceDetails(
+                        swsContext,
+                        &inTable,
+                        &inFull,
+                        &outTable,
+                        &outFull,
+                        &brightness,
+                        &contrast,
+                        &saturation);
+                    sws_setColorspaceDetails(
+                        swsContext,
+                        sws_getCoefficients(toSwsColorspace(avCodecParameters->color_space, avCodecParameters->height)),
+                        AVCOL_RANGE_JPEG == avCodecParameters->color_range ? 1 : inFull,
+                        outTable,
+                        1,
+                        brightness,
+                        contrast,
+                        saturation);
+                }
+
+                std::shared_ptr<Image::Data> createImage(const Image::Info& info, const AVFrame* avFrame)
+                {
+                    Image::Info imageInfo = info;
+                    if (!((0 == avFrame->sample_aspect_ratio.num && 1 == avFrame->sample_aspect_ratio.den) ||
+                        0 == avFrame->sample_aspect_ratio.den))
+                    {
+                        imageInfo.pixelAspectRatio = avFrame->sample_aspect_ratio.num / static_cast<float>(avFrame->sample_aspect_ratio.den);
+                    }
+                    auto out = Image::Data::create(imageInfo);
+                    out->setPluginName(pluginName);
+                    return out;
+                }
+
+                void fillFrame(AVFrame* avFrame, AVPixelFormat avPixelFormat, const std::shared_ptr<Image::Data>& image)
+                {
+                    av_image_fill_arrays(
+                        avFrame->data,
+                        avFrame->linesize,
+                        image->getData(),
+                        avPixelFormat,
+                        image->getWidth(),
+                        image->getHeight(),
+                        1);
+                }
+
+                void convertFrame(const AVFrame* in, AVFrame* out, AVPixelFormat avPixelFormat, SwsContext* swsContext)
+                {
+                    if (swsContext)
+                    {
+                        sws_scale(
+                            swsContext,
+                            (uint8_t const* const*)in->data,
+                            in->linesize,
+                            0,
+                            in->height,
+                            out->data,
+                            out->linesize);
+                    }
+                    else
+                    {
+                        av_image_copy(
+                            out->data,
+                            out->linesize,
+                            const_cast<const uint8_t**>(in->data),
+                            in->linesize,
+                            avPixelFormat,
+                            in->width,
+                            in->height);
+                    }
+                }
+
                 void extractAudio(
                     uint8_t** inData,
                     int inFormat,
@@ -203,6 +368,406 @@ namespace djv
                     return std::string(buf);
                 }
 
+                namespace
+                {
+                    const std::string indexMagic = "djvFFmpegIndex";
+                    const uint32_t indexVersion = 2;
+
+                    //! The size of a packet record in the index file.
+                    const uint64_t indexPacketSize = sizeof(int64_t) + 1;
+
+                    int indexInterrupt(void* opaque)
+                    {
+                        return !*reinterpret_cast<const std::atomic<bool>*>(opaque);
+                    }
+
+                } // namespace
+
+                Info probe(
+                    const System::File::Info& fileInfo,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
+                {
+                    const std::string fileName = fileInfo.getFileName();
+                    AVFormatContext* avFormatContext = nullptr;
+                    int r = avformat_open_input(&avFormatContext, fileName.c_str(), nullptr, nullptr);
+                    if (r >= 0)
+                    {
+                        r = avformat_find_stream_info(avFormatContext, 0);
+                    }
+                    if (r < 0)
+                    {
+                        if (avFormatContext)
+                        {
+                            avformat_close_input(&avFormatContext);
+                        }
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(getErrorString(r)));
+                    }
+
+                    // Use the same streams and information as the reader.
+                    int videoStream = -1;
+                    int audioStream = -1;
+                    for (unsigned int i = 0; i < avFormatContext->nb_streams; ++i)
+                    {
+                        if (-1 == videoStream && avFormatContext->streams[i]->codecpar->codec_type == AVMEDIA_TYPE_VIDEO)
+                        {
+                            videoStream = i;
+                        }
+                        if (-1 == audioStream && avFormatContext->streams[i]->codecpar->codec_type == AVMEDIA_TYPE_AUDIO)
+                        {
+                            audioStream = i;
+                        }
+                    }
+                    Info out;
+                    out.fileName = std::string(fileInfo);
+                    std::string error;
+                    if (-1 == videoStream && -1 == audioStream)
+                    {
+                        error = textSystem->getText(DJV_TEXT("error_no_streams"));
+                    }
+                    if (error.empty() && videoStream != -1)
+                    {
+                        const AVStream* avVideoStream = avFormatContext->streams[videoStream];
+                        const AVCodecParameters* avVideoCodecParameters = avVideoStream->codecpar;
+                        if (auto avVideoCodec = avcodec_find_decoder(avVideoCodecParameters->codec_id))
+                        {
+                            Image::Info imageInfo;
+                            imageInfo.size.w = avVideoCodecParameters->width;
+                            imageInfo.size.h = avVideoCodecParameters->height;
+                            imageInfo.type = toImageType(static_cast<AVPixelFormat>(avVideoCodecParameters->format));
+                            imageInfo.codec = avVideoCodec->long_name;
+                            AVRational rate;
+                            rate.num = avVideoStream->r_frame_rate.den;
+                            rate.den = avVideoStream->r_frame_rate.num;
+                            size_t sequenceSize = 0;
+                            if (avVideoStream->duration != AV_NOPTS_VALUE)
+                            {
+                                sequenceSize = av_rescale_q(avVideoStream->duration, avVideoStream->time_base, rate);
+                            }
+                            else if (avFormatContext->duration != AV_NOPTS_VALUE)
+                            {
+                                sequenceSize = av_rescale_q(avFormatContext->duration, av_get_time_base_q(), rate);
+                            }
+                            out.videoSpeed = Math::IntRational(avVideoStream->r_frame_rate.num, avVideoStream->r_frame_rate.den);
+                            out.videoSequence = Math::Frame::Sequence(Math::Frame::Range(1, sequenceSize));
+                            out.video.push_back(imageInfo);
+                        }
+                        else
+                        {
+                            error = textSystem->getText(DJV_TEXT("error_no_video_codecs"));
+                        }
+                    }
+                    if (error.empty() && audioStream != -1)
+                    {
+                        const AVStream* avAudioStream = avFormatContext->streams[audioStream];
+                        const AVCodecParameters* avAudioCodecParameters = avAudioStream->codecpar;
+                        const Audio::Type audioType = toAudioType(static_cast<AVSampleFormat>(avAudioCodecParameters->format));
+                        auto avAudioCodec = avcodec_find_decoder(avAudioCodecParameters->codec_id);
+                        if (Audio::Type::None == audioType)
+                        {
+                            error = textSystem->getText(DJV_TEXT("error_unsupported_audio_format"));
+                        }
+                        else if (!avAudioCodec)
+                        {
+                            error = textSystem->getText(DJV_TEXT("error_no_audio_codecs"));
+                        }
+                        else
+                        {
+                            size_t sampleCount = 0;
+                            if (avAudioStream->duration != AV_NOPTS_VALUE)
+                            {
+                                sampleCount = avAudioStream->duration;
+                            }
+                            else if (avFormatContext->duration != AV_NOPTS_VALUE)
+                            {
+                                sampleCount = av_rescale_q(avFormatContext->duration, av_get_time_base_q(), avAudioStream->time_base);
+                            }
+                            uint8_t channelCount = avAudioCodecParameters->channels;
+                            switch (channelCount)
+                            {
+                            case 1:
+                            case 2:
+                            case 6:
+                            case 7:
+                            case 8: break;
+                            default: channelCount = 2; break;
+                            }
+                            out.audio.channelCount = channelCount;
+                            out.audio.type = audioType;
+                            out.audio.sampleRate = avAudioCodecParameters->sample_rate;
+                            out.audio.codec = std::string(avAudioCodec->long_name);
+                            out.audioSampleCount = sampleCount;
+                        }
+                    }
+                    AVDictionaryEntry* tag = nullptr;
+                    while ((tag = av_dict_get(avFormatContext->metadata, "", tag, AV_DICT_IGNORE_SUFFIX)))
+                    {
+                        out.tags.set(tag->key, tag->value);
+                    }
+                    avformat_close_input(&avFormatContext);
+                    if (!error.empty())
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(error));
+                    }
+                    return out;
+                }
+
+                Index buildIndex(
+                    const System::File::Info& fileInfo,
+                    int stream,
+                    const std::atomic<bool>& running)
+                {
+                    const std::string fileName = fileInfo.getFileName();
+
+                    // The interrupt callback aborts blocking reads when the
+                    // running flag is cleared.
+                    AVFormatContext* avFormatContext = avformat_alloc_context();
+                    avFormatContext->interrupt_callback.callback = indexInterrupt;
+                    avFormatContext->interrupt_callback.opaque = const_cast<std::atomic<bool>*>(&running);
+                    int r = avformat_open_input(&avFormatContext, fileName.c_str(), nullptr, nullptr);
+                    if (r < 0)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(getErrorString(r)));
+                    }
+                    std::vector<IndexPacket> packets;
+                    r = avformat_find_stream_info(avFormatContext, 0);
+                    if (r >= 0 && stream >= 0 && stream < static_cast<int>(avFormatContext->nb_streams))
+                    {
+                        AVPacket packet;
+                        while (running && (r = av_read_frame(avFormatContext, &packet)) >= 0)
+                        {
+                            if (stream == packet.stream_index)
+                            {
+                                IndexPacket indexPacket;
+                                indexPacket.pts = packet.pts != AV_NOPTS_VALUE ? packet.pts : packet.dts;
+                                indexPacket.keyframe = packet.flags & AV_PKT_FLAG_KEY;
+                                if (indexPacket.pts != AV_NOPTS_VALUE)
+                                {
+                                    packets.push_back(indexPacket);
+                                }
+                            }
+                            av_packet_unref(&packet);
+                        }
+                        if (AVERROR_EOF == r)
+                        {
+                            r = 0;
+                        }
+                    }
+                    avformat_close_input(&avFormatContext);
+                    if (!running)
+                    {
+                        return Index();
+                    }
+                    if (r < 0)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(getErrorString(r)));
+                    }
+                    return Index(fileName, fileInfo.getSize(), fileInfo.getTime(), packets);
+                }
+
+                System::File::Path getIndexPath(
+                    const System::File::Path& directory,
+                    const System::File::Info& fileInfo)
+                {
+                    const std::string fileName = fileInfo.getFileName();
+                    std::stringstream ss;
+                    ss << std::hex << std::setfill('0') << std::setw(sizeof(size_t) * 2) <<
+                        std::hash<std::string>()(fileName) << ".index";
+                    return System::File::Path(directory, ss.str());
+                }
+
+                Index readIndex(
+                    const std::shared_ptr<System::File::IO>& io,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
+                {
+                    std::string magic(indexMagic.size(), 0);
+                    io->read(&magic[0], magic.size());
+                    uint32_t version = 0;
+                    io->readU32(&version);
+                    if (magic != indexMagic || version != indexVersion)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(io->getFileName()).
+                            arg(textSystem->getText(DJV_TEXT("error_bad_magic_number"))));
+                    }
+                    uint32_t fileNameSize = 0;
+                    io->readU32(&fileNameSize);
+                    if (fileNameSize > io->getSize() - io->getPos())
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(io->getFileName()).
+                            arg(textSystem->getText(DJV_TEXT("error_incomplete_file"))));
+                    }
+                    std::string fileName(fileNameSize, 0);
+                    io->read(&fileName[0], fileName.size());
+                    uint64_t fileSize = 0;
+                    int64_t fileTime = 0;
+                    uint64_t count = 0;
+                    io->read(&fileSize, 1, sizeof(uint64_t));
+                    io->read(&fileTime, 1, sizeof(int64_t));
+                    io->read(&count, 1, sizeof(uint64_t));
+
+                    // Compare against the number of records that fit in the
+                    // rest of the file, multiplying the count could overflow.
+                    if (count > (io->getSize() - io->getPos()) / indexPacketSize)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(io->getFileName()).
+                            arg(textSystem->getText(DJV_TEXT("error_incomplete_file"))));
+                    }
+                    std::vector<IndexPacket> packets(count);
+                    for (auto& i : packets)
+                    {
+                        uint8_t keyframe = 0;
+                        io->read(&i.pts, 1, sizeof(int64_t));
+                        io->readU8(&keyframe);
+                        i.keyframe = keyframe != 0;
+                    }
+                    return Index(fileName, fileSize, static_cast<time_t>(fileTime), packets);
+                }
+
+                void writeIndex(const std::shared_ptr<System::File::IO>& io, const Index& value)
+                {
+                    io->write(indexMagic);
+                    io->writeU32(indexVersion);
+                    const std::string& fileName = value.getFileName();
+                    io->writeU32(static_cast<uint32_t>(fileName.size()));
+                    io->write(fileName);
+                    const uint64_t fileSize = value.getFileSize();
+                    const int64_t fileTime = value.getFileTime();
+                    const auto& packets = value.getPackets();
+                    const uint64_t count = packets.size();
+                    io->write(&fileSize, 1, sizeof(uint64_t));
+                    io->write(&fileTime, 1, sizeof(int64_t));
+                    io->write(&count, 1, sizeof(uint64_t));
+                    for (const auto& i : packets)
+                    {
+                        io->write(&i.pts, 1, sizeof(int64_t));
+                        io->writeU8(i.keyframe ? 1 : 0);
+                    }
+                }
+
+                std::shared_ptr<Audio::Waveform> buildWaveform(
+                    const System::File::Info& fileInfo,
+                    const std::atomic<bool>& running)
+                {
+                    const std::string fileName = fileInfo.getFileName();
+                    AVFormatContext* avFormatContext = nullptr;
+                    AVCodecContext* avCodecContext = nullptr;
+                    AVFrame* avFrame = nullptr;
+                    std::shared_ptr<Audio::Waveform> out;
+                    int r = avformat_open_input(&avFormatContext, fileName.c_str(), nullptr, nullptr);
+                    if (r >= 0)
+                    {
+                        r = avformat_find_stream_info(avFormatContext, 0);
+                    }
+                    int stream = -1;
+                    AVCodec* avCodec = nullptr;
+                    if (r >= 0)
+                    {
+                        stream = r = av_find_best_stream(avFormatContext, AVMEDIA_TYPE_AUDIO, -1, -1, &avCodec, 0);
+                    }
+                    if (r >= 0)
+                    {
+                        avCodecContext = avcodec_alloc_context3(avCodec);
+                        r = avcodec_parameters_to_context(avCodecContext, avFormatContext->streams[stream]->codecpar);
+                    }
+                    if (r >= 0)
+                    {
+                        r = avcodec_open2(avCodecContext, avCodec, 0);
+                    }
+                    if (r >= 0)
+                    {
+                        // Use the same channel layouts as the reader.
+                        const AVCodecParameters* avCodecParameters = avFormatContext->streams[stream]->codecpar;
+                        uint8_t channelCount = avCodecParameters->channels;
+                        switch (channelCount)
+                        {
+                        case 1:
+                        case 2:
+                        case 6:
+                        case 7:
+                        case 8: break;
+                        default: channelCount = 2; break;
+                        }
+                        const Audio::Info info(
+                            channelCount,
+                            toAudioType(static_cast<AVSampleFormat>(avCodecParameters->format)),
+                            avCodecParameters->sample_rate);
+                        if (Audio::Type::None == info.type)
+                        {
+                            r = AVERROR_DECODER_NOT_FOUND;
+                        }
+                        else
+                        {
+                            out = std::make_shared<Audio::Waveform>(info.channelCount, info.sampleRate);
+                            avFrame = av_frame_alloc();
+                            AVPacket packet;
+                            bool eof = false;
+                            while (running && r >= 0 && !eof)
+                            {
+                                r = av_read_frame(avFormatContext, &packet);
+                                if (r < 0)
+                                {
+                                    // Drain the frames buffered in the decoder.
+                                    eof = true;
+                                    r = avcodec_send_packet(avCodecContext, nullptr);
+                                }
+                                else
+                                {
+                                    if (stream == packet.stream_index)
+                                    {
+                                        r = avcodec_send_packet(avCodecContext, &packet);
+                                    }
+                                    av_packet_unref(&packet);
+                                }
+                                while (r >= 0)
+                                {
+                                    r = avcodec_receive_frame(avCodecContext, avFrame);
+                                    if (r >= 0)
+                                    {
+                                        auto data = Audio::Data::create(info, avFrame->nb_samples);
+                                        extractAudio(avFrame->data, avCodecParameters->format, avCodecParameters->channels, data);
+                                        out->add(data);
+                                    }
+                                }
+                                if (AVERROR(EAGAIN) == r || AVERROR_EOF == r)
+                                {
+                                    r = 0;
+                                }
+                            }
+                            out->finish();
+                        }
+                    }
+                    if (avFrame)
+                    {
+                        av_frame_free(&avFrame);
+                    }
+                    if (avCodecContext)
+                    {
+                        avcodec_close(avCodecContext);
+                        avcodec_free_context(&avCodecContext);
+                    }
+                    if (avFormatContext)
+                    {
+                        avformat_close_input(&avFormatContext);
+                    }
+                    if (r < 0)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileName).
+                            arg(getErrorString(r)));
+                    }
+                    return running ? out : nullptr;
+                }
+
             } // namespace FFmpeg
         } // namespace IO
     } // namespace AV
@@ -4,10 +4,25 @@
 
 #pragma once
 
-#include <djvAV/FFmpeg.h>
+#include <djvAV/FFmpegIndex.h>
+
+#include <djvAudio/Waveform.h>
+
+#include <atomic>
+
+struct SwsContext;
 
 namespace djv
 {
+    namespace System
+    {
+        namespace File
+        {
+            class IO;
+
+        } // namespace File
+    } // namespace System
+
     namespace AV
     {
         namespace IO
@@ -17,6 +32,39 @@ namespace djv
                 Audio::Type toAudioType(AVSampleFormat);
                 std::string toString(AVSampleFormat);
 
+                //! Get the image type used to decode a pixel format. Luminance
+                //! formats with more than eight bits per component decode to
+                //! 16-bit types, colour formats decode to 8-bit types, and alpha
+                //! is only kept when the format has it.
+                Image::Type toImageType(AVPixelFormat);
+
+                //! Get the pixel format for an image type.
+                AVPixelFormat fromImageType(Image::Type);
+
+                //! Get the software scaler colorspace for a codec colorspace.
+                int toSwsColorspace(AVColorSpace, int height);
+
+                //! Set the software scaler colorspace from the codec colorspace
+                //! and range. The output is always full range.
+                void setColorspaceDetails(SwsContext*, const AVCodecParameters*);
+
+                //! \name Images
+                ///@{
+
+                //! Create an image for a decoded frame, using the pixel aspect
+                //! ratio of the frame.
+                std::shared_ptr<Image::Data> createImage(const Image::Info&, const AVFrame*);
+
+                //! Point the data of a frame at an image.
+                void fillFrame(AVFrame*, AVPixelFormat, const std::shared_ptr<Image::Data>&);
+
+                //! Convert a decoded frame into a frame that was filled with
+                //! fillFrame(). The frame is copied when the software scaler
+                //! context is null.
+                void convertFrame(const AVFrame* in, AVFrame* out, AVPixelFormat, SwsContext*);
+
+                ///@}
+
                 void extractAudio(
                     uint8_t**                    inData,
                     int                          inFormat,
@@ -25,6 +73,57 @@ namespace djv
 
                 std::string getErrorString(int);
 
+                //! Get the file information from the stream headers without
+                //! opening the codecs.
+                //! Throws:
+                //! - System::File::Error
+                Info probe(
+                    const System::File::Info&,
+                    const std::shared_ptr<System::TextSystem>&);
+
+                //! \name Index
+                ///@{
+
+                //! Build the index of a video stream by reading the packets
+                //! without decoding them. Building stops early when the running
+                //! flag is cleared.
+                //! Throws:
+                //! - System::File::Error
+                Index buildIndex(
+                    const System::File::Info&,
+                    int                      stream,
+                    const std::atomic<bool>& running);
+
+                //! Get the path used to store the index of a movie.
+                System::File::Path getIndexPath(
+                    const System::File::Path& directory,
+                    const System::File::Info&);
+
+                //! Throws:
+                //! - System::File::Error
+                Index readIndex(
+                    const std::shared_ptr<System::File::IO>&,
+                    const std::shared_ptr<System::TextSystem>&);
+
+                //! Throws:
+                //! - System::File::Error
+                void writeIndex(const std::shared_ptr<System::File::IO>&, const Index&);
+
+                ///@}
+
+                //! \name Waveform
+                ///@{
+
+                //! Build a waveform overview by decoding the best audio stream.
+                //! Building stops early when the running flag is cleared.
+                //! Throws:
+                //! - System::File::Error
+                std::shared_ptr<Audio::Waveform> buildWaveform(
+                    const System::File::Info&,
+                    const std::atomic<bool>& running);
+
+                ///@}
+
             } // namespace FFmpeg
         } // namespace IO
     } // namespace AV
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/FFmpegIndex.h>
+
+#include <djvSystem/FileInfo.h>
+
+#include <algorithm>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace FFmpeg
+            {
+                bool IndexPacket::operator == (const IndexPacket& other) const
+                {
+                    return pts == other.pts &&
+                        keyframe == other.keyframe;
+                }
+
+                Index::Index()
+                {}
+
+                Index::Index(
+                    const std::string& fileName,
+                    uint64_t fileSize,
+                    time_t fileTime,
+                    const std::vector<IndexPacket>& packets) :
+                    _fileName(fileName),
+                    _fileSize(fileSize),
+                    _fileTime(fileTime),
+                    _packets(packets)
+                {
+                    // Packets are stored in decoding order, sort them by
+                    // presentation order for the lookups.
+                    std::stable_sort(
+                        _packets.begin(),
+                        _packets.end(),
+                        [](const IndexPacket& a, const IndexPacket& b)
+                        {
+                            return a.pts < b.pts;
+                        });
+                    for (size_t i = 0; i < _packets.size(); ++i)
+                    {
+                        if (_packets[i].keyframe)
+                        {
+                            _keyframes.push_back(i);
+                        }
+                    }
+                }
+
+                const std::string& Index::getFileName() const
+                {
+                    return _fileName;
+                }
+
+                uint64_t Index::getFileSize() const
+                {
+                    return _fileSize;
+                }
+
+                time_t Index::getFileTime() const
+                {
+                    return _fileTime;
+                }
+
+                const std::vector<IndexPacket>& Index::getPackets() const
+                {
+                    return _packets;
+                }
+
+                bool Index::isEmpty() const
+                {
+                    return _packets.empty();
+                }
+
+                bool Index::isValid(const System::File::Info& value) const
+                {
+                    return !_packets.empty() &&
+                        value.getFileName() == _fileName &&
+                        value.getSize() == _fileSize &&
+                        value.getTime() == _fileTime;
+                }
+
+                bool Index::getKeyframe(int64_t pts, IndexPacket& out) const
+                {
+                    const auto i = std::upper_bound(
+                        _keyframes.begin(),
+                        _keyframes.end(),
+                        pts,
+                        [this](int64_t value, size_t index)
+                        {
+                            return value < _packets[index].pts;
+                        });
+                    if (i != _keyframes.begin())
+                    {
+                        out = _packets[*(i - 1)];
+                        return true;
+                    }
+                    return false;
+                }
+
+                bool Index::isSameGroup(int64_t a, int64_t b) const
+                {
+                    IndexPacket aKeyframe;
+                    IndexPacket bKeyframe;
+                    return
+                        getKeyframe(a, aKeyframe) &&
+                        getKeyframe(b, bKeyframe) &&
+                        aKeyframe == bKeyframe;
+                }
+
+                size_t Index::getKeyframeCount() const
+                {
+                    return _keyframes.size();
+                }
+
+                bool Index::operator == (const Index& other) const
+                {
+                    return _fileName == other._fileName &&
+                        _fileSize == other._fileSize &&
+                        _fileTime == other._fileTime &&
+                        _packets == other._packets;
+                }
+
+            } // namespace FFmpeg
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAV/FFmpeg.h>
+
+#include <ctime>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace FFmpeg
+            {
+                //! This struct provides a video packet in the index.
+                struct IndexPacket
+                {
+                    int64_t pts      = 0;
+                    bool    keyframe = false;
+
+                    bool operator == (const IndexPacket&) const;
+                };
+
+                //! This class provides an index of the video packets in a movie.
+                //! The index is used to seek directly to the keyframe that starts
+                //! a group of pictures instead of searching for it.
+                class Index
+                {
+                public:
+                    Index();
+                    Index(
+                        const std::string& fileName,
+                        uint64_t fileSize,
+                        time_t fileTime,
+                        const std::vector<IndexPacket>&);
+
+                    //! \name Information
+                    ///@{
+
+                    const std::string& getFileName() const;
+                    uint64_t getFileSize() const;
+                    time_t getFileTime() const;
+
+                    //! Get the packets sorted by presentation timestamp.
+                    const std::vector<IndexPacket>& getPackets() const;
+
+                    //! Get whether the index is empty.
+                    bool isEmpty() const;
+
+                    //! Get whether the index matches the given file.
+                    bool isValid(const System::File::Info&) const;
+
+                    ///@}
+
+                    //! \name Keyframes
+                    ///@{
+
+                    //! Get the last keyframe at or before the given timestamp.
+                    bool getKeyframe(int64_t pts, IndexPacket&) const;
+
+                    //! Get whether two timestamps are in the same group of pictures.
+                    bool isSameGroup(int64_t a, int64_t b) const;
+
+                    //! Get the number of keyframes.
+                    size_t getKeyframeCount() const;
+
+                    ///@}
+
+                    bool operator == (const Index&) const;
+
+                private:
+                    std::string _fileName;
+                    uint64_t _fileSize = 0;
+                    time_t _fileTime = 0;
+                    std::vector<IndexPacket> _packets;
+                    std::vector<size_t> _keyframes;
+                };
+
+            } // namespace FFmpeg
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
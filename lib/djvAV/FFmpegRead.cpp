@@ -2,24 +2,32 @@
 // Copyright (c) 2004-2020 Darby Johnston
 // All rights reserved.
 
+#include <djvAV/FFmpegDecoder.h>
 #include <djvAV/FFmpegFunc.h>
 
 #include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
 #include <djvSystem/LogSystem.h>
+#include <djvSystem/PathFunc.h>
+#include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TimerFunc.h>
 #include <djvSystem/TextSystem.h>
 
+#include <djvCore/Memory.h>
 #include <djvCore/StringFormat.h>
 
 extern "C"
 {
 #include <libavformat/avformat.h>
 #include <libavutil/dict.h>
-#include <libavutil/imgutils.h>
+#include <libavutil/pixdesc.h>
 #include <libswscale/swscale.h>
 
 } // extern "C"
 
+#include <cstring>
+#include <deque>
+
 using namespace djv::Core;
 
 namespace djv
@@ -30,6 +38,79 @@ namespace djv
         {
             namespace FFmpeg
             {
+                namespace
+                {
+                    //! \todo Should this be configurable?
+                    const size_t reverseCacheMaxByteCount = Memory::gigabyte;
+
+                    //! This struct provides a horizontal slice of the software
+                    //! scaler conversion. The scaler converts the source rows,
+                    //! which may overlap the neighboring slices, and only the
+                    //! rows of the slice are kept.
+                    struct Slice
+                    {
+                        int                  y          = 0;
+                        int                  h          = 0;
+                        int                  srcY       = 0;
+                        int                  srcH       = 0;
+                        SwsContext*          swsContext = nullptr;
+                        std::vector<uint8_t> overlap;
+                    };
+
+                    void convertSlice(
+                        Slice&                    slice,
+                        const AVPixFmtDescriptor* desc,
+                        const AVFrame*            in,
+                        const AVFrame*            out)
+                    {
+                        const uint8_t* inData[4] = { nullptr, nullptr, nullptr, nullptr };
+                        for (int i = 0; i < 4 && in->data[i]; ++i)
+                        {
+                            int y = slice.srcY;
+                            if (desc->flags & AV_PIX_FMT_FLAG_PAL && 1 == i)
+                            {
+                                y = 0;
+                            }
+                            else if (1 == i || 2 == i)
+                            {
+                                y >>= desc->log2_chroma_h;
+                            }
+                            inData[i] = in->data[i] + y * in->linesize[i];
+                        }
+                        if (slice.srcY == slice.y && slice.srcH == slice.h)
+                        {
+                            uint8_t* outData[4] = { out->data[0] + slice.y * out->linesize[0], nullptr, nullptr, nullptr };
+                            sws_scale(
+                                slice.swsContext,
+                                inData,
+                                in->linesize,
+                                0,
+                                slice.srcH,
+                                outData,
+                                out->linesize);
+                        }
+                        else
+                        {
+                            const size_t linesize = static_cast<size_t>(out->linesize[0]);
+                            slice.overlap.resize(linesize * slice.srcH);
+                            uint8_t* outData[4] = { slice.overlap.data(), nullptr, nullptr, nullptr };
+                            sws_scale(
+                                slice.swsContext,
+                                inData,
+                                in->linesize,
+                                0,
+                                slice.srcH,
+                                outData,
+                                out->linesize);
+                            memcpy(
+                                out->data[0] + slice.y * linesize,
+                                slice.overlap.data() + (slice.y - slice.srcY) * linesize,
+                                linesize * slice.h);
+                        }
+                    }
+
+                } // namespace
+
                 struct Read::Private
                 {
                     Options options;
@@ -48,7 +129,68 @@ namespace djv
                     std::map<int, AVCodecContext*> avCodecContext;
                     AVFrame* avFrame = nullptr;
                     AVFrame* avFrameRgb = nullptr;
-                    SwsContext* swsContext = nullptr;
+                    AVPixelFormat avPixelFormatRgb = AV_PIX_FMT_NONE;
+                    const AVPixFmtDescriptor* avPixFmtDescriptor = nullptr;
+                    std::vector<Slice> slices;
+
+                    // The frame being converted while the next frame is decoded.
+                    AVFrame* avFrameConvert = nullptr;
+                    Math::Frame::Number convertFrame = Math::Frame::invalid;
+                    std::shared_ptr<Image::Data> convertImage;
+                    bool convertCache = false;
+
+                    // The slices are converted by worker threads that are
+                    // created once for each reader, one thread per slice. The
+                    // values below are guarded by the convert mutex.
+                    std::vector<std::thread> convertThreads;
+                    std::mutex convertMutex;
+                    std::condition_variable convertCV;
+                    std::condition_variable convertFinishedCV;
+                    uint64_t convertGeneration = 0;
+                    size_t convertPending = 0;
+                    bool convertRunning = false;
+
+                    // The last video frame that was decoded.
+                    Math::Frame::Number decodeFrame = Math::Frame::invalid;
+
+                    // The packet index is built in the background.
+                    std::thread indexThread;
+                    std::mutex indexMutex;
+                    std::shared_ptr<Index> index;
+
+                    // Reverse playback decodes a group of pictures at a time into
+                    // the reverse cache, and then adds the frames to the queue
+                    // from the cache until it is empty.
+                    Math::Frame::Number reverseFrame = Math::Frame::invalid;
+                    bool reverseDecode = false;
+                    std::deque<VideoFrame> reverseCache;
+                    size_t reverseCacheByteCount = 0;
+
+                    // The frame cache is filled in the background by a second
+                    // decoder. The cache and the values below are guarded by
+                    // the cache mutex.
+                    std::atomic<bool> hasCache;
+                    std::thread cacheThread;
+                    std::mutex cacheMutex;
+                    std::condition_variable cacheCV;
+                    bool cacheEnabled = false;
+                    Math::Frame::Number cacheFrame = Math::Frame::invalid;
+                    Direction cacheDirection = Direction::Forward;
+                    Math::Frame::Range cacheRange;
+                    uint64_t cacheVersion = 0;
+
+                    // The cache generation is incremented when the in/out
+                    // points, cache size, or cache enabled state change, so
+                    // the cache thread can reset the end of the stream.
+                    uint64_t cacheGeneration = 0;
+
+                    int64_t toPts(Math::Frame::Number) const;
+                    bool getKeyframe(int64_t pts, IndexPacket&);
+                    void buildIndex(
+                        const System::File::Info&,
+                        const System::File::Path&,
+                        const std::shared_ptr<System::TextSystem>&,
+                        const std::shared_ptr<System::LogSystem>&);
                 };
 
                 void Read::_init(
@@ -63,6 +205,7 @@ namespace djv
                     DJV_PRIVATE_PTR();
                     p.options = options;
                     p.running = true;
+                    p.hasCache = false;
                     p.thread = std::thread(
                         [this]
                     {
@@ -163,25 +306,78 @@ namespace djv
 
                                 // Initialize the buffers.
                                 p.avFrameRgb = av_frame_alloc();
+                                p.avFrameConvert = av_frame_alloc();
 
-                                // Initialize the software scaler.
-                                p.swsContext = sws_getContext(
-                                    p.avCodecParameters[p.avVideoStream]->width,
-                                    p.avCodecParameters[p.avVideoStream]->height,
-                                    static_cast<AVPixelFormat>(p.avCodecParameters[p.avVideoStream]->format),
-                                    p.avCodecParameters[p.avVideoStream]->width,
-                                    p.avCodecParameters[p.avVideoStream]->height,
-                                    AV_PIX_FMT_RGBA,
-                                    SWS_BILINEAR,
-                                    0,
-                                    0,
-                                    0);
+                                // Initialize the software scaler. Frames are decoded to
+                                // the smallest image type that keeps the alpha of the
+                                // stream (see FFmpeg::toImageType()), and when the stream
+                                // is already in that format the software scaler is skipped.
+                                //
+                                // The conversion is split into horizontal slices that are
+                                // run on worker threads, each slice with its own scaler
+                                // context. Slices are aligned to the chroma subsampling so
+                                // they can be converted independently.
+                                //
+                                // The chroma upsampling of a vertically subsampled format
+                                // needs the chroma rows of the neighboring slices, so
+                                // those slices also convert one alignment of rows above
+                                // and below and only keep their own rows. This gives the
+                                // same result as a single scaler.
+                                const AVPixelFormat avPixelFormat = static_cast<AVPixelFormat>(avVideoCodecParameters->format);
+                                const Image::Type imageType = FFmpeg::toImageType(avPixelFormat);
+                                p.avPixelFormatRgb = FFmpeg::fromImageType(imageType);
+                                p.avPixFmtDescriptor = av_pix_fmt_desc_get(avPixelFormat);
+                                if (avPixelFormat != p.avPixelFormatRgb)
+                                {
+                                    if (!p.avPixFmtDescriptor)
+                                    {
+                                        throw System::File::Error(String::Format("{0}: {1}").
+                                            arg(_fileInfo.getFileName()).
+                                            arg(_textSystem->getText(DJV_TEXT("error_read_scaler"))));
+                                    }
+                                    const int width = avVideoCodecParameters->width;
+                                    const int height = avVideoCodecParameters->height;
+                                    const int align = std::max(1 << p.avPixFmtDescriptor->log2_chroma_h, 16);
+                                    const int sliceCount = std::max(
+                                        std::min(static_cast<int>(p.options.threadCount), height / align),
+                                        1);
+                                    const int sliceHeight = (height / sliceCount + align - 1) / align * align;
+                                    const int overlap = p.avPixFmtDescriptor->log2_chroma_h > 0 ? align : 0;
+                                    for (int y = 0; y < height; y += sliceHeight)
+                                    {
+                                        Slice slice;
+                                        slice.y = y;
+                                        slice.h = std::min(sliceHeight, height - y);
+                                        slice.srcY = std::max(slice.y - overlap, 0);
+                                        slice.srcH = std::min(slice.y + slice.h + overlap, height) - slice.srcY;
+                                        slice.swsContext = sws_getContext(
+                                            width,
+                                            slice.srcH,
+                                            avPixelFormat,
+                                            width,
+                                            slice.srcH,
+                                            p.avPixelFormatRgb,
+                                            SWS_BILINEAR,
+                                            0,
+                                            0,
+                                            0);
+                                        if (!slice.swsContext)
+                                        {
+                                            throw System::File::Error(String::Format("{0}: {1}").
+                                                arg(_fileInfo.getFileName()).
+                                                arg(_textSystem->getText(DJV_TEXT("error_read_scaler"))));
+                                        }
+                                        FFmpeg::setColorspaceDetails(slice.swsContext, avVideoCodecParameters);
+                                        p.slices.push_back(slice);
+                                    }
+                                    _startConvert();
+                                }
 
                                 // Get information.
                                 Image::Info imageInfo;
-                                imageInfo.size.w = p.avCodecParameters[p.avVideoStream]->width;
-                                imageInfo.size.h = p.avCodecParameters[p.avVideoStream]->height;
-                                imageInfo.type = Image::Type::RGBA_U8;
+                                imageInfo.size.w = avVideoCodecParameters->width;
+                                imageInfo.size.h = avVideoCodecParameters->height;
+                                imageInfo.type = imageType;
                                 imageInfo.codec = avVideoCodec->long_name;
                                 if (avVideoStream->duration != AV_NOPTS_VALUE)
                                 {
@@ -296,74 +492,124 @@ namespace djv
                             }
 
                             p.infoPromise.set_value(p.info);
+                            _notify();
 
-                            while (p.running)
+                            if (p.avVideoStream != -1)
                             {
-                                //! \todo Implement me!
-                                /*bool cacheEnabled = false;
-                                size_t cacheMaxByteCount = 0;
+                                // Start building the packet index, this is only
+                                // done for readers used for playback.
+                                if (_options.buildIndex)
                                 {
-                                    std::lock_guard<std::mutex> lock(_mutex);
-                                    cacheEnabled = _cacheEnabled;
-                                    cacheMaxByteCount = _cacheMaxByteCount;
-                                    _cachedFrames = _getCachedFrames(_cache);
+                                    const System::File::Info fileInfo(_fileInfo.getPath());
+                                    const System::File::Path indexPath(
+                                        _resourceSystem->getPath(System::File::ResourcePath::Documents),
+                                        "FFmpegIndex");
+                                    auto textSystem = _textSystem;
+                                    auto logSystem = _logSystem;
+                                    p.indexThread = std::thread(
+                                        [this, fileInfo, indexPath, textSystem, logSystem]
+                                        {
+                                            _p->buildIndex(fileInfo, indexPath, textSystem, logSystem);
+                                        });
                                 }
-                                if (!cacheEnabled)
+
+                                // Start filling the frame cache.
+                                p.hasCache = true;
+                                p.cacheThread = std::thread(
+                                    [this]
+                                    {
+                                        _fillCache();
+                                    });
+                            }
+
+                            bool playback = false;
+                            InOutPoints inOutPoints;
+                            bool cacheEnabled = false;
+                            size_t cacheMaxByteCount = 0;
+                            bool optionsInit = false;
+                            uint64_t optionsVersion = 0;
+                            while (p.running)
+                            {
+                                // Update the options.
+                                bool optionsChanged = false;
+                                Math::Frame::Number currentFrame = Math::Frame::invalid;
                                 {
-                                    _cache.clear();
+                                    std::lock_guard<std::mutex> lock(_mutex);
+                                    if (!optionsInit || _optionsVersion != optionsVersion)
+                                    {
+                                        optionsInit = true;
+                                        optionsVersion = _optionsVersion;
+                                        optionsChanged = true;
+                                        playback = _playback;
+                                        inOutPoints = _inOutPoints;
+                                        cacheEnabled = _cacheEnabled;
+                                        cacheMaxByteCount = _cacheMaxByteCount;
+                                    }
+                                    if (_videoQueue.getCount())
+                                    {
+                                        currentFrame = _videoQueue.getFrame().frame;
+                                    }
                                 }
-                                if (info.video.size() && _options.layer < info.video.size())
+                                if (p.avVideoStream != -1)
                                 {
-                                    const size_t dataByteCount = info.video[_options.layer].info.getDataByteCount();
-                                    _cache.setMax(cacheMaxByteCount / dataByteCount);
+                                    bool cacheChanged = false;
+                                    {
+                                        std::lock_guard<std::mutex> lock(p.cacheMutex);
+                                        if (optionsChanged)
+                                        {
+                                            p.cacheEnabled = cacheEnabled;
+                                            if (!cacheEnabled)
+                                            {
+                                                _cache.clear();
+                                            }
+                                            const size_t sequenceFrameCount = p.info.videoSequence.getFrameCount();
+                                            const size_t dataByteCount = p.info.video[0].getDataByteCount();
+                                            _cache.setMax(cacheEnabled && dataByteCount ? (cacheMaxByteCount / dataByteCount) : 0);
+                                            _cache.setSequenceSize(sequenceFrameCount);
+                                            _cache.setInOutPoints(inOutPoints);
+                                            p.cacheRange = inOutPoints.getRange(sequenceFrameCount);
+                                            ++p.cacheGeneration;
+                                            cacheChanged = true;
+                                        }
+                                        if (cacheEnabled && currentFrame != Math::Frame::invalid &&
+                                            (currentFrame != p.cacheFrame || p.direction != p.cacheDirection))
+                                        {
+                                            p.cacheFrame = currentFrame;
+                                            p.cacheDirection = p.direction;
+                                            _cache.setDirection(p.direction);
+                                            _cache.setCurrentFrame(currentFrame);
+                                            cacheChanged = true;
+                                        }
+                                    }
+                                    if (cacheChanged)
+                                    {
+                                        p.cacheCV.notify_one();
+                                    }
+                                    _cacheInfoUpdate();
                                 }
-                                else
-                                {
-                                    _cache.setMax(0);
-                                }*/
 
                                 bool read = false;
+                                bool clear = false;
                                 int64_t seek = Math::Frame::invalid;
                                 {
-                                    //const std::vector<Math::Frame::Number> cachedFrames = _cache.getKeys();
                                     std::unique_lock<std::mutex> lock(_mutex);
                                     if (p.queueCV.wait_for(
                                         lock,
                                         System::getTimerDuration(System::TimerValue::Fast),
                                         [this, sequenceSize]
-                                        //[this, sequenceSize, cacheEnabled, &cachedFrames]
                                     {
                                         DJV_PRIVATE_PTR();
                                         const bool video = p.avVideoStream != -1 && (_videoQueue.isFinished() ? false : (_videoQueue.getCount() < _videoQueue.getMax()));
                                         const bool audio = p.avAudioStream != -1 && (_audioQueue.isFinished() ? false : (_audioQueue.getCount() < _audioQueue.getMax()));
 
-                                        /*bool cache = false;
-                                        if (cacheEnabled && !_videoQueue.isFinished() && !_audioQueue.isFinished())
-                                        {
-                                            const size_t cacheMax = _cache.getMax();
-                                            cache |= _cache.getSize() < cacheMax;
-                                            if (_videoQueue.getFrameCount())
-                                            {
-                                                const auto& frame = _videoQueue.getFrame();
-                                                for (const auto& i : cachedFrames)
-                                                {
-                                                    if (i < frame.frame || i > frame.frame + cacheMax)
-                                                    {
-                                                        cache = true;
-                                                        break;
-                                                    }
-                                                }
-                                            }
-                                        }*/
-                                        
                                         return video || audio || p.seek != Math::Frame::invalid || p.direction != _direction;
-                                        //return video || audio || p.seek != Math::Frame::invalid || p.direction != _direction || cache;
                                     }))
                                     {
                                         read = true;
                                         if (p.direction != _direction)
                                         {
                                             p.direction = _direction;
+                                            clear = true;
                                             _videoQueue.setFinished(false);
                                             _videoQueue.clearFrames();
                                             _audioQueue.setFinished(false);
@@ -373,6 +619,7 @@ namespace djv
                                         {
                                             seek = p.seek;
                                             p.seek = Math::Frame::invalid;
+                                            clear = true;
                                             _videoQueue.setFinished(false);
                                             _videoQueue.clearFrames();
                                             _audioQueue.setFinished(false);
@@ -380,13 +627,36 @@ namespace djv
                                         }
                                     }
                                 }
+                                if (clear || !read)
+                                {
+                                    // Discard the frame being converted when the queues
+                                    // are cleared, otherwise finish it while we are idle.
+                                    _finishVideo(!clear);
+                                }
                                 AVPacket packet;
                                 try
                                 {
+                                    if (Direction::Reverse == p.direction && p.avVideoStream != -1)
+                                    {
+                                        if (seek != Math::Frame::invalid)
+                                        {
+                                            p.reverseFrame = seek;
+                                            p.reverseCache.clear();
+                                            p.reverseCacheByteCount = 0;
+                                        }
+                                        if (read && !_readReverse())
+                                        {
+                                            throw std::exception();
+                                        }
+                                        seek = Math::Frame::invalid;
+                                        read = false;
+                                    }
                                     if (seek != Math::Frame::invalid)
                                     {
                                         int64_t t = 0;
                                         int stream = -1;
+                                        bool decodeForward = false;
+                                        Math::Frame::Number videoSeek = seek;
                                         if (p.avVideoStream != -1)
                                         {
                                             stream = p.avVideoStream;
@@ -395,6 +665,41 @@ namespace djv
                                             r.den = p.info.videoSpeed.getNum();
                                             t = av_rescale_q(seek, r, p.avFormatContext->streams[p.avVideoStream]->time_base);
                                             //t = av_rescale_q(seek, r, av_get_time_base_q());
+
+                                            // Seek directly to the keyframe, or keep decoding
+                                            // when the frame is later in the current group of
+                                            // pictures.
+                                            std::shared_ptr<Index> index;
+                                            {
+                                                std::lock_guard<std::mutex> lock(p.indexMutex);
+                                                index = p.index;
+                                            }
+                                            IndexPacket keyframe;
+                                            if (index && index->getKeyframe(t, keyframe))
+                                            {
+                                                decodeForward =
+                                                    p.decodeFrame != Math::Frame::invalid &&
+                                                    seek > p.decodeFrame &&
+                                                    index->isSameGroup(t, p.toPts(p.decodeFrame));
+                                                t = keyframe.pts;
+                                            }
+
+                                            // When scrubbing show the cached frame immediately,
+                                            // decoding continues with the next frame.
+                                            if (!playback && cacheEnabled)
+                                            {
+                                                std::shared_ptr<Image::Data> image;
+                                                bool cached = false;
+                                                {
+                                                    std::lock_guard<std::mutex> lock(p.cacheMutex);
+                                                    cached = _cache.get(seek, image);
+                                                }
+                                                if (cached)
+                                                {
+                                                    _addVideo(seek, image);
+                                                    videoSeek = seek + 1;
+                                                }
+                                            }
                                         }
                                         else if (p.avAudioStream != -1)
                                         {
@@ -405,35 +710,41 @@ namespace djv
                                             t = av_rescale_q(seek, r, p.avFormatContext->streams[p.avAudioStream]->time_base);
                                             //t = av_rescale_q(seek, r, av_get_time_base_q());
                                         }
-                                        if (p.avVideoStream != -1)
-                                        {
-                                            avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
-                                        }
-                                        if (p.avAudioStream != -1)
+                                        if (!decodeForward)
                                         {
-                                            avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
-                                        }
-                                        if (av_seek_frame(
-                                            p.avFormatContext,
-                                            stream,
-                                            t,
-                                            AVSEEK_FLAG_BACKWARD) < 0)
-                                        {
-                                            throw std::exception();
+                                            if (p.avVideoStream != -1)
+                                            {
+                                                avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                                                p.decodeFrame = Math::Frame::invalid;
+                                            }
+                                            if (p.avAudioStream != -1)
+                                            {
+                                                avcodec_flush_buffers(p.avCodecContext[p.avAudioStream]);
+                                            }
+                                            if (av_seek_frame(
+                                                p.avFormatContext,
+                                                stream,
+                                                t,
+                                                AVSEEK_FLAG_BACKWARD) < 0)
+                                            {
+                                                throw std::exception();
+                                            }
                                         }
                                         Math::Frame::Number videoFrame = Math::Frame::invalid;
                                         Math::Frame::Number audioFrame = Math::Frame::invalid;
-                                        while (videoFrame < seek - 1 || audioFrame < seek - 1)
+                                        while ((p.avVideoStream != -1 && videoFrame < seek - 1) ||
+                                            (p.avAudioStream != -1 && audioFrame < seek - 1))
                                         {
                                             if (av_read_frame(p.avFormatContext, &packet) < 0)
                                             {
                                                 if (p.avVideoStream != -1)
                                                 {
                                                     DecodeVideo dv;
-                                                    //dv.cacheEnabled = cacheEnabled;
-                                                    dv.seek         = seek;
+                                                    dv.cacheEnabled = cacheEnabled;
+                                                    dv.seek         = videoSeek;
                                                     _decodeVideo(dv, videoFrame);
                                                     avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                                                    p.decodeFrame = Math::Frame::invalid;
                                                 }
                                                 if (p.avAudioStream != -1)
                                                 {
@@ -448,8 +759,8 @@ namespace djv
                                             {
                                                 DecodeVideo dv;
                                                 dv.packet       = &packet;
-                                                dv.seek         = seek;
-                                                //dv.cacheEnabled = cacheEnabled;
+                                                dv.seek         = videoSeek;
+                                                dv.cacheEnabled = cacheEnabled;
                                                 if (_decodeVideo(dv, videoFrame) < 0)
                                                 {
                                                     throw std::exception();
@@ -478,9 +789,10 @@ namespace djv
                                             if (p.avVideoStream != -1)
                                             {
                                                 DecodeVideo dv;
-                                                //dv.cacheEnabled = cacheEnabled;
+                                                dv.cacheEnabled = cacheEnabled;
                                                 _decodeVideo(dv, videoFrame);
                                                 avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                                                p.decodeFrame = Math::Frame::invalid;
                                             }
                                             if (p.avAudioStream != -1)
                                             {
@@ -494,7 +806,7 @@ namespace djv
                                         {
                                             DecodeVideo dv;
                                             dv.packet       = &packet;
-                                            //dv.cacheEnabled = cacheEnabled;
+                                            dv.cacheEnabled = cacheEnabled;
                                             if (_decodeVideo(dv, videoFrame) < 0)
                                             {
                                                 throw std::exception();
@@ -520,22 +832,32 @@ namespace djv
                                         _logSystem->log("djv::AV::IO::FFmpeg::Read", ss.str());
                                     }*/
                                     av_packet_unref(&packet);
+                                    _finishVideo(true);
                                     {
                                         std::lock_guard<std::mutex> lock(_mutex);
                                         _videoQueue.setFinished(true);
                                         _audioQueue.setFinished(true);
                                     }
+                                    _notify();
                                 }
                             }
                         }
                         catch (const std::exception& e)
                         {
                             p.infoPromise.set_value(Info());
+                            _notify();
                             _logSystem->log("djvAV::IO::FFmpeg::Read", e.what(), System::LogLevel::Error);
                         }
-                        if (p.swsContext)
+                        _finishVideo(false);
+                        _stopConvert();
+                        p.reverseCache.clear();
+                        for (const auto& i : p.slices)
+                        {
+                            sws_freeContext(i.swsContext);
+                        }
+                        if (p.avFrameConvert)
                         {
-                            sws_freeContext(p.swsContext);
+                            av_frame_free(&p.avFrameConvert);
                         }
                         if (p.avFrameRgb)
                         {
@@ -574,6 +896,15 @@ namespace djv
 						//! \todo How do we safely detach the thread here so we don't block?
                         p.thread.join();
                     }
+                    if (p.indexThread.joinable())
+                    {
+                        p.indexThread.join();
+                    }
+                    p.cacheCV.notify_one();
+                    if (p.cacheThread.joinable())
+                    {
+                        p.cacheThread.join();
+                    }
                 }
 
                 std::shared_ptr<Read> Read::create(
@@ -594,12 +925,17 @@ namespace djv
                     return _p->running;
                 }
 
+                bool Read::hasCache() const
+                {
+                    return _p->hasCache;
+                }
+
                 std::future<Info> Read::getInfo()
                 {
                     return _p->infoPromise.get_future();
                 }
 
-                void Read::seek(Math::Frame::Number value, Direction)
+                void Read::seek(Math::Frame::Number value, Direction direction)
                 {
                     DJV_PRIVATE_PTR();
                     {
@@ -607,6 +943,7 @@ namespace djv
                         _videoQueue.clearFrames();
                         _audioQueue.clearFrames();
                         p.seek = value;
+                        _direction = direction;
                     }
                     p.queueCV.notify_one();
                 }
@@ -636,11 +973,23 @@ namespace djv
                             p.avFormatContext->streams[p.avVideoStream]->time_base,
                             r);
                         //std::cout << "decode video = " << frame << std::endl;
+                        p.decodeFrame = frame;
 
-                        if (Math::Frame::invalid == dv.seek || frame >= dv.seek)
+                        if ((Math::Frame::invalid == dv.seek || frame >= dv.seek) &&
+                            (Math::Frame::invalid == dv.end || frame <= dv.end))
                         {
+                            // Finish converting the previous frame, which overlapped
+                            // with decoding this one.
+                            _finishVideo(true);
+
                             std::shared_ptr<Image::Data> image;
-                            if (dv.cacheEnabled && _cache.get(frame, image))
+                            bool cached = false;
+                            if (dv.cacheEnabled)
+                            {
+                                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                                cached = _cache.get(frame, image);
+                            }
+                            if (cached)
                             {}
                             else
                             {
@@ -649,44 +998,494 @@ namespace djv
                                 {
                                     imageInfo = p.info.video[0];
                                 }
-                                if (!((0 == p.avFrame->sample_aspect_ratio.num && 1 == p.avFrame->sample_aspect_ratio.den) ||
-                                    0 == p.avFrame->sample_aspect_ratio.den))
-                                {
-                                    imageInfo.pixelAspectRatio = p.avFrame->sample_aspect_ratio.num / static_cast<float>(p.avFrame->sample_aspect_ratio.den);
-                                }
-                                image = Image::Data::create(imageInfo);
-                                image->setPluginName(pluginName);
-                                av_image_fill_arrays(
-                                    p.avFrameRgb->data,
-                                    p.avFrameRgb->linesize,
-                                    image->getData(),
-                                    AV_PIX_FMT_RGBA,
-                                    image->getWidth(),
-                                    image->getHeight(),
-                                    1);
-                                sws_scale(
-                                    p.swsContext,
-                                    (uint8_t const* const*)p.avFrame->data,
-                                    p.avFrame->linesize,
-                                    0,
-                                    p.avCodecParameters[p.avVideoStream]->height,
-                                    p.avFrameRgb->data,
-                                    p.avFrameRgb->linesize);
+                                image = createImage(imageInfo, p.avFrame);
+                                fillFrame(p.avFrameRgb, p.avPixelFormatRgb, image);
+                                if (p.slices.size())
+                                {
+                                    // Start converting this frame on the worker threads.
+                                    // It is added to the queue by _finishVideo().
+                                    av_frame_ref(p.avFrameConvert, p.avFrame);
+                                    p.convertFrame = frame;
+                                    p.convertImage = image;
+                                    p.convertCache = dv.cacheEnabled;
+                                    {
+                                        std::lock_guard<std::mutex> lock(p.convertMutex);
+                                        ++p.convertGeneration;
+                                        p.convertPending = p.slices.size();
+                                    }
+                                    p.convertCV.notify_all();
+                                    continue;
+                                }
+                                convertFrame(p.avFrame, p.avFrameRgb, p.avPixelFormatRgb, nullptr);
                                 if (dv.cacheEnabled)
                                 {
+                                    std::lock_guard<std::mutex> lock(p.cacheMutex);
                                     _cache.add(frame, image);
                                 }
                             }
+                            _addVideo(frame, image);
+                        }
+                    }
+                    return r;
+                }
+
+                void Read::_startConvert()
+                {
+                    DJV_PRIVATE_PTR();
+                    p.convertRunning = true;
+                    for (size_t i = 0; i < p.slices.size(); ++i)
+                    {
+                        p.convertThreads.push_back(std::thread(
+                            [this, i]
                             {
-                                std::lock_guard<std::mutex> lock(_mutex);
-                                if (Math::Frame::invalid == p.seek)
+                                DJV_PRIVATE_PTR();
+                                uint64_t generation = 0;
+                                while (true)
                                 {
-                                    _videoQueue.addFrame(VideoFrame(frame, image));
+                                    {
+                                        std::unique_lock<std::mutex> lock(p.convertMutex);
+                                        p.convertCV.wait(
+                                            lock,
+                                            [this, generation]
+                                            {
+                                                return !_p->convertRunning || _p->convertGeneration != generation;
+                                            });
+                                        if (!p.convertRunning)
+                                        {
+                                            break;
+                                        }
+                                        generation = p.convertGeneration;
+                                    }
+                                    convertSlice(p.slices[i], p.avPixFmtDescriptor, p.avFrameConvert, p.avFrameRgb);
+                                    bool finished = false;
+                                    {
+                                        std::lock_guard<std::mutex> lock(p.convertMutex);
+                                        --p.convertPending;
+                                        finished = 0 == p.convertPending;
+                                    }
+                                    if (finished)
+                                    {
+                                        p.convertFinishedCV.notify_one();
+                                    }
                                 }
+                            }));
+                    }
+                }
+
+                void Read::_stopConvert()
+                {
+                    DJV_PRIVATE_PTR();
+                    {
+                        std::lock_guard<std::mutex> lock(p.convertMutex);
+                        p.convertRunning = false;
+                    }
+                    p.convertCV.notify_all();
+                    for (auto& i : p.convertThreads)
+                    {
+                        i.join();
+                    }
+                    p.convertThreads.clear();
+                }
+
+                void Read::_finishVideo(bool add)
+                {
+                    DJV_PRIVATE_PTR();
+                    if (p.convertImage)
+                    {
+                        {
+                            std::unique_lock<std::mutex> lock(p.convertMutex);
+                            p.convertFinishedCV.wait(
+                                lock,
+                                [this]
+                                {
+                                    return 0 == _p->convertPending;
+                                });
+                        }
+                        av_frame_unref(p.avFrameConvert);
+                        if (add)
+                        {
+                            if (p.convertCache)
+                            {
+                                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                                _cache.add(p.convertFrame, p.convertImage);
                             }
+                            _addVideo(p.convertFrame, p.convertImage);
                         }
+                        p.convertFrame = Math::Frame::invalid;
+                        p.convertImage.reset();
                     }
-                    return r;
+                }
+
+                void Read::_addVideo(Math::Frame::Number frame, const std::shared_ptr<Image::Data>& image)
+                {
+                    DJV_PRIVATE_PTR();
+                    if (p.reverseDecode)
+                    {
+                        // The whole group of pictures is kept unless it is larger
+                        // than the memory limit, then the earliest frames are
+                        // dropped and decoded again with the next group.
+                        p.reverseCache.push_back(VideoFrame(frame, image));
+                        p.reverseCacheByteCount += image ? image->getDataByteCount() : 0;
+                        while (p.reverseCache.size() > 1 && p.reverseCacheByteCount > reverseCacheMaxByteCount)
+                        {
+                            const auto& front = p.reverseCache.front().data;
+                            p.reverseCacheByteCount -= front ? front->getDataByteCount() : 0;
+                            p.reverseCache.pop_front();
+                        }
+                    }
+                    else
+                    {
+                        {
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            if (Math::Frame::invalid == p.seek)
+                            {
+                                _videoQueue.addFrame(VideoFrame(frame, image));
+                            }
+                        }
+                        _notify();
+                    }
+                }
+
+                bool Read::_readReverse()
+                {
+                    DJV_PRIVATE_PTR();
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _audioQueue.setFinished(true);
+                        if (_videoQueue.getCount() >= _videoQueue.getMax())
+                        {
+                            return true;
+                        }
+                    }
+
+                    // Decode the previous group of pictures when the frames
+                    // from the last one have all been added to the queue.
+                    if (p.reverseCache.empty())
+                    {
+                        if (p.reverseFrame < 0)
+                        {
+                            return false;
+                        }
+
+                        // Seek to the keyframe that starts the group of pictures.
+                        AVStream* avStream = p.avFormatContext->streams[p.avVideoStream];
+                        AVRational r;
+                        r.num = p.info.videoSpeed.getDen();
+                        r.den = p.info.videoSpeed.getNum();
+                        int64_t t = av_rescale_q(p.reverseFrame, r, avStream->time_base);
+                        IndexPacket keyframe;
+                        if (p.getKeyframe(t, keyframe))
+                        {
+                            t = keyframe.pts;
+                        }
+                        _finishVideo(false);
+                        avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                        p.decodeFrame = Math::Frame::invalid;
+                        if (av_seek_frame(p.avFormatContext, p.avVideoStream, t, AVSEEK_FLAG_BACKWARD) < 0)
+                        {
+                            return false;
+                        }
+
+                        // Decode the group of pictures up to the current frame.
+                        p.reverseDecode = true;
+                        p.reverseCacheByteCount = 0;
+                        DecodeVideo dv;
+                        dv.seek = av_rescale_q(t, avStream->time_base, r);
+                        dv.end  = p.reverseFrame;
+                        Math::Frame::Number videoFrame = Math::Frame::invalid;
+                        while (p.running && videoFrame < p.reverseFrame)
+                        {
+                            AVPacket packet;
+                            if (av_read_frame(p.avFormatContext, &packet) < 0)
+                            {
+                                dv.packet = nullptr;
+                                _decodeVideo(dv, videoFrame);
+                                avcodec_flush_buffers(p.avCodecContext[p.avVideoStream]);
+                                p.decodeFrame = Math::Frame::invalid;
+                                break;
+                            }
+                            int result = 0;
+                            if (p.avVideoStream == packet.stream_index)
+                            {
+                                dv.packet = &packet;
+                                result = _decodeVideo(dv, videoFrame);
+                            }
+                            av_packet_unref(&packet);
+                            if (result < 0)
+                            {
+                                break;
+                            }
+                        }
+                        _finishVideo(true);
+                        p.reverseDecode = false;
+                        if (p.reverseCache.empty())
+                        {
+                            return false;
+                        }
+                        p.reverseFrame = p.reverseCache.front().frame - 1;
+                    }
+
+                    // Add the frames to the queue in reverse order.
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        if (Math::Frame::invalid == p.seek && Direction::Reverse == _direction)
+                        {
+                            while (!p.reverseCache.empty() && _videoQueue.getCount() < _videoQueue.getMax())
+                            {
+                                const auto& back = p.reverseCache.back();
+                                p.reverseCacheByteCount -= back.data ? back.data->getDataByteCount() : 0;
+                                _videoQueue.addFrame(back);
+                                p.reverseCache.pop_back();
+                            }
+                        }
+                        else
+                        {
+                            p.reverseCache.clear();
+                            p.reverseCacheByteCount = 0;
+                        }
+                    }
+                    _notify();
+                    return true;
+                }
+
+                void Read::_fillCache()
+                {
+                    DJV_PRIVATE_PTR();
+                    std::shared_ptr<Decoder> decoder;
+                    Math::Frame::Number decodeFrame = Math::Frame::invalid;
+                    Math::Frame::Number end = Math::Frame::invalid;
+                    uint64_t generation = 0;
+                    while (p.running)
+                    {
+                        // Wait for a frame that is missing from the cache. The
+                        // end of the stream is found again when the cache
+                        // options change.
+                        Math::Frame::Number frame = Math::Frame::invalid;
+                        {
+                            std::unique_lock<std::mutex> lock(p.cacheMutex);
+                            p.cacheCV.wait_for(
+                                lock,
+                                System::getTimerDuration(System::TimerValue::Medium),
+                                [this, &end, &generation, &frame]
+                                {
+                                    if (_p->cacheGeneration != generation)
+                                    {
+                                        generation = _p->cacheGeneration;
+                                        end = Math::Frame::invalid;
+                                    }
+                                    frame = _getCacheFrame(end);
+                                    return !_p->running || frame != Math::Frame::invalid;
+                                });
+                        }
+                        if (Math::Frame::invalid == frame)
+                        {
+                            continue;
+                        }
+
+                        if (!decoder)
+                        {
+                            try
+                            {
+                                decoder = Decoder::create(
+                                    _fileInfo.getFileName(),
+                                    p.avVideoStream,
+                                    p.info.videoSpeed,
+                                    std::max(p.options.threadCount / 2, static_cast<size_t>(1)));
+                            }
+                            catch (const std::exception& e)
+                            {
+                                _logSystem->log("djv::AV::IO::FFmpeg::Read", e.what(), System::LogLevel::Error);
+                                break;
+                            }
+                        }
+
+                        // Seek to the group of pictures unless the frame is later in
+                        // the group that is being decoded.
+                        std::shared_ptr<Index> index;
+                        {
+                            std::lock_guard<std::mutex> lock(p.indexMutex);
+                            index = p.index;
+                        }
+                        if (!(decodeFrame != Math::Frame::invalid &&
+                            frame > decodeFrame &&
+                            decoder->isSameGroup(frame, decodeFrame, index)))
+                        {
+                            decodeFrame = Math::Frame::invalid;
+                            if (!decoder->seek(frame, index))
+                            {
+                                end = frame;
+                                continue;
+                            }
+                        }
+
+                        // Decode forward, adding the frames that are missing from
+                        // the cache, until a frame that is not needed.
+                        while (p.running)
+                        {
+                            Math::Frame::Number decoded = Math::Frame::invalid;
+                            if (!decoder->decode(decoded))
+                            {
+                                // Frames past the end of the stream cannot be decoded.
+                                if (decodeFrame < frame)
+                                {
+                                    end = frame;
+                                }
+                                decodeFrame = Math::Frame::invalid;
+                                break;
+                            }
+                            decodeFrame = decoded;
+                            bool add = false;
+                            {
+                                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                                add = p.cacheEnabled &&
+                                    _cache.getSequence().contains(decoded) &&
+                                    !_cache.contains(decoded);
+                            }
+                            if (decoded >= frame && !add)
+                            {
+                                break;
+                            }
+                            if (add)
+                            {
+                                auto image = decoder->getImage();
+                                std::lock_guard<std::mutex> lock(p.cacheMutex);
+                                _cache.add(decoded, image);
+                            }
+                        }
+                    }
+                }
+
+                Math::Frame::Number Read::_getCacheFrame(Math::Frame::Number end) const
+                {
+                    const auto& p = *_p;
+                    Math::Frame::Number out = Math::Frame::invalid;
+                    if (p.cacheEnabled && p.cacheFrame != Math::Frame::invalid)
+                    {
+                        const auto& sequence = _cache.getSequence();
+                        const size_t count = _cache.getMax() + _cache.getReadBehind();
+                        Math::Frame::Number frame = p.cacheFrame;
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            if (sequence.contains(frame) &&
+                                !_cache.contains(frame) &&
+                                (Math::Frame::invalid == end || frame < end))
+                            {
+                                out = frame;
+                                break;
+                            }
+                            switch (p.cacheDirection)
+                            {
+                            case Direction::Forward:
+                                ++frame;
+                                if (frame > p.cacheRange.getMax())
+                                {
+                                    frame = p.cacheRange.getMin();
+                                }
+                                break;
+                            case Direction::Reverse:
+                                --frame;
+                                if (frame < p.cacheRange.getMin())
+                                {
+                                    frame = p.cacheRange.getMax();
+                                }
+                                break;
+                            default: break;
+                            }
+                        }
+                    }
+                    return out;
+                }
+
+                void Read::_cacheInfoUpdate()
+                {
+                    DJV_PRIVATE_PTR();
+                    size_t cacheByteCount = 0;
+                    Math::Frame::Sequence cacheSequence;
+                    Math::Frame::Sequence cachedFrames;
+                    {
+                        std::lock_guard<std::mutex> lock(p.cacheMutex);
+                        if (_cache.getVersion() == p.cacheVersion)
+                        {
+                            return;
+                        }
+                        p.cacheVersion = _cache.getVersion();
+                        cacheByteCount = _cache.getTotalByteCount();
+                        cacheSequence = _cache.getSequence();
+                        cachedFrames = _cache.getFrames();
+                    }
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _cacheByteCount = cacheByteCount;
+                    _cacheSequence = cacheSequence;
+                    _cachedFrames = std::move(cachedFrames);
+                }
+
+                int64_t Read::Private::toPts(Math::Frame::Number value) const
+                {
+                    AVRational r;
+                    r.num = info.videoSpeed.getDen();
+                    r.den = info.videoSpeed.getNum();
+                    return av_rescale_q(value, r, avFormatContext->streams[avVideoStream]->time_base);
+                }
+
+                bool Read::Private::getKeyframe(int64_t pts, IndexPacket& out)
+                {
+                    std::lock_guard<std::mutex> lock(indexMutex);
+                    return index ? index->getKeyframe(pts, out) : false;
+                }
+
+                void Read::Private::buildIndex(
+                    const System::File::Info& fileInfo,
+                    const System::File::Path& path,
+                    const std::shared_ptr<System::TextSystem>& textSystem,
+                    const std::shared_ptr<System::LogSystem>& logSystem)
+                {
+                    // Read the index from a previous session.
+                    const System::File::Path fileName = getIndexPath(path, fileInfo);
+                    std::shared_ptr<Index> out;
+                    try
+                    {
+                        if (System::File::Info(fileName).doesExist())
+                        {
+                            auto io = System::File::IO::create();
+                            io->open(fileName.get(), System::File::Mode::Read);
+                            auto tmp = std::make_shared<Index>(readIndex(io, textSystem));
+                            if (tmp->isValid(fileInfo))
+                            {
+                                out = tmp;
+                            }
+                        }
+                    }
+                    catch (const std::exception& e)
+                    {
+                        logSystem->log("djv::AV::IO::FFmpeg::Read", e.what(), System::LogLevel::Warning);
+                    }
+
+                    // Build a new index and store it.
+                    if (!out && running)
+                    {
+                        try
+                        {
+                            auto tmp = std::make_shared<Index>(FFmpeg::buildIndex(fileInfo, avVideoStream, running));
+                            if (!tmp->isEmpty())
+                            {
+                                out = tmp;
+                                if (!System::File::Info(path).doesExist())
+                                {
+                                    System::File::mkdir(path);
+                                }
+                                auto io = System::File::IO::create();
+                                io->open(fileName.get(), System::File::Mode::Write);
+                                writeIndex(io, *out);
+                            }
+                        }
+                        catch (const std::exception& e)
+                        {
+                            logSystem->log("djv::AV::IO::FFmpeg::Read", e.what(), System::LogLevel::Warning);
+                        }
+                    }
+
+                    std::lock_guard<std::mutex> lock(indexMutex);
+                    index = out;
                 }
 
                 int Read::_decodeAudio(const DecodeAudio& da, Math::Frame::Number& frame)
@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/Filmstrip.h>
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/TextSystem.h>
+
+#include <djvCore/StringFormat.h>
+
+#include <algorithm>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace
+        {
+            const std::string filmstripMagic = "djvFilmstrip";
+            const uint32_t filmstripVersion = 1;
+
+        } // namespace
+
+        struct Filmstrip::Private
+        {
+            std::shared_ptr<System::File::IO> io;
+            uint64_t fileSize = 0;
+            time_t fileTime = 0;
+            Image::Info imageInfo;
+            size_t step = 1;
+            size_t frameCount = 0;
+            size_t imageCount = 0;
+#if defined(DJV_MMAP)
+            const uint8_t* data = nullptr;
+#else // DJV_MMAP
+            std::vector<uint8_t> data;
+#endif // DJV_MMAP
+        };
+
+        void Filmstrip::_init(const std::string& fileName, const std::shared_ptr<System::TextSystem>& textSystem)
+        {
+            DJV_PRIVATE_PTR();
+            p.io = System::File::IO::create();
+            p.io->open(fileName, System::File::Mode::Read);
+
+            std::string magic(filmstripMagic.size(), 0);
+            p.io->read(&magic[0], magic.size());
+            uint32_t version = 0;
+            p.io->readU32(&version);
+            if (magic != filmstripMagic || version != filmstripVersion)
+            {
+                throw System::File::Error(String::Format("{0}: {1}").
+                    arg(fileName).
+                    arg(textSystem->getText(DJV_TEXT("error_bad_magic_number"))));
+            }
+            int64_t fileTime = 0;
+            uint16_t size[2] = { 0, 0 };
+            uint8_t type = 0;
+            uint64_t step = 0;
+            uint64_t frameCount = 0;
+            uint64_t imageCount = 0;
+            p.io->read(&p.fileSize, 1, sizeof(uint64_t));
+            p.io->read(&fileTime, 1, sizeof(int64_t));
+            p.io->readU16(size, 2);
+            p.io->readU8(&type);
+            p.io->readF32(&p.imageInfo.pixelAspectRatio);
+            p.io->read(&step, 1, sizeof(uint64_t));
+            p.io->read(&frameCount, 1, sizeof(uint64_t));
+            p.io->read(&imageCount, 1, sizeof(uint64_t));
+            p.fileTime = static_cast<time_t>(fileTime);
+            p.imageInfo.size.w = size[0];
+            p.imageInfo.size.h = size[1];
+            p.imageInfo.type = type < static_cast<uint8_t>(Image::Type::Count) ?
+                static_cast<Image::Type>(type) :
+                Image::Type::None;
+            p.step = std::max(step, static_cast<uint64_t>(1));
+            p.frameCount = frameCount;
+            p.imageCount = imageCount;
+
+            const size_t imageByteCount = p.imageInfo.getDataByteCount();
+            const size_t remaining = p.io->getSize() - p.io->getPos();
+            if (!p.imageInfo.isValid() ||
+                imageCount > remaining / std::max(imageByteCount, static_cast<size_t>(1)))
+            {
+                throw System::File::Error(String::Format("{0}: {1}").
+                    arg(fileName).
+                    arg(textSystem->getText(DJV_TEXT("error_incomplete_file"))));
+            }
+#if defined(DJV_MMAP)
+            p.data = p.io->mmapP();
+#else // DJV_MMAP
+            const size_t byteCount = imageByteCount * p.imageCount;
+            p.data.resize(byteCount);
+            p.io->read(p.data.data(), byteCount);
+            p.io->close();
+#endif // DJV_MMAP
+        }
+
+        Filmstrip::Filmstrip() :
+            _p(new Private)
+        {}
+
+        Filmstrip::~Filmstrip()
+        {}
+
+        std::shared_ptr<Filmstrip> Filmstrip::create(
+            const std::string& fileName,
+            const std::shared_ptr<System::TextSystem>& textSystem)
+        {
+            auto out = std::shared_ptr<Filmstrip>(new Filmstrip);
+            out->_init(fileName, textSystem);
+            return out;
+        }
+
+        uint64_t Filmstrip::getFileSize() const
+        {
+            return _p->fileSize;
+        }
+
+        time_t Filmstrip::getFileTime() const
+        {
+            return _p->fileTime;
+        }
+
+        bool Filmstrip::isValid(const System::File::Info& value) const
+        {
+            DJV_PRIVATE_PTR();
+            return p.imageCount > 0 &&
+                value.getSize() == p.fileSize &&
+                value.getTime() == p.fileTime;
+        }
+
+        const Image::Info& Filmstrip::getImageInfo() const
+        {
+            return _p->imageInfo;
+        }
+
+        size_t Filmstrip::getStep() const
+        {
+            return _p->step;
+        }
+
+        size_t Filmstrip::getFrameCount() const
+        {
+            return _p->frameCount;
+        }
+
+        size_t Filmstrip::getImageCount() const
+        {
+            return _p->imageCount;
+        }
+
+        std::shared_ptr<Image::Data> Filmstrip::getImage(Math::Frame::Index value) const
+        {
+            DJV_PRIVATE_PTR();
+            std::shared_ptr<Image::Data> out;
+            if (p.imageCount > 0)
+            {
+                const size_t index = std::min(
+                    static_cast<size_t>(std::max(value, static_cast<Math::Frame::Index>(0))) / p.step,
+                    p.imageCount - 1);
+                out = Image::Data::create(p.imageInfo);
+                const size_t byteCount = out->getDataByteCount();
+#if defined(DJV_MMAP)
+                memcpy(out->getData(), p.data + index * byteCount, byteCount);
+#else // DJV_MMAP
+                memcpy(out->getData(), p.data.data() + index * byteCount, byteCount);
+#endif // DJV_MMAP
+            }
+            return out;
+        }
+
+        void Filmstrip::write(
+            const std::string&                                fileName,
+            const System::File::Info&                         fileInfo,
+            size_t                                            step,
+            size_t                                            frameCount,
+            const std::vector<std::shared_ptr<Image::Data> >& images)
+        {
+            const Image::Info imageInfo = !images.empty() ? images[0]->getInfo() : Image::Info();
+            auto io = System::File::IO::create();
+            io->open(fileName, System::File::Mode::Write);
+            io->write(filmstripMagic);
+            io->writeU32(filmstripVersion);
+            const uint64_t fileSize = fileInfo.getSize();
+            const int64_t fileTime = fileInfo.getTime();
+            const uint16_t size[2] = { imageInfo.size.w, imageInfo.size.h };
+            const uint64_t step64 = step;
+            const uint64_t frameCount64 = frameCount;
+            const uint64_t imageCount = images.size();
+            io->write(&fileSize, 1, sizeof(uint64_t));
+            io->write(&fileTime, 1, sizeof(int64_t));
+            io->writeU16(size, 2);
+            io->writeU8(static_cast<uint8_t>(imageInfo.type));
+            io->writeF32(imageInfo.pixelAspectRatio);
+            io->write(&step64, 1, sizeof(uint64_t));
+            io->write(&frameCount64, 1, sizeof(uint64_t));
+            io->write(&imageCount, 1, sizeof(uint64_t));
+            for (const auto& i : images)
+            {
+                io->write(i->getData(), i->getDataByteCount());
+            }
+        }
+
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvImage/Info.h>
+
+#include <djvMath/FrameNumber.h>
+
+#include <djvCore/Core.h>
+
+#include <ctime>
+#include <memory>
+#include <vector>
+
+namespace djv
+{
+    namespace System
+    {
+        class TextSystem;
+
+        namespace File
+        {
+            class Info;
+
+        } // namespace File
+    } // namespace System
+
+    namespace Image
+    {
+        class Data;
+
+    } // namespace Image
+
+    namespace AV
+    {
+        //! This class provides a filmstrip of small images sampled from every
+        //! N-th frame of a movie. The images are stored in a file that is
+        //! memory-mapped when it is opened, so sampling an image only copies
+        //! a thumbnail.
+        class Filmstrip
+        {
+            DJV_NON_COPYABLE(Filmstrip);
+
+        protected:
+            void _init(const std::string& fileName, const std::shared_ptr<System::TextSystem>&);
+            Filmstrip();
+
+        public:
+            ~Filmstrip();
+
+            //! Open a filmstrip file.
+            //! Throws:
+            //! - System::File::Error
+            static std::shared_ptr<Filmstrip> create(
+                const std::string& fileName,
+                const std::shared_ptr<System::TextSystem>&);
+
+            //! \name Information
+            ///@{
+
+            uint64_t getFileSize() const;
+            time_t getFileTime() const;
+
+            //! Get whether the filmstrip matches the given file.
+            bool isValid(const System::File::Info&) const;
+
+            const Image::Info& getImageInfo() const;
+
+            //! Get the number of frames between images.
+            size_t getStep() const;
+
+            size_t getFrameCount() const;
+            size_t getImageCount() const;
+
+            ///@}
+
+            //! Get the image for a frame. This is the image sampled at or
+            //! before the frame.
+            std::shared_ptr<Image::Data> getImage(Math::Frame::Index) const;
+
+            //! Write a filmstrip file. The images must all have the same
+            //! information.
+            //! Throws:
+            //! - System::File::Error
+            static void write(
+                const std::string&                               fileName,
+                const System::File::Info&                        fileInfo,
+                size_t                                           step,
+                size_t                                           frameCount,
+                const std::vector<std::shared_ptr<Image::Data> >& images);
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,225 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/FilmstripSystem.h>
+
+#include <djvAV/CacheWorker.h>
+#include <djvAV/Filmstrip.h>
+#include <djvAV/IO.h>
+
+#if defined(FFmpeg_FOUND)
+#include <djvAV/FFmpegDecoder.h>
+#include <djvAV/FFmpegFunc.h>
+#endif // FFmpeg_FOUND
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/LogSystem.h>
+#include <djvSystem/ResourceSystem.h>
+#include <djvSystem/TextSystem.h>
+
+#include <djvCore/StringFormat.h>
+
+#include <thread>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace
+        {
+            //! \todo Should this be configurable?
+            const size_t cacheMax = 10;
+            const uint16_t imageWidth = 192;
+            const size_t imageMax = 500;
+
+        } // namespace
+
+        struct FilmstripSystem::Private
+        {
+            std::shared_ptr<System::TextSystem> textSystem;
+            System::File::Path indexPath;
+            std::unique_ptr<CacheWorker<Filmstrip> > worker;
+        };
+
+        void FilmstripSystem::_init(const std::shared_ptr<System::Context>& context)
+        {
+            ISystem::_init("djv::AV::FilmstripSystem", context);
+
+            DJV_PRIVATE_PTR();
+
+            p.textSystem = context->getSystemT<System::TextSystem>();
+            auto resourceSystem = context->getSystemT<System::ResourceSystem>();
+            const auto documents = resourceSystem->getPath(System::File::ResourcePath::Documents);
+            p.indexPath = System::File::Path(documents, "FFmpegIndex");
+            auto textSystem = p.textSystem;
+            p.worker.reset(new CacheWorker<Filmstrip>(
+                "djv::AV::FilmstripSystem",
+                System::File::Path(documents, "Filmstrips"),
+                ".filmstrip",
+                cacheMax,
+                [textSystem](const System::File::Path& fileName, const System::File::Info& fileInfo)
+                {
+                    auto out = Filmstrip::create(fileName.get(), textSystem);
+                    return out->isValid(fileInfo) ? out : nullptr;
+                },
+                [this]
+                {
+                    _wake();
+                },
+                context->getSystemT<System::LogSystem>()));
+
+            _logInitTime();
+        }
+
+        FilmstripSystem::FilmstripSystem() :
+            _p(new Private)
+        {}
+
+        FilmstripSystem::~FilmstripSystem()
+        {
+            _p->worker.reset();
+        }
+
+        std::shared_ptr<FilmstripSystem> FilmstripSystem::create(const std::shared_ptr<System::Context>& context)
+        {
+            auto out = context->getSystemT<FilmstripSystem>();
+            if (!out)
+            {
+                out = std::shared_ptr<FilmstripSystem>(new FilmstripSystem);
+                out->_init(context);
+            }
+            return out;
+        }
+
+        std::future<std::shared_ptr<Filmstrip> > FilmstripSystem::getFilmstrip(
+            const System::File::Info& fileInfo,
+            const IO::Info& info)
+        {
+            DJV_PRIVATE_PTR();
+            CacheWorker<Filmstrip>::BuildCallback build;
+#if defined(FFmpeg_FOUND)
+            build = [this, fileInfo, info](const System::File::Path& fileName)
+            {
+                return _buildFilmstrip(fileName, fileInfo, info);
+            };
+#endif // FFmpeg_FOUND
+            return p.worker->request(fileInfo, build);
+        }
+
+        void FilmstripSystem::clearCache()
+        {
+            _p->worker->clearCache();
+        }
+
+#if defined(FFmpeg_FOUND)
+        std::shared_ptr<Filmstrip> FilmstripSystem::_buildFilmstrip(
+            const System::File::Path& fileName,
+            const System::File::Info& fileInfo,
+            const IO::Info& info)
+        {
+            DJV_PRIVATE_PTR();
+
+            // Decode every N-th frame at thumbnail resolution and store the
+            // filmstrip. Only movie files are decoded, image sequences are
+            // not sampled.
+            std::shared_ptr<Filmstrip> out;
+            const size_t frameCount = info.videoSequence.getFrameCount();
+            if (System::File::Type::File == fileInfo.getType() &&
+                !info.video.empty() &&
+                info.video[0].size.w > 0 &&
+                frameCount > 0)
+            {
+                const size_t step = std::max((frameCount + imageMax - 1) / imageMax, static_cast<size_t>(1));
+                const auto& videoInfo = info.video[0];
+                const Image::Size size(
+                    imageWidth,
+                    std::max(imageWidth * videoInfo.size.h / videoInfo.size.w, 1));
+
+                // Use the index from the reader to skip groups of pictures.
+                std::shared_ptr<IO::FFmpeg::Index> index;
+                try
+                {
+                    const auto indexFileName = IO::FFmpeg::getIndexPath(p.indexPath, fileInfo);
+                    if (System::File::Info(indexFileName).doesExist())
+                    {
+                        auto io = System::File::IO::create();
+                        io->open(indexFileName.get(), System::File::Mode::Read);
+                        auto tmp = std::make_shared<IO::FFmpeg::Index>(IO::FFmpeg::readIndex(io, p.textSystem));
+                        if (tmp->isValid(fileInfo))
+                        {
+                            index = tmp;
+                        }
+                    }
+                }
+                catch (const std::exception&)
+                {}
+
+                auto decoder = IO::FFmpeg::Decoder::create(
+                    fileInfo.getFileName(),
+                    -1,
+                    info.videoSpeed,
+                    std::max(std::thread::hardware_concurrency() / 2, 1U),
+                    size,
+                    Image::Type::RGB_U8);
+                const auto& running = p.worker->isRunning();
+                std::vector<std::shared_ptr<Image::Data> > images;
+                Math::Frame::Number decoded = Math::Frame::invalid;
+                for (size_t i = 0; i < frameCount && running; i += step)
+                {
+                    const Math::Frame::Number frame = i;
+                    if (Math::Frame::invalid == decoded ||
+                        (index && !decoder->isSameGroup(frame, decoded, index)))
+                    {
+                        decoder->seek(frame, index);
+                    }
+                    std::shared_ptr<Image::Data> image;
+                    while (running && decoder->decode(decoded))
+                    {
+                        if (decoded >= frame)
+                        {
+                            image = decoder->getImage();
+                            break;
+                        }
+                    }
+                    if (!running)
+                    {
+                        return nullptr;
+                    }
+
+                    // A filmstrip with missing images would be stored for
+                    // good, fail instead.
+                    if (!image)
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(fileInfo.getFileName()).
+                            arg(p.textSystem->getText(DJV_TEXT("error_file_read"))));
+                    }
+                    images.push_back(image);
+                }
+                if (running && !images.empty())
+                {
+                    try
+                    {
+                        Filmstrip::write(fileName.get(), fileInfo, step, frameCount, images);
+                        out = Filmstrip::create(fileName.get(), p.textSystem);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        _log(e.what(), System::LogLevel::Warning);
+                    }
+                }
+            }
+            return out;
+        }
+#endif // FFmpeg_FOUND
+
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvSystem/ISystem.h>
+
+#include <future>
+
+namespace djv
+{
+    namespace System
+    {
+        namespace File
+        {
+            class Info;
+            class Path;
+
+        } // namespace File
+    } // namespace System
+
+    namespace AV
+    {
+        namespace IO
+        {
+            class Info;
+
+        } // namespace IO
+
+        class Filmstrip;
+
+        //! This class provides a system for building movie filmstrips.
+        //!
+        //! Every N-th frame of a movie is decoded once in the background at
+        //! thumbnail resolution and the images are stored in a cache
+        //! directory, so scrubbing the timeline does not decode full
+        //! resolution frames.
+        class FilmstripSystem : public System::ISystem
+        {
+            DJV_NON_COPYABLE(FilmstripSystem);
+
+        protected:
+            void _init(const std::shared_ptr<System::Context>&);
+            FilmstripSystem();
+
+        public:
+            ~FilmstripSystem() override;
+
+            static std::shared_ptr<FilmstripSystem> create(const std::shared_ptr<System::Context>&);
+
+            //! Get the filmstrip for a file. The result is null when the file
+            //! is not a movie or the filmstrip cannot be built.
+            std::future<std::shared_ptr<Filmstrip> > getFilmstrip(
+                const System::File::Info&,
+                const IO::Info&);
+
+            //! Clear the memory cache.
+            void clearCache();
+
+        private:
+            std::shared_ptr<Filmstrip> _buildFilmstrip(
+                const System::File::Path&,
+                const System::File::Info&,
+                const IO::Info&);
+
+            DJV_PRIVATE();
+        };
+
+    } // namespace AV
+} // namespace djv
@@ -6,6 +6,8 @@
 
 #include <djvAV/SpeedFunc.h>
 
+#include <djvMath/MathFunc.h>
+
 using namespace djv::Core;
 
 namespace djv
@@ -36,25 +38,39 @@ namespace djv
 
             void VideoQueue::addFrame(const VideoFrame& value)
             {
-                _queue.push(value);
+                if (_count == _frames.size())
+                {
+                    // Grow the ring buffer, keeping the frames in order.
+                    std::vector<VideoFrame> frames(std::max(std::max(_frames.size() * 2, _max), static_cast<size_t>(1)));
+                    for (size_t i = 0; i < _count; ++i)
+                    {
+                        frames[i] = std::move(_frames[(_head + i) % _frames.size()]);
+                    }
+                    _frames = std::move(frames);
+                    _head = 0;
+                }
+                _frames[(_head + _count) % _frames.size()] = value;
+                ++_count;
             }
 
             VideoFrame VideoQueue::popFrame()
             {
                 VideoFrame out;
-                if (_queue.size())
+                if (_count)
                 {
-                    out = _queue.front();
-                    _queue.pop();
+                    out = std::move(_frames[_head]);
+                    _frames[_head] = VideoFrame();
+                    _head = (_head + 1) % _frames.size();
+                    --_count;
                 }
                 return out;
             }
 
             void VideoQueue::clearFrames()
             {
-                while (_queue.size())
+                while (_count)
                 {
-                    _queue.pop();
+                    popFrame();
                 }
             }
 
@@ -130,36 +146,31 @@ namespace djv
             Math::Frame::Sequence Cache::getFrames() const
             {
                 Math::Frame::Sequence out;
-                std::vector<Math::Frame::Index> frames;
-                for (const auto& i : _cache)
-                {
-                    frames.push_back(i.first);
-                }
-                const size_t size = frames.size();
-                if (size)
+                getFrames(out);
+                return out;
+            }
+
+            void Cache::getFrames(Math::Frame::Sequence& out) const
+            {
+                // The frames are sorted by the map, so the ranges can be
+                // built directly.
+                out.clear();
+                auto i = _cache.begin();
+                if (i != _cache.end())
                 {
-                    std::sort(frames.begin(), frames.end());
-                    Math::Frame::Number rangeStart = frames[0];
-                    Math::Frame::Number prevFrame = frames[0];
-                    size_t i = 1;
-                    for (; i < size; prevFrame = frames[i], ++i)
+                    Math::Frame::Number rangeStart = i->first;
+                    Math::Frame::Number prevFrame = i->first;
+                    for (++i; i != _cache.end(); ++i)
                     {
-                        if (frames[i] != prevFrame + 1)
+                        if (i->first != prevFrame + 1)
                         {
                             out.add(Math::Frame::Range(rangeStart, prevFrame));
-                            rangeStart = frames[i];
+                            rangeStart = i->first;
                         }
+                        prevFrame = i->first;
                     }
-                    if (size > 1)
-                    {
-                        out.add(Math::Frame::Range(rangeStart, prevFrame));
-                    }
-                    else
-                    {
-                        out.add(Math::Frame::Range(rangeStart));
-                    }
+                    out.add(Math::Frame::Range(rangeStart, prevFrame));
                 }
-                return out;
             }
 
             void Cache::setSequenceSize(size_t value)
@@ -196,96 +207,106 @@ namespace djv
 
             void Cache::add(Math::Frame::Index index, const std::shared_ptr<Image::Data>& image)
             {
-                _cache[index] = image;
-                _cacheUpdate();
+                // Frames outside of the cache sequence are not kept.
+                if (_sequence.contains(index))
+                {
+                    _cache[index] = image;
+                    ++_version;
+                }
             }
 
             void Cache::_cacheUpdate()
             {
+                // The cache sequence is a window of frames starting behind
+                // the current frame and wrapping around the in/out points.
+                // The window is calculated directly and the sequence is only
+                // rebuilt when it changes, so moving the current frame does
+                // not allocate memory.
                 const auto range = _inOutPoints.getRange(_sequenceSize);
-                Math::Frame::Index frame = _currentFrame;
-                _sequence = Math::Frame::Sequence();
-                switch (_direction)
+                const Math::Frame::Index min = range.getMin();
+                const Math::Frame::Index max = range.getMax();
+                const Math::Frame::Index size = max - min + 1;
+                const Math::Frame::Index count = std::min(static_cast<Math::Frame::Index>(_max) + 1, size);
+                const Math::Frame::Index readBehind = static_cast<Math::Frame::Index>(_readBehind) % size;
+                const Math::Frame::Index frame = Math::clamp(_currentFrame, min, max);
+                Math::Frame::Range ranges[2];
+                size_t rangeCount = 0;
+                if (count == size)
                 {
-                case Direction::Forward:
+                    ranges[rangeCount++] = Math::Frame::Range(min, max);
+                }
+                else
                 {
-                    for (size_t i = 0; i < _readBehind; ++i)
+                    switch (_direction)
                     {
-                        --frame;
-                        if (frame < range.getMin())
-                        {
-                            frame = range.getMax();
-                        }
-                    }
-                    _sequence.add(Math::Frame::Range(frame));
-                    const Math::Frame::Index first = frame;
-                    for (size_t i = 0; i < _max; ++i)
+                    case Direction::Forward:
                     {
-                        ++frame;
-                        if (first == frame)
+                        Math::Frame::Index start = frame - readBehind;
+                        if (start < min)
                         {
-                            break;
+                            start += size;
                         }
-                        if (frame > range.getMax())
+                        const Math::Frame::Index end = start + count - 1;
+                        if (end <= max)
                         {
-                            frame = range.getMin();
-                            if (frame != _sequence.getRanges().back().getMax())
-                            {
-                                _sequence.add(Math::Frame::Range(frame));
-                            }
+                            ranges[rangeCount++] = Math::Frame::Range(start, end);
                         }
                         else
                         {
-                            _sequence.add(Math::Frame::Range(frame));
-                        }
-                    }
-                    break;
-                }
-                case Direction::Reverse:
-                {
-                    for (size_t i = 0; i < _readBehind; ++i)
-                    {
-                        ++frame;
-                        if (frame > range.getMax())
-                        {
-                            frame = range.getMin();
+                            ranges[rangeCount++] = Math::Frame::Range(min, end - size);
+                            ranges[rangeCount++] = Math::Frame::Range(start, max);
                         }
+                        break;
                     }
-                    _sequence.add(Math::Frame::Range(frame));
-                    const Math::Frame::Index first = frame;
-                    for (size_t i = 0; i < _max; ++i)
+                    case Direction::Reverse:
                     {
-                        --frame;
-                        if (first == frame)
+                        Math::Frame::Index start = frame + readBehind;
+                        if (start > max)
                         {
-                            break;
+                            start -= size;
                         }
-                        if (frame < range.getMin())
+                        const Math::Frame::Index end = start - count + 1;
+                        if (end >= min)
                         {
-                            frame = range.getMax();
-                            if (frame != _sequence.getRanges().back().getMin())
-                            {
-                                _sequence.add(Math::Frame::Range(frame));
-                            }
+                            ranges[rangeCount++] = Math::Frame::Range(end, start);
                         }
                         else
                         {
-                            _sequence.add(Math::Frame::Range(frame));
+                            ranges[rangeCount++] = Math::Frame::Range(min, start);
+                            ranges[rangeCount++] = Math::Frame::Range(end + size, max);
                         }
+                        break;
+                    }
+                    default: break;
                     }
-                    break;
                 }
-                default: break;
+
+                const auto& sequenceRanges = _sequence.getRanges();
+                bool changed = sequenceRanges.size() != rangeCount;
+                for (size_t i = 0; i < rangeCount && !changed; ++i)
+                {
+                    changed = sequenceRanges[i] != ranges[i];
                 }
-                auto i = _cache.begin();
-                while (i != _cache.end())
+                if (changed)
                 {
-                    auto j = i;
-                    ++i;
-                    if (!_sequence.contains(j->first))
+                    _sequence.clear();
+                    for (size_t i = 0; i < rangeCount; ++i)
+                    {
+                        _sequence.add(ranges[i]);
+                    }
+                    auto i = _cache.begin();
+                    while (i != _cache.end())
                     {
-                        _cache.erase(j);
+                        if (!_sequence.contains(i->first))
+                        {
+                            i = _cache.erase(i);
+                        }
+                        else
+                        {
+                            ++i;
+                        }
                     }
+                    ++_version;
                 }
             }
 
@@ -14,6 +14,7 @@
 #include <future>
 #include <queue>
 #include <set>
+#include <vector>
 
 namespace djv
 {
@@ -93,7 +94,13 @@ namespace djv
 
             private:
                 size_t _max = 0;
-                std::queue<VideoFrame> _queue;
+
+                // The frames are kept in a ring buffer so that a queue that
+                // is filled and emptied while playing back does not
+                // allocate memory.
+                std::vector<VideoFrame> _frames;
+                size_t _head = 0;
+                size_t _count = 0;
                 bool _finished = false;
             };
 
@@ -212,7 +219,16 @@ namespace djv
                 //! \name Frames
                 ///@{
 
+                //! Get the cache version. The version is incremented whenever
+                //! the frames or the cache sequence change.
+                uint64_t getVersion() const;
+
                 Math::Frame::Sequence getFrames() const;
+
+                //! Get the cached frames, re-using the memory of the given
+                //! sequence.
+                void getFrames(Math::Frame::Sequence&) const;
+
                 size_t getReadBehind() const;
                 const Math::Frame::Sequence& getSequence() const;
 
@@ -239,6 +255,7 @@ namespace djv
                 Math::Frame::Index _currentFrame = 0;
                 //! \todo Should this be configurable?
                 size_t _readBehind = 10;
+                uint64_t _version = 0;
                 Math::Frame::Sequence _sequence;
                 std::map<Math::Frame::Index, std::shared_ptr<Image::Data> > _cache;
             };
@@ -32,17 +32,17 @@ namespace djv
 
             inline bool VideoQueue::isEmpty() const
             {
-                return 0 == _queue.size();
+                return 0 == _count;
             }
 
             inline size_t VideoQueue::getCount() const
             {
-                return _queue.size();
+                return _count;
             }
 
             inline VideoFrame VideoQueue::getFrame() const
             {
-                return _queue.size() ? _queue.front() : VideoFrame();
+                return _count ? _frames[_head] : VideoFrame();
             }
 
             inline bool VideoQueue::isFinished() const
@@ -143,6 +143,11 @@ namespace djv
                 return out;
             }
 
+            inline uint64_t Cache::getVersion() const
+            {
+                return _version;
+            }
+
             inline size_t Cache::getReadBehind() const
             {
                 return _readBehind;
@@ -171,7 +176,11 @@ namespace djv
 
             inline void Cache::clear()
             {
-                _cache.clear();
+                if (!_cache.empty())
+                {
+                    _cache.clear();
+                    ++_version;
+                }
             }
 
         } // namespace IO
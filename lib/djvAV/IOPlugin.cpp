@@ -5,10 +5,16 @@
 #include <djvAV/IOPlugin.h>
 
 #include <djvSystem/Context.h>
+#include <djvSystem/File.h>
 #include <djvSystem/LogSystem.h>
 #include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TextSystem.h>
 
+#include <djvCore/StringFormat.h>
+
+#include <cctype>
+#include <cstring>
+
 using namespace djv::Core;
 
 namespace djv
@@ -42,6 +48,7 @@ namespace djv
             {
                 std::unique_lock<std::mutex> lock(_mutex);
                 _threadCount = value;
+                ++_optionsVersion;
             }
 
             void IRead::_init(
@@ -53,6 +60,7 @@ namespace djv
             {
                 IIO::_init(fileInfo, options, textSystem, resourceSystem, logSystem);
                 _options = options;
+                _telemetry = Telemetry::create();
             }
 
             IRead::~IRead()
@@ -62,18 +70,21 @@ namespace djv
             {
                 std::lock_guard<std::mutex> lock(_mutex);
                 _playback = value;
+                ++_optionsVersion;
             }
 
             void IRead::setLoop(bool value)
             {
                 std::lock_guard<std::mutex> lock(_mutex);
                 _loop = value;
+                ++_optionsVersion;
             }
             
             void IRead::setInOutPoints(const InOutPoints& value)
             {
                 std::lock_guard<std::mutex> lock(_mutex);
                 _inOutPoints = value;
+                ++_optionsVersion;
             }
 
             size_t IRead::getCacheByteCount()
@@ -98,12 +109,29 @@ namespace djv
             {
                 std::lock_guard<std::mutex> lock(_mutex);
                 _cacheEnabled = value;
+                ++_optionsVersion;
             }
 
             void IRead::setCacheMaxByteCount(size_t value)
             {
                 std::lock_guard<std::mutex> lock(_mutex);
                 _cacheMaxByteCount = value;
+                ++_optionsVersion;
+            }
+
+            void IRead::setCallback(const std::function<void()>& value)
+            {
+                std::lock_guard<std::mutex> lock(_callbackMutex);
+                _callback = value;
+            }
+
+            void IRead::_notify()
+            {
+                std::lock_guard<std::mutex> lock(_callbackMutex);
+                if (_callback)
+                {
+                    _callback();
+                }
             }
 
             void IWrite::_init(
@@ -150,6 +178,35 @@ namespace djv
 
             } // namespace
 
+            FileMagic::FileMagic()
+            {}
+
+            FileMagic::FileMagic(const std::string& bytes, size_t offset, bool whitespace) :
+                bytes(bytes),
+                offset(offset),
+                whitespace(whitespace)
+            {}
+
+            bool PluginDescriptor::matchFileExtension(const System::File::Info& fileInfo) const
+            {
+                return checkExtension(fileInfo, fileExtensions);
+            }
+
+            bool PluginDescriptor::matchFileMagic(const uint8_t* data, size_t size) const
+            {
+                for (const auto& i : fileMagic)
+                {
+                    const size_t end = i.offset + i.bytes.size();
+                    if (end + (i.whitespace ? 1 : 0) <= size &&
+                        0 == memcmp(data + i.offset, i.bytes.data(), i.bytes.size()) &&
+                        (!i.whitespace || isspace(data[end])))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
             bool IPlugin::canRead(const System::File::Info& fileInfo) const
             {
                 return checkExtension(fileInfo, _fileExtensions);
@@ -175,6 +232,18 @@ namespace djv
                 return nullptr;
             }
 
+            Info IPlugin::probe(const System::File::Info& fileInfo) const
+            {
+                auto read = this->read(fileInfo, ReadOptions());
+                if (!read)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileInfo.getFileName()).
+                        arg(_textSystem->getText(DJV_TEXT("error_file_read"))));
+                }
+                return read->getInfo().get();
+            }
+
             std::shared_ptr<IWrite> IPlugin::write(const System::File::Info&, const Info&, const WriteOptions&) const
             {
                 return nullptr;
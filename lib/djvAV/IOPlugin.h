@@ -5,9 +5,12 @@
 #pragma once
 
 #include <djvAV/IO.h>
+#include <djvAV/Telemetry.h>
 
 #include <djvSystem/FileInfo.h>
 
+#include <functional>
+
 namespace djv
 {
     namespace System
@@ -79,6 +82,11 @@ namespace djv
                 VideoQueue _videoQueue;
                 AudioQueue _audioQueue;
                 size_t _threadCount = 4;
+
+                //! The options version is incremented when the thread count or
+                //! read options change, so that the I/O threads only need to
+                //! copy the options when they are different.
+                uint64_t _optionsVersion = 0;
             };
 
             //! This class provides options for reading.
@@ -88,6 +96,10 @@ namespace djv
                 
                 size_t layer = 0;
                 std::string colorSpace;
+
+                //! Build an index of the movie for seeking. This is only
+                //! needed by readers used for playback.
+                bool buildIndex = false;
             };
 
             //! This class provides the interface for reading.
@@ -139,7 +151,30 @@ namespace djv
 
                 ///@}
 
+                //! \name Telemetry
+                ///@{
+
+                //! Get the frame timing telemetry. The telemetry may be
+                //! queried from any thread.
+                const std::shared_ptr<Telemetry>& getTelemetry() const;
+
+                ///@}
+
+                //! \name Callback
+                ///@{
+
+                //! Set a function that is called from the I/O thread when the
+                //! information is available or the video queue has new frames
+                //! or is finished. The function must be thread safe.
+                void setCallback(const std::function<void()>&);
+
+                ///@}
+
             protected:
+                //! Call the callback. This should not be called with the mutex
+                //! locked.
+                void _notify();
+
                 ReadOptions _options;
                 InOutPoints _inOutPoints;
                 Direction _direction = Direction::Forward;
@@ -151,6 +186,11 @@ namespace djv
                 Math::Frame::Sequence _cacheSequence;
                 Math::Frame::Sequence _cachedFrames;
                 Cache _cache;
+                std::shared_ptr<Telemetry> _telemetry;
+
+            private:
+                std::mutex _callbackMutex;
+                std::function<void()> _callback;
             };
 
             //! This class provides options for writing.
@@ -223,6 +263,15 @@ namespace djv
                 //! - std::exception
                 virtual std::shared_ptr<IRead> read(const System::File::Info&, const ReadOptions&) const;
 
+                //! Get the file information without reading any images. This
+                //! is synchronous and may be called from any thread. The
+                //! default implementation opens a reader, plugins override it
+                //! to only read the file header.
+                //!
+                //! Throws:
+                //! - std::exception
+                virtual Info probe(const System::File::Info&) const;
+
                 ///@}
 
                 //! \name Write
@@ -244,6 +293,40 @@ namespace djv
                 std::set<std::string> _fileExtensions;
             };
 
+            //! This struct provides a file magic number, the bytes at the
+            //! given offset that identify a file format.
+            struct FileMagic
+            {
+                FileMagic();
+                FileMagic(const std::string& bytes, size_t offset = 0, bool whitespace = false);
+
+                std::string bytes;
+                size_t      offset      = 0;
+
+                //! Require a whitespace character after the bytes. This is
+                //! used for the short tokens that start text headers.
+                bool        whitespace  = false;
+            };
+
+            //! This struct provides a description of an I/O plugin. Plugins
+            //! are registered with their description and only created when
+            //! they are first used.
+            struct PluginDescriptor
+            {
+                std::string                 pluginName;
+                std::set<std::string>       fileExtensions;
+                bool                        sequence        = false;
+                std::vector<FileMagic>      fileMagic;
+                std::function<std::shared_ptr<IPlugin>(const std::shared_ptr<System::Context>&)> create;
+
+                //! Get whether the file extension matches.
+                bool matchFileExtension(const System::File::Info&) const;
+
+                //! Get whether the start of a file matches one of the magic
+                //! numbers.
+                bool matchFileMagic(const uint8_t*, size_t) const;
+            };
+
         } // namespace IO
     } // namespace AV
 } // namespace djv
@@ -43,6 +43,11 @@ namespace djv
                 return _cacheMaxByteCount;
             }
 
+            inline const std::shared_ptr<Telemetry>& IRead::getTelemetry() const
+            {
+                return _telemetry;
+            }
+
             inline const std::string& IPlugin::getPluginName() const
             {
                 return _pluginName;
@@ -33,11 +33,22 @@
 
 #include <djvSystem/Context.h>
 #include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/LogSystem.h>
 #include <djvSystem/TextSystem.h>
+#include <djvSystem/Trace.h>
 
+#include <djvCore/Cache.h>
 #include <djvCore/StringFormat.h>
 #include <djvCore/StringFunc.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+
 using namespace djv::Core;
 
 namespace djv
@@ -46,13 +57,107 @@ namespace djv
     {
         namespace IO
         {
+            namespace
+            {
+                //! The number of bytes read from the start of a file to check
+                //! the magic numbers.
+                const size_t fileMagicSize = 64;
+
+                const size_t probeCacheMax = 10000;
+
+                //! This struct provides a probe cache item.
+                struct ProbeCacheItem
+                {
+                    time_t time = 0;
+                    Info   info;
+                };
+
+                //! This struct provides a batch of files to probe. The files
+                //! are shared out by the index, so any number of threads can
+                //! work on the batch.
+                struct ProbeBatch
+                {
+                    const std::vector<System::File::Info>* fileInfos = nullptr;
+                    std::vector<std::promise<Info> >* promises = nullptr;
+                    size_t size = 0;
+                    std::atomic<size_t> index;
+                    size_t workers = 0;
+                };
+
+                void probeBatch(IOSystem& system, ProbeBatch& batch)
+                {
+                    for (size_t i = batch.index++; i < batch.size; i = batch.index++)
+                    {
+                        try
+                        {
+                            (*batch.promises)[i].set_value(system.probe((*batch.fileInfos)[i]));
+                        }
+                        catch (const std::exception&)
+                        {
+                            (*batch.promises)[i].set_exception(std::current_exception());
+                        }
+                    }
+                }
+
+                std::vector<uint8_t> readFileMagic(const System::File::Info& fileInfo)
+                {
+                    std::vector<uint8_t> out;
+                    try
+                    {
+                        const auto& sequence = fileInfo.getSequence();
+                        auto io = System::File::IO::create();
+                        io->open(
+                            fileInfo.getFileName(sequence.getFrameCount() > 0 ? sequence.getFrame(0) : Math::Frame::invalid),
+                            System::File::Mode::Read);
+                        out.resize(std::min(fileMagicSize, io->getSize()));
+                        if (out.size() > 0)
+                        {
+                            io->read(out.data(), out.size());
+                        }
+                    }
+                    catch (const std::exception&)
+                    {
+                        out.clear();
+                    }
+                    return out;
+                }
+
+            } // namespace
+
             struct IOSystem::Private
             {
+                std::weak_ptr<System::Context> context;
+                std::shared_ptr<System::LogSystem> logSystem;
                 std::shared_ptr<System::TextSystem> textSystem;
                 std::shared_ptr<Observer::ValueSubject<bool> > optionsChanged;
+                std::map<std::string, PluginDescriptor> descriptors;
                 std::map<std::string, std::shared_ptr<IPlugin> > plugins;
+                std::map<std::string, rapidjson::Document> pendingOptions;
                 std::set<std::string> sequenceExtensions;
                 std::set<std::string> nonSequenceExtensions;
+                std::mutex mutex;
+                Memory::Cache<std::string, ProbeCacheItem> probeCache;
+                std::mutex probeCacheMutex;
+
+                // The batches are probed by a pool of threads that is created
+                // on first use, instead of starting threads for each batch.
+                std::vector<std::thread> probeThreads;
+                std::list<ProbeBatch*> probeBatches;
+                std::mutex probeMutex;
+                std::condition_variable probeCV;
+                std::condition_variable probeFinishedCV;
+                bool probeRunning = true;
+
+                void addDescriptor(
+                    const std::string& pluginName,
+                    const std::set<std::string>& fileExtensions,
+                    bool sequence,
+                    const std::vector<FileMagic>& fileMagic,
+                    const std::function<std::shared_ptr<IPlugin>(const std::shared_ptr<System::Context>&)>& create);
+
+                const PluginDescriptor* findDescriptor(const System::File::Info&) const;
+                std::vector<const PluginDescriptor*> findDescriptors(const System::File::Info&) const;
+                const PluginDescriptor* findDescriptor(const std::vector<uint8_t>& fileMagic) const;
             };
 
             void IOSystem::_init(const std::shared_ptr<System::Context>& context)
@@ -63,51 +168,137 @@ namespace djv
 
                 addDependency(GL::GLFW::GLFWSystem::create(context));
 
+                p.context = context;
+                p.logSystem = context->getSystemT<System::LogSystem>();
                 p.textSystem = context->getSystemT<System::TextSystem>();
 
                 p.optionsChanged = Observer::ValueSubject<bool>::create();
 
-                p.plugins[Cineon::pluginName] = Cineon::Plugin::create(context);
-                p.plugins[DPX::pluginName] = DPX::Plugin::create(context);
-                p.plugins[IFF::pluginName] = IFF::Plugin::create(context);
-                p.plugins[PFM::pluginName] = PFM::Plugin::create(context);
-                p.plugins[PPM::pluginName] = PPM::Plugin::create(context);
-                p.plugins[RLA::pluginName] = RLA::Plugin::create(context);
-                p.plugins[SGI::pluginName] = SGI::Plugin::create(context);
-                p.plugins[Targa::pluginName] = Targa::Plugin::create(context);
+                p.probeCache.setMax(probeCacheMax);
+
+                // The plugins are registered with a description and only
+                // created when they are first used.
+                p.addDescriptor(
+                    Cineon::pluginName,
+                    Cineon::fileExtensions,
+                    true,
+                    { FileMagic("\x80\x2a\x5f\xd7"), FileMagic("\xd7\x5f\x2a\x80") },
+                    [](const std::shared_ptr<System::Context>& context) { return Cineon::Plugin::create(context); });
+                p.addDescriptor(
+                    DPX::pluginName,
+                    DPX::fileExtensions,
+                    true,
+                    { FileMagic("SDPX"), FileMagic("XPDS") },
+                    [](const std::shared_ptr<System::Context>& context) { return DPX::Plugin::create(context); });
+                p.addDescriptor(
+                    IFF::pluginName,
+                    IFF::fileExtensions,
+                    true,
+                    { FileMagic("FOR4") },
+                    [](const std::shared_ptr<System::Context>& context) { return IFF::Plugin::create(context); });
+                p.addDescriptor(
+                    PFM::pluginName,
+                    PFM::fileExtensions,
+                    true,
+                    { FileMagic("PF", 0, true), FileMagic("Pf", 0, true) },
+                    [](const std::shared_ptr<System::Context>& context) { return PFM::Plugin::create(context); });
+                p.addDescriptor(
+                    PPM::pluginName,
+                    PPM::fileExtensions,
+                    true,
+                    {
+                        FileMagic("P1", 0, true),
+                        FileMagic("P2", 0, true),
+                        FileMagic("P3", 0, true),
+                        FileMagic("P4", 0, true),
+                        FileMagic("P5", 0, true),
+                        FileMagic("P6", 0, true)
+                    },
+                    [](const std::shared_ptr<System::Context>& context) { return PPM::Plugin::create(context); });
+                p.addDescriptor(
+                    RLA::pluginName,
+                    RLA::fileExtensions,
+                    true,
+                    {},
+                    [](const std::shared_ptr<System::Context>& context) { return RLA::Plugin::create(context); });
+                p.addDescriptor(
+                    SGI::pluginName,
+                    SGI::fileExtensions,
+                    true,
+                    { FileMagic("\x01\xda") },
+                    [](const std::shared_ptr<System::Context>& context) { return SGI::Plugin::create(context); });
+                p.addDescriptor(
+                    Targa::pluginName,
+                    Targa::fileExtensions,
+                    true,
+                    {},
+                    [](const std::shared_ptr<System::Context>& context) { return Targa::Plugin::create(context); });
 #if defined(FFmpeg_FOUND)
-                p.plugins[FFmpeg::pluginName] = FFmpeg::Plugin::create(context);
+                p.addDescriptor(
+                    FFmpeg::pluginName,
+                    FFmpeg::fileExtensions,
+                    false,
+                    {
+                        FileMagic("ftyp", 4),
+                        FileMagic("RIFF"),
+                        FileMagic("\x1a\x45\xdf\xa3"),
+                        FileMagic("ID3"),
+                        FileMagic("OggS"),
+                        FileMagic("fLaC"),
+                        FileMagic("FLV"),
+                        FileMagic("GIF8"),
+                        FileMagic(std::string("\x00\x00\x01\xba", 4)),
+                        FileMagic(std::string("\x00\x00\x01\xb3", 4))
+                    },
+                    [](const std::shared_ptr<System::Context>& context) { return FFmpeg::Plugin::create(context); });
 #endif // FFmpeg_FOUND
 #if defined(JPEG_FOUND)
-                p.plugins[JPEG::pluginName] = JPEG::Plugin::create(context);
+                p.addDescriptor(
+                    JPEG::pluginName,
+                    JPEG::fileExtensions,
+                    true,
+                    { FileMagic("\xff\xd8\xff") },
+                    [](const std::shared_ptr<System::Context>& context) { return JPEG::Plugin::create(context); });
 #endif // JPEG_FOUND
 #if defined(PNG_FOUND)
-                p.plugins[PNG::pluginName] = PNG::Plugin::create(context);
+                p.addDescriptor(
+                    PNG::pluginName,
+                    PNG::fileExtensions,
+                    true,
+                    { FileMagic("\x89PNG\r\n\x1a\n") },
+                    [](const std::shared_ptr<System::Context>& context) { return PNG::Plugin::create(context); });
 #endif // PNG_FOUND
 #if defined(OpenEXR_FOUND)
-                p.plugins[OpenEXR::pluginName] = OpenEXR::Plugin::create(context);
+                p.addDescriptor(
+                    OpenEXR::pluginName,
+                    OpenEXR::fileExtensions,
+                    true,
+                    { FileMagic("\x76\x2f\x31\x01") },
+                    [](const std::shared_ptr<System::Context>& context) { return OpenEXR::Plugin::create(context); });
 #endif // OpenEXR_FOUND
 #if defined(TIFF_FOUND)
-                p.plugins[TIFF::pluginName] = TIFF::Plugin::create(context);
+                p.addDescriptor(
+                    TIFF::pluginName,
+                    TIFF::fileExtensions,
+                    true,
+                    { FileMagic(std::string("II*\0", 4)), FileMagic(std::string("MM\0*", 4)) },
+                    [](const std::shared_ptr<System::Context>& context) { return TIFF::Plugin::create(context); });
 #endif // TIFF_FOUND
 
-                for (const auto& i : p.plugins)
+                for (const auto& i : p.descriptors)
                 {
-                    if (i.second->canSequence())
+                    if (i.second.sequence)
                     {
-                        const auto& fileExtensions = i.second->getFileExtensions();
-                        p.sequenceExtensions.insert(fileExtensions.begin(), fileExtensions.end());
+                        p.sequenceExtensions.insert(i.second.fileExtensions.begin(), i.second.fileExtensions.end());
                     }
                     else
                     {
-                        const auto& fileExtensions = i.second->getFileExtensions();
-                        p.nonSequenceExtensions.insert(fileExtensions.begin(), fileExtensions.end());
+                        p.nonSequenceExtensions.insert(i.second.fileExtensions.begin(), i.second.fileExtensions.end());
                     }
                 
                     std::stringstream ss;
-                    ss << "I/O plugin: " << i.second->getPluginName() << '\n';
-                    ss << "    Information: " << i.second->getPluginInfo() << '\n';
-                    ss << "    File extensions: " << String::joinSet(i.second->getFileExtensions(), ", ") << '\n';
+                    ss << "I/O plugin: " << i.first << '\n';
+                    ss << "    File extensions: " << String::joinSet(i.second.fileExtensions, ", ") << '\n';
                     _log(ss.str());
                 }
 
@@ -119,7 +310,18 @@ namespace djv
             {}
 
             IOSystem::~IOSystem()
-            {}
+            {
+                DJV_PRIVATE_PTR();
+                {
+                    std::lock_guard<std::mutex> lock(p.probeMutex);
+                    p.probeRunning = false;
+                }
+                p.probeCV.notify_all();
+                for (auto& i : p.probeThreads)
+                {
+                    i.join();
+                }
+            }
 
             std::shared_ptr<IOSystem> IOSystem::create(const std::shared_ptr<System::Context>& context)
             {
@@ -136,9 +338,9 @@ namespace djv
             {
                 DJV_PRIVATE_PTR();
                 std::set<std::string> out;
-                for (const auto& i : p.plugins)
+                for (const auto& i : p.descriptors)
                 {
-                    out.insert(i.second->getPluginName());
+                    out.insert(i.first);
                 }
                 return out;
             }
@@ -147,10 +349,67 @@ namespace djv
             {
                 DJV_PRIVATE_PTR();
                 std::set<std::string> out;
+                for (const auto& i : p.descriptors)
+                {
+                    out.insert(i.second.fileExtensions.begin(), i.second.fileExtensions.end());
+                }
+                return out;
+            }
+
+            std::set<std::string> IOSystem::getLoadedPluginNames() const
+            {
+                DJV_PRIVATE_PTR();
+                std::lock_guard<std::mutex> lock(p.mutex);
+                std::set<std::string> out;
                 for (const auto& i : p.plugins)
                 {
-                    const auto& fileExtensions = i.second->getFileExtensions();
-                    out.insert(fileExtensions.begin(), fileExtensions.end());
+                    out.insert(i.first);
+                }
+                return out;
+            }
+
+            std::shared_ptr<IPlugin> IOSystem::getPlugin(const std::string& pluginName) const
+            {
+                DJV_PRIVATE_PTR();
+                std::shared_ptr<IPlugin> out;
+                const auto i = p.descriptors.find(pluginName);
+                if (i != p.descriptors.end())
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    const auto j = p.plugins.find(pluginName);
+                    if (j != p.plugins.end())
+                    {
+                        out = j->second;
+                    }
+                    else if (auto context = p.context.lock())
+                    {
+                        {
+                            System::Trace::Scope scope(_getTrace(), pluginName, "plugin");
+                            out = i->second.create(context);
+                        }
+                        p.plugins[pluginName] = out;
+
+                        const auto k = p.pendingOptions.find(pluginName);
+                        if (k != p.pendingOptions.end())
+                        {
+                            try
+                            {
+                                out->setOptions(k->second);
+                            }
+                            catch (const std::exception& e)
+                            {
+                                std::stringstream ss;
+                                ss << pluginName << ": " << e.what();
+                                p.logSystem->log(getSystemName(), ss.str(), System::LogLevel::Error);
+                            }
+                            p.pendingOptions.erase(k);
+                        }
+
+                        std::stringstream ss;
+                        ss << "Loaded I/O plugin: " << out->getPluginName() << '\n';
+                        ss << "    Information: " << out->getPluginInfo();
+                        p.logSystem->log(getSystemName(), ss.str());
+                    }
                 }
                 return out;
             }
@@ -158,10 +417,18 @@ namespace djv
             rapidjson::Value IOSystem::getOptions(const std::string& pluginName, rapidjson::Document::AllocatorType& allocator) const
             {
                 DJV_PRIVATE_PTR();
-                const auto i = p.plugins.find(pluginName);
-                if (i != p.plugins.end())
                 {
-                    return i->second->getOptions(allocator);
+                    // Return the pending options without creating the plugin.
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    const auto i = p.pendingOptions.find(pluginName);
+                    if (i != p.pendingOptions.end())
+                    {
+                        return rapidjson::Value(i->second, allocator);
+                    }
+                }
+                if (auto plugin = getPlugin(pluginName))
+                {
+                    return plugin->getOptions(allocator);
                 }
                 return rapidjson::Value();
             }
@@ -169,10 +436,31 @@ namespace djv
             void IOSystem::setOptions(const std::string& pluginName, const rapidjson::Value& value)
             {
                 DJV_PRIVATE_PTR();
-                const auto i = p.plugins.find(pluginName);
-                if (i != p.plugins.end())
+                if (p.descriptors.find(pluginName) != p.descriptors.end())
                 {
-                    i->second->setOptions(value);
+                    std::shared_ptr<IPlugin> plugin;
+                    {
+                        std::lock_guard<std::mutex> lock(p.mutex);
+                        const auto i = p.plugins.find(pluginName);
+                        if (i != p.plugins.end())
+                        {
+                            plugin = i->second;
+                        }
+                        else
+                        {
+                            // Keep the options until the plugin is created.
+                            p.pendingOptions[pluginName].CopyFrom(value, p.pendingOptions[pluginName].GetAllocator());
+                        }
+                    }
+                    if (plugin)
+                    {
+                        plugin->setOptions(value);
+                    }
+                    {
+                        // The options may change the file information.
+                        std::lock_guard<std::mutex> lock(p.probeCacheMutex);
+                        p.probeCache.clear();
+                    }
                     p.optionsChanged->setAlways(true);
                 }
             }
@@ -204,27 +492,23 @@ namespace djv
             bool IOSystem::canRead(const System::File::Info& fileInfo) const
             {
                 DJV_PRIVATE_PTR();
-                for (const auto& i : p.plugins)
+                bool out = p.findDescriptor(fileInfo) != nullptr;
+                if (!out && fileInfo.getPath().getExtension().empty())
                 {
-                    if (i.second->canRead(fileInfo))
-                    {
-                        return true;
-                    }
+                    // Only files without an extension are sniffed so that
+                    // directory listings don't open every file.
+                    out = p.findDescriptor(readFileMagic(fileInfo)) != nullptr;
                 }
-                return false;
+                return out;
             }
 
             std::shared_ptr<IRead> IOSystem::read(const System::File::Info& fileInfo, const ReadOptions& options)
             {
                 DJV_PRIVATE_PTR();
                 std::shared_ptr<IRead> out;
-                for (const auto& i : p.plugins)
+                if (auto plugin = _getReadPlugin(fileInfo))
                 {
-                    if (i.second->canRead(fileInfo))
-                    {
-                        out = i.second->read(fileInfo, options);
-                        break;
-                    }
+                    out = plugin->read(fileInfo, options);
                 }
                 if (!out)
                 {
@@ -235,29 +519,186 @@ namespace djv
                 return out;
             }
 
+            Info IOSystem::probe(const System::File::Info& fileInfo)
+            {
+                DJV_PRIVATE_PTR();
+                const std::string fileName = fileInfo.getFileName();
+                const time_t time = fileInfo.getTime();
+                {
+                    std::lock_guard<std::mutex> lock(p.probeCacheMutex);
+                    ProbeCacheItem item;
+                    if (p.probeCache.get(fileName, item) && item.time == time)
+                    {
+                        return item.info;
+                    }
+                }
+                auto plugin = _getReadPlugin(fileInfo);
+                if (!plugin)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(fileName).
+                        arg(p.textSystem->getText(DJV_TEXT("error_file_read"))));
+                }
+                ProbeCacheItem item;
+                item.time = time;
+                item.info = plugin->probe(fileInfo);
+                {
+                    std::lock_guard<std::mutex> lock(p.probeCacheMutex);
+                    p.probeCache.add(fileName, item);
+                }
+                return item.info;
+            }
+
+            std::vector<std::future<Info> > IOSystem::probe(const std::vector<System::File::Info>& fileInfos)
+            {
+                DJV_PRIVATE_PTR();
+                const size_t size = fileInfos.size();
+                std::vector<std::promise<Info> > promises(size);
+                std::vector<std::future<Info> > out;
+                out.reserve(size);
+                for (auto& i : promises)
+                {
+                    out.push_back(i.get_future());
+                }
+
+                // Share the batch with the pool, the calling thread also
+                // works on it.
+                ProbeBatch batch;
+                batch.fileInfos = &fileInfos;
+                batch.promises = &promises;
+                batch.size = size;
+                batch.index = 0;
+                if (size > 1)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(p.probeMutex);
+                        if (p.probeThreads.empty())
+                        {
+                            _startProbeThreads();
+                        }
+                        p.probeBatches.push_back(&batch);
+                    }
+                    p.probeCV.notify_all();
+                }
+                probeBatch(*this, batch);
+
+                // Wait for the pool threads to finish with the batch.
+                {
+                    std::unique_lock<std::mutex> lock(p.probeMutex);
+                    const auto i = std::find(p.probeBatches.begin(), p.probeBatches.end(), &batch);
+                    if (i != p.probeBatches.end())
+                    {
+                        p.probeBatches.erase(i);
+                    }
+                    p.probeFinishedCV.wait(
+                        lock,
+                        [&batch]
+                        {
+                            return 0 == batch.workers;
+                        });
+                }
+                return out;
+            }
+
+            void IOSystem::_startProbeThreads()
+            {
+                DJV_PRIVATE_PTR();
+                // The calling thread also probes, so one less thread is used.
+                const size_t threadCount = std::max(std::thread::hardware_concurrency(), 2U) - 1;
+                for (size_t i = 0; i < threadCount; ++i)
+                {
+                    p.probeThreads.push_back(std::thread(
+                        [this]
+                        {
+                            DJV_PRIVATE_PTR();
+                            while (true)
+                            {
+                                ProbeBatch* batch = nullptr;
+                                {
+                                    std::unique_lock<std::mutex> lock(p.probeMutex);
+                                    p.probeCV.wait(
+                                        lock,
+                                        [this]
+                                        {
+                                            return _p->probeBatches.size() || !_p->probeRunning;
+                                        });
+                                    if (!p.probeRunning)
+                                    {
+                                        break;
+                                    }
+                                    batch = p.probeBatches.front();
+                                    if (batch->index >= batch->size)
+                                    {
+                                        p.probeBatches.pop_front();
+                                        continue;
+                                    }
+                                    ++batch->workers;
+                                }
+                                probeBatch(*this, *batch);
+                                {
+                                    std::lock_guard<std::mutex> lock(p.probeMutex);
+                                    const auto i = std::find(p.probeBatches.begin(), p.probeBatches.end(), batch);
+                                    if (i != p.probeBatches.end())
+                                    {
+                                        p.probeBatches.erase(i);
+                                    }
+                                    --batch->workers;
+                                }
+                                p.probeFinishedCV.notify_all();
+                            }
+                        }));
+                }
+            }
+
+            std::shared_ptr<IPlugin> IOSystem::_getReadPlugin(const System::File::Info& fileInfo) const
+            {
+                DJV_PRIVATE_PTR();
+                const std::vector<const PluginDescriptor*> descriptors = p.findDescriptors(fileInfo);
+                const PluginDescriptor* descriptor = descriptors.size() ? descriptors[0] : nullptr;
+                if (descriptors.empty() && fileInfo.getPath().getExtension().empty())
+                {
+                    descriptor = p.findDescriptor(readFileMagic(fileInfo));
+                }
+                else if (descriptors.size() > 1)
+                {
+                    // The extension matches more than one plugin.
+                    const std::vector<uint8_t> fileMagic = readFileMagic(fileInfo);
+                    for (const auto i : descriptors)
+                    {
+                        if (i->matchFileMagic(fileMagic.data(), fileMagic.size()))
+                        {
+                            descriptor = i;
+                            break;
+                        }
+                    }
+                }
+                return descriptor ? getPlugin(descriptor->pluginName) : nullptr;
+            }
+
             bool IOSystem::canWrite(const System::File::Info& fileInfo, const Info& info) const
             {
                 DJV_PRIVATE_PTR();
-                for (const auto& i : p.plugins)
+                bool out = false;
+                if (const PluginDescriptor* descriptor = p.findDescriptor(fileInfo))
                 {
-                    if (i.second->canWrite(fileInfo, info))
+                    if (auto plugin = getPlugin(descriptor->pluginName))
                     {
-                        return true;
+                        out = plugin->canWrite(fileInfo, info);
                     }
                 }
-                return false;
+                return out;
             }
 
             std::shared_ptr<IWrite> IOSystem::write(const System::File::Info& fileInfo, const Info& info, const WriteOptions& options)
             {
                 DJV_PRIVATE_PTR();
                 std::shared_ptr<IWrite> out;
-                for (const auto& i : p.plugins)
+                if (const PluginDescriptor* descriptor = p.findDescriptor(fileInfo))
                 {
-                    if (i.second->canWrite(fileInfo, info))
+                    auto plugin = getPlugin(descriptor->pluginName);
+                    if (plugin && plugin->canWrite(fileInfo, info))
                     {
-                        out = i.second->write(fileInfo, info, options);
-                        break;
+                        out = plugin->write(fileInfo, info, options);
                     }
                 }
                 if (!out)
@@ -269,6 +710,59 @@ namespace djv
                 return out;
             }
 
+            void IOSystem::Private::addDescriptor(
+                const std::string& pluginName,
+                const std::set<std::string>& fileExtensions,
+                bool sequence,
+                const std::vector<FileMagic>& fileMagic,
+                const std::function<std::shared_ptr<IPlugin>(const std::shared_ptr<System::Context>&)>& create)
+            {
+                PluginDescriptor descriptor;
+                descriptor.pluginName     = pluginName;
+                descriptor.fileExtensions = fileExtensions;
+                descriptor.sequence       = sequence;
+                descriptor.fileMagic      = fileMagic;
+                descriptor.create         = create;
+                descriptors[pluginName]   = descriptor;
+            }
+
+            const PluginDescriptor* IOSystem::Private::findDescriptor(const System::File::Info& fileInfo) const
+            {
+                for (const auto& i : descriptors)
+                {
+                    if (i.second.matchFileExtension(fileInfo))
+                    {
+                        return &i.second;
+                    }
+                }
+                return nullptr;
+            }
+
+            std::vector<const PluginDescriptor*> IOSystem::Private::findDescriptors(const System::File::Info& fileInfo) const
+            {
+                std::vector<const PluginDescriptor*> out;
+                for (const auto& i : descriptors)
+                {
+                    if (i.second.matchFileExtension(fileInfo))
+                    {
+                        out.push_back(&i.second);
+                    }
+                }
+                return out;
+            }
+
+            const PluginDescriptor* IOSystem::Private::findDescriptor(const std::vector<uint8_t>& fileMagic) const
+            {
+                for (const auto& i : descriptors)
+                {
+                    if (i.second.matchFileMagic(fileMagic.data(), fileMagic.size()))
+                    {
+                        return &i.second;
+                    }
+                }
+                return nullptr;
+            }
+
         } // namespace IO
     } // namespace AV
 } // namespace djv
@@ -17,6 +17,12 @@ namespace djv
         namespace IO
         {
             //! This class provides an I/O system.
+            //!
+            //! The plugins are registered with a description (name, file
+            //! extensions, and magic numbers) and are only created when they
+            //! are first used. Files are dispatched by extension, and by the
+            //! magic numbers at the start of the file when the extension is
+            //! missing or matches more than one plugin.
             class IOSystem : public System::ISystem
             {
                 DJV_NON_COPYABLE(IOSystem);
@@ -36,6 +42,13 @@ namespace djv
                 std::set<std::string> getPluginNames() const;
                 std::set<std::string> getFileExtensions() const;
 
+                //! Get the names of the plugins that have been created.
+                std::set<std::string> getLoadedPluginNames() const;
+
+                //! Get a plugin, creating it if necessary. This function is
+                //! thread safe.
+                std::shared_ptr<IPlugin> getPlugin(const std::string& pluginName) const;
+
                 ///@}
 
                 //! \name Options
@@ -63,12 +76,30 @@ namespace djv
                 //! \name Read
                 ///@{
 
+                //! Get whether a file can be read. Files without an extension
+                //! are checked for magic numbers.
                 bool canRead(const System::File::Info&) const;
 
                 //! Throws:
                 //! - std::exception
                 std::shared_ptr<IRead> read(const System::File::Info&, const ReadOptions& = ReadOptions());
 
+                //! Get the file information without reading any images. This
+                //! may be called from any thread. The information is cached
+                //! by the file name and modification time.
+                //!
+                //! Throws:
+                //! - std::exception
+                Info probe(const System::File::Info&);
+
+                //! Get the file information for multiple files. The files are
+                //! probed in parallel by a pool of threads owned by the system
+                //! and the futures are ready when this
+                //! function returns, an error for one file is set on its future
+                //! and does not stop the others. This may be called from any
+                //! thread.
+                std::vector<std::future<Info> > probe(const std::vector<System::File::Info>&);
+
                 ///@}
 
                 //! \name Write
@@ -83,6 +114,13 @@ namespace djv
                 ///@}
 
             private:
+                //! Get the plugin for reading a file. The file extension is
+                //! used, the magic numbers are only read when the file has no
+                //! extension or the extension matches more than one plugin.
+                std::shared_ptr<IPlugin> _getReadPlugin(const System::File::Info&) const;
+
+                void _startProbeThreads();
+
                 DJV_PRIVATE();
             };
 
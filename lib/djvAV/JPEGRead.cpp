@@ -78,10 +78,19 @@ namespace djv
                     return out;
                 }
 
-                Info Read::_readInfo(const std::string& fileName)
+                Info Read::readInfo(
+                    const std::string& fileName,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
                     auto f = File::create();
-                    return _open(fileName, f);
+                    return _open(fileName, f, speed, sequence, textSystem);
+                }
+
+                Info Read::_readInfo(const std::string& fileName)
+                {
+                    return readInfo(fileName, _speed, _sequence, _textSystem);
                 }
 
                 namespace
@@ -121,7 +130,7 @@ namespace djv
                 {
                     // Open the file.
                     auto f = File::create();
-                    const auto info = _open(fileName, f);
+                    const auto info = _open(fileName, f, _speed, _sequence, _textSystem);
 
                     // Read the file.
                     auto out = Image::Data::create(info.video[0]);
@@ -204,7 +213,12 @@ namespace djv
 
                 } // namespace
 
-                Info Read::_open(const std::string& fileName, const std::shared_ptr<File>& f)
+                Info Read::_open(
+                    const std::string& fileName,
+                    const std::shared_ptr<File>& f,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
                     f->jpeg.err = jpeg_std_error(&f->jpegError.pub);
                     f->jpegError.pub.error_exit = djvJPEGError;
@@ -214,7 +228,7 @@ namespace djv
                         std::vector<std::string> messages;
                         messages.push_back(String::Format("{0}: {1}").
                             arg(fileName).
-                            arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
+                            arg(textSystem->getText(DJV_TEXT("error_file_open"))));
                         for (const auto& i : f->jpegError.messages)
                         {
                             messages.push_back(i);
@@ -227,14 +241,14 @@ namespace djv
                     {
                         throw System::File::Error(String::Format("{0}: {1}").
                             arg(fileName).
-                            arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
+                            arg(textSystem->getText(DJV_TEXT("error_file_open"))));
                     }
                     if (!jpegOpen(f->f, &f->jpeg, &f->jpegError))
                     {
                         std::vector<std::string> messages;
                         messages.push_back(String::Format("{0}: {1}").
                             arg(fileName).
-                            arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
+                            arg(textSystem->getText(DJV_TEXT("error_file_open"))));
                         for (const auto& i : f->jpegError.messages)
                         {
                             messages.push_back(i);
@@ -247,12 +261,12 @@ namespace djv
                     {
                         throw System::File::Error(String::Format("{0}: {1}").
                             arg(fileName).
-                            arg(_textSystem->getText(DJV_TEXT("error_unsupported_color_components"))));
+                            arg(textSystem->getText(DJV_TEXT("error_unsupported_color_components"))));
                     }
                     Info info;
                     info.fileName = fileName;
-                    info.videoSpeed = _speed;
-                    info.videoSequence = _sequence;
+                    info.videoSpeed = speed;
+                    info.videoSequence = sequence;
                     info.video.push_back(Image::Info(f->jpeg.output_width, f->jpeg.output_height, imageType));
 
                     const jpeg_saved_marker_ptr marker = f->jpeg.marker_list;
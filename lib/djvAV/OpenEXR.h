@@ -136,13 +136,30 @@ namespace djv
                         const std::shared_ptr<System::ResourceSystem>&,
                         const std::shared_ptr<System::LogSystem>&);
 
+                    //! Read the file information from the header without creating
+                    //! a reader.
+                    //! Throws:
+                    //! - System::File::Error
+                    static Info readInfo(
+                        const std::string& fileName,
+                        const Math::IntRational& speed,
+                        const Math::Frame::Sequence&,
+                        const Options&,
+                        const std::shared_ptr<System::TextSystem>&);
+
                 protected:
                     Info _readInfo(const std::string& fileName) override;
                     std::shared_ptr<Image::Data> _readImage(const std::string& fileName) override;
 
                 private:
                     struct File;
-                    Info _open(const std::string&, File&);
+                    static Info _open(
+                        const std::string&,
+                        File&,
+                        const Math::IntRational&,
+                        const Math::Frame::Sequence&,
+                        const Options&,
+                        const std::shared_ptr<System::TextSystem>&);
 
                     DJV_PRIVATE();
                 };
@@ -193,6 +210,13 @@ namespace djv
                     std::shared_ptr<IRead> read(const System::File::Info&, const ReadOptions&) const override;
                     std::shared_ptr<IWrite> write(const System::File::Info&, const Info&, const WriteOptions&) const override;
 
+                protected:
+                    bool _probe(
+                        const std::string&,
+                        const Math::IntRational&,
+                        const Math::Frame::Sequence&,
+                        Info&) const override;
+
                 private:
                     DJV_PRIVATE();
                 };
@@ -132,16 +132,27 @@ namespace djv
                     return out;
                 }
 
-                Info Read::_readInfo(const std::string& fileName)
+                Info Read::readInfo(
+                    const std::string& fileName,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const Options& options,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
                     File f;
-                    return _open(fileName, f);
+                    return _open(fileName, f, speed, sequence, options, textSystem);
+                }
+
+                Info Read::_readInfo(const std::string& fileName)
+                {
+                    DJV_PRIVATE_PTR();
+                    return readInfo(fileName, _speed, _sequence, p.options, _textSystem);
                 }
 
                 std::shared_ptr<Image::Data> Read::_readImage(const std::string& fileName)
                 {
                     File f;
-                    Info info = _open(fileName, f);
+                    Info info = _open(fileName, f, _speed, _sequence, _p->options, _textSystem);
                     Image::Info imageInfo = info.video[std::min(_options.layer, info.video.size() - 1)];
                     std::shared_ptr<Image::Data> out = Image::Data::create(imageInfo);
                     out->setPluginName(pluginName);
@@ -214,11 +225,17 @@ namespace djv
                     return out;
                 }
 
-                Info Read::_open(const std::string& fileName, File& f)
+                Info Read::_open(
+                    const std::string& fileName,
+                    File& f,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const Options& options,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
-                    DJV_PRIVATE_PTR();
-
                     Info out;
+                    out.videoSequence = sequence;
+                    out.videoSpeed = speed;
 
                     // Open the file.
 #if defined(DJV_MMAP)
@@ -235,13 +252,11 @@ namespace djv
                     f.fast = f.displayWindow == f.dataWindow;
 
                     // Get the tags.
-                    readTags(f.f->header(), out.tags, _speed);
+                    readTags(f.f->header(), out.tags, out.videoSpeed);
 
                     // Get the layers.
-                    f.layers = getLayers(f.f->header().channels(), p.options.channels);
+                    f.layers = getLayers(f.f->header().channels(), options.channels);
                     out.fileName = fileName;
-                    out.videoSequence = _sequence;
-                    out.videoSpeed = _speed;
                     out.video.resize(f.layers.size());
                     for (size_t i = 0; i < f.layers.size(); ++i)
                     {
@@ -269,7 +284,7 @@ namespace djv
                         {
                             throw System::File::Error(String::Format("{0}: {1}").
                                 arg(fileName).
-                                arg(_textSystem->getText(DJV_TEXT("error_unsupported_image_type"))));
+                                arg(textSystem->getText(DJV_TEXT("error_unsupported_image_type"))));
                         }
                     }
 
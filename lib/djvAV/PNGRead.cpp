@@ -177,10 +177,19 @@ namespace djv
 
                 } // namespace
 
-                Info Read::_readInfo(const std::string& fileName)
+                Info Read::readInfo(
+                    const std::string& fileName,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
                     auto f = File::create();
-                    return _open(fileName, f);
+                    return _open(fileName, f, speed, sequence, textSystem);
+                }
+
+                Info Read::_readInfo(const std::string& fileName)
+                {
+                    return readInfo(fileName, _speed, _sequence, _textSystem);
                 }
 
                 namespace
@@ -211,7 +220,7 @@ namespace djv
                 {
                     // Open the file.
                     auto f = File::create();
-                    const auto info = _open(fileName, f);
+                    const auto info = _open(fileName, f, _speed, _sequence, _textSystem);
 
                     // Read the file.
                     auto out = Image::Data::create(info.video[0]);
@@ -245,14 +254,19 @@ namespace djv
                     return out;
                 }
 
-                Info Read::_open(const std::string& fileName, const std::shared_ptr<File>& f)
+                Info Read::_open(
+                    const std::string& fileName,
+                    const std::shared_ptr<File>& f,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
                     if (!f->png)
                     {
                         std::vector<std::string> messages;
                         messages.push_back(String::Format("{0}: {1}").
                             arg(fileName).
-                            arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
+                            arg(textSystem->getText(DJV_TEXT("error_file_open"))));
                         for (const auto& i : f->pngError.messages)
                         {
                             messages.push_back(i);
@@ -263,7 +277,7 @@ namespace djv
                     {
                         throw System::File::Error(String::Format("{0}: {1}").
                             arg(fileName).
-                            arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
+                            arg(textSystem->getText(DJV_TEXT("error_file_open"))));
                     }
                     uint16_t width    = 0;
                     uint16_t height   = 0;
@@ -274,7 +288,7 @@ namespace djv
                         std::vector<std::string> messages;
                         messages.push_back(String::Format("{0}: {1}").
                             arg(fileName).
-                            arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
+                            arg(textSystem->getText(DJV_TEXT("error_file_open"))));
                         for (const auto& i : f->pngError.messages)
                         {
                             messages.push_back(i);
@@ -287,13 +301,13 @@ namespace djv
                     {
                         throw System::File::Error(String::Format("{0}: {1}").
                             arg(fileName).
-                            arg(_textSystem->getText(DJV_TEXT("error_unsupported_image_type"))));
+                            arg(textSystem->getText(DJV_TEXT("error_unsupported_image_type"))));
                     }
 
                     Info info;
                     info.fileName = fileName;
-                    info.videoSpeed = _speed;
-                    info.videoSequence = _sequence;
+                    info.videoSpeed = speed;
+                    info.videoSequence = sequence;
                     info.video.push_back(Image::Info(width, height, imageType));
                     return info;
                 }
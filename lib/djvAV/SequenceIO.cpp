@@ -7,6 +7,7 @@
 #include <djvGL/ImageConvert.h>
 
 #include <djvAV/SpeedFunc.h>
+#include <djvAV/TelemetryFunc.h>
 
 #include <djvSystem/Context.h>
 #include <djvSystem/File.h>
@@ -38,19 +39,57 @@ namespace djv
                 //! \todo Should this be configurable?
                 const double infoTimeout = 0.5;
 
-            } // namespace
+                enum class JobState
+                {
+                    Free,
+                    Pending,
+                    Running,
+                    Finished
+                };
+
+                //! This struct provides an image read by the workers. The
+                //! jobs are re-used so that the file names and results do not
+                //! allocate memory while playing back.
+                struct Job
+                {
+                    JobState state = JobState::Free;
+                    std::string fileName;
+                    std::shared_ptr<Image::Data> image;
+                    FrameTelemetry telemetry;
+                };
 
-            struct ISequenceRead::Future
-            {
-                Math::Frame::Number frame = Math::Frame::invalid;
-                std::shared_ptr<Image::Data> image;
-            };
+            } // namespace
 
             struct ISequenceRead::Private
             {
                 Math::Frame::Number frame = Math::Frame::invalid;
                 std::promise<Info> infoPromise;
-                std::vector<std::future<Future> > cacheFutures;
+                System::File::NameTemplate nameTemplate;
+
+                // These are re-used by the read thread to avoid allocating
+                // memory while playing back.
+                std::string fileName;
+                std::vector<std::pair<Math::Frame::Number, std::shared_ptr<Image::Data> > > images;
+                std::vector<FrameTelemetry> telemetry;
+                Math::Frame::Sequence cacheSequence;
+                Math::Frame::Sequence cachedFrames;
+
+                // The images are read by a pool of worker threads that is
+                // created once, instead of starting a task for each frame.
+                std::vector<std::thread> workers;
+                std::vector<Job> jobs;
+                // Pending queue jobs are started before pending cache jobs,
+                // so a seek or a queue read never waits behind the cache.
+                std::vector<size_t> pendingQueueJobs;
+                std::vector<size_t> pendingCacheJobs;
+                bool workersRunning = false;
+                std::mutex jobMutex;
+                std::condition_variable jobCV;
+                std::condition_variable jobFinishedCV;
+                std::vector<size_t> queueJobs;
+                std::vector<size_t> cacheJobs;
+
+                uint64_t cacheVersion = 0;
                 std::condition_variable queueCV;
                 Direction direction = Direction::Forward;
                 Math::Frame::Number seek = Math::Frame::invalid;
@@ -77,6 +116,7 @@ namespace djv
                     // Get the sequence.
                     size_t sequenceFrameCount = 0;
                     p.frame = Math::Frame::invalid;
+                    p.nameTemplate = _fileInfo.getNameTemplate();
                     if (System::File::Type::Sequence == _fileInfo.getType())
                     {
                         _sequence = _fileInfo.getSequence();
@@ -100,6 +140,7 @@ namespace djv
                         info = _readInfo(fileName);
                         info.fileName = _fileInfo.getFileName();
                         p.infoPromise.set_value(info);
+                        _notify();
                     }
                     catch (const std::exception&)
                     {
@@ -112,6 +153,7 @@ namespace djv
                             }
                             p.running = false;
                             p.infoPromise.set_exception(std::current_exception());
+                            _notify();
                         }
                         catch (const std::exception& e)
                         {
@@ -122,38 +164,58 @@ namespace djv
                     // Start looping...
                     p.infoTimer = std::chrono::steady_clock::now();
                     const auto timeout = System::getTimerValue(System::TimerValue::VeryFast);
+                    size_t threadCount = 4;
+                    bool playback = false;
+                    bool loop = false;
+                    InOutPoints inOutPoints;
+                    bool cacheEnabled = false;
+                    size_t cacheMaxByteCount = 0;
+                    bool optionsInit = false;
+                    uint64_t optionsVersion = 0;
                     while (p.running)
                     {
                         // Update the options.
-                        size_t threadCount = 4;
-                        bool playback = false;
-                        bool loop = false;
-                        InOutPoints inOutPoints;
-                        bool cacheEnabled = false;
-                        size_t cacheMaxByteCount = 0;
+                        bool optionsChanged = false;
                         {
                             std::lock_guard<std::mutex> lock(_mutex);
-                            threadCount = _threadCount;
-                            playback = _playback;
-                            loop = _loop;
-                            inOutPoints = _inOutPoints;
-                            cacheEnabled = _cacheEnabled;
-                            cacheMaxByteCount = _cacheMaxByteCount;
+                            if (!optionsInit || _optionsVersion != optionsVersion)
+                            {
+                                optionsInit = true;
+                                optionsVersion = _optionsVersion;
+                                optionsChanged = true;
+                                threadCount = _threadCount;
+                                playback = _playback;
+                                loop = _loop;
+                                inOutPoints = _inOutPoints;
+                                cacheEnabled = _cacheEnabled;
+                                cacheMaxByteCount = _cacheMaxByteCount;
+                            }
                         }
-                        if (!cacheEnabled)
+                        const size_t workerCount = std::max(threadCount, static_cast<size_t>(1));
+                        if (optionsChanged && p.workers.size() != workerCount)
                         {
-                            _cache.clear();
+                            _finishCacheJobs(true);
+                            _stopWorkers();
+                            _startWorkers(workerCount);
                         }
-                        if (info.video.size() && _options.layer < info.video.size())
+                        if (!cacheEnabled)
                         {
-                            const size_t dataByteCount = info.video[_options.layer].getDataByteCount();
-                            _cache.setMax(dataByteCount ? (cacheMaxByteCount / dataByteCount) : 0);
-                            _cache.setSequenceSize(info.videoSequence.getFrameCount());
-                            _cache.setInOutPoints(inOutPoints);
+                            _finishCacheJobs(true);
+                            _cache.clear();
                         }
-                        else
+                        if (optionsChanged)
                         {
-                            _cache.setMax(0);
+                            if (info.video.size() && _options.layer < info.video.size())
+                            {
+                                const size_t dataByteCount = info.video[_options.layer].getDataByteCount();
+                                _cache.setMax(dataByteCount ? (cacheMaxByteCount / dataByteCount) : 0);
+                                _cache.setSequenceSize(info.videoSequence.getFrameCount());
+                                _cache.setInOutPoints(inOutPoints);
+                            }
+                            else
+                            {
+                                _cache.setMax(0);
+                            }
                         }
 
                         // Check to see if there is work to be done.
@@ -208,24 +270,27 @@ namespace djv
                             _readCache(playback ? (threadCount / 2) : threadCount, inOutPoints);
                         }
 
-                        // Update information.
+                        // Update information, the cache information is only
+                        // copied when the cache has changed.
                         const auto now = std::chrono::steady_clock::now();
                         std::chrono::duration<double> delta = now - p.infoTimer;
-                        if (delta.count() > infoTimeout)
+                        if (delta.count() > infoTimeout && _cache.getVersion() != p.cacheVersion)
                         {
                             p.infoTimer = now;
+                            p.cacheVersion = _cache.getVersion();
                             size_t cacheByteCount = _cache.getTotalByteCount();
-                            auto cacheSequence = _cache.getSequence();
-                            auto cachedFrames = _cache.getFrames();
+                            p.cacheSequence = _cache.getSequence();
+                            _cache.getFrames(p.cachedFrames);
                             {
                                 std::lock_guard<std::mutex> lock(_mutex);
                                 _cacheByteCount = cacheByteCount;
-                                _cacheSequence = cacheSequence;
-                                _cachedFrames = std::move(cachedFrames);
+                                _cacheSequence = p.cacheSequence;
+                                _cachedFrames = p.cachedFrames;
                             }
                         }
                     }
 
+                    _stopWorkers();
                     p.running = false;
                 });
             }
@@ -288,27 +353,177 @@ namespace djv
                 return std::min(queueMax, threadCount);
             }
 
-            std::future<ISequenceRead::Future> ISequenceRead::_getFuture(Math::Frame::Number i, std::string fileName)
+            void ISequenceRead::_startWorkers(size_t count)
+            {
+                DJV_PRIVATE_PTR();
+                // The queue and the cache each use at most one job per
+                // worker, so there is always a free job.
+                p.jobs.resize(count * 2);
+                p.pendingQueueJobs.reserve(p.jobs.size());
+                p.pendingCacheJobs.reserve(p.jobs.size());
+                p.queueJobs.reserve(p.jobs.size());
+                p.cacheJobs.reserve(p.jobs.size());
+                p.workersRunning = true;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    p.workers.push_back(std::thread(
+                        [this]
+                        {
+                            DJV_PRIVATE_PTR();
+                            while (true)
+                            {
+                                size_t index = 0;
+                                {
+                                    std::unique_lock<std::mutex> lock(p.jobMutex);
+                                    p.jobCV.wait(
+                                        lock,
+                                        [this]
+                                        {
+                                            return
+                                                !_p->workersRunning ||
+                                                _p->pendingQueueJobs.size() ||
+                                                _p->pendingCacheJobs.size();
+                                        });
+                                    if (!p.workersRunning)
+                                    {
+                                        break;
+                                    }
+                                    auto& pending = p.pendingQueueJobs.size() ? p.pendingQueueJobs : p.pendingCacheJobs;
+                                    index = pending.front();
+                                    pending.erase(pending.begin());
+                                    p.jobs[index].state = JobState::Running;
+                                }
+                                _runJob(index);
+                                {
+                                    std::lock_guard<std::mutex> lock(p.jobMutex);
+                                    p.jobs[index].state = JobState::Finished;
+                                }
+                                p.jobFinishedCV.notify_all();
+                            }
+                        }));
+                }
+            }
+
+            void ISequenceRead::_stopWorkers()
+            {
+                DJV_PRIVATE_PTR();
+                {
+                    std::lock_guard<std::mutex> lock(p.jobMutex);
+                    p.workersRunning = false;
+                }
+                p.jobCV.notify_all();
+                for (auto& i : p.workers)
+                {
+                    i.join();
+                }
+                p.workers.clear();
+                p.jobs.clear();
+                p.pendingQueueJobs.clear();
+                p.pendingCacheJobs.clear();
+                p.queueJobs.clear();
+                p.cacheJobs.clear();
+            }
+
+            size_t ISequenceRead::_addJob(Math::Frame::Number frame, const std::string& fileName, bool cache)
+            {
+                DJV_PRIVATE_PTR();
+                size_t out = 0;
+                {
+                    std::lock_guard<std::mutex> lock(p.jobMutex);
+                    for (; p.jobs[out].state != JobState::Free; ++out)
+                        ;
+                    auto& job = p.jobs[out];
+                    job.state = JobState::Pending;
+                    job.fileName = fileName;
+                    job.telemetry = FrameTelemetry();
+                    job.telemetry.frame = frame;
+                    job.telemetry.request = std::chrono::steady_clock::now();
+                    (cache ? p.pendingCacheJobs : p.pendingQueueJobs).push_back(out);
+                }
+                p.jobCV.notify_one();
+                return out;
+            }
+
+            void ISequenceRead::_runJob(size_t index)
+            {
+                auto& job = _p->jobs[index];
+                job.telemetry.ioStart = std::chrono::steady_clock::now();
+                const Time::Duration cpuStart = getThreadCPUTime();
+                try
+                {
+                    job.image = _readImage(job.fileName);
+                }
+                catch (const std::exception& e)
+                {
+                    _logSystem->log(
+                        "djv::AV::ISequenceRead",
+                        String::Format("{0}: {1}").arg(job.fileName).arg(e.what()),
+                        System::LogLevel::Error);
+                }
+                job.telemetry.decodeEnd = std::chrono::steady_clock::now();
+                job.telemetry.cpuTime = getThreadCPUTime() - cpuStart;
+            }
+
+            bool ISequenceRead::_isFinished(const std::vector<size_t>& jobs) const
             {
-                return std::async(
-                    std::launch::async,
-                    [this, i, fileName]
+                for (const auto i : jobs)
+                {
+                    if (_p->jobs[i].state != JobState::Finished)
                     {
-                        Future out;
-                        out.frame = i;
-                        try
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            bool ISequenceRead::_isCacheJob(Math::Frame::Number frame) const
+            {
+                for (const auto i : _p->cacheJobs)
+                {
+                    if (frame == _p->jobs[i].telemetry.frame)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void ISequenceRead::_finishCacheJobs(bool wait)
+            {
+                DJV_PRIVATE_PTR();
+                std::unique_lock<std::mutex> lock(p.jobMutex);
+                if (wait)
+                {
+                    p.jobFinishedCV.wait(
+                        lock,
+                        [this]
                         {
-                            out.image = _readImage(fileName);
-                        }
-                        catch (const std::exception& e)
+                            return _isFinished(_p->cacheJobs);
+                        });
+                }
+                auto i = p.cacheJobs.begin();
+                while (i != p.cacheJobs.end())
+                {
+                    auto& job = p.jobs[*i];
+                    if (JobState::Finished == job.state)
+                    {
+                        if (job.image)
                         {
-                            _logSystem->log(
-                                "djv::AV::ISequenceRead",
-                                String::Format("{0}: {1}").arg(fileName).arg(e.what()),
-                                System::LogLevel::Error);
+#if defined(DJV_MMAP)
+                            job.image->detach();
+#endif // DJV_MMAP
+                            _cache.add(job.telemetry.frame, job.image);
                         }
-                        return out;
-                    });
+                        _telemetry->addFrame(job.telemetry);
+                        job.image.reset();
+                        job.state = JobState::Free;
+                        i = p.cacheJobs.erase(i);
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
             }
 
             size_t ISequenceRead::_readQueue(size_t count, bool loop, bool cacheEnabled)
@@ -317,14 +532,17 @@ namespace djv
 
                 // Get frames to be added to the queue.
                 const size_t sequenceFrameCount = _sequence.getFrameCount();
-                std::vector<std::pair<Math::Frame::Number, std::shared_ptr<Image::Data> > > images;
-                std::vector<std::future<Future> > futures;
                 for (size_t i = 0; i < count; ++i)
                 {
                     std::shared_ptr<Image::Data> cachedImage;
                     if (cacheEnabled && _cache.get(p.frame, cachedImage))
                     {
-                        images.push_back(std::make_pair(p.frame, cachedImage));
+                        p.images.push_back(std::make_pair(p.frame, cachedImage));
+                        FrameTelemetry cacheTelemetry;
+                        cacheTelemetry.frame = p.frame;
+                        cacheTelemetry.request = std::chrono::steady_clock::now();
+                        cacheTelemetry.cacheHit = true;
+                        p.telemetry.push_back(cacheTelemetry);
                     }
                     else
                     {
@@ -332,15 +550,14 @@ namespace djv
                         {
                             if (p.frame >= 0 && p.frame < sequenceFrameCount)
                             {
-                                const Math::Frame::Number frameNumber = _sequence.getFrame(p.frame);
-                                const std::string fileName = _fileInfo.getFileName(frameNumber);
-                                futures.push_back(_getFuture(p.frame, fileName));
+                                p.nameTemplate.getFileName(_sequence.getFrame(p.frame), p.fileName);
+                                p.queueJobs.push_back(_addJob(p.frame, p.fileName, false));
                             }
                         }
                         else
                         {
-                            const std::string fileName = _fileInfo.getFileName();
-                            futures.push_back(_getFuture(p.frame, fileName));
+                            p.nameTemplate.getFileName(Math::Frame::invalid, p.fileName);
+                            p.queueJobs.push_back(_addJob(p.frame, p.fileName, false));
                         }
                     }
 
@@ -367,31 +584,60 @@ namespace djv
                     }
                 }
 
-                // Get the results.
-                for (auto& future : futures)
+                // Wait for the results.
+                {
+                    std::unique_lock<std::mutex> lock(p.jobMutex);
+                    p.jobFinishedCV.wait(
+                        lock,
+                        [this]
+                        {
+                            return _isFinished(_p->queueJobs);
+                        });
+                    for (const auto i : p.queueJobs)
+                    {
+                        auto& job = p.jobs[i];
+                        p.images.push_back(std::make_pair(job.telemetry.frame, job.image));
+                        p.telemetry.push_back(job.telemetry);
+                        job.image.reset();
+                        job.state = JobState::Free;
+                    }
+                }
+                if (cacheEnabled)
                 {
-                    const auto result = future.get();
-                    images.push_back(std::make_pair(result.frame, result.image));
-                    if (cacheEnabled)
+                    for (size_t i = p.images.size() - p.queueJobs.size(); i < p.images.size(); ++i)
                     {
+                        if (p.images[i].second)
+                        {
 #if defined(DJV_MMAP)
-                        result.image->detach();
+                            p.images[i].second->detach();
 #endif // DJV_MMAP
-                        _cache.add(result.frame, result.image);
+                            _cache.add(p.images[i].first, p.images[i].second);
+                        }
                     }
                 }
 
                 // Add the frames to the queue.
+                size_t enqueueCount = 0;
                 {
                     std::lock_guard<std::mutex> lock(_mutex);
-                    for (const auto& i : images)
+                    for (const auto& i : p.images)
                     {
                         if (_videoQueue.getCount() >= _videoQueue.getMax())
                         {
                             break;
                         }
                         _videoQueue.addFrame(VideoFrame(i.first, i.second));
+                        ++enqueueCount;
+                    }
+                }
+                const auto enqueue = std::chrono::steady_clock::now();
+                for (size_t i = 0; i < p.telemetry.size(); ++i)
+                {
+                    if (i < enqueueCount)
+                    {
+                        p.telemetry[i].enqueue = enqueue;
                     }
+                    _telemetry->addFrame(p.telemetry[i]);
                 }
 
                 if (Math::Frame::invalid == p.frame || p.frame < 0 || p.frame >= static_cast<Math::Frame::Number>(sequenceFrameCount))
@@ -399,8 +645,15 @@ namespace djv
                     std::lock_guard<std::mutex> lock(_mutex);
                     _videoQueue.setFinished(true);
                 }
-
-                return futures.size();
+                _notify();
+
+                // Clear the scratch containers, this keeps their capacity but
+                // releases the images.
+                const size_t out = p.queueJobs.size();
+                p.images.clear();
+                p.telemetry.clear();
+                p.queueJobs.clear();
+                return out;
             }
 
             void ISequenceRead::_readCache(size_t count, const AV::IO::InOutPoints& inOutPoints)
@@ -436,12 +689,12 @@ namespace djv
                             }
                         }
                         const size_t max = std::min(_cache.getMax(), sequenceFrameCount);
-                        for (size_t i = 0; i < max && p.cacheFutures.size() < count; ++i)
+                        for (size_t i = 0; i < max && p.cacheJobs.size() < count; ++i)
                         {
-                            if (!_cache.contains(frame))
+                            if (!_cache.contains(frame) && !_isCacheJob(frame))
                             {
-                                const std::string fileName = _fileInfo.getFileName(_sequence.getFrame(frame));
-                                p.cacheFutures.push_back(_getFuture(frame, fileName));
+                                p.nameTemplate.getFileName(_sequence.getFrame(frame), p.fileName);
+                                p.cacheJobs.push_back(_addJob(frame, p.fileName, true));
                             }
                             ++frame;
                             if (frame > range.getMax())
@@ -462,12 +715,12 @@ namespace djv
                             }
                         }
                         const size_t max = std::min(_cache.getMax(), sequenceFrameCount);
-                        for (Math::Frame::Number i = 0; i < max && p.cacheFutures.size() < count; ++i)
+                        for (Math::Frame::Number i = 0; i < max && p.cacheJobs.size() < count; ++i)
                         {
-                            if (!_cache.contains(frame))
+                            if (!_cache.contains(frame) && !_isCacheJob(frame))
                             {
-                                const std::string fileName = _fileInfo.getFileName(_sequence.getFrame(frame));
-                                p.cacheFutures.push_back(_getFuture(frame, fileName));
+                                p.nameTemplate.getFileName(_sequence.getFrame(frame), p.fileName);
+                                p.cacheJobs.push_back(_addJob(frame, p.fileName, true));
                             }
                             --frame;
                             if (frame < range.getMin())
@@ -482,24 +735,7 @@ namespace djv
                 }
 
                 // Get the results.
-                auto i = p.cacheFutures.begin();
-                while (i != p.cacheFutures.end())
-                {
-                    if (i->valid() &&
-                        i->wait_for(std::chrono::seconds(0)) == std::future_status::ready)
-                    {
-                        const auto result = i->get();
-#if defined(DJV_MMAP)
-                        result.image->detach();
-#endif // DJV_MMAP
-                        _cache.add(result.frame, result.image);
-                        i = p.cacheFutures.erase(i);
-                    }
-                    else
-                    {
-                        ++i;
-                    }
-                }
+                _finishCacheJobs(false);
             }
 
             struct ISequenceWrite::Private
@@ -731,6 +967,39 @@ namespace djv
                 return true;
             }
 
+            Info ISequencePlugin::probe(const System::File::Info& fileInfo) const
+            {
+                Math::Frame::Sequence sequence;
+                Math::Frame::Number frameNumber = Math::Frame::invalid;
+                if (System::File::Type::Sequence == fileInfo.getType())
+                {
+                    sequence = fileInfo.getSequence();
+                    if (sequence.getFrameCount())
+                    {
+                        frameNumber = sequence.getFrame(0);
+                    }
+                }
+                Info out;
+                if (_probe(fileInfo.getFileName(frameNumber), fromSpeed(getDefaultSpeed()), sequence, out))
+                {
+                    out.fileName = fileInfo.getFileName();
+                }
+                else
+                {
+                    out = IPlugin::probe(fileInfo);
+                }
+                return out;
+            }
+
+            bool ISequencePlugin::_probe(
+                const std::string&,
+                const Math::IntRational&,
+                const Math::Frame::Sequence&,
+                Info&) const
+            {
+                return false;
+            }
+
         } // namespace IO
     } // namespace AV
 } // namespace djv
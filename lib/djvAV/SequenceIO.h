@@ -45,8 +45,13 @@ namespace djv
             private:
                 bool _hasWork() const;
                 size_t _getQueueCount(size_t threadCount) const;
-                struct Future;
-                std::future<Future> _getFuture(Math::Frame::Number, std::string fileName);
+                void _startWorkers(size_t);
+                void _stopWorkers();
+                size_t _addJob(Math::Frame::Number, const std::string& fileName, bool cache);
+                void _runJob(size_t);
+                bool _isFinished(const std::vector<size_t>& jobs) const;
+                bool _isCacheJob(Math::Frame::Number) const;
+                void _finishCacheJobs(bool wait);
                 size_t _readQueue(size_t count, bool loop, bool cacheEnabled);
                 void _readCache(size_t count, const AV::IO::InOutPoints&);
 
@@ -93,6 +98,22 @@ namespace djv
                 virtual ~ISequencePlugin() = 0;
 
                 bool canSequence() const override;
+
+                //! The information is read from the header of the first frame
+                //! when the plugin supports it, otherwise a reader is used.
+                Info probe(const System::File::Info&) const override;
+
+            protected:
+                //! Read the information from the header of a file. Returns
+                //! false if the plugin does not support reading the header
+                //! directly.
+                //! Throws:
+                //! - System::File::Error
+                virtual bool _probe(
+                    const std::string& fileName,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence&,
+                    Info&) const;
             };
 
         } // namespace IO
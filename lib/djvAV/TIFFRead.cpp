@@ -59,17 +59,26 @@ namespace djv
                     return out;
                 }
 
-                Info Read::_readInfo(const std::string& fileName)
+                Info Read::readInfo(
+                    const std::string& fileName,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
                     File f;
-                    return _open(fileName, f);
+                    return _open(fileName, f, speed, sequence, textSystem);
+                }
+
+                Info Read::_readInfo(const std::string& fileName)
+                {
+                    return readInfo(fileName, _speed, _sequence, _textSystem);
                 }
 
                 std::shared_ptr<Image::Data> Read::_readImage(const std::string& fileName)
                 {
                     std::shared_ptr<Image::Data> out;
                     File f;
-                    const auto info = _open(fileName, f);
+                    const auto info = _open(fileName, f, _speed, _sequence, _textSystem);
                     out = Image::Data::create(info.video[0]);
                     out->setPluginName(pluginName);
                     for (uint16_t y = 0; y < info.video[0].size.h; ++y)
@@ -92,7 +101,12 @@ namespace djv
                     return out;
                 }
 
-                Info Read::_open(const std::string& fileName, File& f)
+                Info Read::_open(
+                    const std::string& fileName,
+                    File& f,
+                    const Math::IntRational& speed,
+                    const Math::Frame::Sequence& sequence,
+                    const std::shared_ptr<System::TextSystem>& textSystem)
                 {
 #if defined(DJV_PLATFORM_WINDOWS)
                     f.f = TIFFOpen(fileName.data(), "r");
@@ -103,7 +117,7 @@ namespace djv
                     {
                         throw System::File::Error(String::Format("{0}: {1}").
                             arg(fileName).
-                            arg(_textSystem->getText(DJV_TEXT("error_file_open"))));
+                            arg(textSystem->getText(DJV_TEXT("error_file_open"))));
                     }
 
                     uint32   width            = 0;
@@ -154,7 +168,7 @@ namespace djv
                     {
                         throw System::File::Error(String::Format("{0}: {1}").
                             arg(fileName).
-                            arg(_textSystem->getText(DJV_TEXT("error_unsupported_image_type"))));
+                            arg(textSystem->getText(DJV_TEXT("error_unsupported_image_type"))));
                     }
 
                     Image::Layout layout;
@@ -202,8 +216,8 @@ namespace djv
 
                     Info info;
                     info.fileName = fileName;
-                    info.videoSpeed = _speed;
-                    info.videoSequence = _sequence;
+                    info.videoSpeed = speed;
+                    info.videoSequence = sequence;
                     info.video.push_back(Image::Info(width, height, imageType, layout));
                     info.tags = tags;
                     return info;
@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/Telemetry.h>
+
+#include <algorithm>
+#include <atomic>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace
+            {
+                int64_t toInt(const Time::TimePoint& value)
+                {
+                    return std::chrono::duration_cast<std::chrono::nanoseconds>(value.time_since_epoch()).count();
+                }
+
+                Time::TimePoint fromInt(int64_t value)
+                {
+                    return Time::TimePoint(std::chrono::duration_cast<Time::TimePoint::duration>(std::chrono::nanoseconds(value)));
+                }
+
+                Time::Duration getDuration(const Time::TimePoint& start, const Time::TimePoint& end)
+                {
+                    return
+                        start != Time::TimePoint() && end != Time::TimePoint() && end > start ?
+                        std::chrono::duration_cast<Time::Duration>(end - start) :
+                        Time::Duration::zero();
+                }
+
+                //! The slots are versioned like a sequence lock; the version
+                //! is odd while the slot is being written, and otherwise it
+                //! is two times the number of times the slot has been written.
+                struct Slot
+                {
+                    std::atomic<uint64_t> version   { 0 };
+                    std::atomic<int64_t>  frame     { 0 };
+                    std::atomic<int64_t>  request   { 0 };
+                    std::atomic<int64_t>  ioStart   { 0 };
+                    std::atomic<int64_t>  decodeEnd { 0 };
+                    std::atomic<int64_t>  cpuTime   { 0 };
+                    std::atomic<int64_t>  enqueue   { 0 };
+                    std::atomic<int64_t>  present   { 0 };
+                    std::atomic<bool>     cacheHit  { false };
+                };
+
+            } // namespace
+
+            Time::Duration FrameTelemetry::getWaitTime() const
+            {
+                return getDuration(request, ioStart);
+            }
+
+            Time::Duration FrameTelemetry::getDecodeTime() const
+            {
+                return getDuration(ioStart, decodeEnd);
+            }
+
+            Time::Duration FrameTelemetry::getIOWaitTime() const
+            {
+                const Time::Duration decodeTime = getDecodeTime();
+                return decodeTime > cpuTime ? (decodeTime - cpuTime) : Time::Duration::zero();
+            }
+
+            Time::Duration FrameTelemetry::getLatency() const
+            {
+                return getDuration(request, enqueue);
+            }
+
+            Time::Duration FrameTelemetry::getQueueTime() const
+            {
+                return getDuration(enqueue, present);
+            }
+
+            bool FrameTelemetry::operator == (const FrameTelemetry& other) const
+            {
+                return
+                    frame == other.frame &&
+                    request == other.request &&
+                    ioStart == other.ioStart &&
+                    decodeEnd == other.decodeEnd &&
+                    cpuTime == other.cpuTime &&
+                    enqueue == other.enqueue &&
+                    present == other.present &&
+                    cacheHit == other.cacheHit;
+            }
+
+            struct Telemetry::Private
+            {
+                size_t capacity = 0;
+                std::unique_ptr<Slot[]> slots;
+                std::atomic<uint64_t> head { 0 };
+                std::atomic<uint64_t> tail { 0 };
+                std::atomic<size_t> starvationCount { 0 };
+
+                bool readSlot(uint64_t index, FrameTelemetry&) const;
+            };
+
+            void Telemetry::_init(size_t capacity)
+            {
+                DJV_PRIVATE_PTR();
+                p.capacity = std::max(capacity, static_cast<size_t>(1));
+                p.slots.reset(new Slot[p.capacity]);
+            }
+
+            Telemetry::Telemetry() :
+                _p(new Private)
+            {}
+
+            Telemetry::~Telemetry()
+            {}
+
+            std::shared_ptr<Telemetry> Telemetry::create(size_t capacity)
+            {
+                auto out = std::shared_ptr<Telemetry>(new Telemetry);
+                out->_init(capacity);
+                return out;
+            }
+
+            size_t Telemetry::getCapacity() const
+            {
+                return _p->capacity;
+            }
+
+            size_t Telemetry::getFrameCount() const
+            {
+                DJV_PRIVATE_PTR();
+                return p.head.load(std::memory_order_acquire) - p.tail.load(std::memory_order_acquire);
+            }
+
+            size_t Telemetry::getStarvationCount() const
+            {
+                return _p->starvationCount.load(std::memory_order_relaxed);
+            }
+
+            std::vector<FrameTelemetry> Telemetry::getFrames() const
+            {
+                DJV_PRIVATE_PTR();
+                std::vector<FrameTelemetry> out;
+                const uint64_t head = p.head.load(std::memory_order_acquire);
+                const uint64_t tail = std::max(
+                    p.tail.load(std::memory_order_acquire),
+                    head > p.capacity ? head - p.capacity : 0);
+                out.reserve(head - tail);
+                for (uint64_t i = tail; i < head; ++i)
+                {
+                    FrameTelemetry frame;
+                    if (p.readSlot(i, frame))
+                    {
+                        out.push_back(frame);
+                    }
+                }
+                return out;
+            }
+
+            void Telemetry::addFrame(const FrameTelemetry& value)
+            {
+                DJV_PRIVATE_PTR();
+                const uint64_t index = p.head.load(std::memory_order_relaxed);
+                Slot& slot = p.slots[index % p.capacity];
+                const uint64_t version = slot.version.load(std::memory_order_relaxed);
+                slot.version.store(version + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                slot.frame.store(value.frame, std::memory_order_relaxed);
+                slot.request.store(toInt(value.request), std::memory_order_relaxed);
+                slot.ioStart.store(toInt(value.ioStart), std::memory_order_relaxed);
+                slot.decodeEnd.store(toInt(value.decodeEnd), std::memory_order_relaxed);
+                slot.cpuTime.store(value.cpuTime.count(), std::memory_order_relaxed);
+                slot.enqueue.store(toInt(value.enqueue), std::memory_order_relaxed);
+                slot.present.store(toInt(value.present), std::memory_order_relaxed);
+                slot.cacheHit.store(value.cacheHit, std::memory_order_relaxed);
+                slot.version.store(version + 2, std::memory_order_release);
+                p.head.store(index + 1, std::memory_order_release);
+            }
+
+            void Telemetry::setPresent(Math::Frame::Number frame, const Time::TimePoint& value)
+            {
+                DJV_PRIVATE_PTR();
+                const uint64_t head = p.head.load(std::memory_order_acquire);
+                const uint64_t tail = std::max(
+                    p.tail.load(std::memory_order_acquire),
+                    head > p.capacity ? head - p.capacity : 0);
+                for (uint64_t i = head; i > tail; --i)
+                {
+                    Slot& slot = p.slots[(i - 1) % p.capacity];
+                    const uint64_t version = slot.version.load(std::memory_order_acquire);
+                    if (0 == (version & 1) && slot.frame.load(std::memory_order_relaxed) == frame)
+                    {
+                        // Only the first presentation is recorded, and the
+                        // time is dropped if the slot was overwritten in the
+                        // meantime.
+                        int64_t present = 0;
+                        if (slot.present.compare_exchange_strong(present, toInt(value)) &&
+                            slot.version.load(std::memory_order_acquire) != version)
+                        {
+                            slot.present.store(0, std::memory_order_relaxed);
+                        }
+                        break;
+                    }
+                }
+            }
+
+            void Telemetry::addStarvation()
+            {
+                _p->starvationCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void Telemetry::clear()
+            {
+                DJV_PRIVATE_PTR();
+                p.tail.store(p.head.load(std::memory_order_acquire), std::memory_order_release);
+                p.starvationCount.store(0, std::memory_order_relaxed);
+            }
+
+            bool Telemetry::Private::readSlot(uint64_t index, FrameTelemetry& out) const
+            {
+                const Slot& slot = slots[index % capacity];
+                const uint64_t expected = (index / capacity + 1) * 2;
+                const uint64_t version = slot.version.load(std::memory_order_acquire);
+                if (version != expected)
+                {
+                    return false;
+                }
+                out.frame = slot.frame.load(std::memory_order_relaxed);
+                out.request = fromInt(slot.request.load(std::memory_order_relaxed));
+                out.ioStart = fromInt(slot.ioStart.load(std::memory_order_relaxed));
+                out.decodeEnd = fromInt(slot.decodeEnd.load(std::memory_order_relaxed));
+                out.cpuTime = Time::Duration(slot.cpuTime.load(std::memory_order_relaxed));
+                out.enqueue = fromInt(slot.enqueue.load(std::memory_order_relaxed));
+                out.present = fromInt(slot.present.load(std::memory_order_relaxed));
+                out.cacheHit = slot.cacheHit.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return slot.version.load(std::memory_order_relaxed) == expected;
+            }
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
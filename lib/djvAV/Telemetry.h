@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvMath/FrameNumber.h>
+
+#include <djvCore/Core.h>
+#include <djvCore/Time.h>
+
+#include <memory>
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            //! This constant provides the default number of frames kept by
+            //! the telemetry.
+            const size_t telemetryCapacityDefault = 1024;
+
+            //! This struct provides the timing of a video frame through a
+            //! reader. Time points that have not been reached are zero.
+            struct FrameTelemetry
+            {
+                Math::Frame::Number   frame     = Math::Frame::invalid;
+                Core::Time::TimePoint request;   //!< The frame was requested by the read thread
+                Core::Time::TimePoint ioStart;   //!< Reading the file started
+                Core::Time::TimePoint decodeEnd; //!< Reading and decoding the file finished
+                Core::Time::Duration  cpuTime    = Core::Time::Duration::zero(); //!< The CPU time spent reading and decoding
+                Core::Time::TimePoint enqueue;   //!< The frame was added to the video queue
+                Core::Time::TimePoint present;   //!< The frame was displayed
+                bool                  cacheHit   = false;
+
+                //! Get the time between the request and the start of reading.
+                Core::Time::Duration getWaitTime() const;
+
+                //! Get the time spent reading and decoding.
+                Core::Time::Duration getDecodeTime() const;
+
+                //! Get the time spent reading and decoding that was not CPU
+                //! time, which is mostly time spent waiting for I/O.
+                Core::Time::Duration getIOWaitTime() const;
+
+                //! Get the time between the request and adding the frame to
+                //! the video queue.
+                Core::Time::Duration getLatency() const;
+
+                //! Get the time the frame spent in the video queue.
+                Core::Time::Duration getQueueTime() const;
+
+                bool operator == (const FrameTelemetry&) const;
+            };
+
+            //! This struct provides a histogram of durations.
+            struct Histogram
+            {
+                //! The bins hold the durations below 1, 2, 4, 8, ... milliseconds,
+                //! the last bin holds the rest.
+                std::vector<size_t>  bins;
+                size_t               count = 0;
+                Core::Time::Duration min   = Core::Time::Duration::zero();
+                Core::Time::Duration max   = Core::Time::Duration::zero();
+                Core::Time::Duration mean  = Core::Time::Duration::zero();
+                Core::Time::Duration p50   = Core::Time::Duration::zero();
+                Core::Time::Duration p95   = Core::Time::Duration::zero();
+            };
+
+            //! This struct provides aggregate telemetry statistics.
+            struct TelemetryStats
+            {
+                size_t    frameCount      = 0;
+                size_t    cacheHitCount   = 0;
+                size_t    presentCount    = 0;
+                size_t    starvationCount = 0;
+                Histogram wait;
+                Histogram decode;
+                Histogram ioWait;
+                Histogram cpu;
+                Histogram latency;
+                Histogram queue;
+            };
+
+            //! This class provides a ring of frame telemetry for a reader.
+            //!
+            //! The ring is lock free so that it can be updated from the read
+            //! thread and queried from the user interface while playing back.
+            //! Frames are added by a single thread (the read thread), when
+            //! the ring is full the oldest frames are overwritten.
+            class Telemetry
+            {
+                DJV_NON_COPYABLE(Telemetry);
+
+            protected:
+                void _init(size_t capacity);
+                Telemetry();
+
+            public:
+                ~Telemetry();
+
+                static std::shared_ptr<Telemetry> create(size_t capacity = telemetryCapacityDefault);
+
+                //! Get the maximum number of frames kept.
+                size_t getCapacity() const;
+
+                //! Get the number of frames that have been added since the
+                //! telemetry was created or cleared.
+                size_t getFrameCount() const;
+
+                //! Get the number of times the video queue was empty during
+                //! playback.
+                size_t getStarvationCount() const;
+
+                //! Get the frames, oldest first. Frames that are being written
+                //! are skipped.
+                std::vector<FrameTelemetry> getFrames() const;
+
+                //! Add a frame. This function must only be called from one
+                //! thread.
+                void addFrame(const FrameTelemetry&);
+
+                //! Set the time the newest copy of a frame was displayed.
+                //! This function must only be called from one thread.
+                void setPresent(Math::Frame::Number, const Core::Time::TimePoint&);
+
+                //! Count a starvation.
+                void addStarvation();
+
+                //! Remove all of the frames.
+                void clear();
+
+            private:
+                DJV_PRIVATE();
+            };
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/TelemetryFunc.h>
+
+#if defined(DJV_PLATFORM_WINDOWS)
+#define NOMINMAX
+#include <windows.h>
+#else // DJV_PLATFORM_WINDOWS
+#include <time.h>
+#endif // DJV_PLATFORM_WINDOWS
+
+#include <algorithm>
+#include <sstream>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            namespace
+            {
+                const size_t histogramBinCount = 12;
+
+                Time::TimePoint getStart(const FrameTelemetry& value)
+                {
+                    return value.request != Time::TimePoint() ? value.request : value.enqueue;
+                }
+
+                Time::TimePoint getEnd(const FrameTelemetry& value)
+                {
+                    Time::TimePoint out = value.present;
+                    if (Time::TimePoint() == out)
+                    {
+                        out = value.enqueue;
+                    }
+                    if (Time::TimePoint() == out)
+                    {
+                        out = value.decodeEnd;
+                    }
+                    return std::max(out, getStart(value));
+                }
+
+            } // namespace
+
+            Time::Duration getThreadCPUTime()
+            {
+                Time::Duration out = Time::Duration::zero();
+#if defined(DJV_PLATFORM_WINDOWS)
+                FILETIME creationTime;
+                FILETIME exitTime;
+                FILETIME kernelTime;
+                FILETIME userTime;
+                if (GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+                {
+                    // The times are in 100 nanosecond units.
+                    const uint64_t kernel = (static_cast<uint64_t>(kernelTime.dwHighDateTime) << 32) | kernelTime.dwLowDateTime;
+                    const uint64_t user = (static_cast<uint64_t>(userTime.dwHighDateTime) << 32) | userTime.dwLowDateTime;
+                    out = Time::Duration((kernel + user) / 10);
+                }
+#else // DJV_PLATFORM_WINDOWS
+                struct timespec ts;
+                if (0 == clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts))
+                {
+                    out = std::chrono::duration_cast<Time::Duration>(
+                        std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec));
+                }
+#endif // DJV_PLATFORM_WINDOWS
+                return out;
+            }
+
+            Histogram getHistogram(std::vector<Time::Duration> values)
+            {
+                Histogram out;
+                out.bins.resize(histogramBinCount, 0);
+                out.count = values.size();
+                if (values.size())
+                {
+                    std::sort(values.begin(), values.end());
+                    out.min = values.front();
+                    out.max = values.back();
+                    Time::Duration sum = Time::Duration::zero();
+                    for (const auto& i : values)
+                    {
+                        sum += i;
+                        size_t bin = 0;
+                        while (bin < histogramBinCount - 1 && i >= std::chrono::milliseconds(1 << bin))
+                        {
+                            ++bin;
+                        }
+                        ++out.bins[bin];
+                    }
+                    out.mean = sum / values.size();
+                    out.p50 = values[(values.size() - 1) * 50 / 100];
+                    out.p95 = values[(values.size() - 1) * 95 / 100];
+                }
+                return out;
+            }
+
+            TelemetryStats getStats(const std::vector<FrameTelemetry>& frames, size_t starvationCount)
+            {
+                TelemetryStats out;
+                out.frameCount = frames.size();
+                out.starvationCount = starvationCount;
+                std::vector<Time::Duration> wait;
+                std::vector<Time::Duration> decode;
+                std::vector<Time::Duration> ioWait;
+                std::vector<Time::Duration> cpu;
+                std::vector<Time::Duration> latency;
+                std::vector<Time::Duration> queue;
+                for (const auto& i : frames)
+                {
+                    if (i.cacheHit)
+                    {
+                        ++out.cacheHitCount;
+                    }
+                    else
+                    {
+                        wait.push_back(i.getWaitTime());
+                        decode.push_back(i.getDecodeTime());
+                        ioWait.push_back(i.getIOWaitTime());
+                        cpu.push_back(i.cpuTime);
+                        if (i.enqueue != Time::TimePoint())
+                        {
+                            latency.push_back(i.getLatency());
+                        }
+                    }
+                    if (i.present != Time::TimePoint())
+                    {
+                        ++out.presentCount;
+                        queue.push_back(i.getQueueTime());
+                    }
+                }
+                out.wait = getHistogram(wait);
+                out.decode = getHistogram(decode);
+                out.ioWait = getHistogram(ioWait);
+                out.cpu = getHistogram(cpu);
+                out.latency = getHistogram(latency);
+                out.queue = getHistogram(queue);
+                return out;
+            }
+
+            std::vector<System::Trace::Event> toTraceEvents(
+                const std::vector<FrameTelemetry>& frames,
+                const std::string& name)
+            {
+                std::vector<System::Trace::Event> out;
+
+                std::vector<FrameTelemetry> sorted = frames;
+                std::sort(
+                    sorted.begin(),
+                    sorted.end(),
+                    [](const FrameTelemetry& a, const FrameTelemetry& b)
+                    {
+                        return getStart(a) < getStart(b);
+                    });
+
+                // Place each frame on the first track that is free.
+                std::vector<Time::TimePoint> tracks;
+                for (const auto& i : sorted)
+                {
+                    const Time::TimePoint start = getStart(i);
+                    const Time::TimePoint end = getEnd(i);
+                    size_t track = 0;
+                    for (; track < tracks.size(); ++track)
+                    {
+                        if (tracks[track] <= start)
+                        {
+                            break;
+                        }
+                    }
+                    if (track < tracks.size())
+                    {
+                        tracks[track] = end;
+                    }
+                    else
+                    {
+                        tracks.push_back(end);
+                    }
+
+                    std::stringstream ss;
+                    ss << name << " " << i.frame;
+                    if (i.cacheHit)
+                    {
+                        ss << " (cache)";
+                    }
+                    System::Trace::Event event(ss.str(), "frame", start, end);
+                    event.track = track;
+                    out.push_back(event);
+
+                    const std::vector<std::pair<std::string, std::pair<Time::TimePoint, Time::TimePoint> > > stages =
+                    {
+                        { "wait", { i.request, i.ioStart } },
+                        { "decode", { i.ioStart, i.decodeEnd } },
+                        { "queue", { i.enqueue, i.present } }
+                    };
+                    for (const auto& j : stages)
+                    {
+                        if (j.second.first != Time::TimePoint() &&
+                            j.second.second != Time::TimePoint() &&
+                            j.second.second >= j.second.first)
+                        {
+                            System::Trace::Event stage(j.first, "telemetry", j.second.first, j.second.second);
+                            stage.track = track;
+                            out.push_back(stage);
+                        }
+                    }
+                }
+                return out;
+            }
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
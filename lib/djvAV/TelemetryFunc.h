@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAV/Telemetry.h>
+
+#include <djvSystem/Trace.h>
+
+#include <string>
+#include <vector>
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace IO
+        {
+            //! \name Timing
+            ///@{
+
+            //! Get the CPU time used by the current thread.
+            Core::Time::Duration getThreadCPUTime();
+
+            ///@}
+
+            //! \name Statistics
+            ///@{
+
+            Histogram getHistogram(std::vector<Core::Time::Duration>);
+
+            TelemetryStats getStats(const std::vector<FrameTelemetry>&, size_t starvationCount = 0);
+
+            ///@}
+
+            //! \name Conversion
+            ///@{
+
+            //! Convert frame telemetry to trace events. Each frame is an event
+            //! from the request to the presentation, with events for the wait,
+            //! decode, and queue stages nested inside. Overlapping frames are
+            //! placed on separate tracks.
+            std::vector<System::Trace::Event> toTraceEvents(
+                const std::vector<FrameTelemetry>&,
+                const std::string& name);
+
+            ///@}
+
+        } // namespace IO
+    } // namespace AV
+} // namespace djv
@@ -23,7 +23,9 @@
 #define GLFW_INCLUDE_NONE
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
 #include <atomic>
+#include <list>
 #include <mutex>
 #include <thread>
 
@@ -36,10 +38,10 @@ namespace djv
         namespace
         {
             //! \todo Should this be configurable?
-            const size_t infoProcessMax  = 4;
-            const size_t imageProcessMax = 4;
-            const size_t infoCacheMax    = 1000;
-            const size_t imageCacheMax   = 1000;
+            const size_t readMin       = 2;
+            const size_t readMax       = 8;
+            const size_t infoCacheMax  = 1000;
+            const size_t imageCacheMax = 1000;
 
             struct InfoRequest
             {
@@ -49,9 +51,10 @@ namespace djv
 
                 InfoRequest(InfoRequest&& other) noexcept :
                     uid(other.uid),
+                    key(other.key),
                     fileInfo(other.fileInfo),
-                    read(std::move(other.read)),
-                    infoFuture(std::move(other.infoFuture)),
+                    priority(other.priority),
+                    token(std::move(other.token)),
                     promise(std::move(other.promise))
                 {}
 
@@ -63,18 +66,20 @@ namespace djv
                     if (this != &other)
                     {
                         uid = other.uid;
+                        key = other.key;
                         fileInfo = other.fileInfo;
-                        read = std::move(other.read);
-                        infoFuture = std::move(other.infoFuture);
+                        priority = other.priority;
+                        token = std::move(other.token);
                         promise = std::move(other.promise);
                     }
                     return *this;
                 }
 
                 UID uid = 0;
+                size_t key = 0;
                 System::File::Info fileInfo;
-                std::shared_ptr<IO::IRead> read;
-                std::future<IO::Info> infoFuture;
+                ThumbnailPriority priority = ThumbnailPriority::First;
+                std::weak_ptr<void> token;
                 std::promise<IO::Info> promise;
             };
 
@@ -86,10 +91,12 @@ namespace djv
 
                 ImageRequest(ImageRequest&& other) noexcept :
                     uid(other.uid),
+                    key(other.key),
                     fileInfo(other.fileInfo),
                     size(std::move(other.size)),
                     type(std::move(other.type)),
-                    read(std::move(other.read)),
+                    priority(other.priority),
+                    token(std::move(other.token)),
                     promise(std::move(other.promise))
                 {}
 
@@ -101,23 +108,41 @@ namespace djv
                     if (this != &other)
                     {
                         uid = other.uid;
+                        key = other.key;
                         fileInfo = other.fileInfo;
                         size = std::move(other.size);
                         type = std::move(other.type);
-                        read = std::move(other.read);
+                        priority = other.priority;
+                        token = std::move(other.token);
                         promise = std::move(other.promise);
                     }
                     return *this;
                 }
 
                 UID uid = 0;
+                size_t key = 0;
                 System::File::Info fileInfo;
                 Image::Size size;
                 Image::Type type = Image::Type::None;
-                std::shared_ptr<IO::IRead> read;
+                ThumbnailPriority priority = ThumbnailPriority::First;
+                std::weak_ptr<void> token;
                 std::promise<std::shared_ptr<Image::Data> > promise;
             };
 
+            //! This struct provides a read in progress that is shared by all of
+            //! the requests with the same cache key.
+            template<typename T>
+            struct Job
+            {
+                size_t key = 0;
+                std::shared_ptr<IO::IRead> read;
+                std::future<IO::Info> infoFuture;
+                bool infoReady = false;
+                std::list<T> requests;
+            };
+            typedef Job<InfoRequest> InfoJob;
+            typedef Job<ImageRequest> ImageJob;
+
             size_t getInfoCacheKey(const System::File::Info& fileInfo)
             {
                 size_t out = 0;
@@ -135,22 +160,76 @@ namespace djv
                 return out;
             }
 
+            //! Get the next request to process. Requests whose futures have
+            //! been released are removed, visible requests are taken before
+            //! prefetch requests, and the most recent requests first.
+            template<typename T>
+            typename std::list<T>::iterator getNextRequest(std::list<T>& requests)
+            {
+                requests.remove_if(
+                    [](const T& value)
+                    {
+                        return value.token.expired();
+                    });
+                auto out = requests.end();
+                if (!requests.empty())
+                {
+                    const auto i = std::find_if(
+                        requests.rbegin(),
+                        requests.rend(),
+                        [](const T& value)
+                        {
+                            return ThumbnailPriority::Visible == value.priority;
+                        });
+                    out = i != requests.rend() ? --(i.base()) : --requests.end();
+                }
+                return out;
+            }
+
+            template<typename T>
+            typename std::list<Job<T> >::iterator findJob(std::list<Job<T> >& jobs, size_t key)
+            {
+                return std::find_if(
+                    jobs.begin(),
+                    jobs.end(),
+                    [key](const Job<T>& value)
+                    {
+                        return key == value.key;
+                    });
+            }
+
+            //! Check whether all of the futures for a job have been released.
+            template<typename T>
+            bool isAbandoned(const Job<T>& job)
+            {
+                for (const auto& i : job.requests)
+                {
+                    if (!i.token.expired())
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
         } // namespace
         
         ThumbnailSystem::InfoFuture::InfoFuture()
         {}
         
-        ThumbnailSystem::InfoFuture::InfoFuture(std::future<IO::Info>& future, UID uid) :
+        ThumbnailSystem::InfoFuture::InfoFuture(std::future<IO::Info>& future, UID uid, const std::shared_ptr<void>& token) :
             future(std::move(future)),
-            uid(uid)
+            uid(uid),
+            token(token)
         {}
         
         ThumbnailSystem::ImageFuture::ImageFuture()
         {}
         
-        ThumbnailSystem::ImageFuture::ImageFuture(std::future<std::shared_ptr<Image::Data> >& future, UID uid) :
+        ThumbnailSystem::ImageFuture::ImageFuture(std::future<std::shared_ptr<Image::Data> >& future, UID uid, const std::shared_ptr<void>& token) :
             future(std::move(future)),
-            uid(uid)
+            uid(uid),
+            token(token)
         {}
 
         ThumbnailError::ThumbnailError(const std::string& what) :
@@ -166,8 +245,11 @@ namespace djv
             std::list<ImageRequest> imageRequests;
             std::condition_variable requestCV;
             std::mutex requestMutex;
-            std::list<InfoRequest> pendingInfoRequests;
-            std::list<ImageRequest> pendingImageRequests;
+            bool jobsChanged = false;
+            size_t readMax = readMin;
+            std::list<InfoJob> infoJobs;
+            std::list<ImageJob> imageJobs;
+            std::atomic<size_t> sharedRequests;
 
             Memory::Cache<size_t, IO::Info> infoCache;
             std::atomic<float> infoCachePercentage;
@@ -197,6 +279,8 @@ namespace djv
             p.imageCache.setMax(imageCacheMax);
             p.imageCachePercentage = 0.F;
             p.clearCache = false;
+            p.readMax = std::max(std::min(static_cast<size_t>(std::thread::hardware_concurrency()), readMax), readMin);
+            p.sharedRequests = 0;
 
 #if defined(DJV_GL_ES2)
             glfwWindowHint(GLFW_CLIENT_API, GLFW_OPENGL_ES_API);
@@ -230,7 +314,8 @@ namespace djv
                 std::stringstream ss;
                 {
                     ss << "Info cache: " << p.infoCachePercentage << "%\n";
-                    ss << "Image cache: " << p.imageCachePercentage << '%';
+                    ss << "Image cache: " << p.imageCachePercentage << "%\n";
+                    ss << "Shared requests: " << p.sharedRequests;
                 }
                 _log(ss.str());
             });
@@ -256,7 +341,6 @@ namespace djv
 
                     auto convert = GL::ImageConvert::create(p.textSystem, resourceSystem);
 
-                    const auto timeout = System::getTimerValue(System::TimerValue::Medium);
                     while (p.running)
                     {
                         if (p.clearCache)
@@ -268,22 +352,27 @@ namespace djv
                             p.imageCachePercentage = 0.F;
                         }
 
-                        bool infoRequests  = p.pendingInfoRequests.size();
-                        bool imageRequests = p.pendingImageRequests.size();
+                        // Wait for new requests or for the reads in progress to
+                        // have new information or frames.
+                        bool infoRequests  = false;
+                        bool imageRequests = false;
                         {
                             std::unique_lock<std::mutex> lock(p.requestMutex);
-                            if (p.requestCV.wait_for(
+                            p.requestCV.wait(
                                 lock,
-                                std::chrono::milliseconds(timeout),
                                 [this]
                             {
                                 DJV_PRIVATE_PTR();
-                                return p.infoRequests.size() || p.imageRequests.size();
-                            }))
-                            {
-                                infoRequests  |= p.infoRequests.size () > 0;
-                                imageRequests |= p.imageRequests.size() > 0;
-                            }
+                                return
+                                    p.infoRequests.size() ||
+                                    p.imageRequests.size() ||
+                                    p.jobsChanged ||
+                                    p.clearCache ||
+                                    !p.running;
+                            });
+                            infoRequests  = p.infoRequests.size() > 0;
+                            imageRequests = p.imageRequests.size() > 0 || p.jobsChanged;
+                            p.jobsChanged = false;
                         }
                         if (infoRequests)
                         {
@@ -325,11 +414,20 @@ namespace djv
         ThumbnailSystem::~ThumbnailSystem()
         {
             DJV_PRIVATE_PTR();
-            p.running = false;
+            {
+                std::lock_guard<std::mutex> lock(p.requestMutex);
+                p.running = false;
+            }
+            p.requestCV.notify_one();
             if (p.thread.joinable())
             {
                 p.thread.join();
             }
+
+            // Destroy the reads while their callbacks can still be called.
+            p.infoJobs.clear();
+            p.imageJobs.clear();
+
             if (p.glfwWindow)
             {
                 glfwDestroyWindow(p.glfwWindow);
@@ -347,18 +445,25 @@ namespace djv
             return out;
         }
 
-        ThumbnailSystem::InfoFuture ThumbnailSystem::getInfo(const System::File::Info& fileInfo)
+        ThumbnailSystem::InfoFuture ThumbnailSystem::getInfo(
+            const System::File::Info& fileInfo,
+            ThumbnailPriority         priority)
         {
             DJV_PRIVATE_PTR();
             InfoRequest request;
+            request.key = getInfoCacheKey(fileInfo);
             request.fileInfo = fileInfo;
+            request.priority = priority;
+            auto token = std::shared_ptr<void>(std::make_shared<bool>(true));
+            request.token = token;
             auto future = request.promise.get_future();
+            const UID uid = request.uid;
             {
                 std::unique_lock<std::mutex> lock(p.requestMutex);
                 p.infoRequests.push_back(std::move(request));
             }
             p.requestCV.notify_one();
-            return InfoFuture(future, request.uid);
+            return InfoFuture(future, uid, token);
         }
         
         void ThumbnailSystem::cancelInfo(UID uid)
@@ -383,20 +488,26 @@ namespace djv
         ThumbnailSystem::ImageFuture ThumbnailSystem::getImage(
             const System::File::Info& fileInfo,
             const Image::Size&        size,
-            Image::Type               type)
+            Image::Type               type,
+            ThumbnailPriority         priority)
         {
             DJV_PRIVATE_PTR();
             ImageRequest request;
+            request.key = getImageCacheKey(fileInfo, size, type);
             request.fileInfo = fileInfo;
             request.size = size;
             request.type = type;
+            request.priority = priority;
+            auto token = std::shared_ptr<void>(std::make_shared<bool>(true));
+            request.token = token;
             auto future = request.promise.get_future();
+            const UID uid = request.uid;
             {
                 std::unique_lock<std::mutex> lock(p.requestMutex);
                 p.imageRequests.push_back(std::move(request));
             }
             p.requestCV.notify_one();
-            return ImageFuture(future, request.uid);
+            return ImageFuture(future, uid, token);
         }
         
         void ThumbnailSystem::cancelImage(UID uid)
@@ -418,6 +529,28 @@ namespace djv
             }
         }
 
+        void ThumbnailSystem::setPriority(UID uid, ThumbnailPriority value)
+        {
+            DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.requestMutex);
+            for (auto& i : p.infoRequests)
+            {
+                if (i.uid == uid)
+                {
+                    i.priority = value;
+                    return;
+                }
+            }
+            for (auto& i : p.imageRequests)
+            {
+                if (i.uid == uid)
+                {
+                    i.priority = value;
+                    return;
+                }
+            }
+        }
+
         float ThumbnailSystem::getInfoCachePercentage() const
         {
             return _p->infoCachePercentage;
@@ -430,154 +563,236 @@ namespace djv
 
         void ThumbnailSystem::clearCache()
         {
-            _p->clearCache = true;
+            DJV_PRIVATE_PTR();
+            {
+                std::lock_guard<std::mutex> lock(p.requestMutex);
+                p.clearCache = true;
+            }
+            p.requestCV.notify_one();
         }
 
         void ThumbnailSystem::_handleInfoRequests()
         {
             DJV_PRIVATE_PTR();
+            bool wake = false;
 
-            // Process new requests.
-            while (p.pendingInfoRequests.size() < infoProcessMax)
+            // Process new requests. Cached requests are finished immediately,
+            // requests for a file that is already being read are added to the
+            // existing job.
+            std::vector<InfoJob*> newJobs;
+            while (true)
             {
-                InfoRequest i;
+                InfoRequest request;
                 {
                     std::unique_lock<std::mutex> lock(p.requestMutex);
-                    if (p.infoRequests.size())
+                    const auto i = getNextRequest(p.infoRequests);
+                    if (i == p.infoRequests.end())
                     {
-                        i = std::move(p.infoRequests.front());
-                        p.infoRequests.pop_front();
+                        break;
                     }
-                    else
+                    const bool cached = p.infoCache.contains(i->key);
+                    const auto job = findJob(p.infoJobs, i->key);
+                    if (!cached && job == p.infoJobs.end() && p.infoJobs.size() >= p.readMax)
                     {
                         break;
                     }
+                    request = std::move(*i);
+                    p.infoRequests.erase(i);
                 }
-                const auto key = getInfoCacheKey(i.fileInfo);
                 IO::Info info;
-                const bool cached = p.infoCache.get(key, info);
-                if (cached)
+                if (p.infoCache.get(request.key, info))
                 {
-                    i.promise.set_value(info);
+                    request.promise.set_value(info);
+                    wake = true;
+                    continue;
                 }
-                else
+                const auto job = findJob(p.infoJobs, request.key);
+                if (job != p.infoJobs.end())
                 {
-                    try
-                    {
-                        i.read = p.io->read(i.fileInfo);
-                        i.infoFuture = i.read->getInfo();
-                        p.pendingInfoRequests.push_back(std::move(i));
-                    }
-                    catch (const std::exception&)
-                    {
-                        try
-                        {
-                            i.promise.set_exception(std::current_exception());
-                        }
-                        catch (const std::exception& e)
-                        {
-                            _log(e.what(), System::LogLevel::Error);
-                        }
-                    }
+                    job->requests.push_back(std::move(request));
+                    ++p.sharedRequests;
+                    continue;
                 }
+                InfoJob newJob;
+                newJob.key = request.key;
+                newJob.requests.push_back(std::move(request));
+                p.infoJobs.push_back(std::move(newJob));
+                newJobs.push_back(&p.infoJobs.back());
             }
 
-            // Process pending requests.
-            auto i = p.pendingInfoRequests.begin();
-            while (i != p.pendingInfoRequests.end())
+            // Probe the file headers for the new jobs together instead of
+            // creating a reader for each file.
+            if (!newJobs.empty())
             {
-                if (i->infoFuture.valid() &&
+                std::vector<System::File::Info> fileInfos;
+                for (const auto& i : newJobs)
+                {
+                    fileInfos.push_back(i->requests.front().fileInfo);
+                }
+                auto futures = p.io->probe(fileInfos);
+                for (size_t i = 0; i < newJobs.size(); ++i)
+                {
+                    newJobs[i]->infoFuture = std::move(futures[i]);
+                }
+            }
+
+            // Process the jobs.
+            auto i = p.infoJobs.begin();
+            while (i != p.infoJobs.end())
+            {
+                if (isAbandoned(*i))
+                {
+                    i = p.infoJobs.erase(i);
+                }
+                else if (i->infoFuture.valid() &&
                     i->infoFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
                 {
                     try
                     {
-                    const auto info = i->infoFuture.get();
-                    p.infoCache.add(getInfoCacheKey(i->fileInfo), info);
-                    p.infoCachePercentage = p.infoCache.getPercentageUsed();
-                    i->promise.set_value(info);
+                        const auto info = i->infoFuture.get();
+                        p.infoCache.add(i->key, info);
+                        p.infoCachePercentage = p.infoCache.getPercentageUsed();
+                        for (auto& j : i->requests)
+                        {
+                            j.promise.set_value(info);
+                            wake = true;
+                        }
                     }
                     catch (const std::exception&)
                     {
-                        try
-                        {
-                            i->promise.set_exception(std::current_exception());
-                        }
-                        catch (const std::exception& e)
+                        for (auto& j : i->requests)
                         {
-                            _log(e.what(), System::LogLevel::Error);
+                            try
+                            {
+                                j.promise.set_exception(std::current_exception());
+                                wake = true;
+                            }
+                            catch (const std::exception& e)
+                            {
+                                _log(e.what(), System::LogLevel::Error);
+                            }
                         }
                     }
-                    i = p.pendingInfoRequests.erase(i);
+                    i = p.infoJobs.erase(i);
                 }
                 else
                 {
                     ++i;
                 }
             }
+
+            if (wake)
+            {
+                _wake();
+            }
         }
 
         void ThumbnailSystem::_handleImageRequests(const std::shared_ptr<GL::ImageConvert>& convert)
         {
             DJV_PRIVATE_PTR();
+            bool wake = false;
 
-            // Process new requests.
-            while (p.pendingImageRequests.size() < imageProcessMax)
+            // Process new requests. Cached requests are finished immediately,
+            // requests for an image that is already being read are added to
+            // the existing job.
+            while (true)
             {
-                ImageRequest i;
+                ImageRequest request;
                 {
                     std::unique_lock<std::mutex> lock(p.requestMutex);
-                    if (p.imageRequests.size())
+                    const auto i = getNextRequest(p.imageRequests);
+                    if (i == p.imageRequests.end())
                     {
-                        i = std::move(p.imageRequests.front());
-                        p.imageRequests.pop_front();
+                        break;
                     }
-                    else
+                    const bool cached = p.imageCache.contains(i->key);
+                    const auto job = findJob(p.imageJobs, i->key);
+                    if (!cached && job == p.imageJobs.end() && p.imageJobs.size() >= p.readMax)
                     {
                         break;
                     }
+                    request = std::move(*i);
+                    p.imageRequests.erase(i);
                 }
-                const auto key = getImageCacheKey(i.fileInfo, i.size, i.type);
                 std::shared_ptr<Image::Data> image;
-                p.imageCache.get(key, image);
-                if (image)
+                if (p.imageCache.get(request.key, image))
                 {
-                    i.promise.set_value(image);
+                    request.promise.set_value(image);
+                    wake = true;
+                    continue;
                 }
-                else
+                const auto job = findJob(p.imageJobs, request.key);
+                if (job != p.imageJobs.end())
+                {
+                    job->requests.push_back(std::move(request));
+                    ++p.sharedRequests;
+                    continue;
+                }
+                try
+                {
+                    ImageJob newJob;
+                    newJob.key = request.key;
+                    newJob.read = p.io->read(request.fileInfo);
+                    newJob.read->setCallback(
+                        [this]
+                        {
+                            DJV_PRIVATE_PTR();
+                            {
+                                std::lock_guard<std::mutex> lock(p.requestMutex);
+                                p.jobsChanged = true;
+                            }
+                            p.requestCV.notify_one();
+                        });
+                    newJob.infoFuture = newJob.read->getInfo();
+                    newJob.requests.push_back(std::move(request));
+                    p.imageJobs.push_back(std::move(newJob));
+                }
+                catch (const std::exception&)
                 {
                     try
                     {
-                        i.read = p.io->read(i.fileInfo);
-                        const auto info = i.read->getInfo().get();
-                        if (info.video.size() > 0)
-                        {
-                            p.pendingImageRequests.push_back(std::move(i));
-                        }
-                        else
-                        {
-                            i.promise.set_value(nullptr);
-                        }
+                        request.promise.set_exception(std::current_exception());
+                        wake = true;
                     }
-                    catch (const std::exception&)
+                    catch (const std::exception& e)
                     {
-                        try
-                        {
-                            i.promise.set_exception(std::current_exception());
-                        }
-                        catch (const std::exception& e)
-                        {
-                            _log(e.what(), System::LogLevel::Error);
-                        }
+                        _log(e.what(), System::LogLevel::Error);
                     }
                 }
             }
 
-            // Process pending requests.
-            auto i = p.pendingImageRequests.begin();
-            while (i != p.pendingImageRequests.end())
+            // Process the jobs.
+            auto i = p.imageJobs.begin();
+            while (i != p.imageJobs.end())
             {
+                if (isAbandoned(*i))
+                {
+                    i = p.imageJobs.erase(i);
+                    continue;
+                }
+
+                // Wait for the information without blocking the other jobs.
                 std::shared_ptr<Image::Data> image;
                 bool finished = false;
+                std::exception_ptr exception;
+                if (!i->infoReady)
+                {
+                    if (i->infoFuture.valid() &&
+                        i->infoFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                    {
+                        try
+                        {
+                            const auto info = i->infoFuture.get();
+                            i->infoReady = true;
+                            finished = info.video.empty();
+                        }
+                        catch (const std::exception&)
+                        {
+                            exception = std::current_exception();
+                        }
+                    }
+                }
+                if (i->infoReady && !finished)
                 {
                     std::lock_guard<std::mutex> lock(i->read->getMutex());
                     auto& queue = i->read->getVideoQueue();
@@ -590,15 +805,18 @@ namespace djv
                         finished = true;
                     }
                 }
+
                 if (image)
                 {
                     try
                     {
+                        // The requests in a job share the same size and type.
+                        const auto& request = i->requests.front();
                         Image::Size imageSize = image->getSize();
                         imageSize.w *= image->getInfo().pixelAspectRatio;
-                        if (i->size != imageSize || i->type != Image::Type::None)
+                        if (request.size != imageSize || request.type != Image::Type::None)
                         {
-                            Image::Size size = i->size;
+                            Image::Size size = request.size;
                             const float aspect = size.h != 0 ? (size.w / static_cast<float>(size.h)) : 1.F;
                             const float imageAspect = imageSize.h != 0 ? (imageSize.w / static_cast<float>(imageSize.h)) : 1.F;
                             if (imageAspect < aspect)
@@ -609,7 +827,7 @@ namespace djv
                             {
                                 size.h = static_cast<int>(size.w / imageAspect);
                             }
-                            const auto type = i->type != Image::Type::None ? i->type : image->getType();
+                            const auto type = request.type != Image::Type::None ? request.type : image->getType();
                             auto info = Image::Info(size, type);
 #if defined(DJV_GL_ES2)
                             info.type = Image::Type::RGBA_U8;
@@ -620,15 +838,35 @@ namespace djv
                             convert->process(*image, info, *tmp);
                             image = tmp;
                         }
-                        p.imageCache.add(getImageCacheKey(i->fileInfo, i->size, i->type), image);
+                        p.imageCache.add(i->key, image);
                         p.imageCachePercentage = p.imageCache.getPercentageUsed();
-                        i->promise.set_value(image);
+                        for (auto& j : i->requests)
+                        {
+                            j.promise.set_value(image);
+                            wake = true;
+                        }
                     }
                     catch (const std::exception&)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+                else if (finished)
+                {
+                    for (auto& j : i->requests)
+                    {
+                        j.promise.set_value(nullptr);
+                        wake = true;
+                    }
+                }
+                if (exception)
+                {
+                    for (auto& j : i->requests)
                     {
                         try
                         {
-                            i->promise.set_exception(std::current_exception());
+                            j.promise.set_exception(exception);
+                            wake = true;
                         }
                         catch (const std::exception& e)
                         {
@@ -636,19 +874,21 @@ namespace djv
                         }
                     }
                 }
-                else if (finished)
-                {
-                    i->promise.set_value(nullptr);
-                }
-                if (image || finished)
+
+                if (image || finished || exception)
                 {
-                    i = p.pendingImageRequests.erase(i);
+                    i = p.imageJobs.erase(i);
                 }
                 else
                 {
                     ++i;
                 }
             }
+
+            if (wake)
+            {
+                _wake();
+            }
         }
 
     } // namespace AV
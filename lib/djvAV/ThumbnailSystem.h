@@ -45,6 +45,16 @@ namespace djv
 
         } // namespace IO
             
+        //! This enumeration provides thumbnail request priorities.
+        enum class ThumbnailPriority
+        {
+            Visible,  //!< The thumbnail is visible
+            Prefetch, //!< The thumbnail may become visible soon
+
+            Count,
+            First = Visible
+        };
+
         //! This class provides a thumbnail error.
         class ThumbnailError : public std::runtime_error
         {
@@ -53,6 +63,11 @@ namespace djv
         };
         
         //! This class provides a system for generating thumbnail images from files.
+        //!
+        //! Requests with the same file, size, and type share a single read.
+        //! Visible requests are handled before prefetch requests, and the most
+        //! recent requests first within a priority. A request is cancelled when
+        //! the returned future structure is destroyed.
         class ThumbnailSystem : public System::ISystem
         {
             DJV_NON_COPYABLE(ThumbnailSystem);
@@ -73,13 +88,16 @@ namespace djv
             struct InfoFuture
             {
                 InfoFuture();
-                InfoFuture(std::future<IO::Info>&, Core::UID);
+                InfoFuture(std::future<IO::Info>&, Core::UID, const std::shared_ptr<void>& token);
                 std::future<IO::Info> future;
                 Core::UID uid = 0;
+                std::shared_ptr<void> token;
             };
             
             //! Get information about a file.
-            InfoFuture getInfo(const System::File::Info&);
+            InfoFuture getInfo(
+                const System::File::Info&,
+                ThumbnailPriority = ThumbnailPriority::Visible);
 
             //! Cancel information about a file.
             void cancelInfo(Core::UID);
@@ -88,20 +106,25 @@ namespace djv
             struct ImageFuture
             {
                 ImageFuture();
-                ImageFuture(std::future<std::shared_ptr<Image::Data> >&, Core::UID);
+                ImageFuture(std::future<std::shared_ptr<Image::Data> >&, Core::UID, const std::shared_ptr<void>& token);
                 std::future<std::shared_ptr<Image::Data> > future;
                 Core::UID uid = 0;
+                std::shared_ptr<void> token;
             };
 
             //! Get a thumbnail image.
             ImageFuture getImage(
                 const System::File::Info& path,
                 const Image::Size&        size,
-                Image::Type               type = Image::Type::None);
+                Image::Type               type     = Image::Type::None,
+                ThumbnailPriority         priority = ThumbnailPriority::Visible);
 
             //! Cancel a thumbnail image.
             void cancelImage(Core::UID);
 
+            //! Change the priority of a request that has not started.
+            void setPriority(Core::UID, ThumbnailPriority);
+
             //! Get the infromation cache percentage used.
             float getInfoCachePercentage() const;
 
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAV/WaveformSystem.h>
+
+#include <djvAV/CacheWorker.h>
+
+#if defined(FFmpeg_FOUND)
+#include <djvAV/FFmpegFunc.h>
+#endif // FFmpeg_FOUND
+
+#include <djvAudio/Waveform.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/LogSystem.h>
+#include <djvSystem/ResourceSystem.h>
+#include <djvSystem/TextSystem.h>
+
+#include <djvCore/StringFormat.h>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace AV
+    {
+        namespace
+        {
+            //! \todo Should this be configurable?
+            const size_t cacheMax = 100;
+
+            const std::string waveformMagic = "djvWaveform";
+            const uint32_t waveformVersion = 1;
+
+            //! Read a waveform, returns null if it does not match the file.
+            std::shared_ptr<Audio::Waveform> readWaveform(
+                const std::shared_ptr<System::File::IO>& io,
+                const System::File::Info& fileInfo,
+                const std::shared_ptr<System::TextSystem>& textSystem)
+            {
+                std::string magic(waveformMagic.size(), 0);
+                io->read(&magic[0], magic.size());
+                uint32_t version = 0;
+                io->readU32(&version);
+                if (magic != waveformMagic || version != waveformVersion)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(io->getFileName()).
+                        arg(textSystem->getText(DJV_TEXT("error_bad_magic_number"))));
+                }
+                uint64_t fileSize = 0;
+                int64_t fileTime = 0;
+                io->read(&fileSize, 1, sizeof(uint64_t));
+                io->read(&fileTime, 1, sizeof(int64_t));
+                if (fileSize != fileInfo.getSize() || fileTime != fileInfo.getTime())
+                {
+                    return nullptr;
+                }
+                uint8_t channelCount = 0;
+                uint64_t sampleRate = 0;
+                uint64_t blockSize = 0;
+                uint64_t sampleCount = 0;
+                io->readU8(&channelCount);
+                io->read(&sampleRate, 1, sizeof(uint64_t));
+                io->read(&blockSize, 1, sizeof(uint64_t));
+                io->read(&sampleCount, 1, sizeof(uint64_t));
+                std::vector<std::vector<Audio::WaveformSample> > blocks(channelCount);
+                for (auto& i : blocks)
+                {
+                    uint64_t count = 0;
+                    io->read(&count, 1, sizeof(uint64_t));
+                    if (count * sizeof(float) * 3 > io->getSize() - io->getPos())
+                    {
+                        throw System::File::Error(String::Format("{0}: {1}").
+                            arg(io->getFileName()).
+                            arg(textSystem->getText(DJV_TEXT("error_incomplete_file"))));
+                    }
+                    i.resize(count);
+                    for (auto& j : i)
+                    {
+                        io->readF32(&j.min);
+                        io->readF32(&j.max);
+                        io->readF32(&j.rms);
+                    }
+                }
+                return std::make_shared<Audio::Waveform>(channelCount, sampleRate, blockSize, sampleCount, blocks);
+            }
+
+            //! Write a waveform. Only the finest level is stored, the coarser
+            //! levels are rebuilt when it is read.
+            void writeWaveform(
+                const std::shared_ptr<System::File::IO>& io,
+                const System::File::Info& fileInfo,
+                const Audio::Waveform& waveform)
+            {
+                io->write(waveformMagic);
+                io->writeU32(waveformVersion);
+                const uint64_t fileSize = fileInfo.getSize();
+                const int64_t fileTime = fileInfo.getTime();
+                const uint64_t sampleRate = waveform.getSampleRate();
+                const uint64_t blockSize = waveform.getBlockSize();
+                const uint64_t sampleCount = waveform.getSampleCount();
+                io->write(&fileSize, 1, sizeof(uint64_t));
+                io->write(&fileTime, 1, sizeof(int64_t));
+                io->writeU8(waveform.getChannelCount());
+                io->write(&sampleRate, 1, sizeof(uint64_t));
+                io->write(&blockSize, 1, sizeof(uint64_t));
+                io->write(&sampleCount, 1, sizeof(uint64_t));
+                for (uint8_t i = 0; i < waveform.getChannelCount(); ++i)
+                {
+                    const auto& level = waveform.getLevel(0, i);
+                    const uint64_t count = level.size();
+                    io->write(&count, 1, sizeof(uint64_t));
+                    for (const auto& j : level)
+                    {
+                        io->writeF32(j.min);
+                        io->writeF32(j.max);
+                        io->writeF32(j.rms);
+                    }
+                }
+            }
+
+        } // namespace
+
+        struct WaveformSystem::Private
+        {
+            std::unique_ptr<CacheWorker<Audio::Waveform> > worker;
+        };
+
+        void WaveformSystem::_init(const std::shared_ptr<System::Context>& context)
+        {
+            ISystem::_init("djv::AV::WaveformSystem", context);
+
+            DJV_PRIVATE_PTR();
+
+            auto textSystem = context->getSystemT<System::TextSystem>();
+            auto resourceSystem = context->getSystemT<System::ResourceSystem>();
+            p.worker.reset(new CacheWorker<Audio::Waveform>(
+                "djv::AV::WaveformSystem",
+                System::File::Path(resourceSystem->getPath(System::File::ResourcePath::Documents), "Waveforms"),
+                ".waveform",
+                cacheMax,
+                [textSystem](const System::File::Path& fileName, const System::File::Info& fileInfo)
+                {
+                    auto io = System::File::IO::create();
+                    io->open(fileName.get(), System::File::Mode::Read);
+                    return readWaveform(io, fileInfo, textSystem);
+                },
+                [this]
+                {
+                    _wake();
+                },
+                context->getSystemT<System::LogSystem>()));
+
+            _logInitTime();
+        }
+
+        WaveformSystem::WaveformSystem() :
+            _p(new Private)
+        {}
+
+        WaveformSystem::~WaveformSystem()
+        {
+            _p->worker.reset();
+        }
+
+        std::shared_ptr<WaveformSystem> WaveformSystem::create(const std::shared_ptr<System::Context>& context)
+        {
+            auto out = context->getSystemT<WaveformSystem>();
+            if (!out)
+            {
+                out = std::shared_ptr<WaveformSystem>(new WaveformSystem);
+                out->_init(context);
+            }
+            return out;
+        }
+
+        std::future<std::shared_ptr<Audio::Waveform> > WaveformSystem::getWaveform(const System::File::Info& fileInfo)
+        {
+            DJV_PRIVATE_PTR();
+            CacheWorker<Audio::Waveform>::BuildCallback build;
+#if defined(FFmpeg_FOUND)
+            // Decode the audio and store the waveform.
+            build = [this, fileInfo](const System::File::Path& fileName)
+            {
+                auto out = IO::FFmpeg::buildWaveform(fileInfo, _p->worker->isRunning());
+                if (out)
+                {
+                    try
+                    {
+                        auto io = System::File::IO::create();
+                        io->open(fileName.get(), System::File::Mode::Write);
+                        writeWaveform(io, fileInfo, *out);
+                    }
+                    catch (const std::exception& e)
+                    {
+                        _log(e.what(), System::LogLevel::Warning);
+                    }
+                }
+                return out;
+            };
+#endif // FFmpeg_FOUND
+            return p.worker->request(fileInfo, build);
+        }
+
+        void WaveformSystem::clearCache()
+        {
+            _p->worker->clearCache();
+        }
+
+    } // namespace AV
+} // namespace djv
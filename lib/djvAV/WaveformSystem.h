@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvSystem/ISystem.h>
+
+#include <future>
+
+namespace djv
+{
+    namespace System
+    {
+        namespace File
+        {
+            class Info;
+
+        } // namespace File
+    } // namespace System
+
+    namespace Audio
+    {
+        class Waveform;
+
+    } // namespace Audio
+
+    namespace AV
+    {
+        //! This class provides a system for building audio waveform overviews.
+        //!
+        //! The audio of a file is decoded once in the background and the
+        //! waveform is stored in a cache directory, so it is available
+        //! immediately the next time the file is opened.
+        class WaveformSystem : public System::ISystem
+        {
+            DJV_NON_COPYABLE(WaveformSystem);
+
+        protected:
+            void _init(const std::shared_ptr<System::Context>&);
+            WaveformSystem();
+
+        public:
+            ~WaveformSystem() override;
+
+            static std::shared_ptr<WaveformSystem> create(const std::shared_ptr<System::Context>&);
+
+            //! Get the waveform for a file. The result is null when the file
+            //! has no audio or the waveform cannot be built.
+            std::future<std::shared_ptr<Audio::Waveform> > getWaveform(const System::File::Info&);
+
+            //! Clear the memory cache.
+            void clearCache();
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace AV
+} // namespace djv
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVPy/AVPy.h>
+
+#include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(djvAVPy, m)
+{
+    wrapAVSystem(m);
+
+    auto mImage = m.def_submodule("Image");
+    wrapImage(mImage);
+
+    auto mIO = m.def_submodule("IO");
+    wrapIO(mIO);
+}
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVPy/AVPy.h>
+
+#include <djvAV/AVSystem.h>
+
+#include <djvSystem/Context.h>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+using namespace djv;
+
+namespace py = pybind11;
+
+void wrapAVSystem(pybind11::module& m)
+{
+    // The context is local to this module so that it does not conflict with
+    // the other Python modules.
+    py::class_<System::Context, std::shared_ptr<System::Context> >(m, "Context", py::module_local())
+        .def_static("create", &System::Context::create, py::arg("argv0") = "djvAVPy")
+        .def("getName", &System::Context::getName)
+        .def("tick", &System::Context::tick);
+
+    py::class_<AV::AVSystem, std::shared_ptr<AV::AVSystem> >(m, "AVSystem")
+        .def_static("create", &AV::AVSystem::create);
+}
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVPy/AVPy.h>
+
+#include <djvAV/IOSystem.h>
+
+#include <djvSystem/Context.h>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace djv;
+
+namespace py = pybind11;
+
+namespace
+{
+    const std::chrono::microseconds queueTimeout(100);
+
+    //! This class provides an iterator over a range of frames. The frames
+    //! are read by the I/O threads in the background while Python consumes
+    //! them, and the GIL is released while waiting.
+    class FrameIterator
+    {
+    public:
+        FrameIterator(
+            const std::shared_ptr<AV::IO::IRead>& read,
+            Math::Frame::Index min,
+            Math::Frame::Index max,
+            size_t queueSize) :
+            _read(read),
+            _frame(min),
+            _max(max)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_read->getMutex());
+                _read->getVideoQueue().setMax(queueSize > 0 ? queueSize : (_read->getThreadCount() * 2));
+            }
+            _read->setLoop(false);
+            _read->setInOutPoints(AV::IO::InOutPoints(true, min, max));
+            _read->seek(min, AV::IO::Direction::Forward);
+            _read->setPlayback(true);
+        }
+
+        ~FrameIterator()
+        {
+            _read->setPlayback(false);
+        }
+
+        std::pair<Math::Frame::Index, std::shared_ptr<Image::Data> > next()
+        {
+            if (_frame > _max)
+            {
+                throw py::stop_iteration();
+            }
+            py::gil_scoped_release release;
+            while (true)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_read->getMutex());
+                    auto& videoQueue = _read->getVideoQueue();
+                    while (!videoQueue.isEmpty())
+                    {
+                        // Discard frames from before the seek. Frames that
+                        // are missing from the file are skipped.
+                        const auto frame = videoQueue.popFrame();
+                        if (frame.frame > _max)
+                        {
+                            videoQueue.clearFrames();
+                            _frame = _max + 1;
+                            throw py::stop_iteration();
+                        }
+                        if (frame.frame >= _frame)
+                        {
+                            _frame = frame.frame + 1;
+                            return std::make_pair(frame.frame, frame.data);
+                        }
+                    }
+                    if (videoQueue.isFinished())
+                    {
+                        break;
+                    }
+
+                    // Audio is not returned so discard it to keep the reader
+                    // from blocking on a full queue.
+                    _read->getAudioQueue().clearFrames();
+                }
+                std::this_thread::sleep_for(queueTimeout);
+            }
+            _frame = _max + 1;
+            throw py::stop_iteration();
+        }
+
+    private:
+        std::shared_ptr<AV::IO::IRead> _read;
+        Math::Frame::Index _frame = 0;
+        Math::Frame::Index _max = 0;
+    };
+
+} // namespace
+
+void wrapIO(pybind11::module& m)
+{
+    py::class_<AV::IO::Info>(m, "Info")
+        .def(py::init<>())
+        .def_readwrite("fileName", &AV::IO::Info::fileName)
+        .def_property(
+            "videoSpeed",
+            [](const AV::IO::Info& value)
+            {
+                return value.videoSpeed.toFloat();
+            },
+            [](AV::IO::Info& value, float speed)
+            {
+                value.videoSpeed = Math::IntRational::fromFloat(speed);
+            })
+        .def("getVideoFrameCount", [](const AV::IO::Info& value)
+            {
+                return value.videoSequence.getFrameCount();
+            })
+        .def_readwrite("video", &AV::IO::Info::video)
+        .def_readwrite("audioSampleCount", &AV::IO::Info::audioSampleCount);
+
+    py::class_<AV::IO::ReadOptions>(m, "ReadOptions")
+        .def(py::init<>())
+        .def_readwrite("videoQueueSize", &AV::IO::ReadOptions::videoQueueSize)
+        .def_readwrite("audioQueueSize", &AV::IO::ReadOptions::audioQueueSize)
+        .def_readwrite("layer", &AV::IO::ReadOptions::layer)
+        .def_readwrite("colorSpace", &AV::IO::ReadOptions::colorSpace)
+        .def_readwrite("buildIndex", &AV::IO::ReadOptions::buildIndex);
+
+    py::class_<AV::IO::WriteOptions>(m, "WriteOptions")
+        .def(py::init<>())
+        .def_readwrite("videoQueueSize", &AV::IO::WriteOptions::videoQueueSize)
+        .def_readwrite("colorSpace", &AV::IO::WriteOptions::colorSpace);
+
+    py::class_<FrameIterator>(m, "FrameIterator")
+        .def("__iter__", [](FrameIterator& value) -> FrameIterator&
+            {
+                return value;
+            })
+        .def("__next__", &FrameIterator::next);
+
+    py::class_<AV::IO::IIO, std::shared_ptr<AV::IO::IIO> >(m, "IIO")
+        .def("isRunning", &AV::IO::IIO::isRunning)
+        .def("getThreadCount", &AV::IO::IIO::getThreadCount)
+        .def("setThreadCount", &AV::IO::IIO::setThreadCount);
+
+    py::class_<AV::IO::IRead, std::shared_ptr<AV::IO::IRead>, AV::IO::IIO>(m, "IRead")
+        .def("getInfo", [](AV::IO::IRead& value)
+            {
+                py::gil_scoped_release release;
+                return value.getInfo().get();
+            })
+        .def("seek", [](AV::IO::IRead& value, int64_t frame)
+            {
+                value.seek(frame, AV::IO::Direction::Forward);
+            })
+        .def("readFrames",
+            [](const std::shared_ptr<AV::IO::IRead>& value, Math::Frame::Index min, Math::Frame::Index max, size_t queueSize)
+            {
+                return new FrameIterator(value, min, max, queueSize);
+            },
+            py::arg("min"),
+            py::arg("max"),
+            py::arg("queueSize") = 0,
+            py::keep_alive<0, 1>());
+
+    py::class_<AV::IO::IWrite, std::shared_ptr<AV::IO::IWrite>, AV::IO::IIO>(m, "IWrite")
+        .def("writeFrame", [](AV::IO::IWrite& value, Math::Frame::Number frame, const std::shared_ptr<Image::Data>& data)
+            {
+                // Wait for room in the queue so Python cannot get ahead of
+                // the I/O threads.
+                py::gil_scoped_release release;
+                while (value.isRunning())
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(value.getMutex());
+                        auto& queue = value.getVideoQueue();
+                        if (queue.getCount() < queue.getMax())
+                        {
+                            queue.addFrame(AV::IO::VideoFrame(frame, data));
+                            break;
+                        }
+                    }
+                    std::this_thread::sleep_for(queueTimeout);
+                }
+            })
+        .def("finish", [](AV::IO::IWrite& value)
+            {
+                py::gil_scoped_release release;
+                {
+                    std::lock_guard<std::mutex> lock(value.getMutex());
+                    value.getVideoQueue().setFinished(true);
+                }
+                while (value.isRunning())
+                {
+                    std::this_thread::sleep_for(queueTimeout);
+                }
+            });
+
+    py::class_<AV::IO::IOSystem, std::shared_ptr<AV::IO::IOSystem> >(m, "IOSystem")
+        .def_static("get", [](const std::shared_ptr<System::Context>& context)
+            {
+                return context->getSystemT<AV::IO::IOSystem>();
+            })
+        .def("getPluginNames", &AV::IO::IOSystem::getPluginNames)
+        .def("getFileExtensions", &AV::IO::IOSystem::getFileExtensions)
+        .def("getSequenceExtensions", &AV::IO::IOSystem::getSequenceExtensions)
+        .def("canRead", [](AV::IO::IOSystem& value, const std::string& fileName)
+            {
+                return value.canRead(System::File::Info(fileName));
+            })
+        .def("read", [](AV::IO::IOSystem& value, const std::string& fileName, const AV::IO::ReadOptions& options)
+            {
+                return value.read(System::File::Info(fileName), options);
+            },
+            py::arg("fileName"),
+            py::arg("options") = AV::IO::ReadOptions())
+        .def("canWrite", [](AV::IO::IOSystem& value, const std::string& fileName, const AV::IO::Info& info)
+            {
+                return value.canWrite(System::File::Info(fileName, false), info);
+            })
+        .def("write", [](AV::IO::IOSystem& value, const std::string& fileName, const AV::IO::Info& info, const AV::IO::WriteOptions& options)
+            {
+                return value.write(System::File::Info(fileName, false), info, options);
+            },
+            py::arg("fileName"),
+            py::arg("info"),
+            py::arg("options") = AV::IO::WriteOptions());
+}
@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVPy/AVPy.h>
+
+#include <djvImage/Data.h>
+#include <djvImage/TypeFunc.h>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/operators.h>
+#include <pybind11/stl.h>
+
+using namespace djv;
+
+namespace py = pybind11;
+
+namespace
+{
+    //! Get the buffer protocol information for image data. The buffer
+    //! references the image data directly so NumPy arrays created from it
+    //! do not copy the pixels. The array shape is (height, width, channels)
+    //! in the order the rows are stored in memory, check the layout mirror
+    //! to see whether the rows are flipped.
+    py::buffer_info getBufferInfo(Image::Data& data)
+    {
+        const auto& info = data.getInfo();
+        const Image::DataType dataType = Image::getDataType(info.type);
+        std::string format;
+        switch (dataType)
+        {
+        case Image::DataType::U8:  format = py::format_descriptor<Image::U8_T>::format(); break;
+        case Image::DataType::U10:
+        case Image::DataType::U32: format = py::format_descriptor<Image::U32_T>::format(); break;
+        case Image::DataType::U16: format = py::format_descriptor<Image::U16_T>::format(); break;
+        case Image::DataType::F16: format = "e"; break;
+        case Image::DataType::F32: format = py::format_descriptor<Image::F32_T>::format(); break;
+        default: throw std::runtime_error("Invalid image type.");
+        }
+        const size_t byteCount = Image::getByteCount(dataType);
+        if (byteCount > 1)
+        {
+            format.insert(0, Core::Memory::Endian::MSB == info.layout.endian ? ">" : "<");
+        }
+        const size_t scanlineByteCount = data.getScanlineByteCount();
+        const size_t pixelByteCount = data.getPixelByteCount();
+        if (Image::DataType::U10 == dataType)
+        {
+            // 10-bit data is packed into a 32-bit value for each pixel.
+            return py::buffer_info(
+                data.getData(),
+                pixelByteCount,
+                format,
+                2,
+                std::vector<size_t>({ info.size.h, info.size.w }),
+                std::vector<size_t>({ scanlineByteCount, pixelByteCount }));
+        }
+        return py::buffer_info(
+            data.getData(),
+            byteCount,
+            format,
+            3,
+            std::vector<size_t>({ info.size.h, info.size.w, Image::getChannelCount(info.type) }),
+            std::vector<size_t>({ scanlineByteCount, pixelByteCount, byteCount }));
+    }
+
+} // namespace
+
+void wrapImage(pybind11::module& m)
+{
+    py::enum_<Image::Type>(m, "Type")
+        .value("None", Image::Type::None)
+        .value("L_U8", Image::Type::L_U8)
+        .value("L_U16", Image::Type::L_U16)
+        .value("L_U32", Image::Type::L_U32)
+        .value("L_F16", Image::Type::L_F16)
+        .value("L_F32", Image::Type::L_F32)
+        .value("LA_U8", Image::Type::LA_U8)
+        .value("LA_U16", Image::Type::LA_U16)
+        .value("LA_U32", Image::Type::LA_U32)
+        .value("LA_F16", Image::Type::LA_F16)
+        .value("LA_F32", Image::Type::LA_F32)
+        .value("RGB_U8", Image::Type::RGB_U8)
+        .value("RGB_U10", Image::Type::RGB_U10)
+        .value("RGB_U16", Image::Type::RGB_U16)
+        .value("RGB_U32", Image::Type::RGB_U32)
+        .value("RGB_F16", Image::Type::RGB_F16)
+        .value("RGB_F32", Image::Type::RGB_F32)
+        .value("RGBA_U8", Image::Type::RGBA_U8)
+        .value("RGBA_U16", Image::Type::RGBA_U16)
+        .value("RGBA_U32", Image::Type::RGBA_U32)
+        .value("RGBA_F16", Image::Type::RGBA_F16)
+        .value("RGBA_F32", Image::Type::RGBA_F32);
+
+    m.def("getChannelCount", &Image::getChannelCount);
+    m.def("getBitDepth", (uint8_t(*)(Image::Type))&Image::getBitDepth);
+
+    py::class_<Image::Mirror>(m, "Mirror")
+        .def(py::init<>())
+        .def(py::init<bool, bool>())
+        .def_readwrite("x", &Image::Mirror::x)
+        .def_readwrite("y", &Image::Mirror::y)
+        .def(py::self == py::self)
+        .def(py::self != py::self);
+
+    py::class_<Image::Layout>(m, "Layout")
+        .def(py::init<>())
+        .def_readwrite("mirror", &Image::Layout::mirror)
+        .def_readwrite("alignment", &Image::Layout::alignment)
+        .def(py::self == py::self)
+        .def(py::self != py::self);
+
+    py::class_<Image::Size>(m, "Size")
+        .def(py::init<uint16_t, uint16_t>(), py::arg("w") = 0, py::arg("h") = 0)
+        .def_readwrite("w", &Image::Size::w)
+        .def_readwrite("h", &Image::Size::h)
+        .def("isValid", &Image::Size::isValid)
+        .def("getAspectRatio", &Image::Size::getAspectRatio)
+        .def(py::self == py::self)
+        .def(py::self != py::self);
+
+    py::class_<Image::Info>(m, "Info")
+        .def(py::init<>())
+        .def(py::init<const Image::Size&, Image::Type, const Image::Layout&>(),
+            py::arg("size"), py::arg("type"), py::arg("layout") = Image::Layout())
+        .def(py::init<uint16_t, uint16_t, Image::Type, const Image::Layout&>(),
+            py::arg("width"), py::arg("height"), py::arg("type"), py::arg("layout") = Image::Layout())
+        .def_readwrite("name", &Image::Info::name)
+        .def_readwrite("size", &Image::Info::size)
+        .def_readwrite("pixelAspectRatio", &Image::Info::pixelAspectRatio)
+        .def_readwrite("type", &Image::Info::type)
+        .def_readwrite("layout", &Image::Info::layout)
+        .def_readwrite("codec", &Image::Info::codec)
+        .def("getAspectRatio", &Image::Info::getAspectRatio)
+        .def("isValid", &Image::Info::isValid)
+        .def("getPixelByteCount", &Image::Info::getPixelByteCount)
+        .def("getScanlineByteCount", &Image::Info::getScanlineByteCount)
+        .def("getDataByteCount", &Image::Info::getDataByteCount)
+        .def(py::self == py::self)
+        .def(py::self != py::self);
+
+    py::class_<Image::Data, std::shared_ptr<Image::Data> >(m, "Data", py::buffer_protocol())
+        .def_static("create", &Image::Data::create)
+        .def("getInfo", &Image::Data::getInfo)
+        .def("getSize", &Image::Data::getSize)
+        .def("getWidth", &Image::Data::getWidth)
+        .def("getHeight", &Image::Data::getHeight)
+        .def("getAspectRatio", &Image::Data::getAspectRatio)
+        .def("getType", &Image::Data::getType)
+        .def("getLayout", &Image::Data::getLayout)
+        .def("isValid", &Image::Data::isValid)
+        .def("getPixelByteCount", &Image::Data::getPixelByteCount)
+        .def("getScanlineByteCount", &Image::Data::getScanlineByteCount)
+        .def("getDataByteCount", &Image::Data::getDataByteCount)
+        .def("getPluginName", &Image::Data::getPluginName)
+        .def("zero", &Image::Data::zero)
+        .def_buffer(&getBufferInfo);
+}
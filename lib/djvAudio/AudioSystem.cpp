@@ -17,6 +17,7 @@
 
 #include <rtaudio/RtAudio.h>
 
+#include <map>
 #include <sstream>
 
 using namespace djv::Core;
@@ -30,6 +31,9 @@ namespace djv
             std::unique_ptr<RtAudio> rtAudio;
             std::vector<std::string> apis;
             std::vector<Device> devices;
+
+            unsigned int getDefaultInputDevice();
+            unsigned int getDefaultOutputDevice();
         };
 
         void AudioSystem::_init(const std::shared_ptr<System::Context>& context)
@@ -56,6 +60,32 @@ namespace djv
                 _log(ss.str());
             }
 
+            // Probing the devices can be slow so it is done concurrently with
+            // the initialization of the other systems. The text is looked up
+            // here since the text system is not thread safe.
+            auto textSystem = context->getSystemT<System::TextSystem>();
+            std::map<DeviceFormat, std::string> formatText;
+            for (auto i : getDeviceFormatEnums())
+            {
+                std::stringstream ss;
+                ss << i;
+                formatText[i] = textSystem->getText(ss.str());
+            }
+            const std::string errorText = textSystem->getText(DJV_TEXT("error_rtaudio_init"));
+            _initTask(
+                [this, formatText, errorText]
+                {
+                    _probeDevices(formatText, errorText);
+                });
+
+            _logInitTime();
+        }
+
+        void AudioSystem::_probeDevices(
+            const std::map<DeviceFormat, std::string>& formatText,
+            const std::string& errorText)
+        {
+            DJV_PRIVATE_PTR();
             try
             {
                 p.rtAudio.reset(new RtAudio);
@@ -130,12 +160,13 @@ namespace djv
                         {
                             std::stringstream ss;
                             ss << "    Native formats: ";
-                            auto textSystem = context->getSystemT<System::TextSystem>();
                             for (auto j : device.nativeFormats)
                             {
-                                std::stringstream ss2;
-                                ss2 << j;
-                                ss << textSystem->getText(ss2.str()) << " ";
+                                const auto k = formatText.find(j);
+                                if (k != formatText.end())
+                                {
+                                    ss << k->second << " ";
+                                }
                             }
                             _log(ss.str());
                         }
@@ -143,25 +174,22 @@ namespace djv
                 }
                 {
                     std::stringstream ss;
-                    ss << "Default input device: " << getDefaultInputDevice();
+                    ss << "Default input device: " << p.getDefaultInputDevice();
                     _log(ss.str());
                 }
                 {
                     std::stringstream ss;
-                    ss << "Default output device: " << getDefaultOutputDevice();
+                    ss << "Default output device: " << p.getDefaultOutputDevice();
                     _log(ss.str());
                 }
             }
             catch (const std::exception& e)
             {
                 std::vector<std::string> messages;
-                auto textSystem = context->getSystemT<System::TextSystem>();
-                messages.push_back(textSystem->getText(DJV_TEXT("error_rtaudio_init")));
+                messages.push_back(errorText);
                 messages.push_back(e.what());
                 _log(String::join(messages, ' '), System::LogLevel::Error);
             }
-
-            _logInitTime();
         }
 
         AudioSystem::AudioSystem() :
@@ -169,7 +197,11 @@ namespace djv
         {}
 
         AudioSystem::~AudioSystem()
-        {}
+        {
+            // The device probe uses the private data so wait for it to
+            // finish, the context may be destroyed before the first tick.
+            waitForInit();
+        }
 
         std::shared_ptr<AudioSystem> AudioSystem::create(const std::shared_ptr<System::Context>& context)
         {
@@ -189,18 +221,30 @@ namespace djv
 
         const std::vector<Device>& AudioSystem::getDevices() const
         {
+            waitForInit();
             return _p->devices;
         }
             
         unsigned int AudioSystem::getDefaultInputDevice()
         {
-            DJV_PRIVATE_PTR();
-            unsigned int out = p.rtAudio->getDefaultInputDevice();
-            const unsigned int rtDeviceCount = p.rtAudio->getDeviceCount();
+            waitForInit();
+            return _p->getDefaultInputDevice();
+        }
+        
+        unsigned int AudioSystem::getDefaultOutputDevice()
+        {
+            waitForInit();
+            return _p->getDefaultOutputDevice();
+        }
+
+        unsigned int AudioSystem::Private::getDefaultInputDevice()
+        {
+            unsigned int out = rtAudio->getDefaultInputDevice();
+            const unsigned int rtDeviceCount = rtAudio->getDeviceCount();
             std::vector<uint8_t> inputChannels;
             for (unsigned int i = 0; i < rtDeviceCount; ++i)
             {
-                const RtAudio::DeviceInfo rtInfo = p.rtAudio->getDeviceInfo(i);
+                const RtAudio::DeviceInfo rtInfo = rtAudio->getDeviceInfo(i);
                 inputChannels.push_back(rtInfo.inputChannels);
             }
             if (out < inputChannels.size())
@@ -219,15 +263,14 @@ namespace djv
             return out;
         }
         
-        unsigned int AudioSystem::getDefaultOutputDevice()
+        unsigned int AudioSystem::Private::getDefaultOutputDevice()
         {
-            DJV_PRIVATE_PTR();
-            unsigned int out = p.rtAudio->getDefaultOutputDevice();
-            const unsigned int rtDeviceCount = p.rtAudio->getDeviceCount();
+            unsigned int out = rtAudio->getDefaultOutputDevice();
+            const unsigned int rtDeviceCount = rtAudio->getDeviceCount();
             std::vector<uint8_t> outputChannels;
             for (unsigned int i = 0; i < rtDeviceCount; ++i)
             {
-                const RtAudio::DeviceInfo rtInfo = p.rtAudio->getDeviceInfo(i);
+                const RtAudio::DeviceInfo rtInfo = rtAudio->getDeviceInfo(i);
                 outputChannels.push_back(rtInfo.outputChannels);
             }
             if (out < outputChannels.size())
@@ -6,6 +6,8 @@
 
 #include <djvSystem/ISystem.h>
 
+#include <map>
+
 namespace djv
 {
     namespace Audio
@@ -55,6 +57,10 @@ namespace djv
             unsigned int getDefaultOutputDevice();
 
         private:
+            void _probeDevices(
+                const std::map<DeviceFormat, std::string>&,
+                const std::string& errorText);
+
             DJV_PRIVATE();
         };
 
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAudio/Resample.h>
+
+#include <djvMath/Math.h>
+#include <djvMath/MathFunc.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace Audio
+    {
+        namespace
+        {
+            size_t gcd(size_t a, size_t b)
+            {
+                while (b)
+                {
+                    const size_t tmp = a % b;
+                    a = b;
+                    b = tmp;
+                }
+                return a;
+            }
+
+            //! The cutoff is lowered slightly below the Nyquist frequency so
+            //! the transition band does not alias.
+            const double cutoffScale = .95;
+
+            //! Multiply and add four lanes at a time. The separate sums let the
+            //! compiler use vector instructions without reordering additions.
+            inline F32_T dot(const F32_T* a, const F32_T* b, size_t count)
+            {
+                F32_T s0 = 0.F;
+                F32_T s1 = 0.F;
+                F32_T s2 = 0.F;
+                F32_T s3 = 0.F;
+                for (size_t i = 0; i < count; i += 4)
+                {
+                    s0 += a[i] * b[i];
+                    s1 += a[i + 1] * b[i + 1];
+                    s2 += a[i + 2] * b[i + 2];
+                    s3 += a[i + 3] * b[i + 3];
+                }
+                return (s0 + s1) + (s2 + s3);
+            }
+
+        } // namespace
+
+        Resampler::Resampler()
+        {}
+
+        Resampler::Resampler(
+            uint8_t channelCount,
+            size_t  inputRate,
+            size_t  outputRate,
+            size_t  tapCount) :
+            _channelCount(channelCount),
+            _inputRate(inputRate),
+            _outputRate(outputRate),
+            _tapCount(std::max((tapCount + 3) / 4 * 4, static_cast<size_t>(4)))
+        {
+            _filterInit();
+            reset();
+        }
+
+        uint8_t Resampler::getChannelCount() const
+        {
+            return _channelCount;
+        }
+
+        size_t Resampler::getInputRate() const
+        {
+            return _inputRate;
+        }
+
+        size_t Resampler::getOutputRate() const
+        {
+            return _outputRate;
+        }
+
+        size_t Resampler::getTapCount() const
+        {
+            return _tapCount;
+        }
+
+        size_t Resampler::getLatency() const
+        {
+            return _tapCount / 2;
+        }
+
+        void Resampler::process(const F32_T* value, size_t sampleCount, std::vector<F32_T>& out)
+        {
+            if (!_channelCount || _filter.empty())
+                return;
+
+            // De-interleave the input.
+            for (uint8_t c = 0; c < _channelCount; ++c)
+            {
+                auto& history = _history[c];
+                const size_t size = history.size();
+                history.resize(size + sampleCount);
+                const F32_T* inP = value + c;
+                F32_T* outP = history.data() + size;
+                for (size_t i = 0; i < sampleCount; ++i, inP += _channelCount, ++outP)
+                {
+                    *outP = *inP;
+                }
+            }
+
+            // Filter the output samples.
+            const size_t half = _tapCount / 2;
+            const size_t size = _history[0].size();
+            if (_index + half < size)
+            {
+                out.reserve(out.size() + ((size - _index) * _up / _down + 1) * _channelCount);
+            }
+            while (_index + half < size)
+            {
+                const size_t start = _index + 1 - half;
+                if (_phaseCount == _up)
+                {
+                    const F32_T* filter = _filter.data() + _remainder * _tapCount;
+                    for (uint8_t c = 0; c < _channelCount; ++c)
+                    {
+                        out.push_back(dot(filter, _history[c].data() + start, _tapCount));
+                    }
+                }
+                else
+                {
+                    const double phase = _remainder * _phaseCount / static_cast<double>(_up);
+                    const size_t phaseIndex = static_cast<size_t>(phase);
+                    const F32_T t = static_cast<F32_T>(phase - phaseIndex);
+                    const F32_T* filter0 = _filter.data() + phaseIndex * _tapCount;
+                    const F32_T* filter1 = filter0 + _tapCount;
+                    for (uint8_t c = 0; c < _channelCount; ++c)
+                    {
+                        const F32_T* history = _history[c].data() + start;
+                        out.push_back(Math::lerp(t, dot(filter0, history, _tapCount), dot(filter1, history, _tapCount)));
+                    }
+                }
+                _remainder += _down;
+                _index += _remainder / _up;
+                _remainder %= _up;
+            }
+
+            // Remove the input that is no longer needed.
+            const size_t remove = std::min(_index + 1 - half, size);
+            for (auto& i : _history)
+            {
+                i.erase(i.begin(), i.begin() + remove);
+            }
+            _index -= remove;
+        }
+
+        void Resampler::reset()
+        {
+            // Start with half of the taps of silence so the first output
+            // sample is aligned with the first input sample.
+            const size_t half = _tapCount / 2;
+            _history.clear();
+            _history.resize(_channelCount, std::vector<F32_T>(half - 1, 0.F));
+            _index = half - 1;
+            _remainder = 0;
+        }
+
+        void Resampler::_filterInit()
+        {
+            _filter.clear();
+            if (!_inputRate || !_outputRate)
+                return;
+
+            const size_t divisor = gcd(_inputRate, _outputRate);
+            _up = _outputRate / divisor;
+            _down = _inputRate / divisor;
+            _phaseCount = std::min(_up, resamplePhaseCount);
+
+            // Build a windowed sinc filter for each phase, with an extra phase
+            // at the end for interpolation.
+            const double cutoff = std::min(1.0, _up / static_cast<double>(_down)) * cutoffScale;
+            const double half = _tapCount / 2.0;
+            _filter.resize((_phaseCount + 1) * _tapCount);
+            for (size_t p = 0; p <= _phaseCount; ++p)
+            {
+                const double phase = p / static_cast<double>(_phaseCount);
+                F32_T* filter = _filter.data() + p * _tapCount;
+                double sum = 0.0;
+                for (size_t k = 0; k < _tapCount; ++k)
+                {
+                    const double t = k - (half - 1.0) - phase;
+                    const double x = Math::pi * cutoff * t;
+                    const double sinc = std::abs(x) > 0.0 ? (std::sin(x) / x) : 1.0;
+                    const double w = t / half;
+                    const double blackman = .42 + .5 * std::cos(Math::pi * w) + .08 * std::cos(2.0 * Math::pi * w);
+                    const double v = sinc * blackman;
+                    filter[k] = static_cast<F32_T>(v);
+                    sum += v;
+                }
+                if (sum != 0.0)
+                {
+                    for (size_t k = 0; k < _tapCount; ++k)
+                    {
+                        filter[k] = static_cast<F32_T>(filter[k] / sum);
+                    }
+                }
+            }
+        }
+
+    } // namespace Audio
+} // namespace djv
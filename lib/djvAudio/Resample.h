@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAudio/Type.h>
+
+#include <vector>
+
+namespace djv
+{
+    namespace Audio
+    {
+        //! This constant provides the default number of filter taps used for
+        //! each output sample.
+        const size_t resampleTapCount = 64;
+
+        //! This constant provides the maximum number of filter phases. Rates
+        //! that need more phases interpolate between neighboring phases.
+        const size_t resamplePhaseCount = 256;
+
+        //! This class provides a polyphase resampler for interleaved floating
+        //! point samples.
+        //!
+        //! The conversion ratio is kept as a reduced fraction of the rates so
+        //! the position in the input never drifts. The output is aligned with
+        //! the input, so the first output samples are produced once half of
+        //! the filter taps of input are available.
+        class Resampler
+        {
+        public:
+            Resampler();
+            Resampler(
+                uint8_t channelCount,
+                size_t  inputRate,
+                size_t  outputRate,
+                size_t  tapCount = resampleTapCount);
+
+            //! \name Information
+            ///@{
+
+            uint8_t getChannelCount() const;
+            size_t getInputRate() const;
+            size_t getOutputRate() const;
+            size_t getTapCount() const;
+
+            //! Get the number of input samples needed before the first output
+            //! sample is produced.
+            size_t getLatency() const;
+
+            ///@}
+
+            //! Resample interleaved samples, the output is appended.
+            void process(const F32_T*, size_t sampleCount, std::vector<F32_T>&);
+
+            //! Clear the input history.
+            void reset();
+
+        private:
+            void _filterInit();
+
+            uint8_t _channelCount = 0;
+            size_t _inputRate = 0;
+            size_t _outputRate = 0;
+            size_t _up = 1;
+            size_t _down = 1;
+            size_t _tapCount = resampleTapCount;
+            size_t _phaseCount = 1;
+            std::vector<F32_T> _filter;
+            std::vector<std::vector<F32_T> > _history;
+            size_t _index = 0;
+            size_t _remainder = 0;
+        };
+
+    } // namespace Audio
+} // namespace djv
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAudio/RingBuffer.h>
+
+#include <algorithm>
+
+namespace djv
+{
+    namespace Audio
+    {
+        RingBuffer::RingBuffer() :
+            _readPos(0),
+            _writePos(0)
+        {}
+
+        RingBuffer::RingBuffer(uint8_t channelCount, size_t sampleMax) :
+            _channelCount(channelCount),
+            _sampleMax(sampleMax),
+            _data(sampleMax * channelCount),
+            _readPos(0),
+            _writePos(0)
+        {}
+
+        uint8_t RingBuffer::getChannelCount() const
+        {
+            return _channelCount;
+        }
+
+        size_t RingBuffer::getSampleMax() const
+        {
+            return _sampleMax;
+        }
+
+        size_t RingBuffer::getReadCount() const
+        {
+            return _writePos.load(std::memory_order_acquire) - _readPos.load(std::memory_order_acquire);
+        }
+
+        size_t RingBuffer::getWriteCount() const
+        {
+            return _sampleMax - getReadCount();
+        }
+
+        size_t RingBuffer::write(const F32_T* value, size_t sampleCount)
+        {
+            if (!_sampleMax)
+                return 0;
+            const size_t writePos = _writePos.load(std::memory_order_relaxed);
+            const size_t readPos = _readPos.load(std::memory_order_acquire);
+            const size_t count = std::min(sampleCount, _sampleMax - (writePos - readPos));
+
+            // Copy the samples up to the end of the buffer, and the rest to
+            // the start.
+            const size_t start = writePos % _sampleMax;
+            const size_t first = std::min(count, _sampleMax - start);
+            std::copy(value, value + first * _channelCount, _data.data() + start * _channelCount);
+            std::copy(value + first * _channelCount, value + count * _channelCount, _data.data());
+
+            _writePos.store(writePos + count, std::memory_order_release);
+            return count;
+        }
+
+        size_t RingBuffer::read(F32_T* value, size_t sampleCount)
+        {
+            if (!_sampleMax)
+                return 0;
+            const size_t readPos = _readPos.load(std::memory_order_relaxed);
+            const size_t writePos = _writePos.load(std::memory_order_acquire);
+            const size_t count = std::min(sampleCount, writePos - readPos);
+
+            const size_t start = readPos % _sampleMax;
+            const size_t first = std::min(count, _sampleMax - start);
+            const F32_T* data = _data.data();
+            std::copy(data + start * _channelCount, data + (start + first) * _channelCount, value);
+            std::copy(data, data + (count - first) * _channelCount, value + first * _channelCount);
+
+            _readPos.store(readPos + count, std::memory_order_release);
+            return count;
+        }
+
+        void RingBuffer::clear()
+        {
+            _readPos.store(_writePos.load(std::memory_order_acquire), std::memory_order_release);
+        }
+
+    } // namespace Audio
+} // namespace djv
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAudio/Type.h>
+
+#include <atomic>
+#include <vector>
+
+namespace djv
+{
+    namespace Audio
+    {
+        //! This class provides a lock-free ring buffer of interleaved floating
+        //! point samples for one producer thread and one consumer thread.
+        //!
+        //! The read and write positions only increase, the number of samples
+        //! in the buffer is the difference between them.
+        class RingBuffer
+        {
+            DJV_NON_COPYABLE(RingBuffer);
+
+        public:
+            RingBuffer();
+            RingBuffer(uint8_t channelCount, size_t sampleMax);
+
+            //! \name Information
+            ///@{
+
+            uint8_t getChannelCount() const;
+            size_t getSampleMax() const;
+
+            //! Get the number of samples that can be read.
+            size_t getReadCount() const;
+
+            //! Get the number of samples that can be written.
+            size_t getWriteCount() const;
+
+            ///@}
+
+            //! Write samples from the producer thread. Returns the number of
+            //! samples that were written.
+            size_t write(const F32_T*, size_t sampleCount);
+
+            //! Read samples from the consumer thread. Returns the number of
+            //! samples that were read.
+            size_t read(F32_T*, size_t sampleCount);
+
+            //! Remove all of the samples. This must not be called while the
+            //! consumer is reading.
+            void clear();
+
+        private:
+            uint8_t _channelCount = 0;
+            size_t _sampleMax = 0;
+            std::vector<F32_T> _data;
+            std::atomic<size_t> _readPos;
+            std::atomic<size_t> _writePos;
+        };
+
+    } // namespace Audio
+} // namespace djv
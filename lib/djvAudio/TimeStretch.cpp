@@ -0,0 +1,214 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAudio/TimeStretch.h>
+
+#include <djvMath/Math.h>
+#include <djvMath/MathFunc.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace Audio
+    {
+        namespace
+        {
+            //! \todo Should this be configurable?
+            const float windowSeconds = .03F;
+            const size_t windowSizeMin = 64;
+
+            //! Compare a window of the input with the natural continuation. The
+            //! comparison uses every other sample to halve the cost.
+            inline float getSimilarity(const F32_T* candidate, const F32_T* natural, size_t size)
+            {
+                float correlation = 0.F;
+                float energy = 0.F;
+                for (size_t i = 0; i < size; i += 2)
+                {
+                    correlation += candidate[i] * natural[i];
+                    energy += candidate[i] * candidate[i];
+                }
+                return correlation / std::sqrt(energy + 1.0e-9F);
+            }
+
+        } // namespace
+
+        TimeStretch::TimeStretch()
+        {}
+
+        TimeStretch::TimeStretch(uint8_t channelCount, size_t sampleRate) :
+            _channelCount(channelCount),
+            _sampleRate(sampleRate)
+        {
+            if (_channelCount && _sampleRate)
+            {
+                _windowSize = std::max(
+                    static_cast<size_t>(_sampleRate * windowSeconds) / 4 * 4,
+                    windowSizeMin);
+                _overlapSize = _windowSize / 2;
+                _searchSize = _overlapSize / 4 * 2;
+
+                // A Hann window overlapped by half sums to one.
+                _window.resize(_windowSize);
+                for (size_t i = 0; i < _windowSize; ++i)
+                {
+                    _window[i] = .5F - .5F * std::cos(Math::pi2 * i / static_cast<float>(_windowSize));
+                }
+            }
+            reset();
+        }
+
+        uint8_t TimeStretch::getChannelCount() const
+        {
+            return _channelCount;
+        }
+
+        size_t TimeStretch::getSampleRate() const
+        {
+            return _sampleRate;
+        }
+
+        size_t TimeStretch::getWindowSize() const
+        {
+            return _windowSize;
+        }
+
+        float TimeStretch::getSpeed() const
+        {
+            return _speed;
+        }
+
+        void TimeStretch::setSpeed(float value)
+        {
+            _speed = Math::clamp(value, timeStretchSpeedRange.getMin(), timeStretchSpeedRange.getMax());
+        }
+
+        void TimeStretch::process(const F32_T* value, size_t sampleCount, std::vector<F32_T>& out)
+        {
+            if (!_windowSize)
+                return;
+
+            // Add the input, and a mono mix that is used to compare windows.
+            _input.insert(_input.end(), value, value + sampleCount * _channelCount);
+            const size_t monoSize = _mono.size();
+            _mono.resize(monoSize + sampleCount);
+            const float channelScale = 1.F / _channelCount;
+            for (size_t i = 0; i < sampleCount; ++i)
+            {
+                const F32_T* p = value + i * _channelCount;
+                float sum = 0.F;
+                for (uint8_t c = 0; c < _channelCount; ++c)
+                {
+                    sum += p[c];
+                }
+                _mono[monoSize + i] = sum * channelScale;
+            }
+
+            const size_t size = _mono.size();
+            while (true)
+            {
+                // Find the window near the input position that is most similar
+                // to the continuation of the previous window.
+                const size_t nominal = static_cast<size_t>(_inputPos);
+                size_t pos = nominal;
+                if (_first)
+                {
+                    if (nominal + _windowSize > size)
+                        break;
+                }
+                else
+                {
+                    if (nominal + _searchSize + _windowSize > size ||
+                        _naturalPos + _overlapSize > size)
+                        break;
+                    const F32_T* natural = _mono.data() + _naturalPos;
+                    float similarity = getSimilarity(_mono.data() + nominal, natural, _overlapSize);
+                    const size_t searchMin = nominal > _searchSize ? (nominal - _searchSize) : (nominal % 2);
+                    for (size_t i = searchMin; i <= nominal + _searchSize; i += 2)
+                    {
+                        const float tmp = getSimilarity(_mono.data() + i, natural, _overlapSize);
+                        if (tmp > similarity)
+                        {
+                            similarity = tmp;
+                            pos = i;
+                        }
+                    }
+
+                    // Refine the position between the compared samples.
+                    const size_t coarse = pos;
+                    for (size_t i = coarse > 0 ? (coarse - 1) : 0; i <= coarse + 1; ++i)
+                    {
+                        if (i != coarse && i + _windowSize <= size)
+                        {
+                            const float tmp = getSimilarity(_mono.data() + i, natural, _overlapSize);
+                            if (tmp > similarity)
+                            {
+                                similarity = tmp;
+                                pos = i;
+                            }
+                        }
+                    }
+                }
+
+                // Overlap the first half of the window with the previous
+                // window, and keep the second half for the next one.
+                const size_t outSize = out.size();
+                out.resize(outSize + _overlapSize * _channelCount);
+                const F32_T* inP = _input.data() + pos * _channelCount;
+                F32_T* outP = out.data() + outSize;
+                F32_T* overlapP = _overlap.data();
+                for (size_t i = 0; i < _overlapSize; ++i)
+                {
+                    const F32_T w = _window[i];
+                    for (uint8_t c = 0; c < _channelCount; ++c, ++inP, ++outP, ++overlapP)
+                    {
+                        *outP = *overlapP + w * *inP;
+                    }
+                }
+                overlapP = _overlap.data();
+                for (size_t i = 0; i < _overlapSize; ++i)
+                {
+                    const F32_T w = _window[_overlapSize + i];
+                    for (uint8_t c = 0; c < _channelCount; ++c, ++inP, ++overlapP)
+                    {
+                        *overlapP = w * *inP;
+                    }
+                }
+
+                _naturalPos = pos + _overlapSize;
+                _inputPos += _overlapSize * static_cast<double>(_speed);
+                _first = false;
+            }
+
+            // Remove the input that is no longer needed.
+            if (!_first)
+            {
+                const size_t nominal = static_cast<size_t>(_inputPos);
+                const size_t remove = std::min(
+                    std::min(nominal > _searchSize ? (nominal - _searchSize) : 0, _naturalPos),
+                    size);
+                _mono.erase(_mono.begin(), _mono.begin() + remove);
+                _input.erase(_input.begin(), _input.begin() + remove * _channelCount);
+                _inputPos -= remove;
+                _naturalPos -= remove;
+            }
+        }
+
+        void TimeStretch::reset()
+        {
+            _input.clear();
+            _mono.clear();
+            _overlap.clear();
+            _overlap.resize(_overlapSize * _channelCount, 0.F);
+            _inputPos = 0.0;
+            _naturalPos = 0;
+            _first = true;
+        }
+
+    } // namespace Audio
+} // namespace djv
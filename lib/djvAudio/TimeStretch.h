@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAudio/Type.h>
+
+#include <vector>
+
+namespace djv
+{
+    namespace Audio
+    {
+        //! This constant provides the range of time stretch speeds.
+        const Math::Range<float> timeStretchSpeedRange(.25F, 4.F);
+
+        //! This class provides time stretching that changes the speed of
+        //! interleaved floating point samples without changing the pitch.
+        //!
+        //! This uses WSOLA (waveform similarity overlap-add): windows of the
+        //! input are taken at the speed and each one is shifted within a
+        //! small range to best match the continuation of the previous window
+        //! before they are overlapped.
+        class TimeStretch
+        {
+        public:
+            TimeStretch();
+            TimeStretch(uint8_t channelCount, size_t sampleRate);
+
+            //! \name Information
+            ///@{
+
+            uint8_t getChannelCount() const;
+            size_t getSampleRate() const;
+
+            //! Get the number of samples in each window.
+            size_t getWindowSize() const;
+
+            ///@}
+
+            //! \name Speed
+            ///@{
+
+            float getSpeed() const;
+
+            //! Set the speed, it is clamped to the time stretch speed range.
+            void setSpeed(float);
+
+            ///@}
+
+            //! Time stretch interleaved samples, the output is appended.
+            void process(const F32_T*, size_t sampleCount, std::vector<F32_T>&);
+
+            //! Clear the input and the overlap.
+            void reset();
+
+        private:
+            uint8_t _channelCount = 0;
+            size_t _sampleRate = 0;
+            float _speed = 1.F;
+            size_t _windowSize = 0;
+            size_t _overlapSize = 0;
+            size_t _searchSize = 0;
+            std::vector<F32_T> _window;
+            std::vector<F32_T> _input;
+            std::vector<F32_T> _mono;
+            std::vector<F32_T> _overlap;
+            double _inputPos = 0.0;
+            size_t _naturalPos = 0;
+            bool _first = true;
+        };
+
+    } // namespace Audio
+} // namespace djv
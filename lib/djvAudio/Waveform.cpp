@@ -0,0 +1,281 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAudio/Waveform.h>
+
+#include <djvAudio/Data.h>
+#include <djvAudio/DataFunc.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace Audio
+    {
+        namespace
+        {
+            //! Combine two summaries weighted by the number of samples in each.
+            WaveformSample combine(
+                const WaveformSample& a,
+                size_t                aCount,
+                const WaveformSample& b,
+                size_t                bCount)
+            {
+                WaveformSample out;
+                out.min = std::min(a.min, b.min);
+                out.max = std::max(a.max, b.max);
+                const size_t count = aCount + bCount;
+                if (count > 0)
+                {
+                    out.rms = std::sqrt(
+                        (a.rms * a.rms * aCount + b.rms * b.rms * bCount) /
+                        static_cast<float>(count));
+                }
+                return out;
+            }
+
+        } // namespace
+
+        bool WaveformSample::operator == (const WaveformSample& other) const
+        {
+            return min == other.min &&
+                max == other.max &&
+                rms == other.rms;
+        }
+
+        Waveform::Waveform()
+        {}
+
+        Waveform::Waveform(
+            uint8_t channelCount,
+            size_t  sampleRate,
+            size_t  blockSize) :
+            _channelCount(channelCount),
+            _sampleRate(sampleRate),
+            _blockSize(std::max(blockSize, static_cast<size_t>(1)))
+        {
+            _levels.resize(1);
+            _levels[0].resize(channelCount);
+            _accumulators.resize(channelCount);
+        }
+
+        Waveform::Waveform(
+            uint8_t                                          channelCount,
+            size_t                                           sampleRate,
+            size_t                                           blockSize,
+            size_t                                           sampleCount,
+            const std::vector<std::vector<WaveformSample> >& blocks) :
+            Waveform(channelCount, sampleRate, blockSize)
+        {
+            _sampleCount = sampleCount;
+            for (size_t i = 0; i < channelCount && i < blocks.size(); ++i)
+            {
+                _levels[0][i] = blocks[i];
+            }
+            finish();
+        }
+
+        uint8_t Waveform::getChannelCount() const
+        {
+            return _channelCount;
+        }
+
+        size_t Waveform::getSampleRate() const
+        {
+            return _sampleRate;
+        }
+
+        size_t Waveform::getBlockSize() const
+        {
+            return _blockSize;
+        }
+
+        size_t Waveform::getSampleCount() const
+        {
+            return _sampleCount;
+        }
+
+        bool Waveform::isFinished() const
+        {
+            return _finished;
+        }
+
+        size_t Waveform::getLevelCount() const
+        {
+            return _levels.size();
+        }
+
+        size_t Waveform::getLevelBlockSize(size_t level) const
+        {
+            return _blockSize << level;
+        }
+
+        const std::vector<WaveformSample>& Waveform::getLevel(size_t level, uint8_t channel) const
+        {
+            return _levels[level][channel];
+        }
+
+        void Waveform::add(const std::shared_ptr<Data>& value)
+        {
+            if (value && value->getChannelCount() == _channelCount)
+            {
+                const auto data = Type::F32 == value->getType() ? value : convert(value, Type::F32);
+                add(reinterpret_cast<const F32_T*>(data->getData()), data->getSampleCount());
+            }
+        }
+
+        void Waveform::add(const F32_T* data, size_t sampleCount)
+        {
+            if (_finished || 0 == _channelCount)
+                return;
+            for (size_t i = 0; i < sampleCount; ++i)
+            {
+                for (uint8_t c = 0; c < _channelCount; ++c, ++data)
+                {
+                    const float v = *data;
+                    auto& a = _accumulators[c];
+                    if (0 == _accumulatorCount)
+                    {
+                        a.min = v;
+                        a.max = v;
+                        a.sum = 0.0;
+                    }
+                    else
+                    {
+                        a.min = std::min(a.min, v);
+                        a.max = std::max(a.max, v);
+                    }
+                    a.sum += v * v;
+                }
+                ++_accumulatorCount;
+                if (_blockSize == _accumulatorCount)
+                {
+                    for (uint8_t c = 0; c < _channelCount; ++c)
+                    {
+                        const auto& a = _accumulators[c];
+                        WaveformSample sample;
+                        sample.min = a.min;
+                        sample.max = a.max;
+                        sample.rms = static_cast<float>(std::sqrt(a.sum / _accumulatorCount));
+                        _levels[0][c].push_back(sample);
+                    }
+                    _accumulatorCount = 0;
+                }
+            }
+            _sampleCount += sampleCount;
+        }
+
+        void Waveform::finish()
+        {
+            if (_finished || _levels.empty())
+                return;
+            _finished = true;
+
+            // Add the last partial block.
+            if (_accumulatorCount > 0)
+            {
+                for (uint8_t c = 0; c < _channelCount; ++c)
+                {
+                    const auto& a = _accumulators[c];
+                    WaveformSample sample;
+                    sample.min = a.min;
+                    sample.max = a.max;
+                    sample.rms = static_cast<float>(std::sqrt(a.sum / _accumulatorCount));
+                    _levels[0][c].push_back(sample);
+                }
+                _accumulatorCount = 0;
+            }
+            _accumulators.clear();
+
+            // Build the coarser levels.
+            size_t size = _channelCount ? _levels[0][0].size() : 0;
+            while (size > 1)
+            {
+                const size_t level = _levels.size() - 1;
+                const size_t levelBlockSize = getLevelBlockSize(level);
+                std::vector<std::vector<WaveformSample> > next(_channelCount);
+                for (uint8_t c = 0; c < _channelCount; ++c)
+                {
+                    const auto& prev = _levels[level][c];
+                    next[c].reserve((size + 1) / 2);
+                    for (size_t i = 0; i < size; i += 2)
+                    {
+                        if (i + 1 < size)
+                        {
+                            // The last value may summarize fewer samples.
+                            const size_t start = (i + 1) * levelBlockSize;
+                            const size_t count = _sampleCount > start ?
+                                std::min(_sampleCount - start, levelBlockSize) :
+                                levelBlockSize;
+                            next[c].push_back(combine(prev[i], levelBlockSize, prev[i + 1], count));
+                        }
+                        else
+                        {
+                            next[c].push_back(prev[i]);
+                        }
+                    }
+                }
+                _levels.push_back(std::move(next));
+                size = _levels.back()[0].size();
+            }
+        }
+
+        std::vector<WaveformSample> Waveform::getSamples(
+            uint8_t                 channel,
+            const Math::SizeTRange& range,
+            size_t                  count) const
+        {
+            std::vector<WaveformSample> out;
+            if (0 == count || channel >= _channelCount || _levels.empty())
+                return out;
+            out.resize(count);
+
+            // Find the coarsest level with at least one value per output value.
+            const size_t rangeSize = range.getMax() - range.getMin() + 1;
+            const double samplesPerValue = rangeSize / static_cast<double>(count);
+            size_t level = 0;
+            while (level + 1 < _levels.size() && getLevelBlockSize(level + 1) <= samplesPerValue)
+            {
+                ++level;
+            }
+            const auto& values = _levels[level][channel];
+            const size_t levelBlockSize = getLevelBlockSize(level);
+            if (values.empty())
+                return out;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const size_t s0 = range.getMin() + static_cast<size_t>(i * samplesPerValue);
+                const size_t s1 = range.getMin() + static_cast<size_t>((i + 1) * samplesPerValue);
+                const size_t b0 = s0 / levelBlockSize;
+                const size_t b1 = std::max(b0 + 1, (s1 + levelBlockSize - 1) / levelBlockSize);
+                if (b0 >= values.size())
+                    break;
+                WaveformSample sample = values[b0];
+                size_t sampleCount = levelBlockSize;
+                for (size_t b = b0 + 1; b < b1 && b < values.size(); ++b)
+                {
+                    sample = combine(sample, sampleCount, values[b], levelBlockSize);
+                    sampleCount += levelBlockSize;
+                }
+                out[i] = sample;
+            }
+            return out;
+        }
+
+        bool Waveform::operator == (const Waveform& other) const
+        {
+            return _channelCount == other._channelCount &&
+                _sampleRate == other._sampleRate &&
+                _blockSize == other._blockSize &&
+                _sampleCount == other._sampleCount &&
+                _finished == other._finished &&
+                _levels == other._levels;
+        }
+
+    } // namespace Audio
+} // namespace djv
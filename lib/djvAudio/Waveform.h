@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvAudio/Type.h>
+
+#include <memory>
+#include <vector>
+
+namespace djv
+{
+    namespace Audio
+    {
+        class Data;
+
+        //! This constant provides the default number of samples summarized by
+        //! each value of the finest waveform level.
+        const size_t waveformBlockSize = 256;
+
+        //! This struct provides a summary of a block of audio samples.
+        struct WaveformSample
+        {
+            float min = 0.F;
+            float max = 0.F;
+            float rms = 0.F;
+
+            bool operator == (const WaveformSample&) const;
+        };
+
+        //! This class provides a multi-resolution overview of audio data.
+        //!
+        //! The finest level summarizes blocks of samples, and each coarser level
+        //! summarizes pairs of values from the previous level. Drawing a range
+        //! of samples picks the coarsest level that still has a value for each
+        //! pixel, so the cost only depends on the number of pixels.
+        class Waveform
+        {
+        public:
+            Waveform();
+            Waveform(
+                uint8_t channelCount,
+                size_t  sampleRate,
+                size_t  blockSize = waveformBlockSize);
+
+            //! Create a finished waveform from the values of the finest level.
+            Waveform(
+                uint8_t                                         channelCount,
+                size_t                                          sampleRate,
+                size_t                                          blockSize,
+                size_t                                          sampleCount,
+                const std::vector<std::vector<WaveformSample> >& blocks);
+
+            //! \name Information
+            ///@{
+
+            uint8_t getChannelCount() const;
+            size_t getSampleRate() const;
+            size_t getBlockSize() const;
+            size_t getSampleCount() const;
+            bool isFinished() const;
+
+            ///@}
+
+            //! \name Levels
+            ///@{
+
+            size_t getLevelCount() const;
+
+            //! Get the number of samples summarized by each value of a level.
+            size_t getLevelBlockSize(size_t level) const;
+
+            const std::vector<WaveformSample>& getLevel(size_t level, uint8_t channel) const;
+
+            ///@}
+
+            //! \name Building
+            ///@{
+
+            //! Add audio data. The data is converted to floating point and the
+            //! channel count must match the waveform.
+            void add(const std::shared_ptr<Data>&);
+
+            //! Add floating point samples.
+            void add(const F32_T*, size_t sampleCount);
+
+            //! Finish adding data and build the coarser levels.
+            void finish();
+
+            ///@}
+
+            //! Get the summary of a range of samples divided into the given
+            //! number of values, for example one value per pixel.
+            std::vector<WaveformSample> getSamples(
+                uint8_t                  channel,
+                const Math::SizeTRange&  range,
+                size_t                   count) const;
+
+            bool operator == (const Waveform&) const;
+
+        private:
+            uint8_t _channelCount = 0;
+            size_t _sampleRate = 0;
+            size_t _blockSize = waveformBlockSize;
+            size_t _sampleCount = 0;
+            bool _finished = false;
+            std::vector<std::vector<std::vector<WaveformSample> > > _levels;
+
+            struct Accumulator
+            {
+                float min = 0.F;
+                float max = 0.F;
+                double sum = 0.0;
+            };
+            std::vector<Accumulator> _accumulators;
+            size_t _accumulatorCount = 0;
+        };
+
+    } // namespace Audio
+} // namespace djv
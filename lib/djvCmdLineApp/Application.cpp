@@ -11,14 +11,19 @@
 #include <djvSystem/LogSystem.h>
 #include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TextSystem.h>
+#include <djvSystem/TimerFunc.h>
 
 #include <djvCore/ErrorFunc.h>
 #include <djvCore/OS.h>
 #include <djvCore/StringFormat.h>
 #include <djvCore/StringFunc.h>
 
+#include <algorithm>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
 using namespace djv::Core;
 
@@ -30,6 +35,16 @@ namespace djv
         {
             //! \todo Should this be configurable?
             const size_t frameRate = 60;
+            const size_t idleTimeout = 1000;
+
+            //! This struct is shared with the context wake callback, which
+            //! may be called from other threads.
+            struct Wake
+            {
+                std::mutex mutex;
+                std::condition_variable cv;
+                bool woken = false;
+            };
 
         } // namespace
 
@@ -37,6 +52,7 @@ namespace djv
         {
             bool running = false;
             int exit = 0;
+            std::shared_ptr<Wake> wake;
         };
 
         void Application::_init(std::list<std::string>& args)
@@ -49,6 +65,21 @@ namespace djv
             }
             Context::_init(argv0);
 
+            // Wake the event loop when systems have finished asynchronous
+            // requests.
+            DJV_PRIVATE_PTR();
+            p.wake = std::make_shared<Wake>();
+            auto wake = p.wake;
+            getWakeCallback()->setCallback(
+                [wake]
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(wake->mutex);
+                        wake->woken = true;
+                    }
+                    wake->cv.notify_one();
+                });
+
             // Parse the command line.
             auto logSystem = getSystemT<System::LogSystem>();
             {
@@ -86,7 +117,9 @@ namespace djv
         {}
 
         Application::~Application()
-        {}
+        {
+            getWakeCallback()->setCallback(nullptr);
+        }
 
         std::shared_ptr<Application> Application::create(std::list<std::string>& args)
         {
@@ -98,21 +131,28 @@ namespace djv
         void Application::run()
         {
             DJV_PRIVATE_PTR();
-            auto time = std::chrono::steady_clock::now();
-            Time::Duration delta = Time::Duration::zero();
             p.running = true;
             while (p.running)
             {
+                const auto time = std::chrono::steady_clock::now();
                 tick();
-
-                auto end = std::chrono::steady_clock::now();
-                delta = std::chrono::duration_cast<Time::Duration>(end - time);
-                while (delta < std::chrono::microseconds(1000000 / frameRate))
+                if (p.running)
                 {
-                    end = std::chrono::steady_clock::now();
-                    delta = std::chrono::duration_cast<Time::Duration>(end - time);
+                    // Sleep until the wake time or until a system wakes us,
+                    // but not more than once per frame.
+                    {
+                        std::unique_lock<std::mutex> lock(p.wake->mutex);
+                        p.wake->cv.wait_until(
+                            lock,
+                            _getWakeTime(time),
+                            [&p]
+                            {
+                                return p.wake->woken;
+                            });
+                        p.wake->woken = false;
+                    }
+                    std::this_thread::sleep_until(time + std::chrono::microseconds(1000000 / frameRate));
                 }
-                time = end;
             }
         }
 
@@ -223,6 +263,17 @@ namespace djv
             std::cout << std::endl;
         }
 
+        Time::TimePoint Application::_getWakeTime(const Time::TimePoint& tickTime) const
+        {
+            // Sleep until the next timer or animation needs a tick, no sooner
+            // than the next frame and no later than the idle timeout.
+            return System::getWakeTime(
+                tickTime,
+                getNextTick(),
+                frameRate,
+                std::chrono::milliseconds(idleTimeout));
+        }
+
         bool Application::_isRunning() const
         {
             return _p->running;
@@ -48,6 +48,10 @@ namespace djv
             virtual void _parseCmdLine(std::list<std::string>&);
             virtual void _printUsage();
 
+            //! Get the time the event loop should wake up, given the time the
+            //! last tick started.
+            Core::Time::TimePoint _getWakeTime(const Core::Time::TimePoint&) const;
+
             bool _isRunning() const;
             void _setRunning(bool);
 
@@ -61,6 +61,14 @@ namespace djv
             GLFWSystem::create(shared_from_this());
             UI::UISystem::create(resetSettings, shared_from_this());
             p.eventSystem = EventSystem::create(getSystemT<GL::GLFW::GLFWSystem>()->getWindow(), shared_from_this());
+
+            // Wake the event loop when systems have finished asynchronous
+            // requests, glfwPostEmptyEvent() may be called from any thread.
+            getWakeCallback()->setCallback(
+                []
+                {
+                    glfwPostEmptyEvent();
+                });
         }
         
         Application::Application() :
@@ -68,7 +76,10 @@ namespace djv
         {}
         
         Application::~Application()
-        {}
+        {
+            // Clear the callback before GLFW is terminated.
+            getWakeCallback()->setCallback(nullptr);
+        }
 
         std::shared_ptr<Application> Application::create(std::list<std::string>& args)
         {
@@ -87,9 +98,22 @@ namespace djv
                 _setRunning(true);
                 while (_isRunning() && glfwWindow && !glfwWindowShouldClose(glfwWindow))
                 {
-                    glfwPollEvents();
+                    // The event system swaps the buffers when the window has
+                    // been repainted. Between ticks wait for input events,
+                    // the next timer, or a wake from a system that has
+                    // finished an asynchronous request, instead of polling.
+                    const auto time = std::chrono::steady_clock::now();
                     tick();
-                    glfwSwapBuffers(glfwWindow);
+                    const auto timeout = std::chrono::duration<double>(
+                        _getWakeTime(time) - std::chrono::steady_clock::now()).count();
+                    if (timeout > 0.0)
+                    {
+                        glfwWaitEventsTimeout(timeout);
+                    }
+                    else
+                    {
+                        glfwPollEvents();
+                    }
                 }
             }
         }
@@ -69,6 +69,7 @@ namespace djv
             glm::vec2 contentScale = glm::vec2(1.F, 1.F);
             std::shared_ptr<Render2D::Render> render;
             std::shared_ptr<GL::OffscreenBuffer> offscreenBuffer;
+            bool swap = false;
 #if defined(DJV_GL_ES2)
             std::shared_ptr<GL::Shader> shader;
 #endif // DJV_GL_ES2
@@ -181,17 +182,24 @@ namespace djv
             const bool resizeRequest = _resizeRequestReset();
             if (resizeRequest)
             {
+                // Widgets request resizing when their size hints change, so
+                // only re-create the offscreen buffer when the window size
+                // has changed.
                 const Image::Size size(p.resize.x, p.resize.y);
-                if (size.isValid())
+                if (!p.offscreenBuffer || p.offscreenBuffer->getSize() != size)
                 {
-                    p.offscreenBuffer = GL::OffscreenBuffer::create(
-                        size,
-                        Image::Type::RGBA_U8,
-                        _getTextSystem());
-                }
-                else
-                {
-                    p.offscreenBuffer.reset();
+                    if (size.isValid())
+                    {
+                        p.offscreenBuffer = GL::OffscreenBuffer::create(
+                            size,
+                            Image::Type::RGBA_U8,
+                            _getTextSystem());
+                        redrawRequest();
+                    }
+                    else
+                    {
+                        p.offscreenBuffer.reset();
+                    }
                 }
             }
 
@@ -216,8 +224,8 @@ namespace djv
 
             if (p.offscreenBuffer)
             {
-                const bool redrawRequest = _redrawRequestReset();
                 const auto& size = p.offscreenBuffer->getSize();
+                const Math::BBox2f bounds(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
                 if (resizeRequest)
                 {
                     for (const auto& i : _getWindows())
@@ -237,25 +245,30 @@ namespace djv
                                 System::Event::Layout layout;
                                 _layoutRecursive(window, layout);
 
-                                System::Event::Clip clip(Math::BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h)));
+                                System::Event::Clip clip(bounds);
                                 _clipRecursive(window, clip);
                             }
                         }
                     }
                 }
 
-                if (resizeRequest || redrawRequest)
+                // The layout may have moved widgets, so the damaged region
+                // is not known until afterwards. Only the damaged region is
+                // cleared and painted, the rest of the offscreen buffer is
+                // kept from the previous frame.
+                Math::BBox2f damage;
+                if (_redrawRequestReset(bounds, damage))
                 {
                     p.offscreenBuffer->bind();
-                    p.render->beginFrame(size);
+                    p.render->beginFrame(size, damage);
                     for (const auto& i : _getWindows())
                     {
                         if (auto window = i.lock())
                         {
                             if (window->isVisible())
                             {
-                                System::Event::Paint paintEvent(Math::BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h)));
-                                System::Event::PaintOverlay paintOverlayEvent(Math::BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h)));
+                                System::Event::Paint paintEvent(damage);
+                                System::Event::PaintOverlay paintOverlayEvent(damage);
                                 _paintRecursive(window, paintEvent, paintOverlayEvent);
                             }
                         }
@@ -263,10 +276,17 @@ namespace djv
                     p.render->endFrame();
 
                     glBindFramebuffer(GL_FRAMEBUFFER, 0);
+                    p.swap = true;
                 }
             }
 
-            _redraw();
+            // Only swap the buffers when the window has changed.
+            if (p.swap)
+            {
+                p.swap = false;
+                _redraw();
+                glfwSwapBuffers(p.glfwWindow);
+            }
         }
 
         void EventSystem::_pushClipRect(const Math::BBox2f& value)
@@ -484,7 +504,7 @@ namespace djv
             {
                 if (auto system = context->getSystemT<EventSystem>())
                 {
-                    system->_redraw();
+                    system->_p->swap = true;
                 }
             }
         }
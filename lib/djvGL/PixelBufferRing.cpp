@@ -0,0 +1,298 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvGL/PixelBufferRing.h>
+
+#include <djvGL/Texture.h>
+
+#include <djvImage/Data.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace GL
+    {
+        namespace
+        {
+            const GLuint64 fenceTimeout = 1000000000;
+
+        } // namespace
+
+        struct PixelBufferRing::Private
+        {
+#if !defined(DJV_GL_ES2)
+            struct Buffer
+            {
+                GLuint id = 0;
+                size_t byteCount = 0;
+                GLsync fence = 0;
+                bool pending = false;
+            };
+            std::vector<Buffer> buffers;
+            size_t index = 0;
+
+            struct Pending
+            {
+                size_t buffer = 0;
+                std::shared_ptr<Texture> texture;
+                Image::Info info;
+            };
+            std::vector<Pending> pending;
+
+            struct Copy
+            {
+                std::shared_ptr<Image::Data> data;
+                uint8_t* mapped = nullptr;
+            };
+            std::list<Copy> copies;
+            size_t copiesInFlight = 0;
+            std::condition_variable copyCV;
+            std::condition_variable finishCV;
+            std::mutex mutex;
+            bool running = true;
+            std::thread thread;
+#endif // DJV_GL_ES2
+
+            size_t uploadCount = 0;
+            size_t uploadByteCount = 0;
+            Time::Duration uploadTime = Time::Duration::zero();
+            size_t stallCount = 0;
+        };
+
+        void PixelBufferRing::_init(size_t count)
+        {
+#if !defined(DJV_GL_ES2)
+            DJV_PRIVATE_PTR();
+            p.buffers.resize(std::max(count, size_t(1)));
+            for (auto& i : p.buffers)
+            {
+                glGenBuffers(1, &i.id);
+            }
+
+            // The worker copies the image data into the mapped buffers.
+            p.thread = std::thread(
+                [this]
+                {
+                    DJV_PRIVATE_PTR();
+                    while (true)
+                    {
+                        Private::Copy copy;
+                        {
+                            std::unique_lock<std::mutex> lock(p.mutex);
+                            p.copyCV.wait(
+                                lock,
+                                [this]
+                                {
+                                    return _p->copies.size() || !_p->running;
+                                });
+                            if (p.copies.empty())
+                            {
+                                break;
+                            }
+                            copy = std::move(p.copies.front());
+                            p.copies.pop_front();
+                        }
+                        memcpy(copy.mapped, copy.data->getData(), copy.data->getDataByteCount());
+                        copy.data.reset();
+                        {
+                            std::unique_lock<std::mutex> lock(p.mutex);
+                            --p.copiesInFlight;
+                        }
+                        p.finishCV.notify_one();
+                    }
+                });
+#endif // DJV_GL_ES2
+        }
+
+        PixelBufferRing::PixelBufferRing() :
+            _p(new Private)
+        {}
+
+        PixelBufferRing::~PixelBufferRing()
+        {
+#if !defined(DJV_GL_ES2)
+            DJV_PRIVATE_PTR();
+            {
+                std::unique_lock<std::mutex> lock(p.mutex);
+                p.running = false;
+            }
+            p.copyCV.notify_one();
+            if (p.thread.joinable())
+            {
+                p.thread.join();
+            }
+            for (auto& i : p.buffers)
+            {
+                if (i.fence)
+                {
+                    glDeleteSync(i.fence);
+                }
+                glDeleteBuffers(1, &i.id);
+            }
+#endif // DJV_GL_ES2
+        }
+
+        std::shared_ptr<PixelBufferRing> PixelBufferRing::create(size_t count)
+        {
+            auto out = std::shared_ptr<PixelBufferRing>(new PixelBufferRing);
+            out->_init(count);
+            return out;
+        }
+
+        size_t PixelBufferRing::getCount() const
+        {
+#if !defined(DJV_GL_ES2)
+            return _p->buffers.size();
+#else // DJV_GL_ES2
+            return 0;
+#endif // DJV_GL_ES2
+        }
+
+        void PixelBufferRing::upload(const std::shared_ptr<Image::Data>& data, const std::shared_ptr<Texture>& texture)
+        {
+            DJV_PRIVATE_PTR();
+            const size_t byteCount = data->getDataByteCount();
+
+#if defined(DJV_GL_ES2)
+            const auto start = std::chrono::steady_clock::now();
+            texture->copy(*data);
+#else // DJV_GL_ES2
+            // When every buffer is already in use this frame, the pending
+            // uploads are finished first so the buffer can be reused.
+            if (p.buffers[p.index].pending)
+            {
+                finish();
+            }
+            const auto start = std::chrono::steady_clock::now();
+            const size_t index = p.index;
+            auto& buffer = p.buffers[index];
+            p.index = (p.index + 1) % p.buffers.size();
+
+            // Wait for the previous transfer from this buffer to finish.
+            if (buffer.fence)
+            {
+                GLenum result = glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+                if (GL_TIMEOUT_EXPIRED == result)
+                {
+                    ++p.stallCount;
+                    glClientWaitSync(buffer.fence, GL_SYNC_FLUSH_COMMANDS_BIT, fenceTimeout);
+                }
+                glDeleteSync(buffer.fence);
+                buffer.fence = 0;
+            }
+
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+            if (byteCount > buffer.byteCount)
+            {
+                glBufferData(GL_PIXEL_UNPACK_BUFFER, byteCount, nullptr, GL_STREAM_DRAW);
+                buffer.byteCount = byteCount;
+            }
+            void* mapped = glMapBufferRange(
+                GL_PIXEL_UNPACK_BUFFER,
+                0,
+                byteCount,
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            if (mapped)
+            {
+                buffer.pending = true;
+                Private::Pending pending;
+                pending.buffer = index;
+                pending.texture = texture;
+                pending.info = data->getInfo();
+                p.pending.push_back(pending);
+                {
+                    std::unique_lock<std::mutex> lock(p.mutex);
+                    Private::Copy copy;
+                    copy.data = data;
+                    copy.mapped = reinterpret_cast<uint8_t*>(mapped);
+                    p.copies.push_back(copy);
+                    ++p.copiesInFlight;
+                }
+                p.copyCV.notify_one();
+            }
+            else
+            {
+                texture->copy(*data);
+            }
+#endif // DJV_GL_ES2
+
+            ++p.uploadCount;
+            p.uploadByteCount += byteCount;
+            p.uploadTime += std::chrono::duration_cast<Time::Duration>(std::chrono::steady_clock::now() - start);
+        }
+
+        void PixelBufferRing::finish()
+        {
+#if !defined(DJV_GL_ES2)
+            DJV_PRIVATE_PTR();
+            if (p.pending.empty())
+                return;
+            const auto start = std::chrono::steady_clock::now();
+            {
+                std::unique_lock<std::mutex> lock(p.mutex);
+                p.finishCV.wait(
+                    lock,
+                    [this]
+                    {
+                        return 0 == _p->copiesInFlight;
+                    });
+            }
+            for (const auto& i : p.pending)
+            {
+                auto& buffer = p.buffers[i.buffer];
+                glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+                if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER))
+                {
+                    i.texture->copyUnpackBuffer(i.info);
+                    buffer.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                }
+                buffer.pending = false;
+            }
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            p.pending.clear();
+            p.uploadTime += std::chrono::duration_cast<Time::Duration>(std::chrono::steady_clock::now() - start);
+#endif // DJV_GL_ES2
+        }
+
+        size_t PixelBufferRing::getUploadCount() const
+        {
+            return _p->uploadCount;
+        }
+
+        size_t PixelBufferRing::getUploadByteCount() const
+        {
+            return _p->uploadByteCount;
+        }
+
+        Time::Duration PixelBufferRing::getUploadTime() const
+        {
+            return _p->uploadTime;
+        }
+
+        size_t PixelBufferRing::getStallCount() const
+        {
+            return _p->stallCount;
+        }
+
+        void PixelBufferRing::resetStats()
+        {
+            DJV_PRIVATE_PTR();
+            p.uploadCount = 0;
+            p.uploadByteCount = 0;
+            p.uploadTime = Time::Duration::zero();
+            p.stallCount = 0;
+        }
+
+    } // namespace GL
+} // namespace djv
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvGL/GL.h>
+
+#include <djvCore/Time.h>
+
+#include <memory>
+
+namespace djv
+{
+    namespace Image
+    {
+        class Data;
+
+    } // namespace Image
+
+    namespace GL
+    {
+        class Texture;
+
+        //! This class provides a ring of pixel unpack buffers for streaming
+        //! image data into textures.
+        //!
+        //! An upload maps a buffer and hands the copy of the image data to a
+        //! persistent worker thread, so the copy runs while the caller keeps
+        //! building the frame. When the frame is drawn finish() waits for the
+        //! copies and updates the textures from the buffers, so the driver
+        //! can perform the transfer asynchronously. Each buffer is protected
+        //! by a fence so it is not overwritten while a transfer is still in
+        //! flight.
+        class PixelBufferRing
+        {
+            DJV_NON_COPYABLE(PixelBufferRing);
+            void _init(size_t count);
+            PixelBufferRing();
+
+        public:
+            ~PixelBufferRing();
+
+            static std::shared_ptr<PixelBufferRing> create(size_t count = 3);
+
+            //! \name Information
+            ///@{
+
+            size_t getCount() const;
+
+            ///@}
+
+            //! \name Upload
+            ///@{
+
+            //! Start uploading image data to a texture. The texture must
+            //! already have the same information as the image data, and it
+            //! is not updated until finish() is called.
+            void upload(const std::shared_ptr<Image::Data>&, const std::shared_ptr<Texture>&);
+
+            //! Wait for the pending copies and update the textures.
+            void finish();
+
+            ///@}
+
+            //! \name Statistics
+            ///@{
+
+            //! Get the number of uploads.
+            size_t getUploadCount() const;
+
+            //! Get the number of bytes uploaded.
+            size_t getUploadByteCount() const;
+
+            //! Get the total time the calling thread spent in uploads,
+            //! including waiting for the copies in finish().
+            Core::Time::Duration getUploadTime() const;
+
+            //! Get the number of times an upload had to wait for a previous
+            //! transfer to finish.
+            size_t getStallCount() const;
+
+            //! Reset the statistics.
+            void resetStats();
+
+            ///@}
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace GL
+} // namespace djv
@@ -45,6 +45,10 @@ namespace djv
             void set(const Image::Info&);
             void copy(const Image::Data&);
             void copy(const Image::Data&, uint16_t x, uint16_t y);
+#if !defined(DJV_GL_ES2)
+            //! Copy from the currently bound pixel unpack buffer.
+            void copyUnpackBuffer(const Image::Info&);
+#endif // DJV_GL_ES2
 
             void bind();
 
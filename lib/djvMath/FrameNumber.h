@@ -48,6 +48,10 @@ namespace djv
                 
                 void add(const Range&);
 
+                //! Remove all of the ranges. The memory is kept so that the
+                //! sequence can be rebuilt without allocating.
+                void clear() noexcept;
+
                 bool isValid() const noexcept;
 
                 ///@}
@@ -13,6 +13,11 @@ namespace djv
                 return _ranges;
             }
 
+            inline void Sequence::clear() noexcept
+            {
+                _ranges.clear();
+            }
+
             inline bool Sequence::isValid() const noexcept
             {
                 return _ranges.size() > 0;
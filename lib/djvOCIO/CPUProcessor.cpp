@@ -0,0 +1,204 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvOCIO/CPUProcessor.h>
+
+#include <djvOCIO/LUT.h>
+#include <djvOCIO/LUTFunc.h>
+
+#include <djvImage/Data.h>
+
+#include <OpenColorIO/OpenColorIO.h>
+
+#include <future>
+#include <thread>
+
+using namespace djv::Core;
+namespace _OCIO = OCIO_NAMESPACE;
+
+namespace djv
+{
+    namespace OCIO
+    {
+        namespace
+        {
+            Domain getDomain(const _OCIO::ConstConfigRcPtr& config, const std::string& colorSpace)
+            {
+                Domain out;
+                if (auto ocioColorSpace = config->getColorSpace(colorSpace.c_str()))
+                {
+                    float vars[3] = { 0.F, 1.F, 0.F };
+                    const int varsCount = ocioColorSpace->getAllocationNumVars();
+                    if (varsCount >= 2 && varsCount <= 3)
+                    {
+                        ocioColorSpace->getAllocationVars(vars);
+                    }
+                    switch (ocioColorSpace->getAllocation())
+                    {
+                    case _OCIO::ALLOCATION_LG2:
+                        out.allocation = Allocation::LG2;
+                        if (varsCount < 2)
+                        {
+                            vars[0] = -10.F;
+                            vars[1] = 6.F;
+                        }
+                        break;
+                    default: break;
+                    }
+                    out.min = vars[0];
+                    out.max = vars[1];
+                    out.offset = vars[2];
+                }
+                return out;
+            }
+
+        } // namespace
+
+        struct CPUProcessor::Private
+        {
+            Convert convert;
+            ProcessorMode mode = ProcessorMode::First;
+            _OCIO::ConstProcessorRcPtr processor;
+            bool noOp = false;
+            std::unique_ptr<LUT1D> lut1D;
+            std::unique_ptr<LUT3D> lut3D;
+        };
+
+        void CPUProcessor::_init(const Convert& convert, ProcessorMode mode)
+        {
+            DJV_PRIVATE_PTR();
+            p.convert = convert;
+            p.mode = mode;
+            auto config = _OCIO::GetCurrentConfig();
+            p.processor = config->getProcessor(convert.input.c_str(), convert.output.c_str());
+            p.noOp = p.processor->isNoOp();
+            if (!p.noOp && ProcessorMode::LUT == mode)
+            {
+                const Domain domain = getDomain(config, convert.input);
+                if (!p.processor->hasChannelCrosstalk())
+                {
+                    p.lut1D.reset(new LUT1D(lut1DSize, domain));
+                    _OCIO::PackedImageDesc imageDesc(p.lut1D->getData(), static_cast<long>(lut1DSize), 1, 4);
+                    p.processor->apply(imageDesc);
+                }
+                else
+                {
+                    p.lut3D.reset(new LUT3D(lut3DEdgeLen, domain));
+                    _OCIO::PackedImageDesc imageDesc(
+                        p.lut3D->getData(),
+                        static_cast<long>(lut3DEdgeLen * lut3DEdgeLen),
+                        static_cast<long>(lut3DEdgeLen),
+                        4);
+                    p.processor->apply(imageDesc);
+                }
+            }
+        }
+
+        CPUProcessor::CPUProcessor() :
+            _p(new Private)
+        {}
+
+        CPUProcessor::~CPUProcessor()
+        {}
+
+        std::shared_ptr<CPUProcessor> CPUProcessor::create(const Convert& convert, ProcessorMode mode)
+        {
+            auto out = std::shared_ptr<CPUProcessor>(new CPUProcessor);
+            out->_init(convert, mode);
+            return out;
+        }
+
+        const Convert& CPUProcessor::getConvert() const
+        {
+            return _p->convert;
+        }
+
+        ProcessorMode CPUProcessor::getMode() const
+        {
+            return _p->mode;
+        }
+
+        bool CPUProcessor::isNoOp() const
+        {
+            return _p->noOp;
+        }
+
+        void CPUProcessor::apply(float* rgba, size_t count) const
+        {
+            DJV_PRIVATE_PTR();
+            if (p.noOp || !count)
+                return;
+            if (p.lut1D)
+            {
+                applyLUT1D(*p.lut1D, rgba, count);
+            }
+            else if (p.lut3D)
+            {
+                applyLUT3D(*p.lut3D, rgba, count);
+            }
+            else
+            {
+                _OCIO::PackedImageDesc imageDesc(rgba, static_cast<long>(count), 1, 4);
+                p.processor->apply(imageDesc);
+            }
+        }
+
+        void CPUProcessor::apply(const std::shared_ptr<Image::Data>& data, size_t threads) const
+        {
+            DJV_PRIVATE_PTR();
+            if (p.noOp || !data || !data->isValid())
+                return;
+
+            const Image::Type type = data->getType();
+            const uint16_t w = data->getWidth();
+            const uint16_t h = data->getHeight();
+            if (!threads)
+            {
+                threads = std::thread::hardware_concurrency();
+            }
+            threads = std::max(std::min(threads, static_cast<size_t>(h)), size_t(1));
+
+            // Divide up the rows for each thread. RGBA_F32 data is converted
+            // in place, other types go through a scratch scanline.
+            const size_t rowsPerThread = (h + threads - 1) / threads;
+            std::vector<std::future<void> > futures;
+            for (size_t i = 0; i < threads; ++i)
+            {
+                const uint16_t y0 = static_cast<uint16_t>(std::min(i * rowsPerThread, static_cast<size_t>(h)));
+                const uint16_t y1 = static_cast<uint16_t>(std::min((i + 1) * rowsPerThread, static_cast<size_t>(h)));
+                if (y0 >= y1)
+                    break;
+                futures.push_back(std::async(
+                    std::launch::async,
+                    [this, data, type, w, y0, y1]
+                    {
+                        std::vector<float> scanline;
+                        if (type != Image::Type::RGBA_F32)
+                        {
+                            scanline.resize(static_cast<size_t>(w) * 4);
+                        }
+                        for (uint16_t y = y0; y < y1; ++y)
+                        {
+                            uint8_t* row = data->getData(y);
+                            if (Image::Type::RGBA_F32 == type)
+                            {
+                                apply(reinterpret_cast<float*>(row), w);
+                            }
+                            else
+                            {
+                                Image::convert(row, type, scanline.data(), Image::Type::RGBA_F32, w);
+                                apply(scanline.data(), w);
+                                Image::convert(scanline.data(), Image::Type::RGBA_F32, row, type, w);
+                            }
+                        }
+                    }));
+            }
+            for (auto& i : futures)
+            {
+                i.get();
+            }
+        }
+
+    } // namespace OCIO
+} // namespace djv
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvOCIO/OCIO.h>
+
+#include <memory>
+
+namespace djv
+{
+    namespace Image
+    {
+        class Data;
+
+    } // namespace Image
+
+    namespace OCIO
+    {
+        //! This enumeration provides the CPU processing modes.
+        enum class ProcessorMode
+        {
+            LUT,   //!< Apply a baked 1D or 3D LUT
+            Exact, //!< Apply the OCIO processor directly, for validation
+
+            Count,
+            First = LUT
+        };
+
+        const size_t lut1DSize    = 4096;
+        const size_t lut3DEdgeLen = 48;
+
+        //! This class provides color space conversions on the CPU.
+        //!
+        //! Conversions without channel crosstalk are baked into a 1D LUT,
+        //! all others into a 3D LUT. The LUT domain follows the allocation
+        //! of the input color space.
+        class CPUProcessor
+        {
+            DJV_NON_COPYABLE(CPUProcessor);
+
+        protected:
+            void _init(const Convert&, ProcessorMode);
+            CPUProcessor();
+
+        public:
+            ~CPUProcessor();
+
+            //! Create a new processor using the current OCIO configuration.
+            //! Throws:
+            //! - std::exception
+            static std::shared_ptr<CPUProcessor> create(const Convert&, ProcessorMode = ProcessorMode::LUT);
+
+            const Convert& getConvert() const;
+            ProcessorMode getMode() const;
+            bool isNoOp() const;
+
+            //! Apply the conversion to RGBA pixels.
+            void apply(float* rgba, size_t count) const;
+
+            //! Apply the conversion to image data. The rows are divided
+            //! between the given number of threads, zero uses the hardware
+            //! concurrency.
+            void apply(const std::shared_ptr<Image::Data>&, size_t threads = 0) const;
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace OCIO
+} // namespace djv
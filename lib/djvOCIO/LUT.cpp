@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvOCIO/LUT.h>
+
+namespace djv
+{
+    namespace OCIO
+    {
+        Domain::Domain()
+        {}
+
+        LUT1D::LUT1D(size_t size, const Domain& domain) :
+            _size(std::max(size, size_t(2))),
+            _domain(domain),
+            _data(_size * 4)
+        {
+            float* p = _data.data();
+            for (size_t i = 0; i < _size; ++i, p += 4)
+            {
+                const float v = _domain.fromLUT(i / static_cast<float>(_size - 1));
+                p[0] = v;
+                p[1] = v;
+                p[2] = v;
+                p[3] = 1.F;
+            }
+        }
+
+        LUT3D::LUT3D(size_t edgeLen, const Domain& domain) :
+            _edgeLen(std::max(edgeLen, size_t(2))),
+            _domain(domain),
+            _data(_edgeLen * _edgeLen * _edgeLen * 4)
+        {
+            std::vector<float> values(_edgeLen);
+            for (size_t i = 0; i < _edgeLen; ++i)
+            {
+                values[i] = _domain.fromLUT(i / static_cast<float>(_edgeLen - 1));
+            }
+            float* p = _data.data();
+            for (size_t b = 0; b < _edgeLen; ++b)
+            {
+                for (size_t g = 0; g < _edgeLen; ++g)
+                {
+                    for (size_t r = 0; r < _edgeLen; ++r, p += 4)
+                    {
+                        p[0] = values[r];
+                        p[1] = values[g];
+                        p[2] = values[b];
+                        p[3] = 1.F;
+                    }
+                }
+            }
+        }
+
+    } // namespace OCIO
+} // namespace djv
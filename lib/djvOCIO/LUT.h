@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace djv
+{
+    namespace OCIO
+    {
+        //! This enumeration provides the LUT domain allocations.
+        enum class Allocation
+        {
+            Uniform,
+            LG2,
+
+            Count,
+            First = Uniform
+        };
+
+        //! This struct provides the mapping from input values to the LUT
+        //! domain. It mirrors the OCIO color space allocation variables.
+        struct Domain
+        {
+            Domain();
+
+            Allocation allocation = Allocation::Uniform;
+            float      min        = 0.F;
+            float      max        = 1.F;
+            float      offset     = 0.F;
+
+            //! Map an input value to the normalized LUT domain.
+            float toLUT(float) const;
+
+            //! Map a normalized LUT domain value back to an input value.
+            float fromLUT(float) const;
+
+            bool operator == (const Domain&) const;
+        };
+
+        //! This class provides a baked per-channel 1D LUT. It is used for
+        //! conversions without channel crosstalk.
+        class LUT1D
+        {
+        public:
+            explicit LUT1D(size_t size = 4096, const Domain& = Domain());
+
+            size_t getSize() const;
+            const Domain& getDomain() const;
+
+            //! The data is stored as interleaved RGBA and is initialized with
+            //! the input values for each entry.
+            float* getData();
+            const float* getData() const;
+
+        private:
+            size_t             _size = 0;
+            Domain             _domain;
+            std::vector<float> _data;
+        };
+
+        //! This class provides a baked 3D LUT.
+        class LUT3D
+        {
+        public:
+            explicit LUT3D(size_t edgeLen = 32, const Domain& = Domain());
+
+            size_t getEdgeLen() const;
+            const Domain& getDomain() const;
+
+            //! The data is stored as RGBA with the red index changing fastest.
+            //! The fourth component is padding so that lattice nodes can be
+            //! loaded as a single SIMD register. The data is initialized with
+            //! the input values for each lattice node.
+            float* getData();
+            const float* getData() const;
+
+        private:
+            size_t             _edgeLen = 0;
+            Domain             _domain;
+            std::vector<float> _data;
+        };
+
+    } // namespace OCIO
+} // namespace djv
+
+#include <djvOCIO/LUTInline.h>
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvOCIO/LUTFunc.h>
+
+#include <djvOCIO/LUT.h>
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DJV_OCIO_SSE
+#include <xmmintrin.h>
+#endif // __SSE2__
+
+namespace djv
+{
+    namespace OCIO
+    {
+        namespace
+        {
+            inline float clamp01(float value)
+            {
+                return std::min(std::max(value, 0.F), 1.F);
+            }
+
+            //! Compute the lattice index and fraction for an input value.
+            inline void latticeCoord(const Domain& domain, float value, size_t edgeLen, size_t& index, float& fraction)
+            {
+                const float x = clamp01(domain.toLUT(value)) * static_cast<float>(edgeLen - 1);
+                index = std::min(static_cast<size_t>(x), edgeLen - 2);
+                fraction = x - static_cast<float>(index);
+            }
+
+        } // namespace
+
+        void applyLUT1D(const LUT1D& lut, float* rgba, size_t count)
+        {
+            const size_t size = lut.getSize();
+            const Domain& domain = lut.getDomain();
+            const float* data = lut.getData();
+            float* p = rgba;
+            for (size_t i = 0; i < count; ++i, p += 4)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    size_t index = 0;
+                    float fraction = 0.F;
+                    latticeCoord(domain, p[c], size, index, fraction);
+                    const float a = data[index * 4 + c];
+                    const float b = data[(index + 1) * 4 + c];
+                    p[c] = a + (b - a) * fraction;
+                }
+            }
+        }
+
+        void applyLUT3D(const LUT3D& lut, float* rgba, size_t count)
+        {
+            const size_t edgeLen = lut.getEdgeLen();
+            const Domain& domain = lut.getDomain();
+            const float* data = lut.getData();
+            const size_t dr = 4;
+            const size_t dg = 4 * edgeLen;
+            const size_t db = 4 * edgeLen * edgeLen;
+            float* p = rgba;
+            for (size_t i = 0; i < count; ++i, p += 4)
+            {
+                size_t ir = 0;
+                size_t ig = 0;
+                size_t ib = 0;
+                float fr = 0.F;
+                float fg = 0.F;
+                float fb = 0.F;
+                latticeCoord(domain, p[0], edgeLen, ir, fr);
+                latticeCoord(domain, p[1], edgeLen, ig, fg);
+                latticeCoord(domain, p[2], edgeLen, ib, fb);
+                const float* c000 = data + ir * dr + ig * dg + ib * db;
+                const float* c111 = c000 + dr + dg + db;
+
+                // Find the tetrahedron that contains the point and the
+                // barycentric weights of its vertices.
+                const float* c1 = nullptr;
+                const float* c2 = nullptr;
+                float w0 = 0.F;
+                float w1 = 0.F;
+                float w2 = 0.F;
+                float w3 = 0.F;
+                if (fr >= fg)
+                {
+                    if (fg >= fb)
+                    {
+                        c1 = c000 + dr;
+                        c2 = c000 + dr + dg;
+                        w0 = 1.F - fr; w1 = fr - fg; w2 = fg - fb; w3 = fb;
+                    }
+                    else if (fr >= fb)
+                    {
+                        c1 = c000 + dr;
+                        c2 = c000 + dr + db;
+                        w0 = 1.F - fr; w1 = fr - fb; w2 = fb - fg; w3 = fg;
+                    }
+                    else
+                    {
+                        c1 = c000 + db;
+                        c2 = c000 + db + dr;
+                        w0 = 1.F - fb; w1 = fb - fr; w2 = fr - fg; w3 = fg;
+                    }
+                }
+                else
+                {
+                    if (fb >= fg)
+                    {
+                        c1 = c000 + db;
+                        c2 = c000 + db + dg;
+                        w0 = 1.F - fb; w1 = fb - fg; w2 = fg - fr; w3 = fr;
+                    }
+                    else if (fb >= fr)
+                    {
+                        c1 = c000 + dg;
+                        c2 = c000 + dg + db;
+                        w0 = 1.F - fg; w1 = fg - fb; w2 = fb - fr; w3 = fr;
+                    }
+                    else
+                    {
+                        c1 = c000 + dg;
+                        c2 = c000 + dg + dr;
+                        w0 = 1.F - fg; w1 = fg - fr; w2 = fr - fb; w3 = fb;
+                    }
+                }
+
+                const float alpha = p[3];
+#if defined(DJV_OCIO_SSE)
+                __m128 v = _mm_mul_ps(_mm_loadu_ps(c000), _mm_set1_ps(w0));
+                v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(c1), _mm_set1_ps(w1)));
+                v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(c2), _mm_set1_ps(w2)));
+                v = _mm_add_ps(v, _mm_mul_ps(_mm_loadu_ps(c111), _mm_set1_ps(w3)));
+                _mm_storeu_ps(p, v);
+#else // DJV_OCIO_SSE
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    p[c] = c000[c] * w0 + c1[c] * w1 + c2[c] * w2 + c111[c] * w3;
+                }
+#endif // DJV_OCIO_SSE
+                p[3] = alpha;
+            }
+        }
+
+    } // namespace OCIO
+} // namespace djv
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+
+namespace djv
+{
+    namespace OCIO
+    {
+        class LUT1D;
+        class LUT3D;
+
+        //! \name Utility
+        ///@{
+
+        //! Apply a 1D LUT to RGBA pixels with linear interpolation. The alpha
+        //! channel is passed through unchanged.
+        void applyLUT1D(const LUT1D&, float* rgba, size_t count);
+
+        //! Apply a 3D LUT to RGBA pixels with tetrahedral interpolation. The
+        //! alpha channel is passed through unchanged. SSE is used when
+        //! available.
+        void applyLUT3D(const LUT3D&, float* rgba, size_t count);
+
+        ///@}
+
+    } // namespace OCIO
+} // namespace djv
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+
+namespace djv
+{
+    namespace OCIO
+    {
+        inline float Domain::toLUT(float value) const
+        {
+            float out = 0.F;
+            switch (allocation)
+            {
+            case Allocation::Uniform:
+                out = (value - min) / (max - min);
+                break;
+            case Allocation::LG2:
+                out = (std::log2(std::max(value + offset, 1.0e-10F)) - min) / (max - min);
+                break;
+            default: break;
+            }
+            return out;
+        }
+
+        inline float Domain::fromLUT(float value) const
+        {
+            float out = 0.F;
+            switch (allocation)
+            {
+            case Allocation::Uniform:
+                out = value * (max - min) + min;
+                break;
+            case Allocation::LG2:
+                out = std::exp2(value * (max - min) + min) - offset;
+                break;
+            default: break;
+            }
+            return out;
+        }
+
+        inline bool Domain::operator == (const Domain& other) const
+        {
+            return
+                allocation == other.allocation &&
+                min == other.min &&
+                max == other.max &&
+                offset == other.offset;
+        }
+
+        inline size_t LUT1D::getSize() const
+        {
+            return _size;
+        }
+
+        inline const Domain& LUT1D::getDomain() const
+        {
+            return _domain;
+        }
+
+        inline float* LUT1D::getData()
+        {
+            return _data.data();
+        }
+
+        inline const float* LUT1D::getData() const
+        {
+            return _data.data();
+        }
+
+        inline size_t LUT3D::getEdgeLen() const
+        {
+            return _edgeLen;
+        }
+
+        inline const Domain& LUT3D::getDomain() const
+        {
+            return _domain;
+        }
+
+        inline float* LUT3D::getData()
+        {
+            return _data.data();
+        }
+
+        inline const float* LUT3D::getData() const
+        {
+            return _data.data();
+        }
+
+    } // namespace OCIO
+} // namespace djv
@@ -9,10 +9,14 @@
 #include <djvSystem/FileInfoFunc.h>
 #include <djvSystem/ResourceSystem.h>
 
+#include <djvCore/Cache.h>
 #include <djvCore/OSFunc.h>
 
 #include <OpenColorIO/OpenColorIO.h>
 
+#include <mutex>
+#include <tuple>
+
 // These need to be included last on macOS.
 #include <djvCore/RapidJSONTemplates.h>
 
@@ -33,6 +37,12 @@ namespace djv
             return path.getFileName();
         }
 
+        namespace
+        {
+            const size_t cpuProcessorCacheMax = 16;
+
+        } // namespace
+
         struct OCIOSystem::Private
         {
             Private(OCIOSystem& p) :
@@ -52,6 +62,10 @@ namespace djv
             std::vector<Display> displays;
             std::vector<std::string> colorSpaces;
 
+            typedef std::tuple<std::string, Convert, ProcessorMode> CPUProcessorKey;
+            Memory::Cache<CPUProcessorKey, std::shared_ptr<CPUProcessor> > cpuProcessorCache;
+            mutable std::mutex cpuProcessorMutex;
+
             std::shared_ptr<Observer::ValueSubject<ConfigMode> > configModeSubject;
             std::shared_ptr<Observer::ValueSubject<Config> > cmdLineConfigSubject;
             std::shared_ptr<Observer::ValueSubject<Config> > envConfigSubject;
@@ -92,6 +106,8 @@ namespace djv
             p.imageColorSpacesSubject = Observer::MapSubject<std::string, std::string>::create();
             p.colorSpacesSubject = Observer::ListSubject<std::string>::create();
 
+            p.cpuProcessorCache.setMax(cpuProcessorCacheMax);
+
             _OCIO::SetLoggingLevel(_OCIO::LOGGING_LEVEL_NONE);
 
             {
@@ -411,6 +427,48 @@ namespace djv
             return std::string();
         }
 
+        std::shared_ptr<CPUProcessor> OCIOSystem::getCPUProcessor(const Convert& convert, ProcessorMode mode)
+        {
+            DJV_PRIVATE_PTR();
+            std::shared_ptr<CPUProcessor> out;
+            const auto key = std::make_tuple(
+                std::string(_OCIO::GetCurrentConfig()->getCacheID()),
+                convert,
+                mode);
+            {
+                std::lock_guard<std::mutex> lock(p.cpuProcessorMutex);
+                if (p.cpuProcessorCache.get(key, out))
+                {
+                    return out;
+                }
+            }
+
+            // Bake the LUT without holding the lock so that other conversions
+            // are not blocked.
+            out = CPUProcessor::create(convert, mode);
+            {
+                std::lock_guard<std::mutex> lock(p.cpuProcessorMutex);
+                p.cpuProcessorCache.add(key, out);
+            }
+            return out;
+        }
+
+        std::shared_ptr<CPUProcessor> OCIOSystem::getCPUProcessor(
+            const std::string& input,
+            const std::string& display,
+            const std::string& view,
+            ProcessorMode mode)
+        {
+            return getCPUProcessor(Convert(input, getColorSpace(display, view)), mode);
+        }
+
+        size_t OCIOSystem::getCPUProcessorCacheSize() const
+        {
+            DJV_PRIVATE_PTR();
+            std::lock_guard<std::mutex> lock(p.cpuProcessorMutex);
+            return p.cpuProcessorCache.getSize();
+        }
+
         std::vector<Config> OCIOSystem::Private::getUserConfigs() const
         {
             std::vector<Config> out;
@@ -564,6 +622,10 @@ namespace djv
                 try
                 {
                     _OCIO::SetCurrentConfig(ocioConfig);
+                    {
+                        std::lock_guard<std::mutex> lock(cpuProcessorMutex);
+                        cpuProcessorCache.clear();
+                    }
 
                     colorSpaces.push_back(std::string());
                     for (int i = 0; i < ocioConfig->getNumColorSpaces(); ++i)
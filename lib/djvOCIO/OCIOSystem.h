@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <djvOCIO/CPUProcessor.h>
 #include <djvOCIO/OCIO.h>
 
 #include <djvSystem/ISystem.h>
@@ -108,6 +109,30 @@ namespace djv
             std::string getColorSpace(const std::string& display, const std::string& view) const;
 
             ///@}
+
+            //! \name CPU Processing
+            ///@{
+
+            //! Get a CPU processor for the current configuration. Processors
+            //! are cached, so repeated requests for the same conversion do not
+            //! re-bake the LUT. This function is thread safe.
+            //! Throws:
+            //! - std::exception
+            std::shared_ptr<CPUProcessor> getCPUProcessor(const Convert&, ProcessorMode = ProcessorMode::LUT);
+
+            //! Get a CPU processor from the input color space to the given
+            //! display and view.
+            //! Throws:
+            //! - std::exception
+            std::shared_ptr<CPUProcessor> getCPUProcessor(
+                const std::string& input,
+                const std::string& display,
+                const std::string& view,
+                ProcessorMode = ProcessorMode::LUT);
+
+            size_t getCPUProcessorCacheSize() const;
+
+            ///@}
             
         private:
             DJV_PRIVATE();
@@ -23,9 +23,11 @@
 #include <codecvt>
 #include <condition_variable>
 #include <cwctype>
+#include <iterator>
 #include <locale>
 #include <mutex>
 #include <thread>
+#include <tuple>
 
 using namespace djv::Core;
 
@@ -76,7 +78,73 @@ namespace djv
             namespace
             {
                 //! \todo Should this be configurable?
-                const size_t glyphCacheMax = 10000;
+                const size_t glyphCacheMax      = 10000;
+                const size_t measureCacheMax    = 10000;
+                const size_t textLinesCacheMax  = 1000;
+                const size_t threadCountMax     = 4;
+                const size_t requestBatchMax    = 100;
+                const uint32_t advanceTableSize = 256;
+
+                //! This class provides the key for the measure and text line caches.
+                class TextKey
+                {
+                public:
+                    TextKey() {}
+                    TextKey(const std::string& text, const FontInfo& fontInfo, uint16_t elide, uint16_t maxLineWidth) :
+                        text(text),
+                        fontInfo(fontInfo),
+                        elide(elide),
+                        maxLineWidth(maxLineWidth)
+                    {}
+
+                    std::string text;
+                    FontInfo fontInfo;
+                    uint16_t elide = 0;
+                    uint16_t maxLineWidth = std::numeric_limits<uint16_t>::max();
+
+                    bool operator < (const TextKey& other) const
+                    {
+                        return
+                            std::tie(fontInfo, elide, maxLineWidth, text) <
+                            std::tie(other.fontInfo, other.elide, other.maxLineWidth, other.text);
+                    }
+                };
+
+                //! This struct provides the glyph metrics used for layout.
+                struct Advance
+                {
+                    bool     valid    = false;
+                    uint16_t advance  = 0;
+                    int32_t  lsbDelta = 0;
+                    int32_t  rsbDelta = 0;
+                };
+
+                //! This struct provides the glyph metrics for a face and size. The
+                //! Latin-1 range is computed up front, other code points on demand.
+                struct AdvanceTable
+                {
+                    FT_Face ftFace = nullptr;
+                    uint16_t size = 0;
+                    float lineHeight = 0.F;
+                    std::vector<Advance> latin1;
+                    std::map<uint32_t, Advance> other;
+                };
+
+                Advance loadAdvance(FT_Face ftFace, uint32_t code)
+                {
+                    Advance out;
+                    if (auto ftGlyphIndex = FT_Get_Char_Index(ftFace, code))
+                    {
+                        if (!FT_Load_Glyph(ftFace, ftGlyphIndex, FT_LOAD_FORCE_AUTOHINT))
+                        {
+                            out.valid = true;
+                            out.advance = static_cast<uint16_t>(ftFace->glyph->advance.x / 64.F);
+                            out.lsbDelta = ftFace->glyph->lsb_delta;
+                            out.rsbDelta = ftFace->glyph->rsb_delta;
+                        }
+                    }
+                    return out;
+                }
 
                 class MetricsRequest
                 {
@@ -149,6 +217,27 @@ namespace djv
                     return '\n' == c || '\r' == c;
                 }
 
+                void elideText(std::basic_string<djv_char_t>& utf32, uint16_t elide)
+                {
+                    const size_t inSize = utf32.size();
+                    const size_t outSize = elide > 0 ? std::min(inSize, static_cast<size_t>(elide)) : inSize;
+                    if (outSize < inSize)
+                    {
+                        utf32.resize(outSize);
+                        utf32.push_back('.');
+                        utf32.push_back('.');
+                        utf32.push_back('.');
+                    }
+                }
+
+                template<typename T>
+                void takeRequests(std::list<T>& queue, std::list<T>& out)
+                {
+                    auto end = queue.begin();
+                    std::advance(end, std::min(queue.size(), requestBatchMax));
+                    out.splice(out.end(), queue, queue.begin(), end);
+                }
+
                 std::shared_ptr<Image::Data> convert(
                     FT_Bitmap bitmap,
                     uint8_t renderModeChannels)
@@ -214,21 +303,21 @@ namespace djv
             struct FontSystem::Private
             {
                 bool lcdRendering = true;
-                bool lcdRenderingThread = lcdRendering;
+                std::atomic<bool> lcdRenderingThread;
 
-                FT_Library ftLibrary = nullptr;
                 System::File::Path fontPath;
-                std::map<FamilyID, std::string> fontFileNames;
+                std::map<std::pair<FamilyID, FaceID>, std::string> fontFileNames;
                 std::map<FamilyID, std::string> fontNames;
                 std::shared_ptr<Observer::MapSubject<FamilyID, std::string> > fontNamesSubject;
                 std::mutex fontNamesMutex;
                 std::shared_ptr<System::Timer> fontNamesTimer;
                 std::map<FamilyID, std::map<FaceID, std::string> > fontFaceNames;
                 std::shared_ptr<Observer::MapSubject<FamilyID, std::map<FaceID, std::string> > > fontFaceNamesSubject;
-                std::map<FamilyID, std::map<FaceID, FT_Face> > fontFaces;
                 std::map<std::string, FamilyID> fontNameToID;
                 std::map<std::pair<FamilyID, std::string>, FamilyID> fontFaceNameToID;
                 std::vector< std::pair<FamilyID, FaceID> > symbolFonts;
+                std::condition_variable fontsCV;
+                bool fontsInit = false;
 
                 std::list<MetricsRequest> metricsQueue;
                 std::list<MeasureRequest> measureQueue;
@@ -237,28 +326,57 @@ namespace djv
                 std::list<TextLinesRequest> textLinesQueue;
                 std::condition_variable requestCV;
                 std::mutex requestMutex;
-                std::list<MetricsRequest> metricsRequests;
-                std::list<MeasureRequest> measureRequests;
-                std::list<MeasureGlyphsRequest> measureGlyphsRequests;
-                std::list<GlyphsRequest> glyphsRequests;
-                std::list<TextLinesRequest> textLinesRequests;
 
-                std::wstring_convert<std::codecvt_utf8<djv_char_t>, djv_char_t> utf32Convert;
+                std::mutex cacheMutex;
                 Memory::Cache<GlyphInfo, std::shared_ptr<Glyph> > glyphCache;
                 std::atomic<size_t> glyphCacheSize;
                 std::atomic<float> glyphCachePercentageUsed;
+                Memory::Cache<TextKey, glm::vec2> measureCache;
+                Memory::Cache<TextKey, std::vector<Math::BBox2f> > measureGlyphsCache;
+                Memory::Cache<TextKey, std::vector<TextLine> > textLinesCache;
+                std::atomic<size_t> measureCacheSize;
+                std::atomic<float> measureCachePercentageUsed;
+                std::atomic<size_t> measureCacheRequests;
+                std::atomic<size_t> measureCacheHits;
+
+                //! Each worker thread has its own FreeType library and faces
+                //! since they cannot be shared between threads.
+                struct Worker
+                {
+                    FT_Library ftLibrary = nullptr;
+                    std::map<FamilyID, std::map<FaceID, FT_Face> > fontFaces;
+                    std::map<FontInfo, AdvanceTable> advanceTables;
+                    std::wstring_convert<std::codecvt_utf8<djv_char_t>, djv_char_t> utf32Convert;
+
+                    std::list<MetricsRequest> metricsRequests;
+                    std::list<MeasureRequest> measureRequests;
+                    std::list<MeasureGlyphsRequest> measureGlyphsRequests;
+                    std::list<GlyphsRequest> glyphsRequests;
+                    std::list<TextLinesRequest> textLinesRequests;
+
+                    std::thread thread;
+
+                    FT_Face getFace(FamilyID, FaceID) const;
+
+                    AdvanceTable* getAdvanceTable(const FontInfo&);
+                    bool getAdvance(uint32_t, const std::vector<FontInfo>&, Advance&);
+                };
+                std::vector<std::unique_ptr<Worker> > workers;
 
                 std::shared_ptr<System::Timer> statsTimer;
-                std::thread thread;
                 std::atomic<bool> running;
 
                 std::vector<FontInfo> getFontInfoList(const FontInfo&) const;
 
-                FT_Face getFace(FamilyID, FaceID) const;
+                template<typename T>
+                bool getCached(const Memory::Cache<TextKey, T>&, const TextKey&, T&);
+                template<typename T>
+                void addCached(Memory::Cache<TextKey, T>&, const TextKey&, const T&);
 
-                std::shared_ptr<Glyph> getGlyph(uint32_t, const std::vector<FontInfo>&);
+                std::shared_ptr<Glyph> getGlyph(Worker&, uint32_t, const std::vector<FontInfo>&);
                 
                 void measure(
+                    Worker&,
                     const std::basic_string<djv_char_t>& utf32,
                     const std::vector<FontInfo>&,
                     uint16_t maxLineWidth,
@@ -274,12 +392,20 @@ namespace djv
 
                 addDependency(context->getSystemT<System::CoreSystem>());
 
+                p.lcdRenderingThread = p.lcdRendering;
                 p.fontPath = _getResourceSystem()->getPath(System::File::ResourcePath::Fonts);
                 p.fontNamesSubject = Observer::MapSubject<FamilyID, std::string>::create();
                 p.fontFaceNamesSubject = Observer::MapSubject<FamilyID, std::map<FaceID, std::string> >::create();
                 p.glyphCache.setMax(glyphCacheMax);
                 p.glyphCacheSize = 0;
                 p.glyphCachePercentageUsed = 0.F;
+                p.measureCache.setMax(measureCacheMax);
+                p.measureGlyphsCache.setMax(measureCacheMax);
+                p.textLinesCache.setMax(textLinesCacheMax);
+                p.measureCacheSize = 0;
+                p.measureCachePercentageUsed = 0.F;
+                p.measureCacheRequests = 0;
+                p.measureCacheHits = 0;
 
                 p.fontNamesTimer = System::Timer::create(context);
                 p.fontNamesTimer->setRepeating(true);
@@ -306,76 +432,119 @@ namespace djv
                     [this](const std::chrono::steady_clock::time_point&, const Time::Duration&)
                 {
                     DJV_PRIVATE_PTR();
+                    const size_t requests = p.measureCacheRequests;
                     std::stringstream ss;
-                    ss << "Glyph cache: " << p.glyphCacheSize << ", " << p.glyphCachePercentageUsed << "%";
+                    ss << "Glyph cache: " << p.glyphCacheSize << ", " << p.glyphCachePercentageUsed << "%\n";
+                    ss << "Measure cache: " << p.measureCacheSize << ", " << p.measureCachePercentageUsed << "%, " <<
+                        "hits: " << (requests > 0 ? (p.measureCacheHits / static_cast<float>(requests) * 100.F) : 0.F) << "%";
                     _log(ss.str());
                 });
 
                 p.running = true;
-                p.thread = std::thread(
-                    [this]
+                const size_t threadCount = std::max(
+                    std::min(static_cast<size_t>(std::thread::hardware_concurrency()), threadCountMax),
+                    size_t(1));
                 {
-                    DJV_PRIVATE_PTR();
-                    _initFreeType();
-                    bool lcdRenderingChanged = false;
-                    const Time::Duration threadTimerDuration = System::getTimerDuration(System::TimerValue::Fast);
-                    while (p.running)
+                    std::stringstream ss;
+                    ss << "Thread count: " << threadCount;
+                    _log(ss.str());
+                }
+                for (size_t i = 0; i < threadCount; ++i)
+                {
+                    p.workers.push_back(std::unique_ptr<Private::Worker>(new Private::Worker));
+                }
+                for (size_t i = 0; i < threadCount; ++i)
+                {
+                    p.workers[i]->thread = std::thread(
+                        [this, i]
                     {
+                        DJV_PRIVATE_PTR();
+                        auto& worker = *p.workers[i];
+                        _initFreeType(i);
+                        const Time::Duration threadTimerDuration = System::getTimerDuration(System::TimerValue::Fast);
+                        while (p.running)
                         {
-                            std::unique_lock<std::mutex> lock(p.requestMutex);
-                            p.requestCV.wait_for(
-                                lock,
-                                threadTimerDuration,
-                                [this]
+                            bool lcdRenderingChanged = false;
+                            bool requestsPending = false;
                             {
-                                DJV_PRIVATE_PTR();
-                                return
-                                    p.lcdRendering != p.lcdRenderingThread ||
+                                std::unique_lock<std::mutex> lock(p.requestMutex);
+                                p.requestCV.wait_for(
+                                    lock,
+                                    threadTimerDuration,
+                                    [this]
+                                {
+                                    DJV_PRIVATE_PTR();
+                                    return
+                                        p.lcdRendering != p.lcdRenderingThread ||
+                                        p.metricsQueue.size() ||
+                                        p.measureQueue.size() ||
+                                        p.measureGlyphsQueue.size() ||
+                                        p.glyphsQueue.size() ||
+                                        p.textLinesQueue.size();
+                                });
+                                if (p.lcdRendering != p.lcdRenderingThread)
+                                {
+                                    p.lcdRenderingThread = p.lcdRendering;
+                                    lcdRenderingChanged = true;
+                                }
+                                takeRequests(p.metricsQueue, worker.metricsRequests);
+                                takeRequests(p.measureQueue, worker.measureRequests);
+                                takeRequests(p.measureGlyphsQueue, worker.measureGlyphsRequests);
+                                takeRequests(p.glyphsQueue, worker.glyphsRequests);
+                                takeRequests(p.textLinesQueue, worker.textLinesRequests);
+                                requestsPending =
                                     p.metricsQueue.size() ||
                                     p.measureQueue.size() ||
+                                    p.measureGlyphsQueue.size() ||
                                     p.glyphsQueue.size() ||
                                     p.textLinesQueue.size();
-                            });
-                            if (p.lcdRendering != p.lcdRenderingThread)
+                            }
+                            if (requestsPending)
                             {
-                                p.lcdRenderingThread = p.lcdRendering;
-                                lcdRenderingChanged = true;
+                                p.requestCV.notify_one();
+                            }
+                            if (lcdRenderingChanged)
+                            {
+                                std::unique_lock<std::mutex> lock(p.cacheMutex);
+                                p.glyphCache.clear();
+                                p.glyphCacheSize = 0;
+                                p.glyphCachePercentageUsed = 0.F;
+                                p.textLinesCache.clear();
+                            }
+                            const bool wake =
+                                worker.metricsRequests.size() ||
+                                worker.measureRequests.size() ||
+                                worker.measureGlyphsRequests.size() ||
+                                worker.glyphsRequests.size() ||
+                                worker.textLinesRequests.size();
+                            if (worker.metricsRequests.size())
+                            {
+                                _handleMetricsRequests(i);
+                            }
+                            if (worker.measureRequests.size())
+                            {
+                                _handleMeasureRequests(i);
+                            }
+                            if (worker.measureGlyphsRequests.size())
+                            {
+                                _handleMeasureGlyphsRequests(i);
+                            }
+                            if (worker.glyphsRequests.size())
+                            {
+                                _handleGlyphsRequests(i);
+                            }
+                            if (worker.textLinesRequests.size())
+                            {
+                                _handleTextLinesRequests(i);
+                            }
+                            if (wake)
+                            {
+                                _wake();
                             }
-                            p.metricsRequests = std::move(p.metricsQueue);
-                            p.measureRequests = std::move(p.measureQueue);
-                            p.measureGlyphsRequests = std::move(p.measureGlyphsQueue);
-                            p.glyphsRequests = std::move(p.glyphsQueue);
-                            p.textLinesRequests = std::move(p.textLinesQueue);
-                        }
-                        if (lcdRenderingChanged)
-                        {
-                            p.glyphCache.clear();
-                            p.glyphCacheSize = 0;
-                            p.glyphCachePercentageUsed = 0.F;
-                        }
-                        if (p.metricsRequests.size())
-                        {
-                            _handleMetricsRequests();
-                        }
-                        if (p.measureRequests.size())
-                        {
-                            _handleMeasureRequests();
-                        }
-                        if (p.measureGlyphsRequests.size())
-                        {
-                            _handleMeasureGlyphsRequests();
-                        }
-                        if (p.glyphsRequests.size())
-                        {
-                            _handleGlyphsRequests();
-                        }
-                        if (p.textLinesRequests.size())
-                        {
-                            _handleTextLinesRequests();
                         }
-                    }
-                    _delFreeType();
-                });
+                        _delFreeType(i);
+                    });
+                }
 
                 _logInitTime();
             }
@@ -388,9 +557,13 @@ namespace djv
             {
                 DJV_PRIVATE_PTR();
                 p.running = false;
-                if (p.thread.joinable())
+                p.fontsCV.notify_all();
+                for (const auto& i : p.workers)
                 {
-                    p.thread.join();
+                    if (i->thread.joinable())
+                    {
+                        i->thread.join();
+                    }
                 }
             }
 
@@ -425,6 +598,16 @@ namespace djv
                 return _p->glyphCachePercentageUsed;
             }
 
+            size_t FontSystem::getMeasureCacheSize() const
+            {
+                return _p->measureCacheSize;
+            }
+
+            float FontSystem::getMeasureCachePercentage() const
+            {
+                return _p->measureCachePercentageUsed;
+            }
+
             void FontSystem::setLCDRendering(bool value)
             {
                 DJV_PRIVATE_PTR();
@@ -459,6 +642,12 @@ namespace djv
                 request.fontInfo = fontInfo;
                 request.elide = elide;
                 auto future = request.promise.get_future();
+                glm::vec2 size = glm::vec2(0.F, 0.F);
+                if (p.getCached(p.measureCache, TextKey(text, fontInfo, elide, request.maxLineWidth), size))
+                {
+                    request.promise.set_value(size);
+                    return future;
+                }
                 {
                     std::unique_lock<std::mutex> lock(p.requestMutex);
                     p.measureQueue.push_back(std::move(request));
@@ -478,6 +667,12 @@ namespace djv
                 request.fontInfo = fontInfo;
                 request.elide = elide;
                 auto future = request.promise.get_future();
+                std::vector<Math::BBox2f> glyphGeom;
+                if (p.getCached(p.measureGlyphsCache, TextKey(text, fontInfo, elide, request.maxLineWidth), glyphGeom))
+                {
+                    request.promise.set_value(std::move(glyphGeom));
+                    return future;
+                }
                 {
                     std::unique_lock<std::mutex> lock(p.requestMutex);
                     p.measureGlyphsQueue.push_back(std::move(request));
@@ -516,6 +711,12 @@ namespace djv
                 request.fontInfo = fontInfo;
                 request.maxLineWidth = maxLineWidth;
                 auto future = request.promise.get_future();
+                std::vector<TextLine> lines;
+                if (p.getCached(p.textLinesCache, TextKey(text, fontInfo, 0, maxLineWidth), lines))
+                {
+                    request.promise.set_value(std::move(lines));
+                    return future;
+                }
                 {
                     std::unique_lock<std::mutex> lock(p.requestMutex);
                     p.textLinesQueue.push_back(std::move(request));
@@ -538,12 +739,40 @@ namespace djv
                 p.requestCV.notify_one();
             }
 
-            void FontSystem::_initFreeType()
+            void FontSystem::_initFreeType(size_t index)
             {
                 DJV_PRIVATE_PTR();
+                auto& worker = *p.workers[index];
+                if (index > 0)
+                {
+                    // Wait for the first worker to find the fonts.
+                    std::map<std::pair<FamilyID, FaceID>, std::string> fontFileNames;
+                    {
+                        std::unique_lock<std::mutex> lock(p.fontNamesMutex);
+                        p.fontsCV.wait(
+                            lock,
+                            [this]
+                            {
+                                return _p->fontsInit || !_p->running;
+                            });
+                        fontFileNames = p.fontFileNames;
+                    }
+                    if (!FT_Init_FreeType(&worker.ftLibrary))
+                    {
+                        for (const auto& i : fontFileNames)
+                        {
+                            FT_Face ftFace;
+                            if (!FT_New_Face(worker.ftLibrary, i.second.c_str(), 0, &ftFace))
+                            {
+                                worker.fontFaces[i.first.first][i.first.second] = ftFace;
+                            }
+                        }
+                    }
+                    return;
+                }
                 try
                 {
-                    FT_Error ftError = FT_Init_FreeType(&p.ftLibrary);
+                    FT_Error ftError = FT_Init_FreeType(&worker.ftLibrary);
                     if (ftError)
                     {
                         throw Error("FreeType cannot be initialized.");
@@ -551,7 +780,7 @@ namespace djv
                     int versionMajor = 0;
                     int versionMinor = 0;
                     int versionPatch = 0;
-                    FT_Library_Version(p.ftLibrary, &versionMajor, &versionMinor, &versionPatch);
+                    FT_Library_Version(worker.ftLibrary, &versionMajor, &versionMinor, &versionPatch);
                     {
                         std::stringstream ss;
                         ss << "FreeType version: " << versionMajor << "." << versionMinor << "." << versionPatch;
@@ -567,7 +796,7 @@ namespace djv
                         }
 
                         FT_Face ftFace;
-                        ftError = FT_New_Face(p.ftLibrary, fileName.c_str(), 0, &ftFace);
+                        ftError = FT_New_Face(worker.ftLibrary, fileName.c_str(), 0, &ftFace);
                         if (ftError)
                         {
                             std::stringstream ss;
@@ -616,7 +845,8 @@ namespace djv
                                 p.fontFaceNameToID[std::make_pair(familyID, ftFace->style_name)] = faceID;
                             }
 
-                            p.fontFileNames[familyID] = fileName;
+                            std::unique_lock<std::mutex> lock(p.fontNamesMutex);
+                            p.fontFileNames[std::make_pair(familyID, faceID)] = fileName;
                             //! \bug Probably not the best way to do this...
                             if (String::match(ftFace->family_name, "Symbols"))
                             {
@@ -624,14 +854,13 @@ namespace djv
                             }
                             else
                             {
-                                std::unique_lock<std::mutex> lock(p.fontNamesMutex);
                                 p.fontNames[familyID] = ftFace->family_name;
                                 p.fontFaceNames[familyID][faceID] = ftFace->style_name;
                             }
-                            p.fontFaces[familyID][faceID] = ftFace;
+                            worker.fontFaces[familyID][faceID] = ftFace;
                         }
                     }
-                    if (!p.fontFaces.size())
+                    if (!worker.fontFaces.size())
                     {
                         throw Error("No fonts were found.");
                     }
@@ -640,31 +869,38 @@ namespace djv
                 {
                     _log(e.what());
                 }
+                {
+                    std::unique_lock<std::mutex> lock(p.fontNamesMutex);
+                    p.fontsInit = true;
+                }
+                p.fontsCV.notify_all();
             }
 
-            void FontSystem::_delFreeType()
+            void FontSystem::_delFreeType(size_t index)
             {
                 DJV_PRIVATE_PTR();
-                if (p.ftLibrary)
+                auto& worker = *p.workers[index];
+                if (worker.ftLibrary)
                 {
-                    for (const auto& i : p.fontFaces)
+                    for (const auto& i : worker.fontFaces)
                     {
                         for (const auto& j : i.second)
                         {
                             FT_Done_Face(j.second);
                         }
                     }
-                    FT_Done_FreeType(p.ftLibrary);
+                    FT_Done_FreeType(worker.ftLibrary);
                 }
             }
 
-            void FontSystem::_handleMetricsRequests()
+            void FontSystem::_handleMetricsRequests(size_t index)
             {
                 DJV_PRIVATE_PTR();
-                for (auto& request : p.metricsRequests)
+                auto& worker = *p.workers[index];
+                for (auto& request : worker.metricsRequests)
                 {
                     Metrics metrics;
-                    if (auto ftFace = p.getFace(request.fontInfo.getFamily(), request.fontInfo.getFace()))
+                    if (auto ftFace = worker.getFace(request.fontInfo.getFamily(), request.fontInfo.getFace()))
                     {
                         /*FT_Error ftError = FT_Set_Char_Size(
                             ftFace->second,
@@ -685,31 +921,25 @@ namespace djv
                     }
                     request.promise.set_value(std::move(metrics));
                 }
-                p.metricsRequests.clear();
+                worker.metricsRequests.clear();
             }
 
-            void FontSystem::_handleMeasureRequests()
+            void FontSystem::_handleMeasureRequests(size_t index)
             {
                 DJV_PRIVATE_PTR();
-                for (auto& request : p.measureRequests)
+                auto& worker = *p.workers[index];
+                for (auto& request : worker.measureRequests)
                 {
                     glm::vec2 size = glm::vec2(0.F, 0.F);
                     try
                     {
-                        auto utf32 = p.utf32Convert.from_bytes(request.text);
-                        const size_t inSize = utf32.size();
-                        const size_t outSize = request.elide > 0 ? std::min(inSize, static_cast<size_t>(request.elide)) : inSize;
-                        while (utf32.size() > outSize)
-                        {
-                            utf32.pop_back();
-                        }
-                        if (outSize < inSize)
-                        {
-                            utf32.push_back('.');
-                            utf32.push_back('.');
-                            utf32.push_back('.');
-                        }
-                        p.measure(utf32, p.getFontInfoList(request.fontInfo), request.maxLineWidth, size);
+                        auto utf32 = worker.utf32Convert.from_bytes(request.text);
+                        elideText(utf32, request.elide);
+                        p.measure(worker, utf32, p.getFontInfoList(request.fontInfo), request.maxLineWidth, size);
+                        p.addCached(
+                            p.measureCache,
+                            TextKey(request.text, request.fontInfo, request.elide, request.maxLineWidth),
+                            size);
                     }
                     catch (const std::exception& e)
                     {
@@ -719,32 +949,26 @@ namespace djv
                     }
                     request.promise.set_value(size);
                 }
-                p.measureRequests.clear();
+                worker.measureRequests.clear();
             }
 
-            void FontSystem::_handleMeasureGlyphsRequests()
+            void FontSystem::_handleMeasureGlyphsRequests(size_t index)
             {
                 DJV_PRIVATE_PTR();
-                for (auto& request : p.measureGlyphsRequests)
+                auto& worker = *p.workers[index];
+                for (auto& request : worker.measureGlyphsRequests)
                 {
                     glm::vec2 size = glm::vec2(0.F, 0.F);
                     std::vector<Math::BBox2f> glyphGeom;
                     try
                     {
-                        auto utf32 = p.utf32Convert.from_bytes(request.text);
-                        const size_t inSize = utf32.size();
-                        const size_t outSize = request.elide > 0 ? std::min(inSize, static_cast<size_t>(request.elide)) : inSize;
-                        while (utf32.size() > outSize)
-                        {
-                            utf32.pop_back();
-                        }
-                        if (outSize < inSize)
-                        {
-                            utf32.push_back('.');
-                            utf32.push_back('.');
-                            utf32.push_back('.');
-                        }
-                        p.measure(utf32, p.getFontInfoList(request.fontInfo), request.maxLineWidth, size, &glyphGeom);
+                        auto utf32 = worker.utf32Convert.from_bytes(request.text);
+                        elideText(utf32, request.elide);
+                        p.measure(worker, utf32, p.getFontInfoList(request.fontInfo), request.maxLineWidth, size, &glyphGeom);
+                        p.addCached(
+                            p.measureGlyphsCache,
+                            TextKey(request.text, request.fontInfo, request.elide, request.maxLineWidth),
+                            glyphGeom);
                     }
                     catch (const std::exception& e)
                     {
@@ -754,18 +978,19 @@ namespace djv
                     }
                     request.promise.set_value(glyphGeom);
                 }
-                p.measureGlyphsRequests.clear();
+                worker.measureGlyphsRequests.clear();
             }
 
-            void FontSystem::_handleGlyphsRequests()
+            void FontSystem::_handleGlyphsRequests(size_t index)
             {
                 DJV_PRIVATE_PTR();
-                for (auto& request : p.glyphsRequests)
+                auto& worker = *p.workers[index];
+                for (auto& request : worker.glyphsRequests)
                 {
                     std::basic_string<djv_char_t> utf32;
                     try
                     {
-                        utf32 = p.utf32Convert.from_bytes(request.text);
+                        utf32 = worker.utf32Convert.from_bytes(request.text);
                     }
                     catch (const std::exception& e)
                     {
@@ -781,7 +1006,7 @@ namespace djv
                     {
                         for (size_t i = 0; i < inSize; ++i)
                         {
-                            p.getGlyph(utf32[i], fontInfoList);
+                            p.getGlyph(worker, utf32[i], fontInfoList);
                         }
                     }
                     else
@@ -790,23 +1015,24 @@ namespace djv
                         size_t i = 0;
                         for (; i < outSize; ++i)
                         {
-                            glyphs[i] = p.getGlyph(utf32[i], fontInfoList);
+                            glyphs[i] = p.getGlyph(worker, utf32[i], fontInfoList);
                         }
                         if (elided)
                         {
-                            glyphs[i] = p.getGlyph('.', fontInfoList);
-                            glyphs[i + 1] = p.getGlyph('.', fontInfoList);
-                            glyphs[i + 2] = p.getGlyph('.', fontInfoList);
+                            glyphs[i] = p.getGlyph(worker, '.', fontInfoList);
+                            glyphs[i + 1] = p.getGlyph(worker, '.', fontInfoList);
+                            glyphs[i + 2] = p.getGlyph(worker, '.', fontInfoList);
                         }
                         request.promise.set_value(std::move(glyphs));
                     }
                 }
-                p.glyphsRequests.clear();
+                worker.glyphsRequests.clear();
             }
 
-            void FontSystem::_handleTextLinesRequests()
+            void FontSystem::_handleTextLinesRequests(size_t index)
             {
                 DJV_PRIVATE_PTR();
+                auto& worker = *p.workers[index];
 
                 // Input:
                 //   Speckled Dace are capable of |living in an array of habitats
@@ -823,10 +1049,10 @@ namespace djv
                 //   "living in an array of"
                 //   "habitats"
 
-                for (auto& request : p.textLinesRequests)
+                for (auto& request : worker.textLinesRequests)
                 {
                     std::vector<TextLine> lines;
-                    if (FT_Face ftFace = p.getFace(request.fontInfo.getFamily(), request.fontInfo.getFace()))
+                    if (FT_Face ftFace = worker.getFace(request.fontInfo.getFamily(), request.fontInfo.getFace()))
                     {
                         /*FT_Error ftError = FT_Set_Char_Size(
                             ftFace->second,
@@ -849,7 +1075,7 @@ namespace djv
                         std::basic_string<djv_char_t> utf32;
                         try
                         {
-                            utf32 = p.utf32Convert.from_bytes(request.text);
+                            utf32 = worker.utf32Convert.from_bytes(request.text);
                         }
                         catch (const std::exception& e)
                         {
@@ -862,7 +1088,7 @@ namespace djv
                         const auto fontInfoList = p.getFontInfoList(request.fontInfo);
                         for (auto i = utf32Begin; i != utf32.end(); ++i)
                         {
-                            glyphs[i - utf32Begin] = p.getGlyph(*i, fontInfoList);
+                            glyphs[i - utf32Begin] = p.getGlyph(worker, *i, fontInfoList);
                         }
 
                         glm::vec2 pos = glm::vec2(0.F, static_cast<float>(ftFace->size->metrics.height) / 64.F);
@@ -901,7 +1127,7 @@ namespace djv
                                     const size_t offset = lineBegin - utf32.begin();
                                     const size_t size = i - lineBegin;
                                     TextLine line;
-                                    line.text = p.utf32Convert.to_bytes(utf32.substr(offset, size));
+                                    line.text = worker.utf32Convert.to_bytes(utf32.substr(offset, size));
                                     line.size = glm::vec2(pos.x, static_cast<float>(ftFace->size->metrics.height) / 64.F);
                                     line.glyphs = std::vector<std::shared_ptr<Glyph> >(glyphs.begin() + offset, glyphs.begin() + offset + size);
                                     lines.push_back(line);
@@ -933,7 +1159,7 @@ namespace djv
                                         const size_t offset = lineBegin - utf32.begin();
                                         const size_t size = i - lineBegin;
                                         TextLine line;
-                                        line.text = p.utf32Convert.to_bytes(utf32.substr(offset, size));
+                                        line.text = worker.utf32Convert.to_bytes(utf32.substr(offset, size));
                                         line.size = glm::vec2(lineBreakPos, static_cast<float>(ftFace->size->metrics.height) / 64.F);
                                         line.glyphs = std::vector<std::shared_ptr<Glyph> >(glyphs.begin() + offset, glyphs.begin() + offset + size);
                                         lines.push_back(line);
@@ -956,7 +1182,7 @@ namespace djv
                                         const size_t offset = lineBegin - utf32.begin();
                                         const size_t size = i - lineBegin;
                                         TextLine line;
-                                        line.text = p.utf32Convert.to_bytes(utf32.substr(offset, size));
+                                        line.text = worker.utf32Convert.to_bytes(utf32.substr(offset, size));
                                         line.size = glm::vec2(pos.x, static_cast<float>(ftFace->size->metrics.height) / 64.F);
                                         line.glyphs = std::vector<std::shared_ptr<Glyph> >(glyphs.begin() + offset, glyphs.begin() + offset + size);
                                         lines.push_back(line);
@@ -993,7 +1219,7 @@ namespace djv
                                 const size_t offset = lineBegin - utf32.begin();
                                 const size_t size = i - lineBegin;
                                 TextLine textLine;
-                                textLine.text = p.utf32Convert.to_bytes(utf32.substr(offset, size));
+                                textLine.text = worker.utf32Convert.to_bytes(utf32.substr(offset, size));
                                 textLine.size = glm::vec2(pos.x, static_cast<float>(ftFace->size->metrics.height) / 64.F);
                                 textLine.glyphs = std::vector<std::shared_ptr<Glyph> >(glyphs.begin() + offset, glyphs.begin() + offset + size);
                                 lines.push_back(textLine);
@@ -1005,10 +1231,11 @@ namespace djv
                                 _log(ss.str(), System::LogLevel::Error);
                             }
                         }
+                        p.addCached(p.textLinesCache, TextKey(request.text, request.fontInfo, 0, request.maxLineWidth), lines);
                     }
                     request.promise.set_value(lines);
                 }
-                p.textLinesRequests.clear();
+                worker.textLinesRequests.clear();
             }
 
             std::vector<FontInfo> FontSystem::Private::getFontInfoList(const FontInfo& fontInfo) const
@@ -1022,7 +1249,30 @@ namespace djv
                 return out;
             }
 
-            FT_Face FontSystem::Private::getFace(FamilyID family, FaceID face) const
+            template<typename T>
+            bool FontSystem::Private::getCached(const Memory::Cache<TextKey, T>& cache, const TextKey& key, T& value)
+            {
+                std::unique_lock<std::mutex> lock(cacheMutex);
+                ++measureCacheRequests;
+                const bool out = cache.get(key, value);
+                if (out)
+                {
+                    ++measureCacheHits;
+                }
+                return out;
+            }
+
+            template<typename T>
+            void FontSystem::Private::addCached(Memory::Cache<TextKey, T>& cache, const TextKey& key, const T& value)
+            {
+                std::unique_lock<std::mutex> lock(cacheMutex);
+                cache.add(key, value);
+                measureCacheSize = measureCache.getSize() + measureGlyphsCache.getSize() + textLinesCache.getSize();
+                measureCachePercentageUsed =
+                    measureCacheSize / static_cast<float>(measureCache.getMax() + measureGlyphsCache.getMax() + textLinesCache.getMax()) * 100.F;
+            }
+
+            FT_Face FontSystem::Private::Worker::getFace(FamilyID family, FaceID face) const
             {
                 FT_Face out = nullptr;
                 const auto i = fontFaces.find(family);
@@ -1037,16 +1287,80 @@ namespace djv
                 return out;
             }
 
-            std::shared_ptr<Glyph> FontSystem::Private::getGlyph(uint32_t code, const std::vector<FontInfo>& fontInfoList)
+            AdvanceTable* FontSystem::Private::Worker::getAdvanceTable(const FontInfo& fontInfo)
+            {
+                auto i = advanceTables.find(fontInfo);
+                if (i == advanceTables.end())
+                {
+                    AdvanceTable table;
+                    if (auto ftFace = getFace(fontInfo.getFamily(), fontInfo.getFace()))
+                    {
+                        if (!FT_Set_Pixel_Sizes(ftFace, 0, static_cast<int>(fontInfo.getSize())))
+                        {
+                            table.ftFace = ftFace;
+                            table.size = fontInfo.getSize();
+                            table.lineHeight = static_cast<float>(ftFace->size->metrics.height) / 64.F;
+                            table.latin1.resize(advanceTableSize);
+                            for (uint32_t code = 0; code < advanceTableSize; ++code)
+                            {
+                                table.latin1[code] = loadAdvance(ftFace, code);
+                            }
+                        }
+                    }
+                    i = advanceTables.insert(std::make_pair(fontInfo, std::move(table))).first;
+                }
+                return i->second.ftFace ? &i->second : nullptr;
+            }
+
+            bool FontSystem::Private::Worker::getAdvance(uint32_t code, const std::vector<FontInfo>& fontInfoList, Advance& out)
+            {
+                for (const auto& fontInfo : fontInfoList)
+                {
+                    if (auto table = getAdvanceTable(fontInfo))
+                    {
+                        if (code < advanceTableSize)
+                        {
+                            out = table->latin1[code];
+                        }
+                        else
+                        {
+                            const auto i = table->other.find(code);
+                            if (i != table->other.end())
+                            {
+                                out = i->second;
+                            }
+                            else
+                            {
+                                out = Advance();
+                                if (!FT_Set_Pixel_Sizes(table->ftFace, 0, static_cast<int>(table->size)))
+                                {
+                                    out = loadAdvance(table->ftFace, code);
+                                }
+                                table->other[code] = out;
+                            }
+                        }
+                        if (out.valid)
+                        {
+                            return true;
+                        }
+                    }
+                }
+                return false;
+            }
+
+            std::shared_ptr<Glyph> FontSystem::Private::getGlyph(Worker& worker, uint32_t code, const std::vector<FontInfo>& fontInfoList)
             {
                 std::shared_ptr<Glyph> out;
                 for (const auto& fontInfo : fontInfoList)
                 {
-                    if (glyphCache.get(GlyphInfo(code, fontInfo), out))
                     {
-                        break;
+                        std::unique_lock<std::mutex> lock(cacheMutex);
+                        if (glyphCache.get(GlyphInfo(code, fontInfo), out))
+                        {
+                            break;
+                        }
                     }
-                    else if (auto ftFace = getFace(fontInfo.getFamily(), fontInfo.getFace()))
+                    if (auto ftFace = worker.getFace(fontInfo.getFamily(), fontInfo.getFace()))
                     {
                         if (auto ftGlyphIndex = FT_Get_Char_Index(ftFace, code))
                         {
@@ -1066,9 +1380,10 @@ namespace djv
                                 //std::cout << "FT_Load_Glyph error: " << ftError << std::endl;
                                 return nullptr;
                             }
+                            const bool lcdRendering = lcdRenderingThread;
                             FT_Render_Mode renderMode = FT_RENDER_MODE_NORMAL;
                             uint8_t renderModeChannels = 1;
-                            if (lcdRenderingThread)
+                            if (lcdRendering)
                             {
                                 renderMode = FT_RENDER_MODE_LCD;
                                 renderModeChannels = 3;
@@ -1106,9 +1421,13 @@ namespace djv
                             out->rsbDelta = ftFace->glyph->rsb_delta;
                             FT_Done_Glyph(ftGlyph);
 
-                            glyphCache.add(out->glyphInfo, out);
-                            glyphCacheSize = glyphCache.getSize();
-                            glyphCachePercentageUsed = glyphCache.getPercentageUsed();
+                            std::unique_lock<std::mutex> lock(cacheMutex);
+                            if (lcdRendering == lcdRenderingThread)
+                            {
+                                glyphCache.add(out->glyphInfo, out);
+                                glyphCacheSize = glyphCache.getSize();
+                                glyphCachePercentageUsed = glyphCache.getPercentageUsed();
+                            }
 
                             break;
                         }
@@ -1118,63 +1437,51 @@ namespace djv
             }
 
             void FontSystem::Private::measure(
+                Worker& worker,
                 const std::basic_string<djv_char_t>& utf32,
                 const std::vector<FontInfo>& fontInfoList,
                 uint16_t maxLineWidth,
                 glm::vec2& size,
                 std::vector<Math::BBox2f>* glyphGeom)
             {
+                // Measuring only needs the glyph advances, so the advance tables
+                // are used instead of rendering the glyphs.
                 glm::vec2 pos(0.F, 0.F);
                 for (const auto& fontInfo : fontInfoList)
                 {
-                    if (auto ftFace = getFace(fontInfo.getFamily(), fontInfo.getFace()))
+                    if (auto table = worker.getAdvanceTable(fontInfo))
                     {
-                        /*FT_Error ftError = FT_Set_Char_Size(
-                            ftFace->second,
-                            0,
-                            static_cast<int>(fontInfo.getSize() * 64.F),
-                            fontInfo.getDPI(),
-                            fontInfo.getDPI());*/
-                        FT_Error ftError = FT_Set_Pixel_Sizes(
-                            ftFace,
-                            0,
-                            static_cast<int>(fontInfo.getSize()));
-                        if (ftError)
-                        {
-                            //std::cout << "FT_Set_Pixel_Sizes error: " << ftError << std::endl;
-                            break;
-                        }
-
-                        pos.y = static_cast<float>(ftFace->size->metrics.height) / 64.F;
+                        const float lineHeight = table->lineHeight;
+                        pos.y = lineHeight;
                         auto textLine = utf32.end();
                         float textLineX = 0.F;
                         int32_t rsbDeltaPrev = 0;
+                        Advance advance;
                         for (auto i = utf32.begin(); i != utf32.end(); ++i)
                         {
-                            const auto glyph = getGlyph(*i, fontInfoList);
-                            if (glyph && glyphGeom)
+                            const bool valid = worker.getAdvance(*i, fontInfoList, advance);
+                            if (valid && glyphGeom)
                             {
                                 glyphGeom->push_back(Math::BBox2f(
                                     pos.x,
-                                    glyph->advance,
-                                    glyph->advance,
-                                    static_cast<float>(ftFace->size->metrics.height) / 64.F));
+                                    advance.advance,
+                                    advance.advance,
+                                    lineHeight));
                             }
 
                             int32_t x = 0;
-                            glm::vec2 posAndSize(0.F, 0.F);
-                            if (glyph && glyph->imageData)
+                            if (valid)
                             {
-                                x = glyph->advance;
-                                if (rsbDeltaPrev - glyph->lsbDelta > 32)
+                                x = advance.advance;
+                                if (rsbDeltaPrev - advance.lsbDelta > 32)
                                 {
                                     x -= 1;
                                 }
-                                else if (rsbDeltaPrev - glyph->lsbDelta < -31)
+                                else if (rsbDeltaPrev - advance.lsbDelta < -31)
                                 {
                                     x += 1;
                                 }
-                                rsbDeltaPrev = glyph->rsbDelta;
+                                rsbDeltaPrev = advance.rsbDelta;
                             }
                             else
                             {
@@ -1185,7 +1492,7 @@ namespace djv
                             {
                                 size.x = std::max(size.x, pos.x);
                                 pos.x = 0.F;
-                                pos.y += static_cast<float>(ftFace->size->metrics.height) / 64.F;
+                                pos.y += lineHeight;
                                 rsbDeltaPrev = 0;
                             }
                             else if (
@@ -1198,13 +1505,13 @@ namespace djv
                                     textLine = utf32.end();
                                     size.x = std::max(size.x, textLineX);
                                     pos.x = 0.F;
-                                    pos.y += static_cast<float>(ftFace->size->metrics.height) / 64.F;
+                                    pos.y += lineHeight;
                                 }
                                 else
                                 {
                                     size.x = std::max(size.x, pos.x);
                                     pos.x = static_cast<float>(x);
-                                    pos.y += static_cast<float>(ftFace->size->metrics.height) / 64.F;
+                                    pos.y += lineHeight;
                                 }
                                 rsbDeltaPrev = 0;
                             }
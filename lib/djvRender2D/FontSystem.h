@@ -131,6 +131,11 @@ namespace djv
 
             //! This class provides a font system.
             //!
+            //! Requests are serviced by a pool of worker threads, each with its
+            //! own FreeType faces. Measurements and text lines are cached by the
+            //! text, font, and width, and cache hits are returned without waiting
+            //! on the workers.
+            //!
             //! \todo Add support for gamma correction?
             //! - https://www.freetype.org/freetype2/docs/text-rendering-general.html
             class FontSystem : public System::ISystem
@@ -165,6 +170,12 @@ namespace djv
                 //! Get the glyph cache percentage used.
                 float getGlyphCachePercentage() const;
 
+                //! Get the measure cache size.
+                size_t getMeasureCacheSize() const;
+
+                //! Get the measure cache percentage used.
+                float getMeasureCachePercentage() const;
+
                 ///@}
 
                 //! \name Options
@@ -216,13 +227,13 @@ namespace djv
                 ///@}
             
             private:
-                void _initFreeType();
-                void _delFreeType();
-                void _handleMetricsRequests();
-                void _handleMeasureRequests();
-                void _handleTextLinesRequests();
-                void _handleMeasureGlyphsRequests();
-                void _handleGlyphsRequests();
+                void _initFreeType(size_t worker);
+                void _delFreeType(size_t worker);
+                void _handleMetricsRequests(size_t worker);
+                void _handleMeasureRequests(size_t worker);
+                void _handleTextLinesRequests(size_t worker);
+                void _handleMeasureGlyphsRequests(size_t worker);
+                void _handleGlyphsRequests(size_t worker);
 
                 DJV_PRIVATE();
             };
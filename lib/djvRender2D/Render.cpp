@@ -8,6 +8,7 @@
 
 #include <djvGL/GLFWSystem.h>
 #include <djvGL/MeshFunc.h>
+#include <djvGL/PixelBufferRing.h>
 #include <djvGL/Shader.h>
 #include <djvGL/Texture.h>
 #include <djvGL/TextureAtlas.h>
@@ -51,6 +52,7 @@ namespace djv
             bool                                         textLCDRendering    = true;
 
             Math::BBox2f                                 viewport;
+            Math::BBox2f                                 region;
             std::vector<std::shared_ptr<Primitive> >     primitives;
             size_t                                       primitivesCount     = 0;
             PrimitiveData                                primitiveData;
@@ -59,6 +61,10 @@ namespace djv
             std::map<UID, uint64_t>                      glyphTextureIDs;
             std::vector<std::shared_ptr<GL::Texture> >   dynamicTextures;
             std::map<UID, std::shared_ptr<GL::Texture> > dynamicTextureCache;
+            std::shared_ptr<GL::PixelBufferRing>         pixelBufferRing;
+            size_t                                       textureUploadCount  = 0;
+            Time::Duration                               textureUploadTime   = Time::Duration::zero();
+            size_t                                       textureUploadStalls = 0;
 #if !defined(DJV_GL_ES2)
             std::map<OCIO::Convert, ColorSpaceData>      colorSpaceCache;
             size_t                                       colorSpaceID        = 1;
@@ -126,6 +132,8 @@ namespace djv
                 0));
             p.primitiveData.textureAtlasCount = _textureAtlasCount;
 
+            p.pixelBufferRing = GL::PixelBufferRing::create(pixelBufferCount);
+
             _imageFilterUpdate();
 
             auto resourceSystem = context->getSystemT<System::ResourceSystem>();
@@ -160,6 +168,9 @@ namespace djv
                     ss << "Glyph texture IDs: " << p.glyphTextureIDs.size() << "\n";
                     ss << "Dynamic textures: " << p.dynamicTextures.size() << "\n";
                     ss << "Dynamic texture cache: " << p.dynamicTextureCache.size() << "\n";
+                    ss << "Texture uploads: " << p.textureUploadCount << "\n";
+                    ss << "Texture upload time: " << p.textureUploadTime.count() << "us\n";
+                    ss << "Texture upload stalls: " << p.textureUploadStalls << "\n";
 #if !defined(DJV_GL_ES2)
                     ss << "Color space cache: " << p.colorSpaceCache.size() << "\n";
 #endif // DJV_GL_ES2
@@ -190,6 +201,15 @@ namespace djv
             _size = size;
             _currentClipRect = Math::BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
             p.viewport = Math::BBox2f(0.F, 0.F, static_cast<float>(size.w), static_cast<float>(size.h));
+            p.region = p.viewport;
+        }
+
+        void Render::beginFrame(const Image::Size& size, const Math::BBox2f& region)
+        {
+            DJV_PRIVATE_PTR();
+            beginFrame(size);
+            _currentClipRect = region;
+            p.region = region;
         }
 
         void Render::endFrame()
@@ -198,6 +218,10 @@ namespace djv
             
             p.primitivesCount = p.primitives.size();
 
+            // Finish streaming the textures that were started while the
+            // primitives were added.
+            p.pixelBufferRing->finish();
+
             if (!p.shader)
             {
                 p.shader = GL::Shader::create(p.vertexSource, p.getFragmentSource());
@@ -244,11 +268,12 @@ namespace djv
                 static_cast<GLint>(p.viewport.min.y),
                 static_cast<GLsizei>(p.viewport.w()),
                 static_cast<GLsizei>(p.viewport.h()));
+            const Math::BBox2f region = flip(p.region, _size);
             glScissor(
-                static_cast<GLint>(p.viewport.min.x),
-                static_cast<GLint>(p.viewport.min.y),
-                static_cast<GLsizei>(p.viewport.w()),
-                static_cast<GLsizei>(p.viewport.h()));
+                static_cast<GLint>(region.min.x),
+                static_cast<GLint>(region.min.y),
+                static_cast<GLsizei>(region.w()),
+                static_cast<GLsizei>(region.h()));
             glClearColor(0.F, 0.F, 0.F, 0.F);
             glClear(GL_COLOR_BUFFER_BIT);
 
@@ -341,6 +366,10 @@ namespace djv
             _clipRects.clear();
             p.primitives.clear();
             p.vboDataSize = 0;
+            p.textureUploadCount = p.pixelBufferRing->getUploadCount();
+            p.textureUploadTime = p.pixelBufferRing->getUploadTime();
+            p.textureUploadStalls += p.pixelBufferRing->getStallCount();
+            p.pixelBufferRing->resetStats();
             while (p.dynamicTextureCache.size() > dynamicTextureCacheMax)
             {
                 auto texture = p.dynamicTextureCache.begin();
@@ -1118,6 +1147,21 @@ namespace djv
             return _p->vbo ? _p->vbo->getSize() : 0;
         }
 
+        size_t Render::getTextureUploadCount() const
+        {
+            return _p->textureUploadCount;
+        }
+
+        Time::Duration Render::getTextureUploadTime() const
+        {
+            return _p->textureUploadTime;
+        }
+
+        size_t Render::getTextureUploadStallCount() const
+        {
+            return _p->textureUploadStalls;
+        }
+
         void Render::_imageFilterUpdate()
         {
             DJV_PRIVATE_PTR();
@@ -1281,7 +1325,14 @@ namespace djv
                         {
                             texture = GL::Texture::create(image->getInfo(), GL_LINEAR, GL_NEAREST);
                         }
-                        texture->copy(*image);
+                        if (image->getDataByteCount() >= pixelBufferMinBytes)
+                        {
+                            pixelBufferRing->upload(image, texture);
+                        }
+                        else
+                        {
+                            texture->copy(*image);
+                        }
                         dynamicTextureCache[uid] = texture;
                         primitive->textureID = texture->getID();
                     }
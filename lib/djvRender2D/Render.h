@@ -15,6 +15,7 @@
 #include <djvMath/BBox.h>
 
 #include <djvCore/RapidJSONFunc.h>
+#include <djvCore/Time.h>
 
 #include <glm/mat3x3.hpp>
 
@@ -49,6 +50,11 @@ namespace djv
             ///@{
 
             void beginFrame(const Image::Size&);
+
+            //! Begin a frame that only clears and draws inside the given
+            //! region, leaving the rest of the framebuffer untouched.
+            void beginFrame(const Image::Size&, const Math::BBox2f&);
+
             void endFrame();
 
             ///@}
@@ -148,6 +154,18 @@ namespace djv
             size_t getDynamicTextureCount() const;
             size_t getVBOSize() const;
 
+            //! Get the number of textures streamed through pixel buffers in
+            //! the last frame.
+            size_t getTextureUploadCount() const;
+
+            //! Get the time the render thread spent streaming textures in the
+            //! last frame.
+            Core::Time::Duration getTextureUploadTime() const;
+
+            //! Get the number of times streaming a texture had to wait for a
+            //! previous transfer to finish.
+            size_t getTextureUploadStallCount() const;
+
             ///@}
 
         private:
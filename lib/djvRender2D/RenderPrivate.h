@@ -22,6 +22,8 @@ namespace djv
         const uint16_t textureAtlasSize       = 8192;
         const size_t   dynamicTextureCount    = 16;
         const size_t   dynamicTextureCacheMax = 16;
+        const size_t   pixelBufferCount       = 3;
+        const size_t   pixelBufferMinBytes    = 1024 * 1024;
 #if !defined(DJV_GL_ES2)
         const size_t   lut3DSize              = 32;
         const size_t   colorSpaceCacheMax     = 32;
@@ -157,6 +157,25 @@ namespace djv
                 }
             }
 
+            bool AnimationSystem::hasActiveAnimations() const
+            {
+                DJV_PRIVATE_PTR();
+                for (const auto& animations : { &p.animations, &p.newAnimations })
+                {
+                    for (const auto& i : *animations)
+                    {
+                        if (auto animation = i.lock())
+                        {
+                            if (animation->isActive())
+                            {
+                                return true;
+                            }
+                        }
+                    }
+                }
+                return false;
+            }
+
             void AnimationSystem::_addAnimation(const std::weak_ptr<Animation>& value)
             {
                 _p->newAnimations.push_back(value);
@@ -118,6 +118,9 @@ namespace djv
 
                 void tick() override;
 
+                //! Get whether any animations are active.
+                bool hasActiveAnimations() const;
+
             private:
                 void _addAnimation(const std::weak_ptr<Animation>&);
 
@@ -4,14 +4,17 @@
 
 #include <djvSystem/Context.h>
 
+#include <djvSystem/Animation.h>
 #include <djvSystem/CoreSystem.h>
 #include <djvSystem/FileIOFunc.h>
 #include <djvSystem/IObject.h>
+#include <djvSystem/InitTaskPool.h>
 #include <djvSystem/LogSystem.h>
 #include <djvSystem/PathFunc.h>
 #include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TextSystem.h>
 #include <djvSystem/TimerFunc.h>
+#include <djvSystem/TraceFunc.h>
 
 #include <djvCore/MemoryFunc.h>
 #include <djvCore/OSFunc.h>
@@ -33,8 +36,9 @@ namespace djv
         namespace
         {
             //! \todo Should this be configurable?
-            const size_t statsRate       = 60;
-            const size_t fpsSamplesCount = 10;
+            const size_t statsRate          = 60;
+            const size_t fpsSamplesCount    = 10;
+            const size_t initTaskThreadsMax = 4;
 
             void addSample(std::list<float>& list, float sample)
             {
@@ -96,6 +100,24 @@ namespace djv
 
         } // namespace
 
+        WakeCallback::WakeCallback()
+        {}
+
+        void WakeCallback::setCallback(const std::function<void()>& value)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _callback = value;
+        }
+
+        void WakeCallback::operator () ()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_callback)
+            {
+                _callback();
+            }
+        }
+
         void Context::_init(const std::string& argv0)
         {
             _name = File::Path(argv0).getBaseName();
@@ -104,13 +126,27 @@ namespace djv
             _set_fmode(_O_BINARY);
 #endif // DJV_PLATFORM_WINDOWS
 
-            _timerSystem = TimerSystem::create(shared_from_this());
-            _resourceSystem = ResourceSystem::create(argv0, shared_from_this());
-            _logSystem = LogSystem::create(shared_from_this());
-            _textSystem = TextSystem::create(shared_from_this());
+            _trace = Trace::Recorder::create();
+            _wakeCallback = std::make_shared<WakeCallback>();
+            {
+                Trace::Scope scope(_trace, "djv::System::TimerSystem", "init");
+                _timerSystem = TimerSystem::create(shared_from_this());
+            }
+            {
+                Trace::Scope scope(_trace, "djv::System::ResourceSystem", "init");
+                _resourceSystem = ResourceSystem::create(argv0, shared_from_this());
+            }
+            {
+                Trace::Scope scope(_trace, "djv::System::LogSystem", "init");
+                _logSystem = LogSystem::create(shared_from_this());
+            }
+            {
+                Trace::Scope scope(_trace, "djv::System::TextSystem", "init");
+                _textSystem = TextSystem::create(shared_from_this());
+            }
             CoreSystem::create(argv0, shared_from_this());
 
-            _logInfo(argv0);
+            _argv0 = argv0;
 
             _fpsTimer = Timer::create(shared_from_this());
             _fpsTimer->setRepeating(true);
@@ -134,7 +170,15 @@ namespace djv
         {}
 
         Context::~Context()
-        {}
+        {
+            // The context may be destroyed before the first tick, for example
+            // when printing the command line usage, so wait for the systems
+            // that are still initializing.
+            for (const auto& system : _systems)
+            {
+                system->waitForInit();
+            }
+        }
 
         std::shared_ptr<Context> Context::create(const std::string& argv0)
         {
@@ -164,6 +208,7 @@ namespace djv
             if (_logSystemOrderInit)
             {
                 _logSystemOrderInit = false;
+                _startupFinished();
                 _logSystemOrder();
                 if (_debugEnv)
                 {
@@ -199,11 +244,43 @@ namespace djv
             ++_tickCount;
         }
 
+        Time::TimePoint Context::getNextTick() const
+        {
+            Time::TimePoint out = _timerSystem->getNextTimeout();
+            auto animationSystem = getSystemT<Animation::AnimationSystem>();
+            if (animationSystem && animationSystem->hasActiveAnimations())
+            {
+                out = std::chrono::steady_clock::now();
+            }
+            return out;
+        }
+
+        const std::shared_ptr<Trace::Recorder>& Context::getTrace() const
+        {
+            return _trace;
+        }
+
+        const Time::Duration& Context::getStartupTime() const
+        {
+            return _startupTime;
+        }
+
         void Context::_addSystem(const std::shared_ptr<ISystemBase>& system)
         {
             _systems.push_back(system);
         }
 
+        const std::shared_ptr<InitTaskPool>& Context::_getInitTaskPool()
+        {
+            if (!_initTaskPool)
+            {
+                _initTaskPool = InitTaskPool::create(std::min(
+                    static_cast<size_t>(std::thread::hardware_concurrency()),
+                    initTaskThreadsMax));
+            }
+            return _initTaskPool;
+        }
+
         void Context::_logInfo(const std::string& argv0)
         {
             std::stringstream ss;
@@ -226,6 +303,47 @@ namespace djv
             _logSystem->log("djv::System::Context", ss.str());
         }
 
+        void Context::_startupFinished()
+        {
+            // Wait for the systems that initialize concurrently.
+            {
+                Trace::Scope scope(_trace, "Wait for initialization", "init");
+                for (const auto& system : _systems)
+                {
+                    system->waitForInit();
+                }
+            }
+
+            // The information is logged here since it uses the text system,
+            // which is loaded by an initialization task.
+            _logInfo(_argv0);
+
+            const auto now = std::chrono::steady_clock::now();
+            _startupTime = std::chrono::duration_cast<Time::Duration>(now - _startTime);
+            _trace->add(Trace::Event(_name, "startup", _startTime, now));
+            {
+                std::stringstream ss;
+                ss << "Startup time: " << _startupTime.count();
+                _logSystem->log("djv::System::Context", ss.str());
+            }
+
+            std::string fileName;
+            if (OS::getEnv("DJV_STARTUP_TRACE", fileName) && !fileName.empty())
+            {
+                try
+                {
+                    Trace::writeChromeJSON(File::Path(fileName), _trace->getEvents());
+                    std::stringstream ss;
+                    ss << "Startup trace: " << fileName;
+                    _logSystem->log("djv::System::Context", ss.str());
+                }
+                catch (const std::exception& e)
+                {
+                    _logSystem->log("djv::System::Context", e.what(), LogLevel::Error);
+                }
+            }
+        }
+
         void Context::_logSystemOrder()
         {
             size_t count = 0;
@@ -6,8 +6,10 @@
 
 #include <djvCore/Time.h>
 
+#include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -16,13 +18,46 @@ namespace djv
     namespace System
     {
         class ISystemBase;
+        class InitTaskPool;
         class LogSystem;
         class ResourceSystem;
         class TextSystem;
         class Timer;
         class TimerSystem;
 
+        namespace Trace
+        {
+            class Recorder;
+
+        } // namespace Trace
+
+        //! This class provides a callback used to wake the application event
+        //! loop, for example when a system has finished an asynchronous
+        //! request. It is thread safe and may outlive the context.
+        class WakeCallback
+        {
+            DJV_NON_COPYABLE(WakeCallback);
+
+        public:
+            WakeCallback();
+
+            //! Set the callback.
+            void setCallback(const std::function<void()>&);
+
+            //! Call the callback.
+            void operator () ();
+
+        private:
+            std::mutex _mutex;
+            std::function<void()> _callback;
+        };
+
         //! This class provides the context.
+        //!
+        //! The initialization of each system and the I/O done during startup
+        //! are recorded in the startup trace. If the DJV_STARTUP_TRACE
+        //! environment variable is set to a file name the trace is written to
+        //! that file in the Chrome trace event format on the first tick.
         class Context : public std::enable_shared_from_this<Context>
         {
             DJV_NON_COPYABLE(Context);
@@ -72,6 +107,16 @@ namespace djv
             //! This function is called by the application event loop.
             virtual void tick();
 
+            //! Get the time when the next tick is needed, for event loops that
+            //! sleep while idle. This is the next timer timeout, or the current
+            //! time when animations are active.
+            Core::Time::TimePoint getNextTick() const;
+
+            //! Get the callback used to wake the application event loop. The
+            //! application sets the callback, systems call it when results
+            //! are ready for the next tick.
+            const std::shared_ptr<WakeCallback>& getWakeCallback() const;
+
             //! Get the average tick FPS.
             float getFPSAverage() const;
 
@@ -80,21 +125,44 @@ namespace djv
 
             ///@}
 
+            //! \name Trace
+            ///@{
+
+            //! Get the startup trace.
+            const std::shared_ptr<Trace::Recorder>& getTrace() const;
+
+            //! Get the startup time, from the creation of the context to the
+            //! first tick.
+            const Core::Time::Duration& getStartupTime() const;
+
+            ///@}
+
         protected:
             void _addSystem(const std::shared_ptr<ISystemBase> &);
 
+            //! Get the pool for the system initialization tasks, it is
+            //! created on first use.
+            const std::shared_ptr<InitTaskPool>& _getInitTaskPool();
+
         private:
             void _logInfo(const std::string& argv0);
+            void _startupFinished();
             void _logSystemOrder();
             void _writeSystemDotGraph();
             void _calcFPS();
 
             std::string _name;
+            std::string _argv0;
+            Core::Time::TimePoint _startTime = std::chrono::steady_clock::now();
+            Core::Time::Duration _startupTime = Core::Time::Duration::zero();
+            std::shared_ptr<Trace::Recorder> _trace;
+            std::shared_ptr<WakeCallback> _wakeCallback;
             std::shared_ptr<TimerSystem> _timerSystem;
             std::shared_ptr<ResourceSystem> _resourceSystem;
             std::shared_ptr<LogSystem> _logSystem;
             std::shared_ptr<TextSystem> _textSystem;
             std::vector<std::shared_ptr<ISystemBase> > _systems;
+            std::shared_ptr<InitTaskPool> _initTaskPool;
             bool _logSystemOrderInit = true;
             size_t _tickCount = 0;
             std::vector<std::pair<std::string, Core::Time::Duration> > _systemTickTimes;
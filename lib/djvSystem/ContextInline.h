@@ -45,6 +45,11 @@ namespace djv
             return out;
         }
 
+        inline const std::shared_ptr<WakeCallback>& Context::getWakeCallback() const
+        {
+            return _wakeCallback;
+        }
+
         inline float Context::getFPSAverage() const
         {
             return _fpsAverage;
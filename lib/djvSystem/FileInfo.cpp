@@ -8,6 +8,8 @@
 
 #include <djvMath/FrameNumberFunc.h>
 
+#include <djvCore/StringFunc.h>
+
 //#pragma optimize("", off)
 
 using namespace djv::Core;
@@ -18,6 +20,38 @@ namespace djv
     {
         namespace File
         {
+            void NameTemplate::getFileName(Math::Frame::Number frame, std::string& out) const
+            {
+                out.clear();
+                out.append(prefix);
+                if (sequence && frame != Math::Frame::invalid)
+                {
+                    const bool negative = frame < 0;
+                    const uint64_t abs = negative ? -frame : frame;
+                    char c[String::cStringLength] = "";
+                    const size_t length = String::intToString(abs, c);
+                    if (negative)
+                    {
+                        out.push_back('-');
+                    }
+                    if (pad > length)
+                    {
+                        out.append(pad - length, '0');
+                    }
+                    out.append(c, length);
+                }
+                out.append(suffix);
+            }
+
+            bool NameTemplate::operator == (const NameTemplate& other) const
+            {
+                return
+                    prefix == other.prefix &&
+                    pad == other.pad &&
+                    suffix == other.suffix &&
+                    sequence == other.sequence;
+            }
+
             Info::Info()
             {}
 
@@ -103,6 +137,27 @@ namespace djv
                 return ss.str();
             }
 
+            NameTemplate Info::getNameTemplate(bool path) const
+            {
+                NameTemplate out;
+                if (!_path.isRoot() && Type::Sequence == _type && _sequence.isValid())
+                {
+                    if (path)
+                    {
+                        out.prefix = _path.getDirectoryName();
+                    }
+                    out.prefix += _path.getBaseName();
+                    out.pad = _sequence.getPad();
+                    out.suffix = _path.getExtension();
+                    out.sequence = true;
+                }
+                else
+                {
+                    out.prefix = getFileName(Math::Frame::invalid, path);
+                }
+                return out;
+            }
+
             void Info::setSequence(const Math::Frame::Sequence& in)
             {
                 _sequence = in;
@@ -67,6 +67,23 @@ namespace djv
                 bool operator == (const DirectoryListOptions&) const;
             };
 
+            //! This struct provides a template for generating the file names of
+            //! a file sequence, for example "/tmp/render." + "0001" + ".exr".
+            struct NameTemplate
+            {
+                std::string prefix;
+                size_t      pad      = 0;
+                std::string suffix;
+                bool        sequence = false;
+
+                //! Get the file name for a frame. The output string is reused,
+                //! so once it has grown to the length of the file names no
+                //! memory is allocated.
+                void getFileName(Math::Frame::Number, std::string&) const;
+
+                bool operator == (const NameTemplate&) const;
+            };
+
             //! This class provides information about files and file sequences.
             //!
             //! A file sequence is a list of file names that share a common name and
@@ -105,6 +122,10 @@ namespace djv
                 //! \param path Include the path in the file name.
                 std::string getFileName(Math::Frame::Number = Math::Frame::invalid, bool path = true) const;
 
+                //! Get a template for generating the file names of the frames.
+                //! \param path Include the path in the file names.
+                NameTemplate getNameTemplate(bool path = true) const;
+
                 //! Get whether this file exists.
                 bool doesExist() const noexcept;
 
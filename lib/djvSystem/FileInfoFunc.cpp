@@ -4,13 +4,20 @@
 
 #include <djvSystem/FileInfoFunc.h>
 
+#include <djvSystem/File.h>
 #include <djvSystem/FileInfoPrivate.h>
 #include <djvSystem/PathFunc.h>
 
 #include <djvMath/FrameNumberFunc.h>
 
+#include <djvCore/StringFormat.h>
+
 #include <algorithm>
 #include <array>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 //#pragma optimize("", off)
 
@@ -22,6 +29,133 @@ namespace djv
     {
         namespace File
         {
+            namespace
+            {
+                //! The maximum directory depth for walking directories.
+                const size_t directoryWalkDepthMax = 64;
+
+            } // namespace
+
+            void directoryWalk(
+                const Path& path,
+                const DirectoryListOptions& options,
+                size_t threadCount,
+                const std::function<void(const Info&)>& callback,
+                const std::function<void(const Path&, const std::exception&)>& errorCallback)
+            {
+                std::mutex mutex;
+                std::condition_variable cv;
+                std::deque<std::pair<Path, size_t> > directories;
+                directories.push_back(std::make_pair(path, 0));
+                size_t busy = 0;
+                std::exception_ptr error;
+                std::exception_ptr exception;
+
+                // Report an error and continue, the walk is stopped if the
+                // error callback throws.
+                auto report = [&](const Path& value, const std::exception& e)
+                {
+                    if (errorCallback)
+                    {
+                        try
+                        {
+                            errorCallback(value, e);
+                        }
+                        catch (...)
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            if (!exception)
+                            {
+                                exception = std::current_exception();
+                            }
+                        }
+                    }
+                    else
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!error)
+                        {
+                            error = std::make_exception_ptr(std::runtime_error(e.what()));
+                        }
+                    }
+                };
+
+                auto worker = [&]
+                {
+                    while (true)
+                    {
+                        std::pair<Path, size_t> directory;
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            cv.wait(
+                                lock,
+                                [&directories, &busy, &exception]
+                                {
+                                    return !directories.empty() || 0 == busy || exception;
+                                });
+                            if (directories.empty() || exception)
+                            {
+                                break;
+                            }
+                            directory = directories.front();
+                            directories.pop_front();
+                            ++busy;
+                        }
+                        std::vector<Path> subDirectories;
+                        std::vector<Info> items;
+                        if (!directoryList(directory.first, options, items))
+                        {
+                            //! \todo How can we translate this?
+                            report(directory.first, Error(String::Format("{0}: {1}").
+                                arg(directory.first.get()).
+                                arg(DJV_TEXT("error_cannot_be_opened"))));
+                        }
+                        for (const auto& info : items)
+                        {
+                            try
+                            {
+                                callback(info);
+                            }
+                            catch (const std::exception& e)
+                            {
+                                report(info.getPath(), e);
+                            }
+                            if (Type::Directory == info.getType() && directory.second < directoryWalkDepthMax)
+                            {
+                                subDirectories.push_back(info.getPath());
+                            }
+                        }
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            for (const auto& i : subDirectories)
+                            {
+                                directories.push_back(std::make_pair(i, directory.second + 1));
+                            }
+                            --busy;
+                        }
+                        cv.notify_all();
+                    }
+                };
+                std::vector<std::thread> threads;
+                for (size_t i = 1; i < std::max(threadCount, static_cast<size_t>(1)); ++i)
+                {
+                    threads.emplace_back(worker);
+                }
+                worker();
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+                if (exception)
+                {
+                    std::rethrow_exception(exception);
+                }
+                if (error)
+                {
+                    std::rethrow_exception(error);
+                }
+            }
+
             bool isSequenceWildcard(const std::string& value) noexcept
             {
                 auto i = value.begin();
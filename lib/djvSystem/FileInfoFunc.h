@@ -9,6 +9,7 @@
 #include <djvCore/Enum.h>
 #include <djvCore/RapidJSONFunc.h>
 
+#include <functional>
 #include <sstream>
 
 namespace djv
@@ -23,6 +24,27 @@ namespace djv
             //! Get the contents of the given directory.
             std::vector<Info> directoryList(const Path& path, const DirectoryListOptions& options = DirectoryListOptions());
 
+            //! Recursively list the contents of the given directory. The
+            //! directories are listed in parallel with the given number of
+            //! threads, and the callback is called from those threads for
+            //! each item in no particular order. The depth is limited to guard
+            //! against loops made with symbolic links.
+            //!
+            //! Directories that cannot be opened and exceptions from the
+            //! callback are passed to the error callback, also from the
+            //! threads, and the walk continues. Without an error callback the
+            //! first error is thrown when the walk is finished.
+            //!
+            //! Throws:
+            //! - std::exception if there is no error callback and an error
+            //!   occurs, or if the error callback throws.
+            void directoryWalk(
+                const Path& path,
+                const DirectoryListOptions& options,
+                size_t threadCount,
+                const std::function<void(const Info&)>& callback,
+                const std::function<void(const Path&, const std::exception&)>& errorCallback = nullptr);
+
             ///@}
 
             //! \name Sequences
@@ -23,13 +23,14 @@ namespace djv
     {
         namespace File
         {
-            std::vector<Info> directoryList(const Path& value, const DirectoryListOptions& options)
+            bool directoryList(const Path& value, const DirectoryListOptions& options, std::vector<Info>& out)
             {
-                std::vector<Info> out;
+                bool open = false;
                 
                 // List the directory contents.
                 if (auto dir = opendir(value.get().c_str()))
                 {
+                    open = true;
                     dirent* de = nullptr;
                     while ((de = readdir(dir)))
                     {
@@ -100,6 +101,13 @@ namespace djv
                 // Sort the items.
                 sort(options, out);
                 
+                return open;
+            }
+
+            std::vector<Info> directoryList(const Path& value, const DirectoryListOptions& options)
+            {
+                std::vector<Info> out;
+                directoryList(value, options, out);
                 return out;
             }
 
@@ -120,9 +120,9 @@ namespace djv
 
             } // namespace
 
-            std::vector<Info> directoryList(const Path& value, const DirectoryListOptions& options)
+            bool directoryList(const Path& value, const DirectoryListOptions& options, std::vector<Info>& out)
             {
-                std::vector<Info> out;
+                bool open = false;
                 if (!value.isEmpty())
                 {
                     // Prepare the path.
@@ -138,6 +138,7 @@ namespace djv
                     HANDLE hFind = FindFirstFileW(pathBuf, &ffd);
                     if (hFind != INVALID_HANDLE_VALUE)
                     {
+                        open = true;
                         try
                         {
                             do
@@ -202,6 +203,7 @@ namespace djv
                         NetResource netResource(16384);
                         netResource.p->lpRemoteName = buf.data();
 
+                        open = true;
                         std::vector<std::string> shares;
                         EnumerateFunc(netResource.p, shares);
                         for (const auto& i : shares)
@@ -213,6 +215,13 @@ namespace djv
                     // Sort the items.
                     sort(options, out);
                 }
+                return open;
+            }
+
+            std::vector<Info> directoryList(const Path& value, const DirectoryListOptions& options)
+            {
+                std::vector<Info> out;
+                directoryList(value, options, out);
                 return out;
             }
 
@@ -12,6 +12,10 @@ namespace djv
     {
         namespace File
         {
+            //! Get the contents of the given directory. Returns false if the
+            //! directory cannot be opened.
+            bool directoryList(const Path&, const DirectoryListOptions&, std::vector<Info>&);
+
             void sequence(Info&, const DirectoryListOptions&, std::vector<Info>&);
             void sort(const DirectoryListOptions&, std::vector<Info>&);
 
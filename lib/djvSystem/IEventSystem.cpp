@@ -273,12 +273,20 @@ namespace djv
 
             void IEventSystem::_updateRecursive(const std::shared_ptr<IObject>& object, Update& event)
             {
-                object->event(event);
-                const auto children = object->_children;
-                for (const auto& child : children)
+                // Only visit the objects that have update events enabled and
+                // their parents. The children are indexed rather than copied
+                // since the list may be modified by the event.
+                if (object->_updateEvents)
                 {
-                    child->_parentsEnabled = object->_enabled && object->_parentsEnabled;
-                    _updateRecursive(child, event);
+                    object->event(event);
+                }
+                for (size_t i = 0; i < object->_children.size(); ++i)
+                {
+                    if (object->_children[i]->_updateEventsCount > 0)
+                    {
+                        const auto child = object->_children[i];
+                        _updateRecursive(child, event);
+                    }
                 }
             }
 
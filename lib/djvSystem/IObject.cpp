@@ -81,10 +81,14 @@ namespace djv
 
                 Event::ChildRemoved childRemovedEvent(value);
                 parent->event(childRemovedEvent);
+
+                parent->_addUpdateEventsCount(-static_cast<int>(value->_updateEventsCount));
             }
 
             value->_parent = shared_from_this();
             _children.push_back(value);
+            _addUpdateEventsCount(static_cast<int>(value->_updateEventsCount));
+            _setParentsEnabledRecursive(value, _enabled && _parentsEnabled);
             
             Event::ChildAdded childAddedEvent(value);
             event(childAddedEvent);
@@ -102,6 +106,8 @@ namespace djv
                 _children.erase(i);
 
                 child->_parent.reset();
+                _addUpdateEventsCount(-static_cast<int>(child->_updateEventsCount));
+                _setParentsEnabledRecursive(child, true);
 
                 Event::ChildRemoved childRemovedEvent(child);
                 event(childRemovedEvent);
@@ -153,6 +159,17 @@ namespace djv
             }
         }
 
+        void IObject::setEnabled(bool value)
+        {
+            if (value == _enabled)
+                return;
+            _enabled = value;
+            for (const auto& child : _children)
+            {
+                _setParentsEnabledRecursive(child, _enabled && _parentsEnabled);
+            }
+        }
+
         bool IObject::event(System::Event::Event& event)
         {
             bool out = false;
@@ -253,6 +270,35 @@ namespace djv
             // Default implementation does nothing.
         }
 
+        void IObject::_setUpdateEvents(bool value)
+        {
+            if (value == _updateEvents)
+                return;
+            _updateEvents = value;
+            _addUpdateEventsCount(value ? 1 : -1);
+        }
+
+        void IObject::_addUpdateEventsCount(int value)
+        {
+            if (!value)
+                return;
+            for (IObject* object = this; object; object = object->_parent.lock().get())
+            {
+                object->_updateEventsCount += value;
+            }
+        }
+
+        void IObject::_setParentsEnabledRecursive(const std::shared_ptr<IObject>& object, bool value)
+        {
+            if (value == object->_parentsEnabled)
+                return;
+            object->_parentsEnabled = value;
+            for (const auto& child : object->_children)
+            {
+                _setParentsEnabledRecursive(child, object->_enabled && value);
+            }
+        }
+
         bool IObject::_eventFilter(const std::shared_ptr<IObject>&, Event::Event&)
         {
             return false;
@@ -145,6 +145,13 @@ namespace djv
             virtual void _initEvent(System::Event::Init&);
             virtual void _updateEvent(System::Event::Update&);
 
+            //! Enable update events. Update events are only sent to objects
+            //! that enable them, so objects that over-ride _updateEvent()
+            //! should call this function.
+            void _setUpdateEvents(bool);
+
+            bool _hasUpdateEvents() const;
+
             //! Over-ride this function to filter events for other objects.
             virtual bool _eventFilter(const std::shared_ptr<IObject>&, Event::Event&);
 
@@ -165,6 +172,8 @@ namespace djv
 
         private:
             void _eventInitRecursive(const std::shared_ptr<IObject>&, Event::Init&);
+            void _addUpdateEventsCount(int);
+            static void _setParentsEnabledRecursive(const std::shared_ptr<IObject>&, bool);
             bool _eventFilter(System::Event::Event&);
 
             template<typename T>
@@ -183,6 +192,9 @@ namespace djv
             bool _enabled = true;
             bool _parentsEnabled = true;
 
+            bool   _updateEvents      = false;
+            size_t _updateEventsCount = 0;
+
             std::vector<std::weak_ptr<IObject> > _filters;
 
             std::shared_ptr<ResourceSystem> _resourceSystem;
@@ -112,9 +112,9 @@ namespace djv
             return parents ? (_parentsEnabled && _enabled) : _enabled;
         }
 
-        inline void IObject::setEnabled(bool value)
+        inline bool IObject::_hasUpdateEvents() const
         {
-            _enabled = value;
+            return _updateEvents;
         }
 
         inline const std::shared_ptr<ResourceSystem>& IObject::_getResourceSystem() const
@@ -5,9 +5,11 @@
 #include <djvSystem/ISystem.h>
 
 #include <djvSystem/Context.h>
+#include <djvSystem/InitTaskPool.h>
 #include <djvSystem/LogSystem.h>
 #include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TextSystem.h>
+#include <djvSystem/Trace.h>
 
 #include <sstream>
 
@@ -26,10 +28,12 @@ namespace djv
             ++systemCount;
             _name = name;
             _context = context;
+            _wakeCallback = context->getWakeCallback();
             context->_addSystem(std::dynamic_pointer_cast<ISystemBase>(shared_from_this()));
         }
         
-        ISystemBase::ISystemBase()
+        ISystemBase::ISystemBase() :
+            _initFinished(true)
         {}
 
         ISystemBase::~ISystemBase()
@@ -46,6 +50,58 @@ namespace djv
             _dependencies.push_back(value);
         }
         
+        void ISystemBase::waitForInit() const
+        {
+            if (_initFinished)
+                return;
+            for (const auto& i : _initFutures)
+            {
+                i.wait();
+            }
+            _initFinished = true;
+        }
+
+        void ISystemBase::_initTask(const std::function<void()>& value)
+        {
+            if (auto context = _context.lock())
+            {
+                std::set<const ISystemBase*> visited;
+                std::vector<std::shared_future<void> > dependencies;
+                _getDependencyInitFutures(visited, dependencies);
+                auto trace = context->getTrace();
+                const std::string name = _name;
+                _initFinished = false;
+                _initFutures.push_back(context->_getInitTaskPool()->addTask(
+                    [trace, name, value]
+                    {
+                        Trace::Scope scope(trace, name, "init task");
+                        value();
+                    },
+                    dependencies));
+            }
+        }
+
+        void ISystemBase::_getDependencyInitFutures(
+            std::set<const ISystemBase*>& visited,
+            std::vector<std::shared_future<void> >& out) const
+        {
+            for (const auto& i : _dependencies)
+            {
+                if (visited.insert(i.get()).second)
+                {
+                    out.insert(out.end(), i->_initFutures.begin(), i->_initFutures.end());
+                    i->_getDependencyInitFutures(visited, out);
+                }
+            }
+        }
+
+        void ISystemBase::_wake()
+        {
+            // Note that the context is not locked here since this function is
+            // called from worker threads.
+            (*_wakeCallback)();
+        }
+
         void ISystemBase::tick()
         {
             // Default implementation does nothing.
@@ -57,6 +113,7 @@ namespace djv
             _textSystem = context->getSystemT<TextSystem>();
             _resourceSystem = context->getSystemT<ResourceSystem>();
             _logSystem = context->getSystemT<LogSystem>();
+            _trace = context->getTrace();
             {
                 std::stringstream ss;
                 ss << name << " starting...";
@@ -90,6 +147,7 @@ namespace djv
         {
             Core::Time::TimePoint time = std::chrono::steady_clock::now();
             const auto diff = std::chrono::duration_cast<Core::Time::Duration>(time - _initStartTime);
+            _trace->add(Trace::Event(getSystemName(), "init", _initStartTime, time));
             std::stringstream ss;
             ss << "Init time: " << diff.count();
             _log(ss.str());
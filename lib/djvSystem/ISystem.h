@@ -8,7 +8,11 @@
 
 #include <djvCore/Time.h>
 
+#include <atomic>
+#include <functional>
+#include <future>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -20,6 +24,13 @@ namespace djv
         class LogSystem;
         class ResourceSystem;
         class TextSystem;
+        class WakeCallback;
+
+        namespace Trace
+        {
+            class Recorder;
+
+        } // namespace Trace
 
         //! This class provides the very base functionality for systems.
         class ISystemBase : public std::enable_shared_from_this<ISystemBase>
@@ -60,6 +71,15 @@ namespace djv
 
             ///@}
 
+            //! \name Initialization
+            ///@{
+
+            //! Wait for the initialization tasks to finish. This function is
+            //! thread safe.
+            void waitForInit() const;
+
+            ///@}
+
             //! \name Tick
             ///@{
 
@@ -68,10 +88,36 @@ namespace djv
 
             ///@}
 
+        protected:
+            //! Run part of the initialization concurrently with the
+            //! initialization of the other systems, for example reading files
+            //! or probing devices. The tasks run on a bounded pool owned by
+            //! the context, and start after the tasks of the dependencies, so
+            //! add the dependencies first. The task must be thread safe and
+            //! must not create systems. Call waitForInit() before using the
+            //! results; the context waits for all of the tasks before the
+            //! first tick. Systems whose tasks use their own members must also
+            //! call waitForInit() in their destructor, since the context may
+            //! be destroyed without ticking.
+            void _initTask(const std::function<void()>&);
+
+            //! Wake the application event loop. This function is thread safe,
+            //! call it after setting the result of an asynchronous request so
+            //! that the result is picked up without waiting for the idle
+            //! timeout.
+            void _wake();
+
         private:
+            void _getDependencyInitFutures(
+                std::set<const ISystemBase*>&,
+                std::vector<std::shared_future<void> >&) const;
+
             std::string _name;
             std::weak_ptr<Context> _context;
+            std::shared_ptr<WakeCallback> _wakeCallback;
             std::vector<std::shared_ptr<ISystemBase> > _dependencies;
+            std::vector<std::shared_future<void> > _initFutures;
+            mutable std::atomic<bool> _initFinished;
         };
 
         //! This class provides the base functionality for systems.
@@ -99,6 +145,9 @@ namespace djv
             //! Get the resource system.
             std::shared_ptr<ResourceSystem> _getResourceSystem() const;
 
+            //! Get the startup trace.
+            std::shared_ptr<Trace::Recorder> _getTrace() const;
+
             //! Log initialization time.
             void _logInitTime();
             
@@ -106,6 +155,7 @@ namespace djv
             std::shared_ptr<TextSystem> _textSystem;
             std::shared_ptr<ResourceSystem> _resourceSystem;
             std::shared_ptr<LogSystem> _logSystem;
+            std::shared_ptr<Trace::Recorder> _trace;
             Core::Time::TimePoint _initStartTime = std::chrono::steady_clock::now();
         };
 
@@ -31,5 +31,10 @@ namespace djv
             return _resourceSystem;
         }
 
+        inline std::shared_ptr<Trace::Recorder> ISystem::_getTrace() const
+        {
+            return _trace;
+        }
+
     } // namespace System
 } // namespace djv
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/InitTaskPool.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+
+namespace djv
+{
+    namespace System
+    {
+        namespace
+        {
+            //! \todo Should this be configurable?
+            const size_t dependencyTimeout = 10;
+
+            struct Task
+            {
+                std::function<void()> callback;
+                std::vector<std::shared_future<void> > dependencies;
+                std::promise<void> promise;
+
+                bool isReady() const
+                {
+                    for (const auto& i : dependencies)
+                    {
+                        if (i.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            };
+
+        } // namespace
+
+        struct InitTaskPool::Private
+        {
+            std::list<std::shared_ptr<Task> > tasks;
+            std::mutex mutex;
+            std::condition_variable cv;
+            bool running = true;
+            std::vector<std::thread> threads;
+
+            std::shared_ptr<Task> takeReadyTask();
+        };
+
+        void InitTaskPool::_init(size_t threadCount)
+        {
+            DJV_PRIVATE_PTR();
+            for (size_t i = 0; i < std::max(threadCount, size_t(1)); ++i)
+            {
+                p.threads.push_back(std::thread(
+                    [this]
+                    {
+                        DJV_PRIVATE_PTR();
+                        while (true)
+                        {
+                            std::shared_ptr<Task> task;
+                            {
+                                std::unique_lock<std::mutex> lock(p.mutex);
+                                while (p.running && !(task = p.takeReadyTask()))
+                                {
+                                    // Tasks waiting on dependencies are normally
+                                    // woken when a task finishes, the timeout
+                                    // covers dependencies from outside the pool.
+                                    if (p.tasks.empty())
+                                    {
+                                        p.cv.wait(lock);
+                                    }
+                                    else
+                                    {
+                                        p.cv.wait_for(lock, std::chrono::milliseconds(dependencyTimeout));
+                                    }
+                                }
+                                if (!task)
+                                {
+                                    break;
+                                }
+                            }
+                            try
+                            {
+                                task->callback();
+                                task->promise.set_value();
+                            }
+                            catch (...)
+                            {
+                                task->promise.set_exception(std::current_exception());
+                            }
+                            task.reset();
+                            {
+                                std::unique_lock<std::mutex> lock(p.mutex);
+                            }
+                            p.cv.notify_all();
+                        }
+                    }));
+            }
+        }
+
+        InitTaskPool::InitTaskPool() :
+            _p(new Private)
+        {}
+
+        InitTaskPool::~InitTaskPool()
+        {
+            DJV_PRIVATE_PTR();
+            {
+                std::unique_lock<std::mutex> lock(p.mutex);
+                p.running = false;
+            }
+            p.cv.notify_all();
+            for (auto& i : p.threads)
+            {
+                if (i.joinable())
+                {
+                    i.join();
+                }
+            }
+        }
+
+        std::shared_ptr<InitTaskPool> InitTaskPool::create(size_t threadCount)
+        {
+            auto out = std::shared_ptr<InitTaskPool>(new InitTaskPool);
+            out->_init(threadCount);
+            return out;
+        }
+
+        size_t InitTaskPool::getThreadCount() const
+        {
+            return _p->threads.size();
+        }
+
+        std::shared_future<void> InitTaskPool::addTask(
+            const std::function<void()>& callback,
+            const std::vector<std::shared_future<void> >& dependencies)
+        {
+            DJV_PRIVATE_PTR();
+            auto task = std::make_shared<Task>();
+            task->callback = callback;
+            for (const auto& i : dependencies)
+            {
+                if (i.valid())
+                {
+                    task->dependencies.push_back(i);
+                }
+            }
+            auto out = task->promise.get_future().share();
+            {
+                std::unique_lock<std::mutex> lock(p.mutex);
+                p.tasks.push_back(task);
+            }
+            p.cv.notify_one();
+            return out;
+        }
+
+        std::shared_ptr<Task> InitTaskPool::Private::takeReadyTask()
+        {
+            std::shared_ptr<Task> out;
+            for (auto i = tasks.begin(); i != tasks.end(); ++i)
+            {
+                if ((*i)->isReady())
+                {
+                    out = *i;
+                    tasks.erase(i);
+                    break;
+                }
+            }
+            return out;
+        }
+
+    } // namespace System
+} // namespace djv
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace djv
+{
+    namespace System
+    {
+        //! This class provides a fixed number of threads for running the
+        //! initialization tasks of the systems.
+        //!
+        //! A task is only started once the tasks it depends on have
+        //! finished, so a worker thread never blocks on another task.
+        class InitTaskPool
+        {
+            DJV_NON_COPYABLE(InitTaskPool);
+            void _init(size_t threadCount);
+            InitTaskPool();
+
+        public:
+            //! Tasks that have not been started are discarded, their futures
+            //! are made ready with a broken promise.
+            ~InitTaskPool();
+
+            static std::shared_ptr<InitTaskPool> create(size_t threadCount);
+
+            //! Get the number of threads.
+            size_t getThreadCount() const;
+
+            //! Add a task. The future is ready when the task has finished,
+            //! and holds the exception if the task throws.
+            std::shared_future<void> addTask(
+                const std::function<void()>&,
+                const std::vector<std::shared_future<void> >& dependencies = {});
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace System
+} // namespace djv
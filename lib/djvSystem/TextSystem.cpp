@@ -11,15 +11,14 @@
 #include <djvSystem/FileIO.h>
 #include <djvSystem/LogSystem.h>
 #include <djvSystem/ResourceSystem.h>
+#include <djvSystem/TextTable.h>
 #include <djvSystem/TimerFunc.h>
+#include <djvSystem/Trace.h>
 
 #include <djvCore/OSFunc.h>
-#include <djvCore/RapidJSONFunc.h>
 #include <djvCore/StringFormat.h>
 #include <djvCore/StringFunc.h>
 
-#include <rapidjson/error/en.h>
-
 #include <future>
 #include <locale>
 #include <map>
@@ -44,8 +43,11 @@ namespace djv
 
             std::shared_ptr<ResourceSystem> resourceSystem;
             std::shared_ptr<LogSystem> logSystem;
+            std::shared_ptr<Trace::Recorder> trace;
 
             std::vector<File::Info> textFiles;
+            std::vector<File::Info> overrideTextFiles;
+            std::map<std::string, File::Path> tableFiles;
 
             std::vector<std::string> locales;
             std::string systemLocale;
@@ -53,6 +55,8 @@ namespace djv
 
             typedef std::map<std::string, std::map<std::string, std::string> > TextMap;
             TextMap text;
+            std::map<std::string, std::shared_ptr<TextTable> > tables;
+            std::set<std::string> loadedLocales;
             std::shared_ptr<Observer::ValueSubject<bool> > textChanged;
 
             mutable std::mutex mutex;
@@ -60,10 +64,14 @@ namespace djv
             std::shared_ptr<Timer> timer;
             std::shared_ptr<File::DirectoryWatcher> directoryWatcher;
 
-            std::vector<File::Info> getTextFiles() const;
+            void findTextFiles();
 
+            void loadLocale(const std::string&);
             void reload(const File::Info&);
 
+            const std::string* findText(const std::string& locale, const std::string& id);
+            const std::string* findID(const std::string& locale, const std::string& text);
+
             TextMap readText(const File::Info&);
             void readAllFutures();
 
@@ -73,6 +81,8 @@ namespace djv
 
         namespace
         {
+            const std::string englishLocale = "en";
+
             std::string parseLocale(const std::string& value)
             {
                 std::string locale = value;
@@ -155,108 +165,128 @@ namespace djv
             DJV_PRIVATE_PTR();
             p.resourceSystem = resourceSystem;
             p.logSystem = logSystem;
+            p.trace = context->getTrace();
             p.currentLocale = Observer::ValueSubject<std::string>::create("en");
             p.textChanged = Observer::ValueSubject<bool>::create();
 
-            // Find the .text files.
-            p.textFiles = p.getTextFiles();
-
-            // Extract the locale names.
-            std::set<std::string> localeSet;
-            for (const auto& textFile : p.textFiles)
-            {
-                std::string temp = File::Path(textFile.getPath().getBaseName()).getExtension();
-                if (temp.size() && '.' == temp[0])
-                {
-                    temp.erase(temp.begin());
-                }
-                if (temp != "all")
+            // Finding the text files and loading the English text is done by
+            // an initialization task, the functions that use the text wait
+            // for it to finish.
+            _initTask(
+                [this]
                 {
-                    localeSet.insert(temp);
-                }
-            }
-            for (const auto& locale : localeSet)
-            {
-                p.locales.push_back(locale);
-            }
-            {
-                std::stringstream ss;
-                ss.str(std::string());
-                ss << "Found text files: " << String::join(p.locales, ", ");
-                p.logSystem->log(getSystemName(), ss.str());
-            }
+                    DJV_PRIVATE_PTR();
 
-            // Get the system locale.
-            std::string djvLang;
-            if (OS::getEnv("DJV_LANG", djvLang) && !djvLang.empty())
-            {
-                {
-                    std::stringstream ss;
-                    ss << "DJV_LANG: " << djvLang;
-                    p.logSystem->log(getSystemName(), ss.str());
-                }
-                p.systemLocale = djvLang;
-            }
-            else
-            {
-                try
-                {
-                    const std::locale locale("");
-                    const std::string localeName = locale.name();
+                    // Find the .text files and the compiled text tables.
+                    p.findTextFiles();
+
+                    // Extract the locale names.
+                    std::set<std::string> localeSet;
+                    for (const auto& textFiles : { p.textFiles, p.overrideTextFiles })
+                    {
+                        for (const auto& textFile : textFiles)
+                        {
+                            const std::string locale = TextTable::getLocale(textFile.getPath());
+                            if (locale != "all")
+                            {
+                                localeSet.insert(locale);
+                            }
+                        }
+                    }
+                    for (const auto& tableFile : p.tableFiles)
+                    {
+                        localeSet.insert(tableFile.first);
+                    }
+                    for (const auto& locale : localeSet)
+                    {
+                        p.locales.push_back(locale);
+                    }
                     {
                         std::stringstream ss;
-                        ss << "std::locale: " << localeName;
+                        ss.str(std::string());
+                        ss << "Found text files: " << String::join(p.locales, ", ");
                         p.logSystem->log(getSystemName(), ss.str());
                     }
-                    const std::string cppLocale = parseLocale(localeName);
-                    if (cppLocale.size())
+
+                    // Get the system locale.
+                    std::string djvLang;
+                    if (OS::getEnv("DJV_LANG", djvLang) && !djvLang.empty())
+                    {
+                        {
+                            std::stringstream ss;
+                            ss << "DJV_LANG: " << djvLang;
+                            p.logSystem->log(getSystemName(), ss.str());
+                        }
+                        p.systemLocale = djvLang;
+                    }
+                    else
                     {
-                        p.systemLocale = cppLocale;
+                        try
+                        {
+                            const std::locale locale("");
+                            const std::string localeName = locale.name();
+                            {
+                                std::stringstream ss;
+                                ss << "std::locale: " << localeName;
+                                p.logSystem->log(getSystemName(), ss.str());
+                            }
+                            const std::string cppLocale = parseLocale(localeName);
+                            if (cppLocale.size())
+                            {
+                                p.systemLocale = cppLocale;
+                            }
+                        }
+                        catch (const std::exception& e)
+                        {
+                            p.logSystem->log(getSystemName(), e.what(), LogLevel::Error);
+                        }
                     }
-                }
-                catch (const std::exception& e)
-                {
-                    p.logSystem->log(getSystemName(), e.what(), LogLevel::Error);
-                }
-            }
 
-            // Check that the system locale is valid.
-            const auto i = localeSet.find(p.systemLocale);
-            if (i == localeSet.end())
-            {
-                // Fall back to using English.
-                const auto j = localeSet.find("en");
-                if (j != localeSet.end())
-                {
-                    p.systemLocale = *j;
-                }
-                else if (localeSet.size())
-                {
-                    // Fall back to using the first one in the list.
-                    p.systemLocale = *localeSet.begin();
-                }
-            }
-            {
-                std::stringstream ss;
-                ss << "System locale: " << p.systemLocale;
-                p.logSystem->log(getSystemName(), ss.str());
-            }
+                    // Check that the system locale is valid.
+                    const auto i = localeSet.find(p.systemLocale);
+                    if (i == localeSet.end())
+                    {
+                        // Fall back to using English.
+                        const auto j = localeSet.find(englishLocale);
+                        if (j != localeSet.end())
+                        {
+                            p.systemLocale = *j;
+                        }
+                        else if (localeSet.size())
+                        {
+                            // Fall back to using the first one in the list.
+                            p.systemLocale = *localeSet.begin();
+                        }
+                    }
+                    {
+                        std::stringstream ss;
+                        ss << "System locale: " << p.systemLocale;
+                        p.logSystem->log(getSystemName(), ss.str());
+                    }
 
-            // Load the text.
-            for (const auto& j : p.textFiles)
-            {
-                p.reload(j);
-            }
+                    // Load the English text, the other locales are loaded when they
+                    // are first used.
+                    p.loadLocale(englishLocale);
+                });
 
             // Start a directory watcher to check for changes to the text files.
+            // The .text files of the loaded locales are re-read and take
+            // priority over the text tables.
             p.directoryWatcher = File::DirectoryWatcher::create(context);
             p.directoryWatcher->setPath(p.resourceSystem->getPath(File::ResourcePath::Text));
             p.directoryWatcher->setCallback(
                 [this]
                 {
-                    for (const auto& j : _p->textFiles)
+                    waitForInit();
+                    for (const auto& textFiles : { _p->textFiles, _p->overrideTextFiles })
                     {
-                        _p->reload(j);
+                        for (const auto& j : textFiles)
+                        {
+                            if (_p->loadedLocales.find(TextTable::getLocale(j.getPath())) != _p->loadedLocales.end())
+                            {
+                                _p->reload(j);
+                            }
+                        }
                     }
                     _p->startTimer();
                 });
@@ -279,7 +309,9 @@ namespace djv
         {}
 
         TextSystem::~TextSystem()
-        {}
+        {
+            waitForInit();
+        }
 
         std::shared_ptr<TextSystem> TextSystem::create(const std::shared_ptr<Context>& context)
         {
@@ -294,11 +326,13 @@ namespace djv
 
         const std::vector<std::string>& TextSystem::getLocales() const
         {
+            waitForInit();
             return _p->locales;
         }
 
         const std::string& TextSystem::getSystemLocale() const
         {
+            waitForInit();
             return _p->systemLocale;
         }
 
@@ -310,6 +344,8 @@ namespace djv
         void TextSystem::setCurrentLocale(const std::string& value)
         {
             DJV_PRIVATE_PTR();
+            waitForInit();
+            p.loadLocale(value);
             if (p.currentLocale->setIfChanged(value))
             {
                 p.textChanged->setAlways(true);
@@ -319,17 +355,17 @@ namespace djv
         const std::string& TextSystem::getText(const std::string& id)
         {
             DJV_PRIVATE_PTR();
+            waitForInit();
             p.readAllFutures();
             {
                 std::unique_lock<std::mutex> lock(p.mutex);
-                const auto i = p.text.find(p.currentLocale->get());
-                if (i != p.text.end())
+                if (const std::string* out = p.findText(p.currentLocale->get(), id))
                 {
-                    const auto j = i->second.find(id);
-                    if (j != i->second.end())
-                    {
-                        return j->second;
-                    }
+                    return *out;
+                }
+                if (const std::string* out = p.findText(englishLocale, id))
+                {
+                    return *out;
                 }
             }
             return id;
@@ -338,19 +374,17 @@ namespace djv
         const std::string& TextSystem::getID(const std::string& text)
         {
             DJV_PRIVATE_PTR();
+            waitForInit();
             p.readAllFutures();
             {
                 std::unique_lock<std::mutex> lock(p.mutex);
-                const auto i = p.text.find(p.currentLocale->get());
-                if (i != p.text.end())
+                if (const std::string* out = p.findID(p.currentLocale->get(), text))
                 {
-                    for (const auto& j : i->second)
-                    {
-                        if (text == j.second)
-                        {
-                            return j.first;
-                        }
-                    }
+                    return *out;
+                }
+                if (const std::string* out = p.findID(englishLocale, text))
+                {
+                    return *out;
                 }
             }
             return text;
@@ -361,18 +395,30 @@ namespace djv
             return _p->textChanged;
         }
 
-        std::vector<File::Info> TextSystem::Private::getTextFiles() const
+        void TextSystem::Private::findTextFiles()
         {
-            std::vector<File::Info> out;
             File::DirectoryListOptions options;
             options.filter = "\\.text$";
 
             const auto textPath = resourceSystem->getPath(File::ResourcePath::Text);
-            out = File::directoryList(textPath, options);
+            File::DirectoryListOptions textPathOptions;
+            textPathOptions.filter = "\\.text$|\\" + textTableExtension + "$";
+            for (const auto& i : File::directoryList(textPath, textPathOptions))
+            {
+                const auto& path = i.getPath();
+                if (textTableExtension == path.getExtension())
+                {
+                    tableFiles[TextTable::getLocale(path)] = path;
+                }
+                else
+                {
+                    textFiles.push_back(i);
+                }
+            }
             
             const auto documentsPath = resourceSystem->getPath(File::ResourcePath::Documents);
             auto list = File::directoryList(documentsPath, options);
-            out.insert(out.end(), list.begin(), list.end());
+            overrideTextFiles.insert(overrideTextFiles.end(), list.begin(), list.end());
 
             try
             {
@@ -382,7 +428,7 @@ namespace djv
                     for (const auto& path : envPaths)
                     {
                         list = File::directoryList(File::Path(path), options);
-                        out.insert(out.end(), list.begin(), list.end());
+                        overrideTextFiles.insert(overrideTextFiles.end(), list.begin(), list.end());
                     }
                 }
             }
@@ -393,10 +439,58 @@ namespace djv
                     String::Format("{0}: {1}").arg("DJV_TEXT_PATH").arg(e.what()),
                     LogLevel::Error);
             }
+        }
 
-            return out;
+        void TextSystem::Private::loadLocale(const std::string& locale)
+        {
+            if (loadedLocales.find(locale) == loadedLocales.end())
+            {
+                loadedLocales.insert(locale);
+
+                // Load the text table, falling back to reading the .text
+                // files when there is no table.
+                bool table = false;
+                const auto i = tableFiles.find(locale);
+                if (i != tableFiles.end())
+                {
+                    try
+                    {
+                        Trace::Scope scope(trace, "Load text table", "io");
+                        auto textTable = TextTable::create(i->second);
+                        {
+                            std::stringstream ss;
+                            ss << i->second.get() << " strings: " << textTable->getCount();
+                            logSystem->log(p.getSystemName(), ss.str());
+                        }
+                        std::unique_lock<std::mutex> lock(mutex);
+                        tables[locale] = textTable;
+                        table = true;
+                    }
+                    catch (const std::exception& e)
+                    {
+                        logSystem->log(p.getSystemName(), e.what(), LogLevel::Error);
+                    }
+                }
+                if (!table)
+                {
+                    for (const auto& j : textFiles)
+                    {
+                        if (TextTable::getLocale(j.getPath()) == locale)
+                        {
+                            reload(j);
+                        }
+                    }
+                }
+                for (const auto& j : overrideTextFiles)
+                {
+                    if (TextTable::getLocale(j.getPath()) == locale)
+                    {
+                        reload(j);
+                    }
+                }
+            }
         }
-        
+
         void TextSystem::Private::reload(const File::Info& value)
         {
             auto info = value;
@@ -413,55 +507,12 @@ namespace djv
             TextMap out;
             try
             {
+                Trace::Scope scope(trace, "Read text", "io");
                 const auto& path = textFile.getPath();
-                const auto& baseName = path.getBaseName();
-                std::string locale;
-                for (auto j = baseName.rbegin(); j != baseName.rend() && *j != '.'; ++j)
-                {
-                    locale.insert(locale.begin(), *j);
-                }
-                
-                auto fileIO = File::IO::create();
-                fileIO->open(path.get(), File::Mode::Read);
-                size_t bufSize = 0;
-#if defined(DJV_MMAP)
-                const char* bufP = reinterpret_cast<const char*>(fileIO->mmapP());
-                const char* bufEnd = reinterpret_cast<const char*>(fileIO->mmapEnd());
-                bufSize = bufEnd - bufP;
-#else // DJV_MMAP
-                std::vector<char> buf;
-                bufSize = fileIO->getSize();
-                buf.resize(bufSize);
-                fileIO->read(buf.data(), bufSize);
-                const char* bufP = buf.data();
-#endif // DJV_MMAP
-
-                // Parse the JSON.
-                rapidjson::Document document;
-                rapidjson::ParseResult result = document.Parse(bufP, bufSize);
-                if (!result)
-                {
-                    size_t line = 0;
-                    size_t character = 0;
-                    RapidJSON::errorLineNumber(bufP, bufSize, result.Offset(), line, character);
-                    throw std::runtime_error(String::Format("{0}: {1} {2} {3}, {4} {5}").
-                        arg(path.get()).
-                        arg(rapidjson::GetParseError_En(result.Code())).
-                        arg("Line").
-                        arg(line).
-                        arg("Character").
-                        arg(character));
-                }
-                for (const auto& i: document.GetObject())
-                {
-                    if (i.value.IsString())
-                    {
-                        out[locale][i.name.GetString()] = i.value.GetString();
-                    }
-                }
+                out[TextTable::getLocale(path)] = TextTable::readText(path);
                 {
                     std::stringstream ss;
-                    ss << textFile.getPath().get() << "' strings: " << out[locale].size();
+                    ss << textFile.getPath().get() << " strings: " << out.begin()->second.size();
                     logSystem->log(p.getSystemName(), ss.str());
                 }
             }
@@ -495,6 +546,38 @@ namespace djv
             }
         }
 
+        const std::string* TextSystem::Private::findText(const std::string& locale, const std::string& id)
+        {
+            const auto i = text.find(locale);
+            if (i != text.end())
+            {
+                const auto j = i->second.find(id);
+                if (j != i->second.end())
+                {
+                    return &j->second;
+                }
+            }
+            const auto j = tables.find(locale);
+            return j != tables.end() ? j->second->getText(id) : nullptr;
+        }
+
+        const std::string* TextSystem::Private::findID(const std::string& locale, const std::string& value)
+        {
+            const auto i = text.find(locale);
+            if (i != text.end())
+            {
+                for (const auto& j : i->second)
+                {
+                    if (value == j.second)
+                    {
+                        return &j.first;
+                    }
+                }
+            }
+            const auto j = tables.find(locale);
+            return j != tables.end() ? j->second->getID(value) : nullptr;
+        }
+
         void TextSystem::Private::startTimer()
         {
             timer->start(
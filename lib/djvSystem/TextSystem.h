@@ -25,6 +25,11 @@ namespace djv
         //! - File::ResourcePath::Documents
         //! - DJV_TEXT environment variable, a list of colon (Linux/macOS)
         //!   or semicolon (Windows) separated paths to search
+        //!
+        //! Compiled text tables (see TextTable) in File::ResourcePath::Text are
+        //! used in place of the .text files in the same directory. Only English
+        //! and the current locale are loaded, and text that is missing from the
+        //! current locale falls back to English.
         class TextSystem : public ISystemBase
         {
             DJV_NON_COPYABLE(TextSystem);
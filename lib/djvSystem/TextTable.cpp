@@ -0,0 +1,409 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/TextTable.h>
+
+#include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+
+#include <djvCore/MemoryFunc.h>
+#include <djvCore/RapidJSONFunc.h>
+#include <djvCore/StringFormat.h>
+
+#include <rapidjson/error/en.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace System
+    {
+        namespace
+        {
+            const char     magic[]        = "djvTexts";
+            const size_t   magicSize      = 8;
+            const uint32_t version        = 1;
+            const size_t   headerSize     = magicSize + sizeof(uint32_t) * 4;
+            const size_t   slotValueCount = 4;
+            const size_t   slotSize       = sizeof(uint32_t) * slotValueCount;
+
+            //! The average number of IDs in each hash bucket.
+            const size_t bucketLoad = 2;
+
+            //! This is FNV-1a followed by a final mix so that different seeds
+            //! give independent hashes.
+            uint32_t hash(const char* data, size_t size, uint32_t seed)
+            {
+                uint32_t out = 2166136261U ^ (seed * 0x9e3779b9U);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    out ^= static_cast<uint8_t>(data[i]);
+                    out *= 16777619U;
+                }
+                out ^= out >> 16;
+                out *= 0x85ebca6bU;
+                out ^= out >> 13;
+                out *= 0xc2b2ae35U;
+                out ^= out >> 16;
+                return out;
+            }
+
+            //! The table is always stored little endian.
+            uint32_t getU32(const uint8_t* p)
+            {
+                return
+                    static_cast<uint32_t>(p[0]) |
+                    static_cast<uint32_t>(p[1]) << 8 |
+                    static_cast<uint32_t>(p[2]) << 16 |
+                    static_cast<uint32_t>(p[3]) << 24;
+            }
+
+            bool isEndianConversion()
+            {
+                return Memory::Endian::MSB == Memory::getEndian();
+            }
+
+            struct Slot
+            {
+                uint32_t idOffset   = 0;
+                uint32_t idSize     = 0;
+                uint32_t textOffset = 0;
+                uint32_t textSize   = 0;
+            };
+
+        } // namespace
+
+        struct TextTable::Private
+        {
+            std::shared_ptr<File::IO> io;
+            std::vector<uint8_t> buf;
+            const uint8_t* seeds = nullptr;
+            const uint8_t* slots = nullptr;
+            const char* blob = nullptr;
+            uint32_t count = 0;
+            uint32_t bucketCount = 0;
+
+            // The strings are only converted to std::string when they are
+            // first asked for.
+            std::vector<std::unique_ptr<std::string> > texts;
+            std::vector<std::unique_ptr<std::string> > ids;
+
+            Slot getSlot(uint32_t) const;
+        };
+
+        void TextTable::_init(const File::Path& path)
+        {
+            DJV_PRIVATE_PTR();
+            p.io = File::IO::create();
+            p.io->open(path.get(), File::Mode::Read);
+            const size_t fileSize = p.io->getSize();
+#if defined(DJV_MMAP)
+            const uint8_t* data = p.io->mmapP();
+#else // DJV_MMAP
+            p.buf.resize(fileSize);
+            p.io->read(p.buf.data(), fileSize);
+            p.io.reset();
+            const uint8_t* data = p.buf.data();
+#endif // DJV_MMAP
+
+            if (fileSize < headerSize ||
+                memcmp(data, magic, magicSize) != 0 ||
+                getU32(data + magicSize) != version)
+            {
+                throw File::Error(String::Format("{0}: {1}").
+                    arg(path.get()).
+                    arg("Unrecognized text table."));
+            }
+            p.count = getU32(data + magicSize + sizeof(uint32_t));
+            p.bucketCount = getU32(data + magicSize + sizeof(uint32_t) * 2);
+            const uint32_t blobSize = getU32(data + magicSize + sizeof(uint32_t) * 3);
+            if (p.count > 0 && 0 == p.bucketCount)
+            {
+                throw File::Error(String::Format("{0}: {1}").
+                    arg(path.get()).
+                    arg("Unrecognized text table."));
+            }
+            const size_t tableSize =
+                headerSize +
+                static_cast<size_t>(p.bucketCount) * sizeof(uint32_t) +
+                static_cast<size_t>(p.count) * slotSize;
+            if (tableSize + blobSize > fileSize)
+            {
+                throw File::Error(String::Format("{0}: {1}").
+                    arg(path.get()).
+                    arg("Text table is truncated."));
+            }
+            p.seeds = data + headerSize;
+            p.slots = p.seeds + p.bucketCount * sizeof(uint32_t);
+            p.blob = reinterpret_cast<const char*>(data + tableSize);
+            for (uint32_t i = 0; i < p.count; ++i)
+            {
+                const Slot slot = p.getSlot(i);
+                if (static_cast<size_t>(slot.idOffset) + slot.idSize > blobSize ||
+                    static_cast<size_t>(slot.textOffset) + slot.textSize > blobSize)
+                {
+                    throw File::Error(String::Format("{0}: {1}").
+                        arg(path.get()).
+                        arg("Text table is truncated."));
+                }
+            }
+            p.texts.resize(p.count);
+            p.ids.resize(p.count);
+        }
+
+        TextTable::TextTable() :
+            _p(new Private)
+        {}
+
+        TextTable::~TextTable()
+        {}
+
+        std::shared_ptr<TextTable> TextTable::create(const File::Path& path)
+        {
+            auto out = std::shared_ptr<TextTable>(new TextTable);
+            out->_init(path);
+            return out;
+        }
+
+        size_t TextTable::getCount() const
+        {
+            return _p->count;
+        }
+
+        const std::string* TextTable::getText(const std::string& id)
+        {
+            DJV_PRIVATE_PTR();
+            const std::string* out = nullptr;
+            if (p.count > 0)
+            {
+                const uint32_t bucket = hash(id.data(), id.size(), 0) % p.bucketCount;
+                const uint32_t seed = getU32(p.seeds + bucket * sizeof(uint32_t));
+                const uint32_t index = hash(id.data(), id.size(), seed) % p.count;
+                const Slot slot = p.getSlot(index);
+                if (slot.idSize == id.size() &&
+                    0 == memcmp(p.blob + slot.idOffset, id.data(), id.size()))
+                {
+                    auto& text = p.texts[index];
+                    if (!text)
+                    {
+                        text.reset(new std::string(p.blob + slot.textOffset, slot.textSize));
+                    }
+                    out = text.get();
+                }
+            }
+            return out;
+        }
+
+        const std::string* TextTable::getID(const std::string& text)
+        {
+            DJV_PRIVATE_PTR();
+            const std::string* out = nullptr;
+            for (uint32_t i = 0; i < p.count; ++i)
+            {
+                const Slot slot = p.getSlot(i);
+                if (slot.textSize == text.size() &&
+                    0 == memcmp(p.blob + slot.textOffset, text.data(), text.size()))
+                {
+                    auto& id = p.ids[i];
+                    if (!id)
+                    {
+                        id.reset(new std::string(p.blob + slot.idOffset, slot.idSize));
+                    }
+                    out = id.get();
+                    break;
+                }
+            }
+            return out;
+        }
+
+        void TextTable::write(const File::Path& path, const std::map<std::string, std::string>& text)
+        {
+            // Intern the strings into the blob.
+            std::string blob;
+            std::map<std::string, uint32_t> interned;
+            auto intern = [&blob, &interned](const std::string& value)
+            {
+                const auto i = interned.find(value);
+                if (i != interned.end())
+                {
+                    return i->second;
+                }
+                const uint32_t offset = static_cast<uint32_t>(blob.size());
+                blob.append(value);
+                interned[value] = offset;
+                return offset;
+            };
+            std::vector<std::pair<std::string, Slot> > items;
+            for (const auto& i : text)
+            {
+                Slot slot;
+                slot.idOffset = intern(i.first);
+                slot.idSize = static_cast<uint32_t>(i.first.size());
+                slot.textOffset = intern(i.second);
+                slot.textSize = static_cast<uint32_t>(i.second.size());
+                items.push_back(std::make_pair(i.first, slot));
+            }
+            if (blob.size() > std::numeric_limits<uint32_t>::max())
+            {
+                throw File::Error(String::Format("{0}: {1}").
+                    arg(path.get()).
+                    arg("Text table is too large."));
+            }
+
+            // Build the minimal perfect hash. The IDs are distributed into
+            // buckets, then starting with the largest bucket a seed is found
+            // that places all of the IDs in the bucket into free slots.
+            const uint32_t count = static_cast<uint32_t>(items.size());
+            const uint32_t bucketCount = static_cast<uint32_t>(std::max(size_t(1), items.size() / bucketLoad));
+            std::vector<std::vector<size_t> > buckets(bucketCount);
+            for (size_t i = 0; i < items.size(); ++i)
+            {
+                const auto& id = items[i].first;
+                buckets[hash(id.data(), id.size(), 0) % bucketCount].push_back(i);
+            }
+            std::vector<uint32_t> bucketOrder(bucketCount);
+            for (uint32_t i = 0; i < bucketCount; ++i)
+            {
+                bucketOrder[i] = i;
+            }
+            std::stable_sort(
+                bucketOrder.begin(),
+                bucketOrder.end(),
+                [&buckets](uint32_t a, uint32_t b)
+                {
+                    return buckets[a].size() > buckets[b].size();
+                });
+            std::vector<uint32_t> seeds(bucketCount, 0);
+            std::vector<Slot> slots(count);
+            std::vector<bool> used(count, false);
+            std::vector<uint32_t> indices;
+            for (const auto bucket : bucketOrder)
+            {
+                const auto& ids = buckets[bucket];
+                if (ids.empty())
+                {
+                    break;
+                }
+                uint32_t seed = 1;
+                for (; seed < std::numeric_limits<uint32_t>::max(); ++seed)
+                {
+                    indices.clear();
+                    for (const auto i : ids)
+                    {
+                        const auto& id = items[i].first;
+                        const uint32_t index = hash(id.data(), id.size(), seed) % count;
+                        if (used[index] || std::find(indices.begin(), indices.end(), index) != indices.end())
+                        {
+                            break;
+                        }
+                        indices.push_back(index);
+                    }
+                    if (indices.size() == ids.size())
+                    {
+                        break;
+                    }
+                }
+                seeds[bucket] = seed;
+                for (size_t i = 0; i < ids.size(); ++i)
+                {
+                    used[indices[i]] = true;
+                    slots[indices[i]] = items[ids[i]].second;
+                }
+            }
+
+            // Write the file.
+            auto io = File::IO::create();
+            io->open(path.get(), File::Mode::Write);
+            io->setEndianConversion(isEndianConversion());
+            io->write(magic, magicSize);
+            io->writeU32(version);
+            io->writeU32(count);
+            io->writeU32(bucketCount);
+            io->writeU32(static_cast<uint32_t>(blob.size()));
+            io->writeU32(seeds.data(), seeds.size());
+            for (const auto& i : slots)
+            {
+                const uint32_t values[slotValueCount] = { i.idOffset, i.idSize, i.textOffset, i.textSize };
+                io->writeU32(values, slotValueCount);
+            }
+            io->write(blob.data(), blob.size());
+        }
+
+        std::map<std::string, std::string> TextTable::readText(const File::Path& path)
+        {
+            std::map<std::string, std::string> out;
+            auto fileIO = File::IO::create();
+            fileIO->open(path.get(), File::Mode::Read);
+            size_t bufSize = 0;
+#if defined(DJV_MMAP)
+            const char* bufP = reinterpret_cast<const char*>(fileIO->mmapP());
+            const char* bufEnd = reinterpret_cast<const char*>(fileIO->mmapEnd());
+            bufSize = bufEnd - bufP;
+#else // DJV_MMAP
+            std::vector<char> buf;
+            bufSize = fileIO->getSize();
+            buf.resize(bufSize);
+            fileIO->read(buf.data(), bufSize);
+            const char* bufP = buf.data();
+#endif // DJV_MMAP
+
+            // Parse the JSON.
+            rapidjson::Document document;
+            rapidjson::ParseResult result = document.Parse(bufP, bufSize);
+            if (!result)
+            {
+                size_t line = 0;
+                size_t character = 0;
+                RapidJSON::errorLineNumber(bufP, bufSize, result.Offset(), line, character);
+                throw std::runtime_error(String::Format("{0}: {1} {2} {3}, {4} {5}").
+                    arg(path.get()).
+                    arg(rapidjson::GetParseError_En(result.Code())).
+                    arg("Line").
+                    arg(line).
+                    arg("Character").
+                    arg(character));
+            }
+            for (const auto& i : document.GetObject())
+            {
+                if (i.value.IsString())
+                {
+                    out[i.name.GetString()] = i.value.GetString();
+                }
+            }
+            return out;
+        }
+
+        std::string TextTable::getLocale(const File::Path& path)
+        {
+            const auto& baseName = path.getBaseName();
+            if (textTableExtension == path.getExtension())
+            {
+                return baseName;
+            }
+            std::string out;
+            for (auto i = baseName.rbegin(); i != baseName.rend() && *i != '.'; ++i)
+            {
+                out.insert(out.begin(), *i);
+            }
+            return out;
+        }
+
+        Slot TextTable::Private::getSlot(uint32_t index) const
+        {
+            const uint8_t* p = slots + index * slotSize;
+            Slot out;
+            out.idOffset   = getU32(p);
+            out.idSize     = getU32(p + sizeof(uint32_t));
+            out.textOffset = getU32(p + sizeof(uint32_t) * 2);
+            out.textSize   = getU32(p + sizeof(uint32_t) * 3);
+            return out;
+        }
+
+    } // namespace System
+} // namespace djv
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvSystem/Path.h>
+
+#include <djvCore/Core.h>
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace djv
+{
+    namespace System
+    {
+        //! This constant provides the text table file extension.
+        const std::string textTableExtension = ".djvtext";
+
+        //! This class provides a compiled table of the text for one locale.
+        //!
+        //! The IDs are stored in a minimal perfect hash table that indexes
+        //! a single blob of interned strings. The tables are compiled from the
+        //! .text files by the djv_text_compile tool at build time, one file
+        //! for each locale.
+        class TextTable
+        {
+            DJV_NON_COPYABLE(TextTable);
+
+        protected:
+            void _init(const File::Path&);
+            TextTable();
+
+        public:
+            ~TextTable();
+
+            //! Open a text table. The file is memory-mapped when available,
+            //! otherwise it is read into memory.
+            //! Throws:
+            //! - File::Error
+            static std::shared_ptr<TextTable> create(const File::Path&);
+
+            //! Get the number of strings.
+            size_t getCount() const;
+
+            //! Get the text for the given ID, or nullptr if the ID is not in
+            //! the table. This function is not thread safe.
+            const std::string* getText(const std::string&);
+
+            //! Get the ID for the given text, or nullptr if the text is not in
+            //! the table. This function is not thread safe.
+            const std::string* getID(const std::string&);
+
+            //! Write a text table.
+            //! Throws:
+            //! - File::Error
+            static void write(const File::Path&, const std::map<std::string, std::string>&);
+
+            //! Read a .text file.
+            //! Throws:
+            //! - std::exception
+            static std::map<std::string, std::string> readText(const File::Path&);
+
+            //! Get the locale of a .text file or text table from the file name
+            //! (e.g., "djvUI.en.text" or "en.djvtext").
+            static std::string getLocale(const File::Path&);
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace System
+} // namespace djv
@@ -6,6 +6,8 @@
 
 #include <djvSystem/Context.h>
 
+#include <algorithm>
+
 using namespace djv::Core;
 
 namespace djv
@@ -113,6 +115,26 @@ namespace djv
             }
         }
 
+        Time::TimePoint TimerSystem::getNextTimeout() const
+        {
+            DJV_PRIVATE_PTR();
+            Time::TimePoint out = Time::TimePoint::max();
+            for (const auto& timers : { &p.timers, &p.newTimers })
+            {
+                for (const auto& i : *timers)
+                {
+                    if (auto timer = i.lock())
+                    {
+                        if (timer->isActive())
+                        {
+                            out = std::min(out, timer->_start + timer->_timeout);
+                        }
+                    }
+                }
+            }
+            return out;
+        }
+
         void TimerSystem::_addTimer(const std::weak_ptr<Timer>& value)
         {
             _p->newTimers.push_back(value);
@@ -94,6 +94,10 @@ namespace djv
 
             void tick() override;
 
+            //! Get the time of the next timeout. If there are no active timers
+            //! the maximum time point is returned.
+            Core::Time::TimePoint getNextTimeout() const;
+
         private:
             void _addTimer(const std::weak_ptr<Timer>&);
 
@@ -33,6 +33,17 @@ namespace djv
                 std::chrono::milliseconds(getTimerValue(value))));
         }
 
+        Time::TimePoint getWakeTime(
+            const Time::TimePoint& tickTime,
+            const Time::TimePoint& nextTick,
+            size_t frameRate,
+            const Time::Duration& idleTimeout)
+        {
+            const auto frame = tickTime + Time::Duration(frameRate > 0 ? (1000000 / frameRate) : 0);
+            const auto idle = tickTime + idleTimeout;
+            return std::min(std::max(nextTick, frame), std::max(idle, frame));
+        }
+
         DJV_ENUM_HELPERS_IMPLEMENTATION(TimerValue);
 
     } // namespace System
@@ -22,6 +22,20 @@ namespace djv
 
         ///@}
 
+        //! \name Event Loops
+        ///@{
+
+        //! Get the time an event loop should wake up given the time the last
+        //! tick started and the time the next tick is needed. The result is
+        //! no sooner than the next frame and no later than the idle timeout.
+        Core::Time::TimePoint getWakeTime(
+            const Core::Time::TimePoint& tickTime,
+            const Core::Time::TimePoint& nextTick,
+            size_t frameRate,
+            const Core::Time::Duration& idleTimeout);
+
+        ///@}
+
         DJV_ENUM_HELPERS(TimerValue);
 
     } // namespace System
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/Trace.h>
+
+#include <mutex>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace System
+    {
+        namespace Trace
+        {
+            Event::Event() :
+                thread(std::this_thread::get_id())
+            {}
+
+            Event::Event(
+                const std::string& name,
+                const std::string& category,
+                const Time::TimePoint& start,
+                const Time::TimePoint& end) :
+                name(name),
+                category(category),
+                start(start),
+                end(end),
+                thread(std::this_thread::get_id())
+            {}
+
+            struct Recorder::Private
+            {
+                mutable std::mutex mutex;
+                std::vector<Event> events;
+            };
+
+            Recorder::Recorder() :
+                _p(new Private)
+            {}
+
+            Recorder::~Recorder()
+            {}
+
+            std::shared_ptr<Recorder> Recorder::create()
+            {
+                return std::shared_ptr<Recorder>(new Recorder);
+            }
+
+            void Recorder::add(const Event& value)
+            {
+                DJV_PRIVATE_PTR();
+                std::unique_lock<std::mutex> lock(p.mutex);
+                p.events.push_back(value);
+            }
+
+            std::vector<Event> Recorder::getEvents() const
+            {
+                DJV_PRIVATE_PTR();
+                std::unique_lock<std::mutex> lock(p.mutex);
+                return p.events;
+            }
+
+            void Recorder::clear()
+            {
+                DJV_PRIVATE_PTR();
+                std::unique_lock<std::mutex> lock(p.mutex);
+                p.events.clear();
+            }
+
+            Scope::Scope(
+                const std::shared_ptr<Recorder>& recorder,
+                const std::string& name,
+                const std::string& category) :
+                _recorder(recorder)
+            {
+                if (_recorder)
+                {
+                    _event.name = name;
+                    _event.category = category;
+                    _event.start = std::chrono::steady_clock::now();
+                }
+            }
+
+            Scope::~Scope()
+            {
+                if (_recorder)
+                {
+                    _event.end = std::chrono::steady_clock::now();
+                    _recorder->add(_event);
+                }
+            }
+
+        } // namespace Trace
+    } // namespace System
+} // namespace djv
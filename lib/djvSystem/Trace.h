@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvCore/Core.h>
+#include <djvCore/Time.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace djv
+{
+    namespace System
+    {
+        //! This namespace provides performance tracing.
+        namespace Trace
+        {
+            //! This struct provides a trace event.
+            struct Event
+            {
+                Event();
+                Event(
+                    const std::string& name,
+                    const std::string& category,
+                    const Core::Time::TimePoint& start,
+                    const Core::Time::TimePoint& end);
+
+                std::string           name;
+                std::string           category;
+                Core::Time::TimePoint start;
+                Core::Time::TimePoint end;
+                std::thread::id       thread;
+
+                //! Events on the same thread with different tracks are shown
+                //! on separate rows.
+                size_t                track    = 0;
+            };
+
+            //! This class provides a thread safe recorder for trace events.
+            class Recorder
+            {
+                DJV_NON_COPYABLE(Recorder);
+
+            protected:
+                Recorder();
+
+            public:
+                ~Recorder();
+
+                static std::shared_ptr<Recorder> create();
+
+                //! Add an event.
+                void add(const Event&);
+
+                //! Get the events.
+                std::vector<Event> getEvents() const;
+
+                //! Remove all of the events.
+                void clear();
+
+            private:
+                DJV_PRIVATE();
+            };
+
+            //! This class records an event for the lifetime of the object.
+            class Scope
+            {
+                DJV_NON_COPYABLE(Scope);
+
+            public:
+                Scope(
+                    const std::shared_ptr<Recorder>&,
+                    const std::string& name,
+                    const std::string& category);
+                ~Scope();
+
+            private:
+                std::shared_ptr<Recorder> _recorder;
+                Event _event;
+            };
+
+        } // namespace Trace
+    } // namespace System
+} // namespace djv
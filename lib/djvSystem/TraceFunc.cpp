@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystem/TraceFunc.h>
+
+#include <djvSystem/FileIO.h>
+#include <djvSystem/Path.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <sstream>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace System
+    {
+        namespace Trace
+        {
+            namespace
+            {
+                std::string escape(const std::string& value)
+                {
+                    std::string out;
+                    for (const auto i : value)
+                    {
+                        switch (i)
+                        {
+                        case '"':  out += "\\\""; break;
+                        case '\\': out += "\\\\"; break;
+                        case '\n': out += "\\n"; break;
+                        case '\t': out += "\\t"; break;
+                        default:
+                            if (static_cast<unsigned char>(i) < 0x20)
+                            {
+                                char buf[7];
+                                snprintf(buf, 7, "\\u%04x", static_cast<unsigned char>(i));
+                                out += buf;
+                            }
+                            else
+                            {
+                                out += i;
+                            }
+                            break;
+                        }
+                    }
+                    return out;
+                }
+
+            } // namespace
+
+            std::string toChromeJSON(const std::vector<Event>& events)
+            {
+                Time::TimePoint origin;
+                if (events.size())
+                {
+                    origin = std::min_element(
+                        events.begin(),
+                        events.end(),
+                        [](const Event& a, const Event& b)
+                        {
+                            return a.start < b.start;
+                        })->start;
+                }
+
+                // Chrome traces use integer thread IDs, so the threads (and
+                // the tracks within them) are numbered in the order they are
+                // found.
+                std::map<std::pair<std::thread::id, size_t>, size_t> threads;
+
+                std::stringstream ss;
+                ss << "{\"traceEvents\":[";
+                for (size_t i = 0; i < events.size(); ++i)
+                {
+                    const auto& event = events[i];
+                    const auto thread = threads.insert(std::make_pair(std::make_pair(event.thread, event.track), threads.size())).first->second;
+                    const auto ts = std::chrono::duration_cast<std::chrono::microseconds>(event.start - origin);
+                    const auto dur = std::chrono::duration_cast<std::chrono::microseconds>(event.end - event.start);
+                    ss << (i > 0 ? "," : "") << "\n";
+                    ss << "{\"name\":\"" << escape(event.name) << "\",";
+                    ss << "\"cat\":\"" << escape(event.category) << "\",";
+                    ss << "\"ph\":\"X\",";
+                    ss << "\"ts\":" << ts.count() << ",";
+                    ss << "\"dur\":" << dur.count() << ",";
+                    ss << "\"pid\":1,";
+                    ss << "\"tid\":" << thread << "}";
+                }
+                ss << "\n],\"displayTimeUnit\":\"ms\"}\n";
+                return ss.str();
+            }
+
+            void writeChromeJSON(const File::Path& path, const std::vector<Event>& events)
+            {
+                const std::string json = toChromeJSON(events);
+                auto io = File::IO::create();
+                io->open(path.get(), File::Mode::Write);
+                io->write(json.data(), json.size());
+            }
+
+        } // namespace Trace
+    } // namespace System
+} // namespace djv
@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvSystem/Trace.h>
+
+namespace djv
+{
+    namespace System
+    {
+        namespace File
+        {
+            class Path;
+
+        } // namespace File
+
+        namespace Trace
+        {
+            //! \name Conversion
+            ///@{
+
+            //! Convert events to the Chrome trace event format, which can be
+            //! viewed with chrome://tracing or Perfetto. The times are relative
+            //! to the earliest event.
+            std::string toChromeJSON(const std::vector<Event>&);
+
+            ///@}
+
+            //! \name I/O
+            ///@{
+
+            //! Write events in the Chrome trace event format.
+            //! Throws:
+            //! - File::Error
+            void writeChromeJSON(const File::Path&, const std::vector<Event>&);
+
+            ///@}
+
+        } // namespace Trace
+    } // namespace System
+} // namespace djv
@@ -30,6 +30,11 @@ namespace djv
             std::vector<std::weak_ptr<Window> > newWindows;
             bool resizeRequest = false;
             bool redrawRequest = false;
+            bool redrawAll = false;
+            Math::BBox2f redrawRect = Math::BBox2f(0.F, 0.F, 0.F, 0.F);
+            size_t paintCount = 0;
+            size_t partialPaintCount = 0;
+            float paintPercentage = 0.F;
             bool textLCDRenderingDirty = false;
             bool tooltips = false;
             std::shared_ptr<Observer::Value<bool> > textLCDRenderingObserver;
@@ -97,7 +102,9 @@ namespace djv
                 if (auto system = weak.lock())
                 {
                     std::stringstream ss;
-                    ss << "Global widget count: " << Widget::getGlobalWidgetCount();
+                    ss << "Global widget count: " << Widget::getGlobalWidgetCount() << std::endl;
+                    ss << "Paint count: " << system->_p->paintCount << std::endl;
+                    ss << "Partial paint count: " << system->_p->partialPaintCount;
                     system->_log(ss.str());
                     
                     /*std::map<std::string, size_t> classNames;
@@ -126,7 +133,41 @@ namespace djv
 
         void EventSystem::redrawRequest()
         {
-            _p->redrawRequest = true;
+            DJV_PRIVATE_PTR();
+            p.redrawRequest = true;
+            p.redrawAll = true;
+        }
+
+        void EventSystem::redrawRequest(const Math::BBox2f& value)
+        {
+            DJV_PRIVATE_PTR();
+            if (value.isValid())
+            {
+                if (p.redrawRequest)
+                {
+                    p.redrawRect.expand(value);
+                }
+                else
+                {
+                    p.redrawRect = value;
+                }
+                p.redrawRequest = true;
+            }
+        }
+
+        size_t EventSystem::getPaintCount() const
+        {
+            return _p->paintCount;
+        }
+
+        size_t EventSystem::getPartialPaintCount() const
+        {
+            return _p->partialPaintCount;
+        }
+
+        float EventSystem::getPaintPercentage() const
+        {
+            return _p->paintPercentage;
         }
 
         bool EventSystem::areTooltipsEnabled() const
@@ -160,6 +201,7 @@ namespace djv
                         }
                     }
                     style->setClean();
+                    redrawRequest();
                 }
 
                 if (!p.newWindows.empty())
@@ -230,8 +272,43 @@ namespace djv
 
         bool EventSystem::_redrawRequestReset()
         {
-            const bool out = _p->redrawRequest;
-            _p->redrawRequest = false;
+            DJV_PRIVATE_PTR();
+            const bool out = p.redrawRequest;
+            p.redrawRequest = false;
+            p.redrawAll = false;
+            return out;
+        }
+
+        bool EventSystem::_redrawRequestReset(const Math::BBox2f& bounds, Math::BBox2f& damage)
+        {
+            DJV_PRIVATE_PTR();
+            bool out = false;
+            if (p.redrawRequest)
+            {
+                if (p.redrawAll)
+                {
+                    damage = bounds;
+                }
+                else
+                {
+                    damage = bounds.intersect(Math::BBox2f(
+                        glm::vec2(floorf(p.redrawRect.min.x), floorf(p.redrawRect.min.y)),
+                        glm::vec2(ceilf(p.redrawRect.max.x), ceilf(p.redrawRect.max.y))));
+                }
+                out = damage.isValid();
+                if (out)
+                {
+                    ++p.paintCount;
+                    const float boundsArea = bounds.getArea();
+                    p.paintPercentage = boundsArea > 0.F ? (damage.getArea() / boundsArea * 100.F) : 0.F;
+                    if (damage != bounds)
+                    {
+                        ++p.partialPaintCount;
+                    }
+                }
+            }
+            p.redrawRequest = false;
+            p.redrawAll = false;
             return out;
         }
 
@@ -247,43 +324,77 @@ namespace djv
 
         void EventSystem::_initLayoutRecursive(const std::shared_ptr<Widget>& widget, System::Event::InitLayout& event)
         {
-            for (const auto& child : widget->getChildWidgets())
+            // The size dirty flags are set on the parents of a widget when it
+            // is resized, so only those branches are visited.
+            if (widget->_sizeDirty)
             {
-                _initLayoutRecursive(child, event);
+                for (const auto& child : widget->getChildWidgets())
+                {
+                    _initLayoutRecursive(child, event);
+                }
+                widget->event(event);
             }
-            widget->event(event);
         }
 
         void EventSystem::_preLayoutRecursive(const std::shared_ptr<Widget>& widget, System::Event::PreLayout& event)
         {
-            for (const auto& child : widget->getChildWidgets())
+            if (widget->_sizeDirty)
             {
-                _preLayoutRecursive(child, event);
+                for (const auto& child : widget->getChildWidgets())
+                {
+                    _preLayoutRecursive(child, event);
+                }
+                widget->event(event);
+                widget->_sizeDirty = false;
             }
-            widget->event(event);
         }
 
         void EventSystem::_layoutRecursive(const std::shared_ptr<Widget>& widget, System::Event::Layout& event)
         {
+            // Widgets that have not changed are skipped. Setting the geometry
+            // of a child marks it for layout, so the children are checked
+            // after the layout event.
             if (widget->isVisible())
             {
-                widget->event(event);
+                if (widget->_layoutDirty)
+                {
+                    widget->_layoutDirty = false;
+                    widget->event(event);
+                }
                 for (const auto& child : widget->getChildWidgets())
                 {
-                    _layoutRecursive(child, event);
+                    if (child->_layoutDirty || child->_childDirty)
+                    {
+                        _layoutRecursive(child, event);
+                    }
                 }
             }
         }
 
         void EventSystem::_clipRecursive(const std::shared_ptr<Widget>& widget, System::Event::Clip& event)
         {
-            widget->event(event);
+            // The clipping of a widget affects all of its children.
+            if (widget->_clipDirty)
+            {
+                widget->_clipDirty = false;
+                widget->event(event);
+                for (const auto& child : widget->getChildWidgets())
+                {
+                    child->_clipDirty = true;
+                }
+            }
             const Math::BBox2f clipRect = event.getClipRect();
+            bool childDirty = false;
             for (const auto& child : widget->getChildWidgets())
             {
-                event.setClipRect(clipRect.intersect(child->getGeometry()));
-                _clipRecursive(child, event);
+                if (child->_clipDirty || child->_childDirty)
+                {
+                    event.setClipRect(clipRect.intersect(child->getGeometry()));
+                    _clipRecursive(child, event);
+                }
+                childDirty |= child->_isDirty();
             }
+            widget->_childDirty = childDirty;
             event.setClipRect(clipRect);
         }
 
@@ -292,6 +403,8 @@ namespace djv
             System::Event::Paint& event,
             System::Event::PaintOverlay& overlayEvent)
         {
+            // The clipping rectangle starts out as the damaged region, so
+            // widgets outside of it are skipped.
             if (widget->isVisible() && !widget->isClipped())
             {
                 const Math::BBox2f clipRect = event.getClipRect();
@@ -300,9 +413,12 @@ namespace djv
                 for (const auto& child : widget->getChildWidgets())
                 {
                     const Math::BBox2f childClipRect = clipRect.intersect(child->getGeometry());
-                    event.setClipRect(childClipRect);
-                    overlayEvent.setClipRect(childClipRect);
-                    _paintRecursive(child, event, overlayEvent);
+                    if (childClipRect.isValid())
+                    {
+                        event.setClipRect(childClipRect);
+                        overlayEvent.setClipRect(childClipRect);
+                        _paintRecursive(child, event, overlayEvent);
+                    }
                 }
                 widget->event(overlayEvent);
                 _popClipRect();
@@ -30,8 +30,29 @@ namespace djv
             ///@{
 
             void resizeRequest();
+
+            //! Request a redraw of the entire window.
             void redrawRequest();
 
+            //! Request a redraw of a damaged region. The regions are
+            //! accumulated until the next paint.
+            void redrawRequest(const Math::BBox2f&);
+
+            ///@}
+
+            //! \name Statistics
+            ///@{
+
+            //! Get the number of frames that have been painted.
+            size_t getPaintCount() const;
+
+            //! Get the number of frames that were only partially painted.
+            size_t getPartialPaintCount() const;
+
+            //! Get the percentage of the window that was painted in the last
+            //! frame.
+            float getPaintPercentage() const;
+
             ///@}
 
             //! \name Tooltips
@@ -50,6 +71,10 @@ namespace djv
             bool _resizeRequestReset();
             bool _redrawRequestReset();
 
+            //! Reset the redraw request and get the damaged region clipped
+            //! to the given bounds, rounded out to whole pixels.
+            bool _redrawRequestReset(const Math::BBox2f& bounds, Math::BBox2f& damage);
+
             virtual void _pushClipRect(const Math::BBox2f&);
             virtual void _popClipRect();
 
@@ -39,6 +39,7 @@ namespace djv
         {
             Widget::_init(context);
             setClassName("djv::UI::Icon");
+            _setUpdateEvents(true);
             _p->iconSystem = context->getSystemT<IconSystem>();
         }
 
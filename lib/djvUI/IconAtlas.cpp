@@ -0,0 +1,213 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvUI/IconAtlas.h>
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/File.h>
+#include <djvSystem/FileIO.h>
+
+#include <djvCore/Memory.h>
+#include <djvCore/StringFormat.h>
+
+#include <cstring>
+#include <map>
+
+using namespace djv::Core;
+
+namespace djv
+{
+    namespace UI
+    {
+        namespace
+        {
+            const char     magic[]       = "djvIcons";
+            const size_t   magicSize     = 8;
+            const uint32_t version       = 1;
+            const size_t   dataAlignment = 16;
+
+            struct Item
+            {
+                Image::Info info;
+                uint32_t    offset = 0;
+            };
+
+            //! The index is always stored little endian.
+            bool isEndianConversion()
+            {
+                return Memory::Endian::MSB == Memory::getEndian();
+            }
+
+            size_t getIndexByteCount(const std::string& name)
+            {
+                return
+                    sizeof(uint32_t) + name.size() +
+                    sizeof(uint16_t) * 2 +
+                    sizeof(uint8_t) * 5 +
+                    sizeof(uint32_t);
+            }
+
+            size_t align(size_t value)
+            {
+                return (value + dataAlignment - 1) / dataAlignment * dataAlignment;
+            }
+
+        } // namespace
+
+        struct IconAtlas::Private
+        {
+            std::shared_ptr<System::File::IO> io;
+            std::map<std::string, Item> items;
+        };
+
+        void IconAtlas::_init(const System::File::Path& path)
+        {
+            DJV_PRIVATE_PTR();
+            p.io = System::File::IO::create();
+            p.io->open(path.get(), System::File::Mode::Read);
+            p.io->setEndianConversion(isEndianConversion());
+
+            char fileMagic[magicSize];
+            p.io->read(fileMagic, magicSize);
+            uint32_t fileVersion = 0;
+            p.io->readU32(&fileVersion);
+            if (memcmp(fileMagic, magic, magicSize) != 0 || fileVersion != version)
+            {
+                throw System::File::Error(String::Format("{0}: {1}").
+                    arg(path.get()).
+                    arg("Unrecognized icon atlas."));
+            }
+
+            uint32_t count = 0;
+            p.io->readU32(&count);
+            const size_t fileSize = p.io->getSize();
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                uint32_t nameSize = 0;
+                p.io->readU32(&nameSize);
+                std::string name(nameSize, 0);
+                p.io->read(&name[0], nameSize);
+                Item item;
+                uint16_t size[2] = { 0, 0 };
+                p.io->readU16(size, 2);
+                uint8_t values[5] = { 0, 0, 0, 0, 0 };
+                p.io->readU8(values, 5);
+                p.io->readU32(&item.offset);
+                item.info = Image::Info(
+                    size[0],
+                    size[1],
+                    static_cast<Image::Type>(values[0]),
+                    Image::Layout(
+                        Image::Mirror(values[1] != 0, values[2] != 0),
+                        values[3],
+                        static_cast<Memory::Endian>(values[4])));
+                if (item.offset + item.info.getDataByteCount() > fileSize)
+                {
+                    throw System::File::Error(String::Format("{0}: {1}").
+                        arg(path.get()).
+                        arg("Icon atlas is truncated."));
+                }
+                p.items[name] = item;
+            }
+        }
+
+        IconAtlas::IconAtlas() :
+            _p(new Private)
+        {}
+
+        IconAtlas::~IconAtlas()
+        {}
+
+        std::shared_ptr<IconAtlas> IconAtlas::create(const System::File::Path& path)
+        {
+            auto out = std::shared_ptr<IconAtlas>(new IconAtlas);
+            out->_init(path);
+            return out;
+        }
+
+        std::vector<std::string> IconAtlas::getNames() const
+        {
+            std::vector<std::string> out;
+            for (const auto& i : _p->items)
+            {
+                out.push_back(i.first);
+            }
+            return out;
+        }
+
+        bool IconAtlas::hasIcon(const std::string& name) const
+        {
+            return _p->items.find(name) != _p->items.end();
+        }
+
+        std::shared_ptr<Image::Data> IconAtlas::getIcon(const std::string& name)
+        {
+            DJV_PRIVATE_PTR();
+            std::shared_ptr<Image::Data> out;
+            const auto i = p.items.find(name);
+            if (i != p.items.end())
+            {
+                // The pixel data is copied straight out of the file without
+                // decoding.
+                out = Image::Data::create(i->second.info);
+                p.io->setPos(i->second.offset);
+                p.io->read(out->getData(), out->getDataByteCount());
+            }
+            return out;
+        }
+
+        void IconAtlas::write(
+            const System::File::Path& path,
+            const std::vector<std::pair<std::string, std::shared_ptr<Image::Data> > >& icons)
+        {
+            auto io = System::File::IO::create();
+            io->open(path.get(), System::File::Mode::Write);
+            io->setEndianConversion(isEndianConversion());
+
+            // Compute the offsets of the pixel data.
+            size_t offset = magicSize + sizeof(uint32_t) * 2;
+            for (const auto& i : icons)
+            {
+                offset += getIndexByteCount(i.first);
+            }
+            std::vector<uint32_t> offsets;
+            for (const auto& i : icons)
+            {
+                offset = align(offset);
+                offsets.push_back(static_cast<uint32_t>(offset));
+                offset += i.second->getDataByteCount();
+            }
+
+            // Write the index.
+            io->write(magic, magicSize);
+            io->writeU32(version);
+            io->writeU32(static_cast<uint32_t>(icons.size()));
+            for (size_t i = 0; i < icons.size(); ++i)
+            {
+                const std::string& name = icons[i].first;
+                const auto& info = icons[i].second->getInfo();
+                io->writeU32(static_cast<uint32_t>(name.size()));
+                io->write(name.data(), name.size());
+                io->writeU16(info.size.w);
+                io->writeU16(info.size.h);
+                io->writeU8(static_cast<uint8_t>(info.type));
+                io->writeU8(info.layout.mirror.x ? 1 : 0);
+                io->writeU8(info.layout.mirror.y ? 1 : 0);
+                io->writeU8(static_cast<uint8_t>(info.layout.alignment));
+                io->writeU8(static_cast<uint8_t>(info.layout.endian));
+                io->writeU32(offsets[i]);
+            }
+
+            // Write the pixel data.
+            const std::vector<uint8_t> padding(dataAlignment, 0);
+            for (size_t i = 0; i < icons.size(); ++i)
+            {
+                io->write(padding.data(), offsets[i] - io->getPos());
+                io->write(icons[i].second->getData(), icons[i].second->getDataByteCount());
+            }
+        }
+
+    } // namespace UI
+} // namespace djv
@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvSystem/Path.h>
+
+#include <djvCore/Core.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace djv
+{
+    namespace Image
+    {
+        class Data;
+
+    } // namespace Image
+
+    namespace UI
+    {
+        //! This constant provides the icon atlas file extension.
+        const std::string iconAtlasExtension = ".djvicons";
+
+        //! This class provides a file of pre-decoded icons.
+        //!
+        //! The file starts with an index of the icons followed by the pixel
+        //! data of each icon. The icons are packed by the djv_icon_atlas tool
+        //! at build time, one file for each DPI directory.
+        class IconAtlas
+        {
+            DJV_NON_COPYABLE(IconAtlas);
+
+        protected:
+            void _init(const System::File::Path&);
+            IconAtlas();
+
+        public:
+            ~IconAtlas();
+
+            //! Open an icon atlas. The file is kept open (memory-mapped when
+            //! available) for the lifetime of the atlas.
+            //! Throws:
+            //! - System::File::Error
+            static std::shared_ptr<IconAtlas> create(const System::File::Path&);
+
+            //! Get the icon names.
+            std::vector<std::string> getNames() const;
+
+            //! Get whether the atlas contains an icon.
+            bool hasIcon(const std::string&) const;
+
+            //! Get an icon. This function is not thread safe.
+            //! Throws:
+            //! - System::File::Error
+            std::shared_ptr<Image::Data> getIcon(const std::string&);
+
+            //! Write an icon atlas.
+            //! Throws:
+            //! - System::File::Error
+            static void write(
+                const System::File::Path&,
+                const std::vector<std::pair<std::string, std::shared_ptr<Image::Data> > >&);
+
+        private:
+            DJV_PRIVATE();
+        };
+
+    } // namespace UI
+} // namespace djv
@@ -4,6 +4,8 @@
 
 #include <djvUI/IconSystem.h>
 
+#include <djvUI/IconAtlas.h>
+
 #include <djvAV/AVSystem.h>
 #include <djvAV/IOSystem.h>
 
@@ -15,6 +17,7 @@
 #include <djvSystem/LogSystem.h>
 #include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TimerFunc.h>
+#include <djvSystem/Trace.h>
 
 #include <djvCore/Cache.h>
 
@@ -83,6 +86,7 @@ namespace djv
         {
             System::File::Path iconPath;
             std::vector<uint16_t> dpiList;
+            std::map<uint16_t, std::shared_ptr<IconAtlas> > atlases;
             std::shared_ptr<AV::IO::IOSystem> io;
             std::list<ImageRequest> imageQueue;
             std::condition_variable requestCV;
@@ -98,6 +102,7 @@ namespace djv
             std::atomic<bool> running;
 
             System::File::Path getPath(const std::string& name, uint16_t dpi) const;
+            System::File::Path getAtlasPath(uint16_t dpi) const;
             uint16_t findClosestDPI(uint16_t) const;
         };
 
@@ -130,14 +135,12 @@ namespace djv
                 _log(ss.str());
             });
 
-            p.running = true;
-            p.thread = std::thread(
+            // Finding the DPI values and opening the atlas for the default
+            // icon size is done by an initialization task.
+            _initTask(
                 [this]
-            {
-                DJV_PRIVATE_PTR();
-                try
                 {
-                    // Find the DPI values.
+                    DJV_PRIVATE_PTR();
                     for (const auto& i : System::File::directoryList(p.iconPath))
                     {
                         const std::string fileName = i.getFileName(Math::Frame::invalid, false);
@@ -157,20 +160,39 @@ namespace djv
                         ss << "Found DPI: " << i;
                         _log(ss.str());
                     }
+                    _getAtlas(p.findClosestDPI(Style::iconSizeDefault));
+                });
 
+            p.running = true;
+            p.thread = std::thread(
+                [this]
+            {
+                DJV_PRIVATE_PTR();
+                // Wait for the DPI values and the default atlas.
+                waitForInit();
+                try
+                {
                     const auto timeout = System::getTimerValue(System::TimerValue::Medium);
                     while (p.running)
                     {
                         {
+                            // Only poll while there are reads in progress,
+                            // otherwise wait for new requests.
                             std::unique_lock<std::mutex> lock(p.requestMutex);
-                            if (p.requestCV.wait_for(
-                                lock,
-                                std::chrono::milliseconds(timeout),
-                                [this]
+                            const auto predicate = [this]
                             {
                                 DJV_PRIVATE_PTR();
-                                return p.imageQueue.size();
-                            }))
+                                return p.imageQueue.size() || !p.running;
+                            };
+                            if (p.pendingImageRequests.size())
+                            {
+                                p.requestCV.wait_for(lock, std::chrono::milliseconds(timeout), predicate);
+                            }
+                            else
+                            {
+                                p.requestCV.wait(lock, predicate);
+                            }
+                            if (p.imageQueue.size())
                             {
                                 p.newImageRequests = std::move(p.imageQueue);
                             }
@@ -197,7 +219,12 @@ namespace djv
         IconSystem::~IconSystem()
         {
             DJV_PRIVATE_PTR();
-            p.running = false;
+            waitForInit();
+            {
+                std::lock_guard<std::mutex> lock(p.requestMutex);
+                p.running = false;
+            }
+            p.requestCV.notify_one();
             if (p.thread.joinable())
             {
                 p.thread.join();
@@ -236,6 +263,7 @@ namespace djv
         void IconSystem::_handleImageRequests()
         {
             DJV_PRIVATE_PTR();
+            bool wake = false;
 
             // Process new requests.
             for (auto& i : p.newImageRequests)
@@ -244,28 +272,52 @@ namespace djv
                 p.imageCache.get(i.key, image);
                 if (!image)
                 {
+                    // Look for the icon in the atlas first, falling back to
+                    // reading the individual icon file.
+                    const uint16_t dpi = p.findClosestDPI(i.size);
                     try
                     {
-                        i.path = p.getPath(i.name, p.findClosestDPI(i.size));
-                        i.read = p.io->read(i.path);
-                        p.pendingImageRequests.push_back(std::move(i));
+                        if (auto atlas = _getAtlas(dpi))
+                        {
+                            image = atlas->getIcon(i.name);
+                            if (image)
+                            {
+                                p.imageCache.add(i.key, image);
+                                p.imageCachePercentage = p.imageCache.getPercentageUsed();
+                            }
+                        }
                     }
                     catch (const std::exception& e)
+                    {
+                        _log(e.what(), System::LogLevel::Error);
+                    }
+                    if (!image)
                     {
                         try
                         {
-                            i.promise.set_exception(std::current_exception());
+                            i.path = p.getPath(i.name, dpi);
+                            i.read = p.io->read(i.path);
+                            p.pendingImageRequests.push_back(std::move(i));
                         }
                         catch (const std::exception& e)
                         {
+                            try
+                            {
+                                i.promise.set_exception(std::current_exception());
+                                wake = true;
+                            }
+                            catch (const std::exception& e)
+                            {
+                                _log(e.what(), System::LogLevel::Error);
+                            }
                             _log(e.what(), System::LogLevel::Error);
                         }
-                        _log(e.what(), System::LogLevel::Error);
                     }
                 }
                 if (image)
                 {
                     i.promise.set_value(image);
+                    wake = true;
                 }
             }
             p.newImageRequests.clear();
@@ -293,6 +345,7 @@ namespace djv
                     p.imageCache.add(i->key, image);
                     p.imageCachePercentage = p.imageCache.getPercentageUsed();
                     i->promise.set_value(image);
+                    wake = true;
                     i = p.pendingImageRequests.erase(i);
                 }
                 else if (finished)
@@ -308,6 +361,7 @@ namespace djv
                         try
                         {
                             i->promise.set_exception(std::current_exception());
+                            wake = true;
                         }
                         catch (const std::exception& e)
                         {
@@ -322,6 +376,43 @@ namespace djv
                     ++i;
                 }
             }
+
+            if (wake)
+            {
+                _wake();
+            }
+        }
+
+        std::shared_ptr<IconAtlas> IconSystem::_getAtlas(uint16_t dpi)
+        {
+            DJV_PRIVATE_PTR();
+            const auto i = p.atlases.find(dpi);
+            if (i != p.atlases.end())
+            {
+                return i->second;
+            }
+
+            // Atlases are opened on first use. Failures are only tried once
+            // and the individual icon files are used instead.
+            std::shared_ptr<IconAtlas> out;
+            const System::File::Path path = p.getAtlasPath(dpi);
+            if (System::File::Info(path).doesExist())
+            {
+                try
+                {
+                    System::Trace::Scope scope(_getTrace(), "Open icon atlas", "io");
+                    out = IconAtlas::create(path);
+                    std::stringstream ss;
+                    ss << "Icon atlas: " << path << ", " << out->getNames().size() << " icons";
+                    _log(ss.str());
+                }
+                catch (const std::exception& e)
+                {
+                    _log(e.what(), System::LogLevel::Error);
+                }
+            }
+            p.atlases[dpi] = out;
+            return out;
         }
 
         System::File::Path IconSystem::Private::getPath(const std::string& name, uint16_t dpi) const
@@ -340,6 +431,13 @@ namespace djv
             return out;
         }
 
+        System::File::Path IconSystem::Private::getAtlasPath(uint16_t dpi) const
+        {
+            std::stringstream ss;
+            ss << dpi << "DPI" << iconAtlasExtension;
+            return System::File::Path(iconPath, ss.str());
+        }
+
         uint16_t IconSystem::Private::findClosestDPI(uint16_t value) const
         {
             const uint16_t dpi = static_cast<uint16_t>(value / static_cast<float>(Style::iconSizeDefault) * static_cast<float>(Render2D::dpiDefault));
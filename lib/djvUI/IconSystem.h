@@ -20,7 +20,13 @@ namespace djv
 
     namespace UI
     {
+        class IconAtlas;
+
         //! This class provides an icon system.
+        //!
+        //! Icons are served from the pre-decoded icon atlas of the closest
+        //! DPI when one is available, otherwise they are read from the
+        //! individual icon files.
         class IconSystem : public System::ISystem
         {
             DJV_NON_COPYABLE(IconSystem);
@@ -42,6 +48,7 @@ namespace djv
 
         private:
             void _handleImageRequests();
+            std::shared_ptr<IconAtlas> _getAtlas(uint16_t dpi);
 
             DJV_PRIVATE();
         };
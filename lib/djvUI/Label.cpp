@@ -60,6 +60,7 @@ namespace djv
             {
                 Widget::_init(context);
                 setClassName("djv::UI::Text::Label");
+                _setUpdateEvents(true);
                 setVAlign(VAlign::Center);
                 _p->fontSystem = context->getSystemT<Render2D::Font::FontSystem>();
             }
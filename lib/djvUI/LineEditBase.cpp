@@ -82,6 +82,7 @@ namespace djv
                 DJV_PRIVATE_PTR();
 
                 setClassName("djv::UI::LineEditBase");
+                _setUpdateEvents(true);
                 setVAlign(VAlign::Center);
                 setPointerEnabled(true);
                 setBackgroundRole(UI::ColorRole::Trough);
@@ -121,6 +121,7 @@ namespace djv
             {
                 Widget::_init(context);
                 setClassName("djv::UI::MenuWidget");
+                _setUpdateEvents(true);
                 _fontSystem = context->getSystemT<Render2D::Font::FontSystem>();
             }
 
@@ -886,6 +887,7 @@ namespace djv
             {
                 const auto& style = _getStyle();
                 const Math::BBox2f& g = getMargin().bbox(getGeometry(), style);
+                const float sh = style->getMetric(MetricsRole::Shadow);
                 for (const auto& i : _widgetToPos)
                 {
                     const auto& pos = i.second;
@@ -902,6 +904,7 @@ namespace djv
                         _widgetToPopup[i.first] = popup;
                     }
                     const Math::BBox2f popupGeometry = Layout::getPopupGeometry(popup, pos, minimumSize);
+                    i.first->setPaintMargin(sh);
                     i.first->setGeometry(popupGeometry.intersect(g));
                 }
                 for (const auto& i : _widgetToButton)
@@ -921,6 +924,7 @@ namespace djv
                             popup = Layout::getPopup(popup, g, buttonBBox, minimumSize);
                         }
                         const Math::BBox2f popupGeometry = Layout::getPopupGeometry(popup, buttonBBox, minimumSize);
+                        i.first->setPaintMargin(sh);
                         i.first->setGeometry(popupGeometry.intersect(g));
                     }
                 }
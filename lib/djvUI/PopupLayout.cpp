@@ -70,6 +70,7 @@ namespace djv
             {
                 DJV_PRIVATE_PTR();
                 const Math::BBox2f& g = getGeometry();
+                const float sh = _getStyle()->getMetric(MetricsRole::Shadow);
                 if (auto button = p.button.lock())
                 {
                     for (const auto& i : getChildWidgets())
@@ -87,6 +88,7 @@ namespace djv
                         {
                             popup = j->second;
                         }
+                        i->setPaintMargin(sh);
                         i->setGeometry(Layout::getPopupGeometry(popup, buttonBBox, minimumSize).intersect(g));
                     }
                 }
@@ -13,6 +13,7 @@
 #include <djvSystem/FileInfo.h>
 #include <djvSystem/PathFunc.h>
 #include <djvSystem/ResourceSystem.h>
+#include <djvSystem/Trace.h>
 
 #include <djvCore/ErrorFunc.h>
 #include <djvCore/StringFormat.h>
@@ -53,9 +54,15 @@ namespace djv
                     _settingsPath = resourceSystem->getPath(System::File::ResourcePath::SettingsFile);
                 }
 
+                // The settings file is read by an initialization task, the
+                // settings wait for it to finish when they are loaded.
                 if (!reset)
                 {
-                    _readSettingsFile();
+                    _initTask(
+                        [this]
+                        {
+                            _readSettingsFile();
+                        });
                 }
 
                 _logInitTime();
@@ -66,6 +73,7 @@ namespace djv
 
             SettingsSystem::~SettingsSystem()
             {
+                waitForInit();
                 _saveSettings();
             }
 
@@ -99,6 +107,23 @@ namespace djv
                 if (!_settingsIO)
                     return;
 
+                waitForInit();
+                if (!_parseError.empty())
+                {
+                    // The text is not available to the initialization task,
+                    // so parse errors are logged here.
+                    std::stringstream ss;
+                    ss << "Cannot read settings" << " '" << _settingsPath << "': " <<
+                        std::string(String::Format("{0} {1} {2}, {3} {4}").
+                            arg(_parseError).
+                            arg(_getText(DJV_TEXT("error_line_number"))).
+                            arg(_parseErrorLine).
+                            arg(_getText(DJV_TEXT("error_character_number"))).
+                            arg(_parseErrorCharacter));
+                    _log(ss.str(), System::LogLevel::Error);
+                    _parseError.clear();
+                }
+
                 std::stringstream ss;
                 ss << "Loading settings: " << settings->getName();
                 _log(ss.str());
@@ -154,6 +179,7 @@ namespace djv
                         ss << "Reading settings: " << _settingsPath;
                         _log(ss.str());
 
+                        System::Trace::Scope scope(_getTrace(), "Read settings", "io");
                         auto fileIO = System::File::IO::create();
                         fileIO->open(_settingsPath.get(), System::File::Mode::Read);
                         size_t bufSize = 0;
@@ -172,23 +198,18 @@ namespace djv
                         rapidjson::ParseResult result = _document.Parse(bufP, bufSize);
                         if (!result)
                         {
-                            size_t line = 0;
-                            size_t character = 0;
-                            RapidJSON::errorLineNumber(bufP, bufSize, result.Offset(), line, character);
-                            throw std::runtime_error(String::Format("{0} {1} {2}, {3} {4}").
-                                arg(rapidjson::GetParseError_En(result.Code())).
-                                arg(_getText(DJV_TEXT("error_line_number"))).
-                                arg(line).
-                                arg(_getText(DJV_TEXT("error_character_number"))).
-                                arg(character));
+                            _parseError = rapidjson::GetParseError_En(result.Code());
+                            RapidJSON::errorLineNumber(bufP, bufSize, result.Offset(), _parseErrorLine, _parseErrorCharacter);
                         }
-
-                        for (const auto& i : _document.GetObject())
+                        else
                         {
-                            if (0 == strcmp("SettingsVersion", i.name.GetString()))
+                            for (const auto& i : _document.GetObject())
                             {
-                                fromJSON(i.value, readSettingsVersion);
-                                break;
+                                if (0 == strcmp("SettingsVersion", i.name.GetString()))
+                                {
+                                    fromJSON(i.value, readSettingsVersion);
+                                    break;
+                                }
                             }
                         }
                     }
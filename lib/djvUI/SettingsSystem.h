@@ -50,6 +50,9 @@ namespace djv
 
                 bool _reset = false;
                 rapidjson::Document _document;
+                std::string _parseError;
+                size_t _parseErrorLine = 0;
+                size_t _parseErrorCharacter = 0;
                 std::vector<std::shared_ptr<ISettings> > _settings;
                 System::File::Path _settingsPath;
                 bool _settingsIO = true;
@@ -58,6 +58,7 @@ namespace djv
                 Widget::_init(context);
                 DJV_PRIVATE_PTR();
                 setClassName("djv::UI::Text::Block");
+                _setUpdateEvents(true);
                 p.fontSystem = context->getSystemT<Render2D::Font::FontSystem>();
                 p.textCache.setMax(5);
             }
@@ -94,6 +94,7 @@ namespace djv
                 const Math::BBox2f& g = getGeometry();
                 const auto& style = _getStyle();
                 const float to = style->getMetric(MetricsRole::TooltipOffset);
+                const float sh = style->getMetric(MetricsRole::Shadow);
                 for (auto i : _widgetToPos)
                 {
                     const glm::vec2& minimumSize = i.first->getMinimumSize();
@@ -127,6 +128,7 @@ namespace djv
                     {
                         return a.intersect(g).getArea() > b.intersect(g).getArea();
                     });
+                    i.first->setPaintMargin(sh);
                     i.first->setGeometry(geomCandidates.front());
                 }
             }
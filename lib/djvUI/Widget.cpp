@@ -149,8 +149,10 @@ namespace djv
         {
             if (value == _geometry)
                 return;
+            _redraw();
             _geometry = value;
-            _resize();
+            _setGeometryDirty();
+            _redraw();
         }
 
         void Widget::move(const glm::vec2& value)
@@ -207,6 +209,15 @@ namespace djv
             _redraw();
         }
 
+        void Widget::setPaintMargin(float value)
+        {
+            if (value == _paintMargin)
+                return;
+            _redraw();
+            _paintMargin = value;
+            _redraw();
+        }
+
         void Widget::setPointerEnabled(bool value)
         {
             _pointerEnabled = value;
@@ -508,6 +519,10 @@ namespace djv
                         {
                             _childWidgets.erase(i);
                         }
+
+                        // The paint margin of the child may be outside of
+                        // this widget's geometry.
+                        widget->_redraw();
                     }
                     _resize();
                     break;
@@ -559,6 +574,11 @@ namespace djv
                             }
                         }
                     }
+                    else if (_tooltipUpdateEvents)
+                    {
+                        _setUpdateEvents(false);
+                        _tooltipUpdateEvents = false;
+                    }
                     break;
                 }
                 case System::Event::Type::InitLayout:
@@ -638,6 +658,14 @@ namespace djv
                     const auto& info = pointerEvent.getPointerInfo();
                     const auto id = info.id;
                     _pointerHover[id] = info.projectedPos;
+                    if (!_hasUpdateEvents())
+                    {
+                        // Enable update events while the pointer is hovering
+                        // for the tooltip timer.
+                        _setUpdateEvents(true);
+                        _tooltipUpdateEvents = true;
+                        _updateTime = std::chrono::steady_clock::now();
+                    }
                     _pointerToTooltips[id] = TooltipData();
                     _pointerToTooltips[id].timer = _updateTime;
                     _pointerEnterEvent(static_cast<System::Event::PointerEnter&>(event));
@@ -846,17 +874,52 @@ namespace djv
 
         void Widget::_resize()
         {
+            _sizeDirty = true;
+            _layoutDirty = true;
+            _clipDirty = true;
+            for (auto parent = std::dynamic_pointer_cast<Widget>(getParent().lock());
+                parent && !(parent->_sizeDirty && parent->_childDirty);
+                parent = std::dynamic_pointer_cast<Widget>(parent->getParent().lock()))
+            {
+                parent->_sizeDirty = true;
+                parent->_layoutDirty = true;
+                parent->_childDirty = true;
+            }
+            if (auto eventSystem = _eventSystem.lock())
+            {
+                eventSystem->resizeRequest();
+                eventSystem->redrawRequest(_geometry.margin(_paintMargin));
+            }
+        }
+
+        void Widget::_setGeometryDirty()
+        {
+            // A change in geometry does not change the size hints, so only
+            // this widget needs the layout and clip events.
+            _layoutDirty = true;
+            _clipDirty = true;
+            for (auto parent = std::dynamic_pointer_cast<Widget>(getParent().lock());
+                parent && !parent->_childDirty;
+                parent = std::dynamic_pointer_cast<Widget>(parent->getParent().lock()))
+            {
+                parent->_childDirty = true;
+            }
             if (auto eventSystem = _eventSystem.lock())
             {
                 eventSystem->resizeRequest();
             }
         }
 
+        bool Widget::_isDirty() const
+        {
+            return _sizeDirty || _layoutDirty || _clipDirty || _childDirty;
+        }
+
         void Widget::_redraw()
         {
             if (auto eventSystem = _eventSystem.lock())
             {
-                eventSystem->redrawRequest();
+                eventSystem->redrawRequest(_geometry.margin(_paintMargin));
             }
         }
 
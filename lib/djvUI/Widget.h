@@ -111,6 +111,14 @@ namespace djv
 
             void setShadowOverlay(const std::set<Side>&);
 
+            //! Get the margin outside of the geometry that is painted, for
+            //! example a drop shadow drawn by the parent.
+            float getPaintMargin() const;
+
+            //! Set the paint margin. The margin is included in the damage when
+            //! the widget is redrawn or its geometry changes.
+            void setPaintMargin(float);
+
             ///@}
 
             //! \name Input
@@ -196,10 +204,13 @@ namespace djv
 
             ///@}
 
-            //! Call this function when the widget needs resizing.
+            //! Call this function when the widget needs resizing. The widget
+            //! and its parents are marked for the next pre-layout, layout, and
+            //! clip events, and the geometry of the widget is redrawn.
             void _resize();
 
-            //! Call this function to redraw the widget.
+            //! Call this function to redraw the widget. Only the geometry of
+            //! the widget and the paint margin are marked as damaged.
             void _redraw();
 
             //! Set the minimum size. This is computed and set in the pre-layout event.
@@ -213,8 +224,16 @@ namespace djv
             virtual std::shared_ptr<ITooltipWidget> _createTooltip(const glm::vec2& pos);
 
         private:
+            void _setGeometryDirty();
+            bool _isDirty() const;
+
             std::vector<std::shared_ptr<Widget> > _childWidgets;
 
+            bool                _sizeDirty       = true;
+            bool                _layoutDirty     = true;
+            bool                _clipDirty       = true;
+            bool                _childDirty      = false;
+
             std::chrono::steady_clock::time_point _updateTime;
 
             bool                _visible         = true;
@@ -233,6 +252,7 @@ namespace djv
 
             ColorRole           _backgroundRole  = ColorRole::None;
             std::set<Side>      _shadowOverlay;
+            float               _paintMargin     = 0.F;
 
             bool _pointerEnabled = false;
             std::map<System::Event::PointerID, glm::vec2> _pointerHover;
@@ -247,6 +267,7 @@ namespace djv
             };
             std::map<System::Event::PointerID, TooltipData> _pointerToTooltips;
             std::set<std::shared_ptr<Tooltip> > _tooltipsToDelete;
+            bool _tooltipUpdateEvents = false;
 
             std::weak_ptr<EventSystem> _eventSystem;
             std::shared_ptr<Render2D::Render> _render;
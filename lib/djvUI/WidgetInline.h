@@ -91,6 +91,11 @@ namespace djv
             return _shadowOverlay;
         }
 
+        inline float Widget::getPaintMargin() const
+        {
+            return _paintMargin;
+        }
+
         inline bool Widget::isPointerEnabled() const
         {
             return _pointerEnabled;
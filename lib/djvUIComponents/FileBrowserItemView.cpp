@@ -41,6 +41,7 @@ namespace djv
             {
                 //! \todo Should this be configurable?
                 const size_t thumbnailFadeTime = 200;
+                const size_t prefetchRows      = 2;
 
                 const size_t invalid = static_cast<size_t>(-1);
 
@@ -49,8 +50,6 @@ namespace djv
                     System::File::Info info;
                     std::string name;
 
-                    Math::BBox2f geometry;
-
                     bool nameLinesInit = true;
                     std::vector<Render2D::Font::TextLine> nameLines;
 
@@ -92,6 +91,12 @@ namespace djv
                 std::map<size_t, std::future<std::vector<std::shared_ptr<Render2D::Font::Glyph> > > > sizeGlyphsFutures;
                 std::map<size_t, std::future<std::vector<std::shared_ptr<Render2D::Font::Glyph> > > > timeGlyphsFutures;
                 std::vector<float> split = { .7F, .8F, 1.F };
+
+                size_t columns = 1;
+                glm::vec2 itemSize = glm::vec2(0.F, 0.F);
+                float itemSpacing = 0.F;
+                std::pair<size_t, size_t> visible = std::make_pair(0, 0);
+                std::pair<size_t, size_t> onscreen = std::make_pair(0, 0);
                 OCIO::Config ocioConfig;
                 std::string outputColorSpace;
 
@@ -112,6 +117,7 @@ namespace djv
                 Widget::_init(context);
                 DJV_PRIVATE_PTR();
                 setClassName("djv::UIComponents::FileBrowser::ItemView");
+                _setUpdateEvents(true);
 
                 p.fontSystem = context->getSystemT<Render2D::Font::FontSystem>();
 
@@ -307,36 +313,30 @@ namespace djv
                 const float s = style->getMetric(UI::MetricsRole::Spacing);
                 const float b = style->getMetric(UI::MetricsRole::Border);
                 const float sh = style->getMetric(UI::MetricsRole::Shadow);
-                glm::vec2 pos = g.min;
-                const size_t itemsSize = p.items.size();
                 switch (p.viewType)
                 {
                 case UI::ViewType::Tiles:
-                    pos += s;
-                    for (size_t i = 0; i < itemsSize; ++i)
+                {
+                    const float itemWidth = p.thumbnailSize.w + b * 2.F + sh * 2.F;
+                    p.columns = 1;
+                    float x = g.min.x + s + itemWidth;
+                    while (x <= g.max.x - itemWidth)
                     {
-                        const float itemHeight = p.thumbnailSize.h + p.nameFontMetrics.lineHeight * 2.F + m * 2.F + b * 2.F + sh * 2.F;
-                        const float itemWidth = p.thumbnailSize.w + b * 2.F + sh * 2.F;
-                        p.items[i].geometry = Math::BBox2f(pos.x, pos.y, itemWidth, itemHeight);
-                        pos.x += itemWidth;
-                        if (pos.x > g.max.x - itemWidth)
-                        {
-                            pos.x = g.min.x + s;
-                            pos.y += itemHeight + s;
-                        }
-                        else
-                        {
-                            pos.x += s;
-                        }
+                        ++p.columns;
+                        x += s + itemWidth;
                     }
+                    p.itemSize = glm::vec2(
+                        itemWidth,
+                        p.thumbnailSize.h + p.nameFontMetrics.lineHeight * 2.F + m * 2.F + b * 2.F + sh * 2.F);
+                    p.itemSpacing = s;
                     break;
+                }
                 case UI::ViewType::List:
-                    for (size_t i = 0; i < itemsSize; ++i)
-                    {
-                        const float itemHeight = std::max(static_cast<float>(p.thumbnailSize.h), p.nameFontMetrics.lineHeight + m * 2.F);
-                        p.items[i].geometry = Math::BBox2f(pos.x, pos.y, g.w(), itemHeight);
-                        pos.y += itemHeight;
-                    }
+                    p.columns = 1;
+                    p.itemSize = glm::vec2(
+                        g.w(),
+                        std::max(static_cast<float>(p.thumbnailSize.h), p.nameFontMetrics.lineHeight + m * 2.F));
+                    p.itemSpacing = 0.F;
                     break;
                 default: break;
                 }
@@ -347,117 +347,35 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 if (isClipped())
                     return;
-                if (auto context = getContext().lock())
+
+                // Request the items that are visible plus a margin, so they
+                // are ready before they are scrolled into view. Requests for
+                // the items that have moved out of the range are cancelled.
+                const float margin = (p.itemSize.y + p.itemSpacing) * prefetchRows;
+                const auto range = _getItemRange(event.getClipRect().margin(0.F, margin, 0.F, margin));
+                const auto onscreen = _getItemRange(event.getClipRect());
+                const size_t itemsSize = p.items.size();
+                for (size_t i = p.visible.first; i < p.visible.second && i < itemsSize; ++i)
                 {
-                    const auto& style = _getStyle();
-                    const auto& clipRect = event.getClipRect();
-                    const size_t itemsSize = p.items.size();
-                    for (size_t i = 0; i < itemsSize; ++i)
+                    if (i < range.first || i >= range.second)
                     {
-                        auto& item = p.items[i];
-                        if (item.geometry.intersects(clipRect))
-                        {
-                            if (item.nameLinesInit)
-                            {
-                                item.nameLinesInit = false;
-                                const auto k = p.nameLinesFutures.find(i);
-                                if (k == p.nameLinesFutures.end())
-                                {
-                                    const float m = style->getMetric(UI::MetricsRole::MarginSmall);
-                                    const auto fontInfo = style->getFontInfo(Render2D::Font::faceDefault, UI::MetricsRole::FontMedium);
-                                    item.name = item.info.getFileName(Math::Frame::invalid, false);
-                                    p.nameLinesFutures[i] = p.fontSystem->textLines(
-                                        item.name,
-                                        p.thumbnailSize.w - static_cast<uint16_t>(m * 2.F),
-                                        fontInfo);
-                                }
-                            }
-                            if (item.ioInfoInit)
-                            {
-                                item.ioInfoInit = false;
-                                if (p.ioInfoFutures.find(i) == p.ioInfoFutures.end())
-                                {
-                                    auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
-                                    auto ioSystem = context->getSystemT<AV::IO::IOSystem>();
-                                    if (thumbnailSystem && ioSystem)
-                                    {
-                                        if (ioSystem->canRead(item.info))
-                                        {
-                                            p.ioInfoFutures[i] = thumbnailSystem->getInfo(item.info);
-                                        }
-                                    }
-                                }
-                            }
-                            if (item.thumbnailInit)
-                            {
-                                item.thumbnailInit = false;
-                                if (p.thumbnailFutures.find(i) == p.thumbnailFutures.end())
-                                {
-                                    auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
-                                    auto ioSystem = context->getSystemT<AV::IO::IOSystem>();
-                                    if (thumbnailSystem && ioSystem && ioSystem->canRead(item.info))
-                                    {
-                                        p.thumbnailFutures[i] = thumbnailSystem->getImage(item.info, p.thumbnailSize);
-                                    }
-                                }
-                            }
-                            if (item.nameGlyphsInit)
-                            {
-                                item.nameGlyphsInit = false;
-                                if (p.nameGlyphsFutures.find(i) == p.nameGlyphsFutures.end())
-                                {
-                                    const std::string& label = item.info.getFileName(Math::Frame::invalid, false);
-                                    const auto fontInfo = style->getFontInfo(Render2D::Font::faceDefault, UI::MetricsRole::FontMedium);
-                                    p.nameGlyphsFutures[i] = p.fontSystem->getGlyphs(label, fontInfo);
-                                }
-                            }
-                            if (item.sizeGlyphsInit)
-                            {
-                                item.sizeGlyphsInit = false;
-                                if (p.sizeGlyphsFutures.find(i) == p.sizeGlyphsFutures.end())
-                                {
-                                    std::stringstream ss;
-                                    const uint64_t size = item.info.getSize();
-                                    ss << Memory::getSizeLabel(size);
-                                    std::stringstream ss2;
-                                    ss2 << Memory::getUnitLabel(size);
-                                    ss << _getText(ss2.str());
-                                    const auto fontInfo = style->getFontInfo(Render2D::Font::faceDefault, UI::MetricsRole::FontMedium);
-                                    p.sizeGlyphsFutures[i] = p.fontSystem->getGlyphs(ss.str(), fontInfo);
-                                }
-                            }
-                            if (item.timeGlyphsInit)
-                            {
-                                item.timeGlyphsInit = false;
-                                if (p.timeGlyphsFutures.find(i) == p.timeGlyphsFutures.end())
-                                {
-                                    const std::string& label = AV::Time::getLabel(item.info.getTime());
-                                    const auto fontInfo = style->getFontInfo(Render2D::Font::faceDefault, UI::MetricsRole::FontMedium);
-                                    p.timeGlyphsFutures[i] = p.fontSystem->getGlyphs(label, fontInfo);
-                                }
-                            }
-                        }
-                        else if (auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>())
-                        {
-                            const auto j = p.ioInfoFutures.find(i);
-                            if (j != p.ioInfoFutures.end())
-                            {
-                                item.ioInfoInit = true;
-                                item.ioInfoValid = false;
-                                thumbnailSystem->cancelInfo(j->second.uid);
-                                p.ioInfoFutures.erase(j);
-                            }
-                            const auto k = p.thumbnailFutures.find(i);
-                            if (k != p.thumbnailFutures.end())
-                            {
-                                item.thumbnailInit = true;
-                                item.thumbnail.reset();
-                                thumbnailSystem->cancelImage(k->second.uid);
-                                p.thumbnailFutures.erase(k);
-                            }
-                        }
+                        _itemCancel(i);
                     }
                 }
+                for (size_t i = range.first; i < range.second; ++i)
+                {
+                    const bool visible = i >= onscreen.first && i < onscreen.second;
+                    const bool wasVisible = i >= p.onscreen.first && i < p.onscreen.second;
+                    _itemRequest(i, visible ? AV::ThumbnailPriority::Visible : AV::ThumbnailPriority::Prefetch);
+                    if (visible && !wasVisible)
+                    {
+                        // Prefetched items that have scrolled into view move
+                        // to the front of the queue.
+                        _itemPriority(i, AV::ThumbnailPriority::Visible);
+                    }
+                }
+                p.visible = range;
+                p.onscreen = onscreen;
             }
 
             void ItemView::_paintEvent(System::Event::Paint& event)
@@ -471,11 +389,11 @@ namespace djv
 
                 const auto& render = _getRender();
                 const auto& ut = _getUpdateTime();
-                const size_t itemsSize = p.items.size();
-                for (size_t i = 0; i < itemsSize; ++i)
+                const auto range = _getItemRange(event.getClipRect());
+                for (size_t i = range.first; i < range.second; ++i)
                 {
                     const auto& item = p.items[i];
-                    Math::BBox2f itemGeometry = item.geometry;
+                    Math::BBox2f itemGeometry = _getItemGeometry(i);
 
                     const bool selected = p.selectionModel->isSelected(i);
                     switch (p.viewType)
@@ -681,15 +599,11 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 event.accept();
                 const auto& pointerInfo = event.getPointerInfo();
-                const size_t itemsSize = p.items.size();
-                for (size_t i = 0; i < itemsSize; ++i)
+                const size_t i = _getItem(pointerInfo.pos);
+                if (i != invalid)
                 {
-                    if (p.items[i].geometry.contains(pointerInfo.pos))
-                    {
-                        p.hover = i;
-                        _redraw();
-                        break;
-                    }
+                    p.hover = i;
+                    _redraw();
                 }
             }
 
@@ -724,15 +638,11 @@ namespace djv
                 }
                 else
                 {
-                    const size_t itemsSize = p.items.size();
-                    for (size_t i = 0; i < itemsSize; ++i)
+                    const size_t i = _getItem(pointerInfo.pos);
+                    if (i != invalid)
                     {
-                        if (p.items[i].geometry.contains(pointerInfo.pos))
-                        {
-                            p.hover = i;
-                            _redraw();
-                            break;
-                        }
+                        p.hover = i;
+                        _redraw();
                     }
                 }
             }
@@ -743,18 +653,14 @@ namespace djv
                 if (p.pressedId)
                     return;
                 const auto& pointerInfo = event.getPointerInfo();
-                const size_t itemsSize = p.items.size();
-                for (size_t i = 0; i < itemsSize; ++i)
+                const size_t i = _getItem(pointerInfo.pos);
+                if (i != invalid)
                 {
-                    if (p.items[i].geometry.contains(pointerInfo.pos))
-                    {
-                        event.accept();
-                        p.grab = i;
-                        p.pressedId = pointerInfo.id;
-                        p.pressedPos = pointerInfo.pos;
-                        _redraw();
-                        break;
-                    }
+                    event.accept();
+                    p.grab = i;
+                    p.pressedId = pointerInfo.id;
+                    p.pressedPos = pointerInfo.pos;
+                    _redraw();
                 }
             }
 
@@ -771,29 +677,25 @@ namespace djv
                     const auto i = hover.find(pointerInfo.id);
                     if (i != hover.end())
                     {
-                        const size_t itemsSize = p.items.size();
-                        for (size_t j = 0; j < itemsSize; ++j)
+                        const size_t j = _getItem(i->second);
+                        if (j != invalid)
                         {
-                            const auto& item = p.items[j];
-                            if (item.geometry.contains(i->second))
+                            const int modifiers = event.getKeyModifiers();
+                            if (0 == modifiers)
                             {
-                                const int modifiers = event.getKeyModifiers();
-                                if (0 == modifiers)
+                                if (p.activatedCallback)
                                 {
-                                    if (p.activatedCallback)
-                                    {
-                                        p.activatedCallback({ item.info });
-                                    }
-                                    if (p.activatedCallback2)
-                                    {
-                                        p.activatedCallback2({ j });
-                                    }
+                                    p.activatedCallback({ p.items[j].info });
                                 }
-                                else
+                                if (p.activatedCallback2)
                                 {
-                                    p.selectionModel->select(j, modifiers);
+                                    p.activatedCallback2({ j });
                                 }
                             }
+                            else
+                            {
+                                p.selectionModel->select(j, modifiers);
+                            }
                         }
                     }
                     _redraw();
@@ -838,21 +740,17 @@ namespace djv
                 DJV_PRIVATE_PTR();
                 std::shared_ptr<UI::ITooltipWidget> out;
                 std::string text;
-                const size_t itemsSize = p.items.size();
-                for (size_t i = 0; i < itemsSize; ++i)
+                const size_t i = _getItem(pos);
+                if (i != invalid)
                 {
                     const auto& item = p.items[i];
-                    if (item.geometry.contains(pos))
+                    if (item.ioInfoValid)
                     {
-                        if (item.ioInfoValid)
-                        {
-                            text = _getTooltip(item.info, item.ioInfo);
-                        }
-                        else
-                        {
-                            text = _getTooltip(item.info);
-                        }
-                        break;
+                        text = _getTooltip(item.info, item.ioInfo);
+                    }
+                    else
+                    {
+                        text = _getTooltip(item.info);
                     }
                 }
                 if (!text.empty())
@@ -1098,6 +996,199 @@ namespace djv
                 return out;
             }
 
+            Math::BBox2f ItemView::_getItemGeometry(size_t index) const
+            {
+                DJV_PRIVATE_PTR();
+                const Math::BBox2f& g = getGeometry();
+                const size_t column = index % p.columns;
+                const size_t row = index / p.columns;
+                return Math::BBox2f(
+                    g.min.x + p.itemSpacing + column * (p.itemSize.x + p.itemSpacing),
+                    g.min.y + p.itemSpacing + row * (p.itemSize.y + p.itemSpacing),
+                    p.itemSize.x,
+                    p.itemSize.y);
+            }
+
+            size_t ItemView::_getItem(const glm::vec2& pos) const
+            {
+                DJV_PRIVATE_PTR();
+                size_t out = invalid;
+                const Math::BBox2f& g = getGeometry();
+                const glm::vec2 stride = p.itemSize + p.itemSpacing;
+                if (stride.x > 0.F && stride.y > 0.F && pos.x >= g.min.x && pos.y >= g.min.y)
+                {
+                    const size_t column = static_cast<size_t>((pos.x - g.min.x - p.itemSpacing) / stride.x);
+                    const size_t row = static_cast<size_t>((pos.y - g.min.y - p.itemSpacing) / stride.y);
+                    const size_t index = row * p.columns + column;
+                    if (column < p.columns && index < p.items.size() && _getItemGeometry(index).contains(pos))
+                    {
+                        out = index;
+                    }
+                }
+                return out;
+            }
+
+            std::pair<size_t, size_t> ItemView::_getItemRange(const Math::BBox2f& value) const
+            {
+                DJV_PRIVATE_PTR();
+                std::pair<size_t, size_t> out(0, 0);
+                const Math::BBox2f& g = getGeometry();
+                const float stride = p.itemSize.y + p.itemSpacing;
+                const size_t itemsSize = p.items.size();
+                if (stride > 0.F && itemsSize > 0 && value.max.y >= g.min.y)
+                {
+                    const float y0 = std::max(value.min.y - g.min.y - p.itemSpacing, 0.F);
+                    const float y1 = value.max.y - g.min.y - p.itemSpacing;
+                    const size_t row0 = static_cast<size_t>(y0 / stride);
+                    const size_t row1 = static_cast<size_t>(y1 / stride) + 1;
+                    out.first = std::min(row0 * p.columns, itemsSize);
+                    out.second = std::min(row1 * p.columns, itemsSize);
+                }
+                return out;
+            }
+
+            void ItemView::_itemRequest(size_t i, AV::ThumbnailPriority priority)
+            {
+                DJV_PRIVATE_PTR();
+                if (auto context = getContext().lock())
+                {
+                    const auto& style = _getStyle();
+                    auto& item = p.items[i];
+                    if (item.nameLinesInit)
+                    {
+                        item.nameLinesInit = false;
+                        const auto k = p.nameLinesFutures.find(i);
+                        if (k == p.nameLinesFutures.end())
+                        {
+                            const float m = style->getMetric(UI::MetricsRole::MarginSmall);
+                            const auto fontInfo = style->getFontInfo(Render2D::Font::faceDefault, UI::MetricsRole::FontMedium);
+                            item.name = item.info.getFileName(Math::Frame::invalid, false);
+                            p.nameLinesFutures[i] = p.fontSystem->textLines(
+                                item.name,
+                                p.thumbnailSize.w - static_cast<uint16_t>(m * 2.F),
+                                fontInfo);
+                        }
+                    }
+                    if (item.ioInfoInit)
+                    {
+                        item.ioInfoInit = false;
+                        if (p.ioInfoFutures.find(i) == p.ioInfoFutures.end())
+                        {
+                            auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
+                            auto ioSystem = context->getSystemT<AV::IO::IOSystem>();
+                            if (thumbnailSystem && ioSystem)
+                            {
+                                if (ioSystem->canRead(item.info))
+                                {
+                                    p.ioInfoFutures[i] = thumbnailSystem->getInfo(item.info, priority);
+                                }
+                            }
+                        }
+                    }
+                    if (item.thumbnailInit)
+                    {
+                        item.thumbnailInit = false;
+                        if (p.thumbnailFutures.find(i) == p.thumbnailFutures.end())
+                        {
+                            auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>();
+                            auto ioSystem = context->getSystemT<AV::IO::IOSystem>();
+                            if (thumbnailSystem && ioSystem && ioSystem->canRead(item.info))
+                            {
+                                p.thumbnailFutures[i] = thumbnailSystem->getImage(
+                                    item.info,
+                                    p.thumbnailSize,
+                                    Image::Type::None,
+                                    priority);
+                            }
+                        }
+                    }
+                    if (item.nameGlyphsInit)
+                    {
+                        item.nameGlyphsInit = false;
+                        if (p.nameGlyphsFutures.find(i) == p.nameGlyphsFutures.end())
+                        {
+                            const std::string& label = item.info.getFileName(Math::Frame::invalid, false);
+                            const auto fontInfo = style->getFontInfo(Render2D::Font::faceDefault, UI::MetricsRole::FontMedium);
+                            p.nameGlyphsFutures[i] = p.fontSystem->getGlyphs(label, fontInfo);
+                        }
+                    }
+                    if (item.sizeGlyphsInit)
+                    {
+                        item.sizeGlyphsInit = false;
+                        if (p.sizeGlyphsFutures.find(i) == p.sizeGlyphsFutures.end())
+                        {
+                            std::stringstream ss;
+                            const uint64_t size = item.info.getSize();
+                            ss << Memory::getSizeLabel(size);
+                            std::stringstream ss2;
+                            ss2 << Memory::getUnitLabel(size);
+                            ss << _getText(ss2.str());
+                            const auto fontInfo = style->getFontInfo(Render2D::Font::faceDefault, UI::MetricsRole::FontMedium);
+                            p.sizeGlyphsFutures[i] = p.fontSystem->getGlyphs(ss.str(), fontInfo);
+                        }
+                    }
+                    if (item.timeGlyphsInit)
+                    {
+                        item.timeGlyphsInit = false;
+                        if (p.timeGlyphsFutures.find(i) == p.timeGlyphsFutures.end())
+                        {
+                            const std::string& label = AV::Time::getLabel(item.info.getTime());
+                            const auto fontInfo = style->getFontInfo(Render2D::Font::faceDefault, UI::MetricsRole::FontMedium);
+                            p.timeGlyphsFutures[i] = p.fontSystem->getGlyphs(label, fontInfo);
+                        }
+                    }
+                }
+            }
+
+            void ItemView::_itemCancel(size_t i)
+            {
+                DJV_PRIVATE_PTR();
+                if (auto context = getContext().lock())
+                {
+                    if (auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>())
+                    {
+                        auto& item = p.items[i];
+                        const auto j = p.ioInfoFutures.find(i);
+                        if (j != p.ioInfoFutures.end())
+                        {
+                            item.ioInfoInit = true;
+                            item.ioInfoValid = false;
+                            thumbnailSystem->cancelInfo(j->second.uid);
+                            p.ioInfoFutures.erase(j);
+                        }
+                        const auto k = p.thumbnailFutures.find(i);
+                        if (k != p.thumbnailFutures.end())
+                        {
+                            item.thumbnailInit = true;
+                            item.thumbnail.reset();
+                            thumbnailSystem->cancelImage(k->second.uid);
+                            p.thumbnailFutures.erase(k);
+                        }
+                    }
+                }
+            }
+
+            void ItemView::_itemPriority(size_t i, AV::ThumbnailPriority priority)
+            {
+                DJV_PRIVATE_PTR();
+                if (auto context = getContext().lock())
+                {
+                    if (auto thumbnailSystem = context->getSystemT<AV::ThumbnailSystem>())
+                    {
+                        const auto j = p.ioInfoFutures.find(i);
+                        if (j != p.ioInfoFutures.end())
+                        {
+                            thumbnailSystem->setPriority(j->second.uid, priority);
+                        }
+                        const auto k = p.thumbnailFutures.find(i);
+                        if (k != p.thumbnailFutures.end())
+                        {
+                            thumbnailSystem->setPriority(k->second.uid, priority);
+                        }
+                    }
+                }
+            }
+
             std::string ItemView::_getTooltip(const System::File::Info& fileInfo) const
             {
                 std::stringstream ss;
@@ -1216,27 +1307,10 @@ namespace djv
                     p.nameLinesFutures.clear();
                     p.thumbnailFutures.clear();
 
-                    const auto& style = _getStyle();
-                    const auto& clipRect = getClipRect();
-                    for (size_t i = 0; i < itemsSize; ++i)
+                    for (size_t i = p.visible.first; i < p.visible.second && i < itemsSize; ++i)
                     {
-                        auto& item = p.items[i];
-                        if (item.geometry.intersects(clipRect))
-                        {
-                            const auto fontInfo = style->getFontInfo(Render2D::Font::faceDefault, UI::MetricsRole::FontMedium);
-                            item.name = item.info.getFileName(Math::Frame::invalid, false);
-                            const float m = style->getMetric(UI::MetricsRole::MarginSmall);
-                            p.nameLinesFutures[i] = p.fontSystem->textLines(
-                                item.name,
-                                p.thumbnailSize.w - static_cast<uint16_t>(m * 2.F),
-                                fontInfo);
-
-                            auto ioSystem = context->getSystemT<AV::IO::IOSystem>();
-                            if (ioSystem && ioSystem->canRead(item.info))
-                            {
-                                p.thumbnailFutures[i] = thumbnailSystem->getImage(item.info, p.thumbnailSize);
-                            }
-                        }
+                        const bool visible = i >= p.onscreen.first && i < p.onscreen.second;
+                        _itemRequest(i, visible ? AV::ThumbnailPriority::Visible : AV::ThumbnailPriority::Prefetch);
                     }
                 }
             }
@@ -1282,6 +1356,8 @@ namespace djv
                     p.nameGlyphsFutures.clear();
                     p.sizeGlyphsFutures.clear();
                     p.timeGlyphsFutures.clear();
+                    p.visible = std::make_pair(0, 0);
+                    p.onscreen = std::make_pair(0, 0);
                 }
             }
 
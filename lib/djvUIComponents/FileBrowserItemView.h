@@ -25,6 +25,8 @@ namespace djv
 
     namespace AV
     {
+        enum class ThumbnailPriority;
+
         namespace IO
         {
             class Info;
@@ -38,6 +40,10 @@ namespace djv
         {
             //! This class provides a file browser item view.
             //!
+            //! The view is virtualized: item geometry is computed from the index,
+            //! and text and thumbnails are only requested for the items inside
+            //! the clip rectangle plus a prefetch margin.
+            //!
             //! \todo Elide names which are too long.
             //! \todo Show an animated spinner for thumbnails that are loading.
             //! \todo Show an error icon for thumbnails that failed to load.
@@ -114,6 +120,13 @@ namespace djv
             private:
                 std::vector<System::File::Info> _getSelectedItems(const std::set<size_t>&) const;
 
+                Math::BBox2f _getItemGeometry(size_t) const;
+                size_t _getItem(const glm::vec2&) const;
+                std::pair<size_t, size_t> _getItemRange(const Math::BBox2f&) const;
+                void _itemRequest(size_t, AV::ThumbnailPriority);
+                void _itemCancel(size_t);
+                void _itemPriority(size_t, AV::ThumbnailPriority);
+
                 std::string _getTooltip(const System::File::Info&) const;
                 std::string _getTooltip(const System::File::Info&, const AV::IO::Info&) const;
                 
@@ -82,6 +82,7 @@ namespace djv
             DJV_PRIVATE_PTR();
 
             setClassName("djv::UIComponents::SceneWidget");
+            _setUpdateEvents(true);
             setPointerEnabled(true);
 
             p.sceneRotate = Observer::ValueSubject<SceneRotate>::create(SceneRotate::None);
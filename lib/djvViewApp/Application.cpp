@@ -37,6 +37,7 @@
 #include <djvAV/AVSystem.h>
 #include <djvAV/IOSystem.h>
 #include <djvAV/SpeedFunc.h>
+#include <djvAV/TelemetryFunc.h>
 #include <djvSystem/TextSystem.h>
 #include <djvSystem/TimerFunc.h>
 
@@ -48,6 +49,7 @@
 
 #include <djvSystem/LogSystem.h>
 #include <djvSystem/ResourceSystem.h>
+#include <djvSystem/TraceFunc.h>
 
 #include <djvCore/StringFormat.h>
 
@@ -74,6 +76,7 @@ namespace djv
             std::shared_ptr<std::string> inPointCmdLine;
             std::shared_ptr<std::string> outPointCmdLine;
             std::shared_ptr<std::string> frameCmdLine;
+            std::shared_ptr<std::string> traceCmdLine;
 
             std::shared_ptr<ApplicationSettings> settings;
 
@@ -307,6 +310,34 @@ namespace djv
             p.mainWindow->show();
 
             Desktop::Application::run();
+
+            // Write the frame telemetry.
+            if (p.traceCmdLine)
+            {
+                std::vector<System::Trace::Event> events;
+                if (auto fileSystem = getSystemT<FileSystem>())
+                {
+                    for (const auto& i : fileSystem->observeMedia()->get())
+                    {
+                        if (auto telemetry = i->getTelemetry())
+                        {
+                            const auto mediaEvents = AV::IO::toTraceEvents(
+                                telemetry->getFrames(),
+                                i->getFileInfo().getFileName(Math::Frame::invalid, false));
+                            events.insert(events.end(), mediaEvents.begin(), mediaEvents.end());
+                        }
+                    }
+                }
+                try
+                {
+                    System::Trace::writeChromeJSON(System::File::Path(*p.traceCmdLine), events);
+                }
+                catch (const std::exception& e)
+                {
+                    auto logSystem = getSystemT<System::LogSystem>();
+                    logSystem->log("djv::ViewApp::Application", e.what(), System::LogLevel::Error);
+                }
+            }
         }
 
         void Application::_parseCmdLine(std::list<std::string>& args)
@@ -476,6 +507,18 @@ namespace djv
                     p.frameCmdLine.reset(new std::string(*arg));
                     arg = args.erase(arg);
                 }
+                else if ("-trace" == *arg)
+                {
+                    arg = args.erase(arg);
+                    if (args.end() == arg)
+                    {
+                        throw std::runtime_error(String::Format("{0}: {1}").
+                            arg("-trace").
+                            arg(textSystem->getText(DJV_TEXT("error_cannot_parse_argument"))));
+                    }
+                    p.traceCmdLine.reset(new std::string(*arg));
+                    arg = args.erase(arg);
+                }
                 else
                 {
                     p.cmdlinePaths.push_back(*arg);
@@ -635,6 +678,11 @@ namespace djv
             std::cout << "   " << textSystem->getText(DJV_TEXT("djv_cli_option_frame")) << std::endl;
             std::cout << "   " << textSystem->getText(DJV_TEXT("djv_cli_option_frame_description")) << std::endl;
             std::cout << std::endl;
+            std::cout << " " << textSystem->getText(DJV_TEXT("djv_cli_options_debugging")) << std::endl;
+            std::cout << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_cli_option_trace")) << std::endl;
+            std::cout << "   " << textSystem->getText(DJV_TEXT("djv_cli_option_trace_description")) << std::endl;
+            std::cout << std::endl;
         }
 
         void Application::_printUsageMaya()
@@ -20,6 +20,7 @@
 #include <djvRender2D/Render.h>
 
 #include <djvAV/IO.h>
+#include <djvAV/TelemetryFunc.h>
 #include <djvAV/ThumbnailSystem.h>
 
 #include <djvSystem/Context.h>
@@ -33,6 +34,11 @@ namespace djv
     {
         namespace
         {
+            float toMilliseconds(const Time::Duration& value)
+            {
+                return std::chrono::duration<float, std::milli>(value).count();
+            }
+
             class IDebugWidget : public UI::Widget
             {
             public:
@@ -364,6 +370,16 @@ namespace djv
                 _lineGraphs["VBOSize"] = UIComponents::LineGraphWidget::create(context);
                 _lineGraphs["VBOSize"]->setPrecision(0);
 
+                _textBlocks["TextureUploadTime"] = UI::Text::Block::create(context);
+                _lineGraphs["TextureUploadTime"] = UIComponents::LineGraphWidget::create(context);
+                _lineGraphs["TextureUploadTime"]->setPrecision(2);
+
+                _textBlocks["TextureUploadStalls"] = UI::Text::Block::create(context);
+
+                _textBlocks["Paint"] = UI::Text::Block::create(context);
+                _lineGraphs["Paint"] = UIComponents::LineGraphWidget::create(context);
+                _lineGraphs["Paint"]->setPrecision(2);
+
                 for (auto& i : _textBlocks)
                 {
                     i.second->setFontFamily(Render2D::Font::familyMono);
@@ -379,6 +395,11 @@ namespace djv
                 _layout->addChild(_lineGraphs["DynamicTextureCount"]);
                 _layout->addChild(_textBlocks["VBOSize"]);
                 _layout->addChild(_lineGraphs["VBOSize"]);
+                _layout->addChild(_textBlocks["TextureUploadTime"]);
+                _layout->addChild(_lineGraphs["TextureUploadTime"]);
+                _layout->addChild(_textBlocks["TextureUploadStalls"]);
+                _layout->addChild(_textBlocks["Paint"]);
+                _layout->addChild(_lineGraphs["Paint"]);
                 addChild(_layout);
 
                 _timer = System::Timer::create(context);
@@ -412,11 +433,26 @@ namespace djv
                 const float textureAtlasPercentage = render->getTextureAtlasPercentage();
                 const size_t dynamicTextureCount = render->getDynamicTextureCount();
                 const size_t vboSize = render->getVBOSize();
+                const size_t textureUploadCount = render->getTextureUploadCount();
+                const float textureUploadTime = render->getTextureUploadTime().count() / 1000.F;
+                const size_t textureUploadStallCount = render->getTextureUploadStallCount();
+                size_t paintCount = 0;
+                size_t partialPaintCount = 0;
+                float paintPercentage = 0.F;
+                if (auto context = getContext().lock())
+                {
+                    auto eventSystem = context->getSystemT<UI::EventSystem>();
+                    paintCount = eventSystem->getPaintCount();
+                    partialPaintCount = eventSystem->getPartialPaintCount();
+                    paintPercentage = eventSystem->getPaintPercentage();
+                }
 
                 _lineGraphs["Primitives"]->addSample(primitives);
                 _thermometerWidgets["TextureAtlas"]->setPercentage(textureAtlasPercentage);
                 _lineGraphs["DynamicTextureCount"]->addSample(dynamicTextureCount);
                 _lineGraphs["VBOSize"]->addSample(vboSize);
+                _lineGraphs["TextureUploadTime"]->addSample(textureUploadTime);
+                _lineGraphs["Paint"]->addSample(paintPercentage);
 
                 {
                     std::stringstream ss;
@@ -443,6 +479,26 @@ namespace djv
                     ss << vboSize;
                     _textBlocks["VBOSize"]->setText(ss.str());
                 }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_render_texture_upload_time")) << ": ";
+                    ss.precision(2);
+                    ss << std::fixed << textureUploadTime << "ms (" << textureUploadCount << ")";
+                    _textBlocks["TextureUploadTime"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_render_texture_upload_stalls")) << ": ";
+                    ss << textureUploadStallCount;
+                    _textBlocks["TextureUploadStalls"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_render_paint")) << ": ";
+                    ss.precision(2);
+                    ss << std::fixed << paintPercentage << "% (" << partialPaintCount << "/" << paintCount << ")";
+                    _textBlocks["Paint"]->setText(ss.str());
+                }
             }
 
             class MediaDebugWidget : public UI::Widget
@@ -464,7 +520,10 @@ namespace djv
 
             private:
                 void _widgetUpdate();
+                void _telemetryUpdate();
 
+                std::weak_ptr<Media> _media;
+                size_t _telemetryFrameCount = 0;
                 Math::Frame::Sequence _sequence;
                 Math::Frame::Index _currentFrame = 0;
                 size_t _videoQueueMax = 0;
@@ -474,6 +533,7 @@ namespace djv
                 std::map<std::string, std::shared_ptr<UI::Text::Block> > _textBlocks;
                 std::map<std::string, std::shared_ptr<UIComponents::LineGraphWidget> > _lineGraphs;
                 std::shared_ptr<UI::VerticalLayout> _layout;
+                std::shared_ptr<System::Timer> _timer;
                 std::shared_ptr<Observer::Value<std::shared_ptr<Media> > > _currentMediaObserver;
                 std::shared_ptr<Observer::Value<Math::Frame::Sequence> > _sequenceObserver;
                 std::shared_ptr<Observer::Value<Math::Frame::Index> > _currentFrameObserver;
@@ -499,6 +559,15 @@ namespace djv
                 _lineGraphs["AudioQueue"] = UIComponents::LineGraphWidget::create(context);
                 _lineGraphs["AudioQueue"]->setPrecision(0);
 
+                _textBlocks["DecodeTime"] = UI::Text::Block::create(context);
+                _lineGraphs["DecodeTime"] = UIComponents::LineGraphWidget::create(context);
+                _lineGraphs["DecodeTime"]->setPrecision(2);
+                _textBlocks["IOWaitTime"] = UI::Text::Block::create(context);
+                _textBlocks["Latency"] = UI::Text::Block::create(context);
+                _textBlocks["QueueTime"] = UI::Text::Block::create(context);
+                _textBlocks["CacheHits"] = UI::Text::Block::create(context);
+                _textBlocks["Starvations"] = UI::Text::Block::create(context);
+
                 for (auto& i : _textBlocks)
                 {
                     i.second->setFontFamily(Render2D::Font::familyMono);
@@ -511,9 +580,28 @@ namespace djv
                 _layout->addChild(_lineGraphs["VideoQueue"]);
                 _layout->addChild(_textBlocks["AudioQueue"]);
                 _layout->addChild(_lineGraphs["AudioQueue"]);
+                _layout->addChild(_textBlocks["DecodeTime"]);
+                _layout->addChild(_lineGraphs["DecodeTime"]);
+                _layout->addChild(_textBlocks["IOWaitTime"]);
+                _layout->addChild(_textBlocks["Latency"]);
+                _layout->addChild(_textBlocks["QueueTime"]);
+                _layout->addChild(_textBlocks["CacheHits"]);
+                _layout->addChild(_textBlocks["Starvations"]);
                 addChild(_layout);
 
                 auto weak = std::weak_ptr<MediaDebugWidget>(std::dynamic_pointer_cast<MediaDebugWidget>(shared_from_this()));
+                _timer = System::Timer::create(context);
+                _timer->setRepeating(true);
+                _timer->start(
+                    System::getTimerDuration(System::TimerValue::Medium),
+                    [weak](const std::chrono::steady_clock::time_point&, const Time::Duration&)
+                {
+                    if (auto widget = weak.lock())
+                    {
+                        widget->_telemetryUpdate();
+                    }
+                });
+
                 if (auto fileSystem = context->getSystemT<FileSystem>())
                 {
                     _currentMediaObserver = Observer::Value<std::shared_ptr<Media>>::create(
@@ -526,6 +614,8 @@ namespace djv
                             {
                                 i.second->resetSamples();
                             }
+                            widget->_media = value;
+                            widget->_telemetryFrameCount = 0;
 
                             if (value)
                             {
@@ -608,6 +698,7 @@ namespace djv
                                 widget->_audioQueueCountObserver.reset();
                                 widget->_widgetUpdate();
                             }
+                            widget->_telemetryUpdate();
                         }
                     });
                 }
@@ -661,6 +752,74 @@ namespace djv
                 }
             }
 
+            void MediaDebugWidget::_telemetryUpdate()
+            {
+                AV::IO::TelemetryStats stats;
+                if (auto media = _media.lock())
+                {
+                    media->updateDebugInfo();
+                    if (auto telemetry = media->getTelemetry())
+                    {
+                        stats = AV::IO::getStats(telemetry->getFrames(), telemetry->getStarvationCount());
+                        const size_t frameCount = telemetry->getFrameCount();
+                        if (frameCount != _telemetryFrameCount)
+                        {
+                            _telemetryFrameCount = frameCount;
+                            _lineGraphs["DecodeTime"]->addSample(toMilliseconds(stats.decode.p50));
+                        }
+                    }
+                }
+
+                {
+                    std::stringstream ss;
+                    ss.precision(2);
+                    ss << std::fixed;
+                    ss << _getText(DJV_TEXT("debug_media_decode_time")) << ": ";
+                    ss << toMilliseconds(stats.decode.p50) << " / ";
+                    ss << toMilliseconds(stats.decode.p95) << " / ";
+                    ss << toMilliseconds(stats.decode.max) << " ms";
+                    _textBlocks["DecodeTime"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss.precision(2);
+                    ss << std::fixed;
+                    ss << _getText(DJV_TEXT("debug_media_io_wait_time")) << ": ";
+                    ss << toMilliseconds(stats.ioWait.mean) << " ms";
+                    _textBlocks["IOWaitTime"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss.precision(2);
+                    ss << std::fixed;
+                    ss << _getText(DJV_TEXT("debug_media_latency")) << ": ";
+                    ss << toMilliseconds(stats.latency.p50) << " / ";
+                    ss << toMilliseconds(stats.latency.p95) << " ms";
+                    _textBlocks["Latency"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss.precision(2);
+                    ss << std::fixed;
+                    ss << _getText(DJV_TEXT("debug_media_queue_time")) << ": ";
+                    ss << toMilliseconds(stats.queue.p50) << " / ";
+                    ss << toMilliseconds(stats.queue.p95) << " ms";
+                    _textBlocks["QueueTime"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_cache_hits")) << ": ";
+                    ss << stats.cacheHitCount << " / " << stats.frameCount;
+                    _textBlocks["CacheHits"]->setText(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << _getText(DJV_TEXT("debug_media_starvations")) << ": ";
+                    ss << stats.starvationCount;
+                    _textBlocks["Starvations"]->setText(ss.str());
+                }
+            }
+
         } // namespace
 
         struct DebugWidget::Private
@@ -75,6 +75,7 @@ namespace djv
             std::shared_ptr<Observer::Value<bool> > cacheEnabledObserver;
             std::shared_ptr<Observer::Value<int> > cacheSizeObserver;
             std::shared_ptr<System::Timer> cacheTimer;
+            std::shared_ptr<Observer::List<std::shared_ptr<Media> > > mediaObserver;
 
             typedef std::pair<System::File::Info, std::string> FileInfoAndNumber;
 
@@ -363,26 +364,45 @@ namespace djv
 
             p.cacheTimer = System::Timer::create(context);
             p.cacheTimer->setRepeating(true);
-            p.cacheTimer->start(
-                System::getTimerDuration(System::TimerValue::Medium),
-                [weak](const std::chrono::steady_clock::time_point&, const Time::Duration&)
+
+            // The cache is only polled while there is media open, so the
+            // timer does not wake the application when it is idle.
+            p.mediaObserver = Observer::List<std::shared_ptr<Media> >::create(
+                p.media,
+                [weak](const std::vector<std::shared_ptr<Media> >& value)
                 {
                     if (auto system = weak.lock())
                     {
-                        size_t cacheMaxByteCount  = 0;
-                        size_t cacheByteCount = 0;
-                        for (const auto& i : system->_p->media->get())
+                        if (value.empty())
                         {
-                            if (i->hasCache())
-                            {
-                                cacheMaxByteCount  += i->getCacheMaxByteCount();
-                                cacheByteCount += i->getCacheByteCount();
-                            }
+                            system->_p->cacheTimer->stop();
+                            system->_p->cachePercentage->setIfChanged(0.F);
+                        }
+                        else if (!system->_p->cacheTimer->isActive())
+                        {
+                            system->_p->cacheTimer->start(
+                                System::getTimerDuration(System::TimerValue::Medium),
+                                [weak](const std::chrono::steady_clock::time_point&, const Time::Duration&)
+                                {
+                                    if (auto system = weak.lock())
+                                    {
+                                        size_t cacheMaxByteCount  = 0;
+                                        size_t cacheByteCount = 0;
+                                        for (const auto& i : system->_p->media->get())
+                                        {
+                                            if (i->hasCache())
+                                            {
+                                                cacheMaxByteCount  += i->getCacheMaxByteCount();
+                                                cacheByteCount += i->getCacheByteCount();
+                                            }
+                                        }
+                                        const float percentage = cacheMaxByteCount ?
+                                            (cacheByteCount / static_cast<float>(cacheMaxByteCount) * 100.F) :
+                                            0.F;
+                                        system->_p->cachePercentage->setIfChanged(percentage);
+                                    }
+                                });
                         }
-                        const float percentage = cacheMaxByteCount ?
-                            (cacheByteCount / static_cast<float>(cacheMaxByteCount) * 100.F) :
-                            0.F;
-                        system->_p->cachePercentage->setIfChanged(percentage);
                     }
                 });
 
@@ -12,7 +12,11 @@
 #include <djvAV/TimeFunc.h>
 
 #include <djvAudio/AudioSystem.h>
+#include <djvAudio/Data.h>
 #include <djvAudio/DataFunc.h>
+#include <djvAudio/Resample.h>
+#include <djvAudio/RingBuffer.h>
+#include <djvAudio/TimeStretch.h>
 
 #include <djvSystem/Context.h>
 #include <djvSystem/FileInfoFunc.h>
@@ -26,6 +30,12 @@
 #include <djvCore/StringFunc.h>
 #include <djvCore/UndoStack.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 using namespace djv::Core;
 
 namespace djv
@@ -36,6 +46,9 @@ namespace djv
         {
             //! \todo Should this be configurable?
             const size_t audioBufferFrameCount = 256;
+            const float  audioOutputSeconds    = .5F;
+            const float  audioScrubSeconds     = .08F;
+            const size_t audioProducerTimeout  = 10;
             const size_t videoQueueSize        = 10;
             const size_t realSpeedFrameCount   = 30;
             
@@ -80,12 +93,29 @@ namespace djv
             std::shared_ptr<Observer::ValueSubject<size_t> > audioQueueMax;
             std::shared_ptr<Observer::ValueSubject<size_t> > audioQueueCount;
             std::shared_ptr<AV::IO::IRead> read;
+            bool starved = false;
 
             AV::IO::Direction ioDirection = AV::IO::Direction::Forward;
             std::unique_ptr<RtAudio> rtAudio;
-            std::shared_ptr<Audio::Data> audioData;
-            size_t audioDataSamplesOffset = 0;
-            size_t audioDataSamplesCount = 0;
+            size_t audioOutputRate = 0;
+            std::shared_ptr<AV::IO::IRead> audioRead;
+            std::unique_ptr<Audio::TimeStretch> audioTimeStretch;
+            std::unique_ptr<Audio::Resampler> audioResampler;
+            std::unique_ptr<Audio::RingBuffer> audioOutput;
+            std::vector<Audio::F32_T> audioPending;
+            size_t audioPendingPos = 0;
+            std::vector<Audio::F32_T> audioStretched;
+            std::vector<Audio::F32_T> audioResampled;
+            std::vector<Audio::F32_T> audioFaded;
+            size_t audioOutputLatency = 0;
+            std::atomic<size_t> audioDataSamplesCount;
+            bool audioSync = false;
+            size_t audioScrubSamplesCount = 0;
+            std::atomic<bool> audioScrubFinished;
+            bool audioRunning = true;
+            std::mutex audioMutex;
+            std::condition_variable audioCV;
+            std::thread audioThread;
             Math::Frame::Index frameOffset = 0;
             Time::Duration currentTime = Time::Duration::zero();
             std::chrono::steady_clock::time_point playbackTime;
@@ -96,7 +126,6 @@ namespace djv
             std::shared_ptr<System::Timer> queueTimer;
             std::shared_ptr<System::Timer> realSpeedTimer;
             std::shared_ptr<System::Timer> cacheTimer;
-            std::shared_ptr<System::Timer> debugTimer;
         };
 
         void Media::_init(
@@ -131,6 +160,8 @@ namespace djv
             p.cachedFrames = Observer::ValueSubject<Math::Frame::Sequence>::create();
             p.annotations = Observer::ListSubject<std::shared_ptr<AnnotatePrimitive> >::create();
             p.undoStack = Command::UndoStack::create();
+            p.audioDataSamplesCount = 0;
+            p.audioScrubFinished = false;
             
             p.videoQueueMax = Observer::ValueSubject<size_t>::create();
             p.audioQueueMax = Observer::ValueSubject<size_t>::create();
@@ -155,8 +186,6 @@ namespace djv
             });
             p.cacheTimer = System::Timer::create(context);
             p.cacheTimer->setRepeating(true);
-            p.debugTimer = System::Timer::create(context);
-            p.debugTimer->setRepeating(true);
 
             try
             {
@@ -185,6 +214,44 @@ namespace djv
                         media->_queueUpdate();
                     }
                 });
+
+            // The audio is time stretched and resampled on a separate thread
+            // so the output does not depend on the user interface. The thread
+            // only wakes up while there is audio to produce.
+            p.audioThread = std::thread(
+                [this]
+                {
+                    DJV_PRIVATE_PTR();
+                    std::unique_lock<std::mutex> lock(p.audioMutex);
+                    while (p.audioRunning)
+                    {
+                        if (p.audioSync || p.audioScrubSamplesCount || p.audioPendingPos < p.audioPending.size())
+                        {
+                            p.audioCV.wait_for(
+                                lock,
+                                std::chrono::milliseconds(audioProducerTimeout),
+                                [this]
+                                {
+                                    return !_p->audioRunning;
+                                });
+                        }
+                        else
+                        {
+                            p.audioCV.wait(
+                                lock,
+                                [this]
+                                {
+                                    return !_p->audioRunning ||
+                                        _p->audioSync ||
+                                        _p->audioScrubSamplesCount;
+                                });
+                        }
+                        if (p.audioRunning)
+                        {
+                            _audioUpdate();
+                        }
+                    }
+                });
         }
 
         Media::Media() :
@@ -194,6 +261,15 @@ namespace djv
         Media::~Media()
         {
             DJV_PRIVATE_PTR();
+            {
+                std::unique_lock<std::mutex> lock(p.audioMutex);
+                p.audioRunning = false;
+            }
+            p.audioCV.notify_one();
+            if (p.audioThread.joinable())
+            {
+                p.audioThread.join();
+            }
             p.rtAudio.reset();
         }
 
@@ -406,6 +482,16 @@ namespace djv
             {
                 setPlayback(Playback::Stop);
                 _seek(p.currentFrame->get());
+
+                // Play a short burst of audio while scrubbing.
+                if (_isAudioEnabled())
+                {
+                    {
+                        std::unique_lock<std::mutex> lock(p.audioMutex);
+                        p.audioScrubSamplesCount = static_cast<size_t>(p.audioOutputRate * audioScrubSeconds);
+                    }
+                    _startAudioStream();
+                }
             }
         }
 
@@ -727,6 +813,39 @@ namespace djv
             _p->undoStack->redo();
         }
 
+        void Media::updateDebugInfo()
+        {
+            DJV_PRIVATE_PTR();
+            if (p.read)
+            {
+                bool valid = false;
+                size_t videoQueueMax   = 0;
+                size_t videoQueueCount = 0;
+                size_t audioQueueMax   = 0;
+                size_t audioQueueCount = 0;
+                {
+                    std::unique_lock<std::mutex> lock(p.read->getMutex());
+                    if (lock.owns_lock())
+                    {
+                        valid = true;
+                        const auto& videoQueue = p.read->getVideoQueue();
+                        const auto& audioQueue = p.read->getAudioQueue();
+                        videoQueueMax   = videoQueue.getMax();
+                        videoQueueCount = videoQueue.getCount();
+                        audioQueueMax   = audioQueue.getMax();
+                        audioQueueCount = audioQueue.getCount();
+                    }
+                }
+                if (valid)
+                {
+                    p.videoQueueMax->setAlways(videoQueueMax);
+                    p.videoQueueCount->setAlways(videoQueueCount);
+                    p.audioQueueMax->setAlways(audioQueueMax);
+                    p.audioQueueCount->setAlways(audioQueueCount);
+                }
+            }
+        }
+
         std::shared_ptr<Observer::IValueSubject<size_t> > Media::observeVideoQueueMax() const
         {
             return _p->videoQueueMax;
@@ -747,6 +866,12 @@ namespace djv
             return _p->audioQueueCount;
         }
 
+        std::shared_ptr<AV::IO::Telemetry> Media::getTelemetry() const
+        {
+            DJV_PRIVATE_PTR();
+            return p.read ? p.read->getTelemetry() : nullptr;
+        }
+
         bool Media::_hasAudio() const
         {
             DJV_PRIVATE_PTR();
@@ -756,11 +881,20 @@ namespace djv
         bool Media::_isAudioEnabled() const
         {
             DJV_PRIVATE_PTR();
+            const float speed = _getAudioSpeed();
             return _hasAudio() &&
-                p.speed->get() == p.defaultSpeed->get() &&
+                speed >= Audio::timeStretchSpeedRange.getMin() &&
+                speed <= Audio::timeStretchSpeedRange.getMax() &&
                 !p.playEveryFrame->get();
         }
 
+        float Media::_getAudioSpeed() const
+        {
+            DJV_PRIVATE_PTR();
+            const float defaultSpeed = p.defaultSpeed->get().toFloat();
+            return defaultSpeed > 0.F ? (p.speed->get().toFloat() / defaultSpeed) : 0.F;
+        }
+
         bool Media::_hasAudioSyncPlayback() const
         {
             DJV_PRIVATE_PTR();
@@ -780,8 +914,13 @@ namespace djv
                     AV::IO::ReadOptions options;
                     options.layer = p.layers->get().second;
                     options.videoQueueSize = videoQueueSize;
+                    options.buildIndex = true;
                     auto io = context->getSystemT<AV::IO::IOSystem>();
                     p.read = io->read(p.fileInfo, options);
+                    {
+                        std::unique_lock<std::mutex> lock(p.audioMutex);
+                        p.audioRead = p.read;
+                    }
                     p.read->setThreadCount(p.threadCount->get());
                     p.read->setLoop(true);
                     p.read->setCacheEnabled(p.cacheEnabled);
@@ -827,18 +966,50 @@ namespace djv
                         rtParameters.deviceId = audioSystem->getDefaultOutputDevice();
                         rtParameters.nChannels = p.audioInfo.channelCount;
                         unsigned int rtBufferFrames = audioBufferFrameCount;
+
+                        // Use the sample rate of the file when the device
+                        // supports it, otherwise resample to the preferred
+                        // rate of the device.
+                        p.audioOutputRate = p.audioInfo.sampleRate;
+                        const auto& devices = audioSystem->getDevices();
+                        if (rtParameters.deviceId < devices.size())
+                        {
+                            const auto& device = devices[rtParameters.deviceId];
+                            if (!device.sampleRates.empty() &&
+                                std::find(device.sampleRates.begin(), device.sampleRates.end(), p.audioOutputRate) == device.sampleRates.end() &&
+                                device.preferredSampleRate > 0)
+                            {
+                                p.audioOutputRate = device.preferredSampleRate;
+                            }
+                        }
+                        {
+                            std::unique_lock<std::mutex> lock(p.audioMutex);
+                            p.audioTimeStretch.reset(new Audio::TimeStretch(p.audioInfo.channelCount, p.audioInfo.sampleRate));
+                            p.audioTimeStretch->setSpeed(_getAudioSpeed());
+                            p.audioResampler.reset(p.audioOutputRate != p.audioInfo.sampleRate ?
+                                new Audio::Resampler(p.audioInfo.channelCount, p.audioInfo.sampleRate, p.audioOutputRate) :
+                                nullptr);
+                            p.audioOutput.reset(new Audio::RingBuffer(
+                                p.audioInfo.channelCount,
+                                static_cast<size_t>(p.audioOutputRate * audioOutputSeconds)));
+                            p.audioPending.clear();
+                            p.audioPendingPos = 0;
+                        }
+                        p.audioOutputLatency = 0;
+
                         try
                         {
                             p.rtAudio->openStream(
                                 &rtParameters,
                                 nullptr,
-                                Audio::toRtAudio(p.audioInfo.type),
-                                p.audioInfo.sampleRate,
+                                Audio::toRtAudio(Audio::Type::F32),
+                                p.audioOutputRate,
                                 &rtBufferFrames,
                                 _rtAudioCallback,
                                 this,
                                 nullptr,
                                 _rtAudioErrorCallback);
+                            p.audioOutputLatency = static_cast<size_t>(std::max(p.rtAudio->getStreamLatency(), 0L));
                         }
                         catch (const std::exception& e)
                         {
@@ -871,43 +1042,6 @@ namespace djv
                             }
                         });
 
-                    p.debugTimer->start(
-                        System::getTimerDuration(System::TimerValue::Medium),
-                        [weak](const std::chrono::steady_clock::time_point&, const Time::Duration&)
-                        {
-                            if (auto media = weak.lock())
-                            {
-                                if (media->_p->read)
-                                {
-                                    bool valid = false;
-                                    size_t videoQueueMax   = 0;
-                                    size_t videoQueueCount = 0;
-                                    size_t audioQueueMax   = 0;
-                                    size_t audioQueueCount = 0;
-                                    {
-                                        std::unique_lock<std::mutex> lock(media->_p->read->getMutex());
-                                        if (lock.owns_lock())
-                                        {
-                                            valid = true;
-                                            const auto& videoQueue = media->_p->read->getVideoQueue();
-                                            const auto& audioQueue = media->_p->read->getAudioQueue();
-                                            videoQueueMax   = videoQueue.getMax();
-                                            videoQueueCount = videoQueue.getCount();
-                                            audioQueueMax   = audioQueue.getMax();
-                                            audioQueueCount = audioQueue.getCount();
-                                        }
-                                    }
-                                    if (valid)
-                                    {
-                                        media->_p->videoQueueMax->setAlways(videoQueueMax);
-                                        media->_p->videoQueueCount->setAlways(videoQueueCount);
-                                        media->_p->audioQueueMax->setAlways(audioQueueMax);
-                                        media->_p->audioQueueCount->setAlways(audioQueueCount);
-                                    }
-                                }
-                            }
-                        });
-
                     p.valid = true;
                 }
                 catch (const std::exception& e)
@@ -930,6 +1064,13 @@ namespace djv
             DJV_PRIVATE_PTR();
             if (p.speed->setIfChanged(value))
             {
+                {
+                    std::unique_lock<std::mutex> lock(p.audioMutex);
+                    if (p.audioTimeStretch)
+                    {
+                        p.audioTimeStretch->setSpeed(_getAudioSpeed());
+                    }
+                }
                 _seek(p.currentFrame->get());
                 p.audioEnabled->setIfChanged(_isAudioEnabled());
                 if (_hasAudioSyncPlayback())
@@ -1007,19 +1148,19 @@ namespace djv
             DJV_PRIVATE_PTR();
             if (auto context = p.context.lock())
             {
+                // Stop the audio stream first so the audio callback is not
+                // reading the output while it is cleared.
+                _stopAudioStream();
                 if (p.read)
                 {
                     p.read->seek(value, p.ioDirection);
                 }
-                p.audioData.reset();
-                p.audioDataSamplesOffset = 0;
-                p.audioDataSamplesCount = 0;
+                _audioReset();
                 p.frameOffset = p.currentFrame->get();
                 p.currentTime = Time::Duration::zero();
                 p.realSpeedTime = std::chrono::steady_clock::now();
                 p.realSpeedFrameCount = 0;
                 p.playEveryFrameTime = Time::Duration::zero();
-                _stopAudioStream();
             }
         }
 
@@ -1050,9 +1191,6 @@ namespace djv
                     }
                     p.ioDirection = forward ? AV::IO::Direction::Forward : AV::IO::Direction::Reverse;
                     _seek(p.currentFrame->get());
-                    p.audioData.reset();
-                    p.audioDataSamplesOffset = 0;
-                    p.audioDataSamplesCount = 0;
                     p.frameOffset = p.currentFrame->get();
                     p.currentTime = Time::Duration::zero();
                     p.playbackTime = std::chrono::steady_clock::now();
@@ -1097,12 +1235,16 @@ namespace djv
                 const auto& speed = p.speed->get();
                 if (_hasAudioSyncPlayback())
                 {
-                    if (p.audioDataSamplesCount)
+                    // The samples given to the device are heard after the
+                    // output latency. The resampler and the time stretch are
+                    // aligned with their input so they do not add to it.
+                    const size_t audioDataSamplesCount = p.audioDataSamplesCount;
+                    if (audioDataSamplesCount > p.audioOutputLatency)
                     {
                         Math::Frame::Index frame = p.frameOffset +
                             AV::Time::scale(
-                                p.audioDataSamplesCount,
-                                Math::IntRational(1, static_cast<int>(p.audioInfo.sampleRate)),
+                                audioDataSamplesCount - p.audioOutputLatency,
+                                Math::IntRational(1, static_cast<int>(p.audioOutputRate)),
                                 speed.swap());
                         _setCurrentFrame(frame);
                     }
@@ -1133,6 +1275,11 @@ namespace djv
             DJV_PRIVATE_PTR();
             if (auto context = p.context.lock())
             {
+                {
+                    std::unique_lock<std::mutex> lock(p.audioMutex);
+                    p.audioSync = _hasAudioSyncPlayback();
+                }
+                p.audioCV.notify_one();
                 try
                 {
                     p.rtAudio->startStream();
@@ -1222,6 +1369,14 @@ namespace djv
                         frame = queue.getFrame();
                         gotFrame = true;
                     }
+
+                    // Count each time playback runs out of frames.
+                    const bool starved = playback != Playback::Stop && queue.isEmpty();
+                    if (starved && !p.starved)
+                    {
+                        p.read->getTelemetry()->addStarvation();
+                    }
+                    p.starved = starved;
                 }
                 if (gotFrame)
                 {
@@ -1233,7 +1388,10 @@ namespace djv
                         p.realSpeedTime = now;
                         p.realSpeedFrameCount = 0;
                     }
-                    p.currentImage->setIfChanged(frame.data);
+                    if (p.currentImage->setIfChanged(frame.data))
+                    {
+                        p.read->getTelemetry()->setPresent(frame.frame, std::chrono::steady_clock::now());
+                    }
                     if (p.playEveryFrame->get())
                     {
                         _setCurrentFrame(frame.frame);
@@ -1253,100 +1411,162 @@ namespace djv
             }
         }
         
-        int Media::_rtAudioCallback(
-            void* outputBuffer,
-            void* inputBuffer,
-            unsigned int nFrames,
-            double streamTime,
-            RtAudioStreamStatus status,
-            void* userData)
+        void Media::_audioReset()
         {
-            Media* media = reinterpret_cast<Media*>(userData);
-            const auto& info = media->_p->audioInfo;
-
-            size_t outputSampleCount = static_cast<size_t>(nFrames);
-            size_t sampleCount = 0;
-            const size_t sampleByteCount = info.channelCount * Audio::getByteCount(info.type);
-            const float volume = !media->_p->mute->get() ? media->_p->volume->get() : 0.F;
-
-            if (media->_p->audioData)
+            DJV_PRIVATE_PTR();
+            std::unique_lock<std::mutex> lock(p.audioMutex);
+            if (p.audioTimeStretch)
+            {
+                p.audioTimeStretch->reset();
+            }
+            if (p.audioResampler)
             {
-                sampleCount += media->_p->audioData->getSampleCount() - media->_p->audioDataSamplesOffset;
+                p.audioResampler->reset();
             }
+            if (p.audioOutput)
+            {
+                p.audioOutput->clear();
+            }
+            p.audioPending.clear();
+            p.audioPendingPos = 0;
+            p.audioDataSamplesCount = 0;
+            p.audioSync = false;
+            p.audioScrubSamplesCount = 0;
+            p.audioScrubFinished = false;
+        }
 
-            // Get audio frames from the read queue.
-            std::vector<AV::IO::AudioFrame> frames;
+        void Media::_audioUpdate()
+        {
+            // This is called from the audio thread with the audio mutex
+            // locked.
+            DJV_PRIVATE_PTR();
+            if (!p.audioRead || !p.audioTimeStretch || !p.audioOutput)
+                return;
+            const bool sync = p.audioSync;
+
+            // Time stretch and resample the audio frames from the read queue
+            // until the output is full. This is done here so the audio
+            // callback only needs to copy samples.
+            const uint8_t channelCount = p.audioOutput->getChannelCount();
+            if (p.audioPendingPos < p.audioPending.size())
             {
-                std::lock_guard<std::mutex> lock(media->_p->read->getMutex());
-                auto& queue = media->_p->read->getAudioQueue();
-                while (!queue.isEmpty() && sampleCount < outputSampleCount)
+                const size_t count = p.audioOutput->write(
+                    p.audioPending.data() + p.audioPendingPos,
+                    (p.audioPending.size() - p.audioPendingPos) / channelCount);
+                p.audioPendingPos += count * channelCount;
+                if (p.audioPendingPos >= p.audioPending.size())
                 {
-                    auto frame = queue.getFrame();
-                    frames.push_back(frame);
-                    queue.popFrame();
-                    sampleCount += frame.data->getSampleCount();
+                    p.audioPending.clear();
+                    p.audioPendingPos = 0;
                 }
             }
-
-            // Use the remaining data from the frame.
-            uint8_t* p = reinterpret_cast<uint8_t*>(outputBuffer);
-            if (media->_p->audioData)
+            const size_t scrubSampleCount = static_cast<size_t>(p.audioOutputRate * audioScrubSeconds);
+            while (p.audioPending.empty() &&
+                (sync || p.audioScrubSamplesCount) &&
+                p.audioOutput->getWriteCount() > 0)
             {
-                const size_t size = std::min(
-                    media->_p->audioData->getSampleCount() - media->_p->audioDataSamplesOffset,
-                    outputSampleCount);
-                //memcpy(
-                //    p,
-                //    media->_p->audioData->getData() + media->_p->audioDataSamplesOffset * sampleByteCount,
-                //    size * sampleByteCount);
-                Audio::volume(
-                    media->_p->audioData->getData() + media->_p->audioDataSamplesOffset * sampleByteCount,
-                    p,
-                    volume,
-                    size,
-                    info.channelCount,
-                    info.type);
-                p += size * sampleByteCount;
-                media->_p->audioDataSamplesOffset += size;
-                media->_p->audioDataSamplesCount += size;
-                outputSampleCount -= size;
-                if (media->_p->audioDataSamplesOffset >= media->_p->audioData->getSampleCount())
+                std::shared_ptr<Audio::Data> data;
+                {
+                    std::lock_guard<std::mutex> lock(p.audioRead->getMutex());
+                    auto& queue = p.audioRead->getAudioQueue();
+                    if (!queue.isEmpty())
+                    {
+                        data = queue.popFrame().data;
+                    }
+                }
+                if (!data)
+                    break;
+                if (data->getType() != Audio::Type::F32)
+                {
+                    data = Audio::convert(data, Audio::Type::F32);
+                }
+
+                // The time stretch is bypassed at normal speed. The scratch
+                // buffers keep their capacity between updates.
+                const Audio::F32_T* samples = reinterpret_cast<const Audio::F32_T*>(data->getData());
+                size_t sampleCount = data->getSampleCount();
+                if (p.audioTimeStretch->getSpeed() != 1.F)
+                {
+                    p.audioStretched.clear();
+                    p.audioTimeStretch->process(samples, sampleCount, p.audioStretched);
+                    samples = p.audioStretched.data();
+                    sampleCount = p.audioStretched.size() / channelCount;
+                }
+                if (p.audioResampler)
                 {
-                    media->_p->audioData.reset();
-                    media->_p->audioDataSamplesOffset = 0;
+                    p.audioResampled.clear();
+                    p.audioResampler->process(samples, sampleCount, p.audioResampled);
+                    samples = p.audioResampled.data();
+                    sampleCount = p.audioResampled.size() / channelCount;
+                }
+
+                if (!sync)
+                {
+                    // Fade out the scrub burst so it does not click.
+                    sampleCount = std::min(sampleCount, p.audioScrubSamplesCount);
+                    p.audioFaded.resize(sampleCount * channelCount);
+                    for (size_t i = 0; i < sampleCount; ++i)
+                    {
+                        const float fade = (p.audioScrubSamplesCount - i) / static_cast<float>(scrubSampleCount);
+                        for (uint8_t c = 0; c < channelCount; ++c)
+                        {
+                            p.audioFaded[i * channelCount + c] = samples[i * channelCount + c] * fade;
+                        }
+                    }
+                    samples = p.audioFaded.data();
+                    p.audioScrubSamplesCount -= sampleCount;
                 }
+
+                // Keep the samples that do not fit in the output for the
+                // next update.
+                const size_t count = p.audioOutput->write(samples, sampleCount);
+                p.audioPending.insert(
+                    p.audioPending.end(),
+                    samples + count * channelCount,
+                    samples + sampleCount * channelCount);
             }
 
-            // Process the frames.
-            for (const auto& i : frames)
+            // Let the audio callback stop the stream once the scrub burst has
+            // been played.
+            if (!sync && !p.audioScrubSamplesCount && p.audioPending.empty())
             {
-                media->_p->audioData = i.data;
-                size_t size = std::min(i.data->getSampleCount(), outputSampleCount);
-                //memcpy(
-                //    p,
-                //    i.audio->getData(),
-                //    size * sampleByteCount);
-                Audio::volume(
-                    i.data->getData(),
-                    p,
-                    volume,
-                    size,
-                    info.channelCount,
-                    info.type);
-                p += size * sampleByteCount;
-                media->_p->audioDataSamplesOffset = size;
-                media->_p->audioDataSamplesCount += size;
-                outputSampleCount -= size;
+                p.audioScrubFinished = true;
             }
+        }
+
+        int Media::_rtAudioCallback(
+            void* outputBuffer,
+            void* inputBuffer,
+            unsigned int nFrames,
+            double streamTime,
+            RtAudioStreamStatus status,
+            void* userData)
+        {
+            Media* media = reinterpret_cast<Media*>(userData);
+            const uint8_t channelCount = media->_p->audioOutput->getChannelCount();
+            const float volume = !media->_p->mute->get() ? media->_p->volume->get() : 0.F;
 
-            const size_t zero = (nFrames * sampleByteCount) - (p - reinterpret_cast<uint8_t*>(outputBuffer));
+            // Copy the samples that were prepared by the audio thread.
+            Audio::F32_T* p = reinterpret_cast<Audio::F32_T*>(outputBuffer);
+            const size_t sampleCount = media->_p->audioOutput->read(p, nFrames);
+            Audio::volume(
+                reinterpret_cast<const uint8_t*>(p),
+                reinterpret_cast<uint8_t*>(p),
+                volume,
+                sampleCount,
+                channelCount,
+                Audio::Type::F32);
+            media->_p->audioDataSamplesCount += sampleCount;
+
+            const size_t zero = (nFrames - sampleCount) * channelCount;
             if (zero)
             {
-                //! \todo Is this the correct way to clear the audio data?
-                memset(p, 0, zero);
+                std::fill(p + sampleCount * channelCount, p + nFrames * channelCount, 0.F);
             }
 
-            return 0;
+            // Stop the stream when the scrub burst has been played, the
+            // output that was given to the device is drained first.
+            return zero && media->_p->audioScrubFinished ? 1 : 0;
         }
 
         void Media::_rtAudioErrorCallback(
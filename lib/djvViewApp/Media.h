@@ -24,6 +24,15 @@ namespace djv
         } // namespace Command
     } // namespace Core
 
+    namespace AV
+    {
+        namespace IO
+        {
+            class Telemetry;
+
+        } // namespace IO
+    } // namespace AV
+
     namespace Image
     {
         class Data;
@@ -193,17 +202,25 @@ namespace djv
             //! \name Debugging
             ///@{
 
+            //! Update the queue information. The queues are not polled
+            //! otherwise, so this is called by the debugging tools.
+            void updateDebugInfo();
+
             std::shared_ptr<Core::Observer::IValueSubject<size_t> > observeVideoQueueMax() const;
             std::shared_ptr<Core::Observer::IValueSubject<size_t> > observeAudioQueueMax() const;
             std::shared_ptr<Core::Observer::IValueSubject<size_t> > observeVideoQueueCount() const;
             std::shared_ptr<Core::Observer::IValueSubject<size_t> > observeAudioQueueCount() const;
 
+            //! Get the frame timing telemetry of the reader.
+            std::shared_ptr<AV::IO::Telemetry> getTelemetry() const;
+
             ///@}
 
         private:
             bool _hasAudio() const;
             bool _isAudioEnabled() const;
             bool _hasAudioSyncPlayback() const;
+            float _getAudioSpeed() const;
             void _open();
             void _setSpeed(const Math::IntRational&);
             void _setCurrentFrame(Math::Frame::Index);
@@ -213,6 +230,8 @@ namespace djv
             void _startAudioStream();
             void _stopAudioStream();
             void _queueUpdate();
+            void _audioReset();
+            void _audioUpdate();
 
             static int _rtAudioCallback(
                 void* outputBuffer,
@@ -22,6 +22,8 @@
 #include <djvRender2D/Render.h>
 
 #include <djvAV/AVSystem.h>
+#include <djvAV/Filmstrip.h>
+#include <djvAV/FilmstripSystem.h>
 #include <djvAV/IOSystem.h>
 #include <djvAV/TimeFunc.h>
 
@@ -42,6 +44,8 @@ namespace djv
         {
             System::File::Info fileInfo;
             std::shared_ptr<AV::IO::IRead> read;
+            std::future<std::shared_ptr<AV::Filmstrip> > filmstripFuture;
+            std::shared_ptr<AV::Filmstrip> filmstrip;
             AV::IO::Info info;
             Math::Frame::Sequence sequence;
             Math::IntRational speed;
@@ -95,6 +99,18 @@ namespace djv
                 {
                     if (auto widget = weak.lock())
                     {
+                        // Use the filmstrip instead of the reader when it
+                        // is available.
+                        if (widget->_p->filmstripFuture.valid() &&
+                            widget->_p->filmstripFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+                        {
+                            widget->_p->filmstrip = widget->_p->filmstripFuture.get();
+                            if (widget->_p->filmstrip)
+                            {
+                                widget->_p->read.reset();
+                            }
+                        }
+
                         if (widget->_p->read)
                         {
                             AV::IO::VideoFrame frame;
@@ -114,7 +130,7 @@ namespace djv
                                 widget->_textUpdate();
                             }
                         }
-                        else if (widget->_p->imageWidget->getImage())
+                        else if (!widget->_p->filmstrip && widget->_p->imageWidget->getImage())
                         {
                             widget->_p->currentFrame = 0;
                             widget->_p->image.reset();
@@ -190,6 +206,8 @@ namespace djv
                 if (value == p.fileInfo)
                     return;
                 p.fileInfo = value;
+                p.filmstripFuture = std::future<std::shared_ptr<AV::Filmstrip> >();
+                p.filmstrip.reset();
                 if (!p.fileInfo.isEmpty())
                 {
                     try
@@ -202,6 +220,8 @@ namespace djv
                         const auto info = p.read->getInfo().get();
                         p.speed = info.videoSpeed;
                         p.sequence = info.videoSequence;
+                        auto filmstripSystem = context->getSystemT<AV::FilmstripSystem>();
+                        p.filmstripFuture = filmstripSystem->getFilmstrip(value, info);
                     }
                     catch (const std::exception& e)
                     {
@@ -220,7 +240,14 @@ namespace djv
             DJV_PRIVATE_PTR();
             if (value == p.pipPos && timelineGeometry == p.timelineGeometry)
                 return;
-            if (p.read)
+            if (p.filmstrip)
+            {
+                p.currentFrame = frame;
+                p.image = p.filmstrip->getImage(frame);
+                p.imageWidget->setImage(p.image);
+                _textUpdate();
+            }
+            else if (p.read)
             {
                 p.read->seek(frame, AV::IO::Direction::Forward);
             }
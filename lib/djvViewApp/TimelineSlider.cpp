@@ -20,14 +20,23 @@
 #include <djvRender2D/Render.h>
 
 #include <djvAV/AVSystem.h>
+#include <djvAV/Filmstrip.h>
+#include <djvAV/FilmstripSystem.h>
 #include <djvAV/IOSystem.h>
 #include <djvAV/TimeFunc.h>
+#include <djvAV/WaveformSystem.h>
+
+#include <djvAudio/Waveform.h>
 
 #include <djvSystem/Context.h>
 #include <djvSystem/Timer.h>
 
 #include <djvMath/Math.h>
 
+#include <glm/gtx/matrix_transform_2d.hpp>
+
+#include <map>
+
 using namespace djv::Core;
 
 namespace djv
@@ -47,6 +56,13 @@ namespace djv
             bool cacheEnabled = false;
             Math::Frame::Sequence cacheSequence;
             Math::Frame::Sequence cachedFrames;
+            std::shared_ptr<AV::WaveformSystem> waveformSystem;
+            std::shared_ptr<Audio::Waveform> waveform;
+            std::future<std::shared_ptr<Audio::Waveform> > waveformFuture;
+            std::shared_ptr<AV::FilmstripSystem> filmstripSystem;
+            std::shared_ptr<AV::Filmstrip> filmstrip;
+            std::future<std::shared_ptr<AV::Filmstrip> > filmstripFuture;
+            std::map<size_t, std::shared_ptr<Image::Data> > filmstripImages;
             Render2D::Font::FontInfo fontInfo;
             Render2D::Font::Metrics fontMetrics;
             std::future<Render2D::Font::Metrics> fontMetricsFuture;
@@ -90,9 +106,12 @@ namespace djv
             DJV_PRIVATE_PTR();
 
             setClassName("djv::ViewApp::TimelineSlider");
+            _setUpdateEvents(true);
             setBackgroundRole(UI::ColorRole::Trough);
 
             p.fontSystem = context->getSystemT<Render2D::Font::FontSystem>();
+            p.waveformSystem = context->getSystemT<AV::WaveformSystem>();
+            p.filmstripSystem = context->getSystemT<AV::FilmstripSystem>();
 
             p.pipWidget = TimelinePIPWidget::create(context);
             p.pipOverlay = UI::Layout::Overlay::create(context);
@@ -151,6 +170,11 @@ namespace djv
             if (value == p.media)
                 return;
             p.media = value;
+            p.waveform.reset();
+            p.waveformFuture = std::future<std::shared_ptr<Audio::Waveform> >();
+            p.filmstrip.reset();
+            p.filmstripFuture = std::future<std::shared_ptr<AV::Filmstrip> >();
+            p.filmstripImages.clear();
             if (p.media)
             {
                 auto weak = std::weak_ptr<TimelineSlider>(std::dynamic_pointer_cast<TimelineSlider>(shared_from_this()));
@@ -160,6 +184,23 @@ namespace djv
                 {
                     if (auto widget = weak.lock())
                     {
+                        if (value.audio.isValid() &&
+                            !widget->_p->waveform &&
+                            !widget->_p->waveformFuture.valid() &&
+                            widget->_p->waveformSystem)
+                        {
+                            widget->_p->waveformFuture = widget->_p->waveformSystem->getWaveform(
+                                widget->_p->media->getFileInfo());
+                        }
+                        if (!value.video.empty() &&
+                            !widget->_p->filmstrip &&
+                            !widget->_p->filmstripFuture.valid() &&
+                            widget->_p->filmstripSystem)
+                        {
+                            widget->_p->filmstripFuture = widget->_p->filmstripSystem->getFilmstrip(
+                                widget->_p->media->getFileInfo(),
+                                value);
+                        }
                         widget->_p->speed = value.videoSpeed;
                         widget->_textUpdate();
                         widget->_currentFrameUpdate();
@@ -366,11 +407,42 @@ namespace djv
                 const float m = style->getMetric(UI::MetricsRole::MarginSmall);
                 const float b = style->getMetric(UI::MetricsRole::Border);
                 const Math::BBox2f& hg = _getHandleGeometry();
+                const auto& render = _getRender();
+
+                // Draw the filmstrip.
+                const size_t sequenceFrameCount = p.sequence.getFrameCount();
+                if (p.filmstrip && sequenceFrameCount > 0)
+                {
+                    const auto& info = p.filmstrip->getImageInfo();
+                    const float h = g.h();
+                    const float w = floorf(h * info.getAspectRatio());
+                    if (w >= 1.F)
+                    {
+                        render->pushClipRect(g);
+                        render->setFillColor(Image::Color(1.F, 1.F, 1.F, .5F));
+                        for (float x = g.min.x; x < g.max.x; x += w)
+                        {
+                            const Math::Frame::Index frame = _posToFrame(x - g.min.x + w / 2.F);
+                            const size_t index = frame / p.filmstrip->getStep();
+                            auto i = p.filmstripImages.find(index);
+                            if (i == p.filmstripImages.end())
+                            {
+                                i = p.filmstripImages.insert(std::make_pair(index, p.filmstrip->getImage(frame))).first;
+                            }
+                            glm::mat3x3 m(1.F);
+                            m = glm::translate(m, glm::vec2(x, g.min.y));
+                            m = glm::scale(m, glm::vec2(w / info.size.w, h / info.size.h));
+                            render->pushTransform(m);
+                            render->drawImage(i->second, glm::vec2(0.F, 0.F));
+                            render->popTransform();
+                        }
+                        render->popClipRect();
+                    }
+                }
 
                 // Draw the time ticks.
                 auto color = style->getColor(UI::ColorRole::Foreground);
                 color.setF32(color.getF32(3) * .4F, 3);
-                const auto& render = _getRender();
                 render->setFillColor(color);
                 std::vector<Math::BBox2f> rects;
                 for (const auto& tick : p.timeTicks)
@@ -389,6 +461,59 @@ namespace djv
                 }
                 render->drawRects(rects);
 
+                // Draw the audio waveform.
+                if (p.waveform && p.speed.getNum() > 0 && sequenceFrameCount > 0)
+                {
+                    const double samplesPerFrame =
+                        p.waveform->getSampleRate() * p.speed.getDen() / static_cast<double>(p.speed.getNum());
+                    const size_t sampleCount = std::min(
+                        static_cast<size_t>(sequenceFrameCount * samplesPerFrame),
+                        p.waveform->getSampleCount());
+                    const float x0 = _frameToPos(0);
+                    const float x1 = _frameToPos(sequenceFrameCount);
+                    const size_t width = x1 > x0 ? static_cast<size_t>(x1 - x0) : 0;
+                    if (sampleCount > 0 && width > 0)
+                    {
+                        // Combine the channels into a single waveform with one
+                        // value per pixel.
+                        const Math::SizeTRange range(0, sampleCount - 1);
+                        std::vector<Audio::WaveformSample> samples;
+                        for (uint8_t c = 0; c < p.waveform->getChannelCount(); ++c)
+                        {
+                            const auto channel = p.waveform->getSamples(c, range, width);
+                            if (samples.empty())
+                            {
+                                samples = channel;
+                            }
+                            else
+                            {
+                                for (size_t i = 0; i < samples.size() && i < channel.size(); ++i)
+                                {
+                                    samples[i].min = std::min(samples[i].min, channel[i].min);
+                                    samples[i].max = std::max(samples[i].max, channel[i].max);
+                                }
+                            }
+                        }
+                        auto color = style->getColor(UI::ColorRole::Foreground);
+                        color.setF32(color.getF32(3) * .2F, 3);
+                        render->setFillColor(color);
+                        rects.clear();
+                        const float h = g.h() / 2.F;
+                        const float y = g.min.y + h;
+                        for (size_t i = 0; i < samples.size(); ++i)
+                        {
+                            const float max = std::min(std::max(samples[i].max, -1.F), 1.F);
+                            const float min = std::min(std::max(samples[i].min, -1.F), 1.F);
+                            rects.emplace_back(Math::BBox2f(
+                                x0 + i,
+                                floorf(y - max * h),
+                                1.F,
+                                std::max(ceilf((max - min) * h), 1.F)));
+                        }
+                        render->drawRects(rects);
+                    }
+                }
+
                 // Draw the in/out points.
                 if (p.inOutPointsEnabled)
                 {
@@ -437,7 +562,6 @@ namespace djv
                 }
 
                 // Draw the frame ticks.
-                const size_t sequenceFrameCount = p.sequence.getFrameCount();
                 if (_getFrameLength() > b * 2.F)
                 {
                     auto color = style->getColor(UI::ColorRole::Foreground);
@@ -577,6 +701,33 @@ namespace djv
         void TimelineSlider::_updateEvent(System::Event::Update & event)
         {
             DJV_PRIVATE_PTR();
+            if (p.filmstripFuture.valid() &&
+                p.filmstripFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                try
+                {
+                    p.filmstrip = p.filmstripFuture.get();
+                    p.filmstripImages.clear();
+                    _redraw();
+                }
+                catch (const std::exception & e)
+                {
+                    _log(e.what(), System::LogLevel::Error);
+                }
+            }
+            if (p.waveformFuture.valid() &&
+                p.waveformFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                try
+                {
+                    p.waveform = p.waveformFuture.get();
+                    _redraw();
+                }
+                catch (const std::exception & e)
+                {
+                    _log(e.what(), System::LogLevel::Error);
+                }
+            }
             if (p.fontMetricsFuture.valid() &&
                 p.fontMetricsFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
             {
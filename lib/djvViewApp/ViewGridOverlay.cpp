@@ -50,6 +50,7 @@ namespace djv
         {
             Widget::_init(context);
             DJV_PRIVATE_PTR();
+            _setUpdateEvents(true);
             for (size_t i = 0; i < 26; ++i)
             {
                 p.letters.push_back('A' + i);
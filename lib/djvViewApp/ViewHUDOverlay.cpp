@@ -60,6 +60,7 @@ namespace djv
             DJV_PRIVATE_PTR();
 
             setClassName("djv::ViewApp::HUDOverlay");
+            _setUpdateEvents(true);
 
             p.fontSystem = context->getSystemT<Render2D::Font::FontSystem>();
         }
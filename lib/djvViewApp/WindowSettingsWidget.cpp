@@ -297,6 +297,7 @@ namespace djv
             DJV_PRIVATE_PTR();
 
             setClassName("djv::ViewApp::BackgroundImageSettingsWidget");
+            _setUpdateEvents(true);
 
             p.imageWidget = UI::ImageWidget::create(context);
             p.imageWidget->setMargin(UI::MetricsRole::MarginSmall);
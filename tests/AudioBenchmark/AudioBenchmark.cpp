@@ -0,0 +1,313 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCmdLineApp/Application.h>
+
+#include <djvAudio/Resample.h>
+#include <djvAudio/TimeStretch.h>
+
+#include <djvMath/Math.h>
+#include <djvMath/MathFunc.h>
+
+#include <djvCore/ErrorFunc.h>
+#include <djvCore/RapidJSONFunc.h>
+
+#include <rapidjson/writer.h>
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+using namespace djv;
+
+namespace
+{
+    const float secondsDefault = 10.F;
+    const size_t blockSize = 512;
+
+    const std::vector<uint8_t> channelCountsDefault = { 1, 2, 6 };
+
+    const std::vector<std::pair<size_t, size_t> > ratesDefault =
+    {
+        { 44100, 48000 },
+        { 48000, 44100 },
+        { 48000, 96000 }
+    };
+
+    const std::vector<float> speedsDefault = { .25F, .5F, 1.F, 2.F, 4.F };
+
+    //! This struct provides the results of a benchmark case.
+    struct Result
+    {
+        std::string name;
+        uint8_t     channelCount = 0;
+        size_t      inputRate    = 0;
+        size_t      outputRate   = 0;
+        float       speed        = 1.F;
+        size_t      sampleCount  = 0;
+        float       seconds      = 0.F;
+    };
+
+    std::string toJSONLine(const Result& value)
+    {
+        rapidjson::Document document;
+        document.SetObject();
+        auto& allocator = document.GetAllocator();
+        auto add = [&document, &allocator](const char* name, rapidjson::Value value)
+        {
+            document.AddMember(rapidjson::StringRef(name), value, allocator);
+        };
+        const float audioSeconds = value.inputRate > 0 ? value.sampleCount / static_cast<float>(value.inputRate) : 0.F;
+        const size_t channelSampleCount = value.sampleCount * value.channelCount;
+        add("case", toJSON(value.name, allocator));
+        add("channels", toJSON(static_cast<int>(value.channelCount), allocator));
+        add("input_rate", toJSON(value.inputRate, allocator));
+        add("output_rate", toJSON(value.outputRate, allocator));
+        add("speed", toJSON(value.speed, allocator));
+        add("samples", toJSON(value.sampleCount, allocator));
+        add("seconds", toJSON(value.seconds, allocator));
+        add("realtime", toJSON(value.seconds > 0.F ? audioSeconds / value.seconds : 0.F, allocator));
+        add("ns_per_channel_sample", toJSON(
+            channelSampleCount > 0 ? value.seconds * 1000000000.F / channelSampleCount : 0.F,
+            allocator));
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        document.Accept(writer);
+        return buffer.GetString();
+    }
+
+    //! Create noise mixed with a sine so the time stretch search has
+    //! something to match.
+    std::vector<Audio::F32_T> createInput(uint8_t channelCount, size_t sampleRate, size_t sampleCount)
+    {
+        std::vector<Audio::F32_T> out(sampleCount * channelCount);
+        std::minstd_rand random;
+        std::uniform_real_distribution<float> distribution(-.1F, .1F);
+        for (size_t i = 0; i < sampleCount; ++i)
+        {
+            const float v = .5F * std::sin(Math::pi2 * 440.F * i / static_cast<float>(sampleRate));
+            for (uint8_t c = 0; c < channelCount; ++c)
+            {
+                out[i * channelCount + c] = v + distribution(random);
+            }
+        }
+        return out;
+    }
+
+} // namespace
+
+class Application : public CmdLine::Application
+{
+    DJV_NON_COPYABLE(Application);
+
+protected:
+    void _init(std::list<std::string>&);
+
+    Application();
+
+public:
+    static std::shared_ptr<Application> create(std::list<std::string>&);
+
+    void run() override;
+
+protected:
+    void _parseCmdLine(std::list<std::string>&) override;
+    void _printUsage() override;
+
+private:
+    Result _resample(uint8_t channelCount, size_t inputRate, size_t outputRate);
+    Result _timeStretch(uint8_t channelCount, size_t sampleRate, float speed);
+
+    float _seconds = secondsDefault;
+    std::vector<uint8_t> _channelCounts = channelCountsDefault;
+    std::string _output;
+};
+
+void Application::_init(std::list<std::string>& args)
+{
+    CmdLine::Application::_init(args);
+
+    _parseCmdLine(args);
+}
+
+Application::Application()
+{}
+
+std::shared_ptr<Application> Application::create(std::list<std::string>& args)
+{
+    auto out = std::shared_ptr<Application>(new Application);
+    out->_init(args);
+    return out;
+}
+
+void Application::run()
+{
+    std::ofstream file;
+    if (!_output.empty())
+    {
+        file.open(_output);
+    }
+    std::ostream& out = file.is_open() ? file : std::cout;
+
+    for (const auto channelCount : _channelCounts)
+    {
+        for (const auto& rate : ratesDefault)
+        {
+            out << toJSONLine(_resample(channelCount, rate.first, rate.second)) << std::endl;
+        }
+        for (const auto speed : speedsDefault)
+        {
+            out << toJSONLine(_timeStretch(channelCount, 48000, speed)) << std::endl;
+        }
+    }
+}
+
+void Application::_parseCmdLine(std::list<std::string>& args)
+{
+    CmdLine::Application::_parseCmdLine(args);
+    if (0 == getExitCode())
+    {
+        auto i = args.begin();
+        while (i != args.end())
+        {
+            if ("-seconds" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error("-seconds: Cannot parse the argument.");
+                }
+                float value = 0.F;
+                std::stringstream ss(*i);
+                ss >> value;
+                i = args.erase(i);
+                _seconds = std::max(value, 1.F);
+            }
+            else if ("-channels" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error("-channels: Cannot parse the argument.");
+                }
+                int value = 0;
+                std::stringstream ss(*i);
+                ss >> value;
+                i = args.erase(i);
+                _channelCounts = { static_cast<uint8_t>(Math::clamp(value, 1, 255)) };
+            }
+            else if ("-output" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error("-output: Cannot parse the argument.");
+                }
+                _output = *i;
+                i = args.erase(i);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+        if (args.size())
+        {
+            _printUsage();
+            exit(1);
+        }
+    }
+}
+
+void Application::_printUsage()
+{
+    std::cout << std::endl;
+    std::cout << " Benchmark the audio resampler and time stretch." << std::endl;
+    std::cout << " The results are written as JSON, one line for each case." << std::endl;
+    std::cout << std::endl;
+    std::cout << " Usage:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "   AudioBenchmark [option]..." << std::endl;
+    std::cout << std::endl;
+    std::cout << " Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "   -seconds (value)" << std::endl;
+    std::cout << "   Set the duration of the audio for each case. Default: " << secondsDefault << std::endl;
+    std::cout << std::endl;
+    std::cout << "   -channels (value)" << std::endl;
+    std::cout << "   Use a single channel count." << std::endl;
+    std::cout << std::endl;
+    std::cout << "   -output (file)" << std::endl;
+    std::cout << "   Write the results to a file instead of the standard output." << std::endl;
+    std::cout << std::endl;
+
+    CmdLine::Application::_printUsage();
+}
+
+Result Application::_resample(uint8_t channelCount, size_t inputRate, size_t outputRate)
+{
+    Result out;
+    out.name = "Resampler";
+    out.channelCount = channelCount;
+    out.inputRate = inputRate;
+    out.outputRate = outputRate;
+    out.sampleCount = static_cast<size_t>(_seconds * inputRate);
+    const auto input = createInput(channelCount, inputRate, out.sampleCount);
+    Audio::Resampler resampler(channelCount, inputRate, outputRate);
+    std::vector<Audio::F32_T> output;
+    output.reserve((out.sampleCount * outputRate / inputRate + blockSize) * channelCount);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < out.sampleCount; i += blockSize)
+    {
+        resampler.process(input.data() + i * channelCount, std::min(blockSize, out.sampleCount - i), output);
+    }
+    out.seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    return out;
+}
+
+Result Application::_timeStretch(uint8_t channelCount, size_t sampleRate, float speed)
+{
+    Result out;
+    out.name = "TimeStretch";
+    out.channelCount = channelCount;
+    out.inputRate = sampleRate;
+    out.outputRate = sampleRate;
+    out.speed = speed;
+    out.sampleCount = static_cast<size_t>(_seconds * sampleRate);
+    const auto input = createInput(channelCount, sampleRate, out.sampleCount);
+    Audio::TimeStretch timeStretch(channelCount, sampleRate);
+    timeStretch.setSpeed(speed);
+    std::vector<Audio::F32_T> output;
+    output.reserve(static_cast<size_t>(out.sampleCount / speed + blockSize) * channelCount);
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < out.sampleCount; i += blockSize)
+    {
+        timeStretch.process(input.data() + i * channelCount, std::min(blockSize, out.sampleCount - i), output);
+    }
+    out.seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - start).count();
+    return out;
+}
+
+DJV_MAIN()
+{
+    int r = 1;
+    try
+    {
+        auto args = Application::args(argc, argv);
+        auto app = Application::create(args);
+        if (0 == app->getExitCode())
+        {
+            app->run();
+        }
+        r = app->getExitCode();
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << Core::Error::format(e) << std::endl;
+    }
+    return r;
+}
@@ -0,0 +1,660 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvCmdLineApp/Application.h>
+
+#include <djvAV/DPXFunc.h>
+#include <djvAV/IOSystem.h>
+#include <djvAV/PPMFunc.h>
+#if defined(OpenEXR_FOUND)
+#include <djvAV/OpenEXRFunc.h>
+#endif // OpenEXR_FOUND
+#if defined(TIFF_FOUND)
+#include <djvAV/TIFFFunc.h>
+#endif // TIFF_FOUND
+
+#include <djvImage/Data.h>
+#include <djvImage/InfoFunc.h>
+#include <djvImage/TypeFunc.h>
+
+#include <djvSystem/File.h>
+#include <djvSystem/FileInfoFunc.h>
+#include <djvSystem/PathFunc.h>
+
+#include <djvCore/ErrorFunc.h>
+#include <djvCore/RapidJSONFunc.h>
+
+#include <rapidjson/writer.h>
+
+#if defined(DJV_PLATFORM_WINDOWS)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else // DJV_PLATFORM_WINDOWS
+#include <sys/resource.h>
+#endif // DJV_PLATFORM_WINDOWS
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <thread>
+
+using namespace djv;
+
+// Count the allocations made through operator new. Image data that is
+// allocated by other means (for example memory-mapped files) is not counted.
+namespace
+{
+    std::atomic<size_t> allocationCount(0);
+    std::atomic<size_t> allocationByteCount(0);
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+    allocationByteCount += size;
+    if (void* out = std::malloc(size > 0 ? size : 1))
+    {
+        return out;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+    const size_t frameCountDefault = 24;
+
+    const std::vector<Image::Size> sizesDefault =
+    {
+        Image::Size(640, 360),
+        Image::Size(1920, 1080),
+        Image::Size(3840, 2160)
+    };
+
+    const std::vector<Image::Type> typesDefault =
+    {
+        Image::Type::RGB_U8,
+        Image::Type::RGB_U10,
+        Image::Type::RGB_U16,
+        Image::Type::RGB_F16,
+        Image::Type::RGBA_F32
+    };
+
+    //! Get the peak resident set size of the process in bytes.
+    size_t getPeakRSS()
+    {
+        size_t out = 0;
+#if defined(DJV_PLATFORM_WINDOWS)
+        PROCESS_MEMORY_COUNTERS counters;
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            out = counters.PeakWorkingSetSize;
+        }
+#else // DJV_PLATFORM_WINDOWS
+        struct rusage usage;
+        if (0 == getrusage(RUSAGE_SELF, &usage))
+        {
+#if defined(DJV_PLATFORM_MACOS)
+            out = static_cast<size_t>(usage.ru_maxrss);
+#else // DJV_PLATFORM_MACOS
+            out = static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif // DJV_PLATFORM_MACOS
+        }
+#endif // DJV_PLATFORM_WINDOWS
+        return out;
+    }
+
+    //! Create a test pattern of moving vertical bars, like djv_test_pattern
+    //! but rendered without OpenGL.
+    std::shared_ptr<Image::Data> createTestPattern(const Image::Info& info, size_t frame)
+    {
+        const float background = .5F;
+        const float foreground = 1.F;
+        const uint16_t barWidth = 10;
+        const uint16_t barSpacing = 100;
+        std::vector<float> scanline(static_cast<size_t>(info.size.w) * 4);
+        for (uint16_t x = 0; x < info.size.w; ++x)
+        {
+            const float v = ((x + frame) % barSpacing) < barWidth ? foreground : background;
+            float* p = scanline.data() + x * 4;
+            p[0] = v;
+            p[1] = v;
+            p[2] = v;
+            p[3] = 1.F;
+        }
+        auto out = Image::Data::create(info);
+        for (uint16_t y = 0; y < info.size.h; ++y)
+        {
+            Image::convert(scanline.data(), Image::Type::RGBA_F32, out->getData(y), info.type, info.size.w);
+        }
+        return out;
+    }
+
+    //! This struct provides a benchmark case, a plugin with a set of options.
+    struct Case
+    {
+        std::string pluginName;
+        std::string extension;
+        std::string options;
+        std::function<rapidjson::Value(rapidjson::Document::AllocatorType&)> toJSON;
+    };
+
+    //! This struct provides the results of a benchmark case.
+    struct Result
+    {
+        Case        benchmarkCase;
+        Image::Size size;
+        Image::Type type            = Image::Type::None;
+        size_t      frameCount      = 0;
+        size_t      byteCount       = 0;
+        float       writeSeconds    = 0.F;
+        float       readSeconds     = 0.F;
+        size_t      writeAllocationCount     = 0;
+        size_t      writeAllocationByteCount = 0;
+        size_t      readAllocationCount      = 0;
+        size_t      readAllocationByteCount  = 0;
+        size_t      peakRSS         = 0;
+        std::string error;
+    };
+
+    std::string toJSONLine(const Result& value)
+    {
+        rapidjson::Document document;
+        document.SetObject();
+        auto& allocator = document.GetAllocator();
+        auto add = [&document, &allocator](const char* name, rapidjson::Value value)
+        {
+            document.AddMember(rapidjson::StringRef(name), value, allocator);
+        };
+        const float megabytes = value.byteCount / 1000000.F;
+        add("plugin", toJSON(value.benchmarkCase.pluginName, allocator));
+        add("options", toJSON(value.benchmarkCase.options, allocator));
+        {
+            std::stringstream ss;
+            ss << value.size.w << "x" << value.size.h;
+            add("size", toJSON(ss.str(), allocator));
+        }
+        {
+            std::stringstream ss;
+            ss << value.type;
+            add("type", toJSON(ss.str(), allocator));
+        }
+        add("frames", toJSON(value.frameCount, allocator));
+        add("bytes", toJSON(value.byteCount, allocator));
+        add("write_seconds", toJSON(value.writeSeconds, allocator));
+        add("write_fps", toJSON(value.writeSeconds > 0.F ? value.frameCount / value.writeSeconds : 0.F, allocator));
+        add("write_mbps", toJSON(value.writeSeconds > 0.F ? megabytes / value.writeSeconds : 0.F, allocator));
+        add("write_allocations", toJSON(value.writeAllocationCount, allocator));
+        add("write_allocation_bytes", toJSON(value.writeAllocationByteCount, allocator));
+        add("read_seconds", toJSON(value.readSeconds, allocator));
+        add("read_fps", toJSON(value.readSeconds > 0.F ? value.frameCount / value.readSeconds : 0.F, allocator));
+        add("read_mbps", toJSON(value.readSeconds > 0.F ? megabytes / value.readSeconds : 0.F, allocator));
+        add("read_allocations", toJSON(value.readAllocationCount, allocator));
+        add("read_allocation_bytes", toJSON(value.readAllocationByteCount, allocator));
+        add("peak_rss", toJSON(value.peakRSS, allocator));
+        if (!value.error.empty())
+        {
+            add("error", toJSON(value.error, allocator));
+        }
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        document.Accept(writer);
+        return buffer.GetString();
+    }
+
+} // namespace
+
+class Application : public CmdLine::Application
+{
+    DJV_NON_COPYABLE(Application);
+
+protected:
+    void _init(std::list<std::string>&);
+
+    Application();
+
+public:
+    static std::shared_ptr<Application> create(std::list<std::string>&);
+
+    void run() override;
+
+protected:
+    void _parseCmdLine(std::list<std::string>&) override;
+    void _printUsage() override;
+
+private:
+    std::vector<Case> _getCases() const;
+    Result _run(const Case&, const Image::Size&, Image::Type);
+    void _write(const System::File::Info&, const Image::Info&, Result&);
+    void _read(const System::File::Info&, Result&);
+
+    size_t _frameCount = frameCountDefault;
+    std::vector<Image::Size> _sizes = sizesDefault;
+    std::vector<Image::Type> _types = typesDefault;
+    std::set<std::string> _pluginNames;
+    std::string _output;
+    System::File::Path _tempPath;
+};
+
+void Application::_init(std::list<std::string>& args)
+{
+    CmdLine::Application::_init(args);
+
+    _parseCmdLine(args);
+}
+
+Application::Application()
+{}
+
+std::shared_ptr<Application> Application::create(std::list<std::string>& args)
+{
+    auto out = std::shared_ptr<Application>(new Application);
+    out->_init(args);
+    return out;
+}
+
+void Application::run()
+{
+    _tempPath = System::File::Path(System::File::getTemp(), "IOBenchmark");
+    if (!System::File::Info(_tempPath).doesExist())
+    {
+        System::File::mkdir(_tempPath);
+    }
+
+    std::ofstream file;
+    if (!_output.empty())
+    {
+        file.open(_output);
+    }
+    std::ostream& out = file.is_open() ? file : std::cout;
+
+    // The sizes are run from smallest to largest so that the increases in
+    // peak RSS can be attributed to a case.
+    std::vector<Image::Size> sizes = _sizes;
+    std::sort(
+        sizes.begin(),
+        sizes.end(),
+        [](const Image::Size& a, const Image::Size& b)
+        {
+            return a.w * a.h < b.w * b.h;
+        });
+    for (const auto& size : sizes)
+    {
+        for (const auto& benchmarkCase : _getCases())
+        {
+            for (const auto& type : _types)
+            {
+                out << toJSONLine(_run(benchmarkCase, size, type)) << std::endl;
+            }
+        }
+    }
+}
+
+void Application::_parseCmdLine(std::list<std::string>& args)
+{
+    CmdLine::Application::_parseCmdLine(args);
+    if (0 == getExitCode())
+    {
+        auto i = args.begin();
+        while (i != args.end())
+        {
+            if ("-frame_count" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error("-frame_count: Cannot parse the argument.");
+                }
+                int value = 0;
+                std::stringstream ss(*i);
+                ss >> value;
+                i = args.erase(i);
+                _frameCount = static_cast<size_t>(std::max(value, 1));
+            }
+            else if ("-size" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error("-size: Cannot parse the argument.");
+                }
+                Image::Size value;
+                std::stringstream ss(*i);
+                ss >> value;
+                i = args.erase(i);
+                _sizes = { value };
+            }
+            else if ("-type" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error("-type: Cannot parse the argument.");
+                }
+                Image::Type value = Image::Type::None;
+                std::stringstream ss(*i);
+                ss >> value;
+                i = args.erase(i);
+                _types = { value };
+            }
+            else if ("-plugin" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error("-plugin: Cannot parse the argument.");
+                }
+                _pluginNames.insert(*i);
+                i = args.erase(i);
+            }
+            else if ("-output" == *i)
+            {
+                i = args.erase(i);
+                if (args.end() == i)
+                {
+                    throw std::runtime_error("-output: Cannot parse the argument.");
+                }
+                _output = *i;
+                i = args.erase(i);
+            }
+            else
+            {
+                ++i;
+            }
+        }
+        if (args.size())
+        {
+            _printUsage();
+            exit(1);
+        }
+    }
+}
+
+void Application::_printUsage()
+{
+    std::cout << std::endl;
+    std::cout << " Benchmark the reading and writing of image sequences for each I/O plugin." << std::endl;
+    std::cout << " The results are written as JSON, one line for each case." << std::endl;
+    std::cout << std::endl;
+    std::cout << " Usage:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "   IOBenchmark [option]..." << std::endl;
+    std::cout << std::endl;
+    std::cout << " Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "   -frame_count (value)" << std::endl;
+    std::cout << "   Set the number of frames in each sequence. Default: " << frameCountDefault << std::endl;
+    std::cout << std::endl;
+    std::cout << "   -size \"(width) (height)\"" << std::endl;
+    std::cout << "   Use a single image size." << std::endl;
+    std::cout << std::endl;
+    std::cout << "   -type (value)" << std::endl;
+    std::cout << "   Use a single image type." << std::endl;
+    std::cout << std::endl;
+    std::cout << "   -plugin (value)" << std::endl;
+    std::cout << "   Only run the given plugin. This option may be given more than once." << std::endl;
+    std::cout << std::endl;
+    std::cout << "   -output (file)" << std::endl;
+    std::cout << "   Write the results to a file instead of the standard output." << std::endl;
+    std::cout << std::endl;
+
+    CmdLine::Application::_printUsage();
+}
+
+std::vector<Case> Application::_getCases() const
+{
+    std::vector<Case> out;
+    out.push_back({ "Cineon", ".cin", "", nullptr });
+    for (const auto& endian : AV::IO::DPX::getEndianEnums())
+    {
+        std::stringstream ss;
+        ss << "endian=" << endian;
+        out.push_back({ "DPX", ".dpx", ss.str(),
+            [endian](rapidjson::Document::AllocatorType& allocator)
+            {
+                AV::IO::DPX::Options options;
+                options.endian = endian;
+                return toJSON(options, allocator);
+            } });
+    }
+    for (const auto& data : AV::IO::PPM::getDataEnums())
+    {
+        std::stringstream ss;
+        ss << "data=" << data;
+        out.push_back({ "PPM", ".ppm", ss.str(),
+            [data](rapidjson::Document::AllocatorType& allocator)
+            {
+                AV::IO::PPM::Options options;
+                options.data = data;
+                return toJSON(options, allocator);
+            } });
+    }
+    out.push_back({ "PNG", ".png", "", nullptr });
+    out.push_back({ "JPEG", ".jpg", "", nullptr });
+#if defined(OpenEXR_FOUND)
+    for (const auto& compression : AV::IO::OpenEXR::getCompressionEnums())
+    {
+        std::stringstream ss;
+        ss << "compression=" << compression;
+        out.push_back({ "OpenEXR", ".exr", ss.str(),
+            [compression](rapidjson::Document::AllocatorType& allocator)
+            {
+                AV::IO::OpenEXR::Options options;
+                options.compression = compression;
+                return toJSON(options, allocator);
+            } });
+    }
+#endif // OpenEXR_FOUND
+#if defined(TIFF_FOUND)
+    for (const auto& compression : AV::IO::TIFF::getCompressionEnums())
+    {
+        std::stringstream ss;
+        ss << "compression=" << compression;
+        out.push_back({ "TIFF", ".tif", ss.str(),
+            [compression](rapidjson::Document::AllocatorType& allocator)
+            {
+                AV::IO::TIFF::Options options;
+                options.compression = compression;
+                return toJSON(options, allocator);
+            } });
+    }
+#endif // TIFF_FOUND
+
+    // Remove the plugins that are not available or were not requested.
+    auto io = getSystemT<AV::IO::IOSystem>();
+    const auto pluginNames = io->getPluginNames();
+    auto i = out.begin();
+    while (i != out.end())
+    {
+        if (pluginNames.find(i->pluginName) == pluginNames.end() ||
+            (!_pluginNames.empty() && _pluginNames.find(i->pluginName) == _pluginNames.end()))
+        {
+            i = out.erase(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+    return out;
+}
+
+Result Application::_run(const Case& benchmarkCase, const Image::Size& size, Image::Type type)
+{
+    Result out;
+    out.benchmarkCase = benchmarkCase;
+    out.size = size;
+    out.type = type;
+    out.frameCount = _frameCount;
+    try
+    {
+        auto io = getSystemT<AV::IO::IOSystem>();
+        if (benchmarkCase.toJSON)
+        {
+            rapidjson::Document document;
+            io->setOptions(benchmarkCase.pluginName, benchmarkCase.toJSON(document.GetAllocator()));
+        }
+
+        const Image::Info info(size, type);
+        const System::File::Info fileInfo(
+            System::File::Path(_tempPath, "IOBenchmark.1" + benchmarkCase.extension),
+            System::File::Type::Sequence,
+            Math::Frame::Sequence(1, static_cast<Math::Frame::Number>(_frameCount)));
+        _write(fileInfo, info, out);
+        _read(fileInfo, out);
+
+        for (size_t i = 0; i < _frameCount; ++i)
+        {
+            std::remove(fileInfo.getFileName(static_cast<Math::Frame::Number>(i + 1)).c_str());
+        }
+    }
+    catch (const std::exception& e)
+    {
+        out.error = e.what();
+    }
+    out.peakRSS = getPeakRSS();
+    return out;
+}
+
+void Application::_write(const System::File::Info& fileInfo, const Image::Info& info, Result& result)
+{
+    auto io = getSystemT<AV::IO::IOSystem>();
+    AV::IO::Info ioInfo;
+    ioInfo.video.push_back(info);
+    if (!io->canWrite(fileInfo, ioInfo))
+    {
+        throw std::runtime_error("Cannot write the image type.");
+    }
+
+    // Create the images before starting the timer so that only the plugin
+    // is measured.
+    std::vector<std::shared_ptr<Image::Data> > images;
+    for (size_t i = 0; i < _frameCount; ++i)
+    {
+        images.push_back(createTestPattern(info, i));
+    }
+
+    const size_t allocationCountStart = allocationCount;
+    const size_t allocationByteCountStart = allocationByteCount;
+    const auto start = std::chrono::steady_clock::now();
+    auto write = io->write(fileInfo, ioInfo);
+    size_t frame = 0;
+    while (write->isRunning())
+    {
+        if (frame < images.size())
+        {
+            std::lock_guard<std::mutex> lock(write->getMutex());
+            auto& queue = write->getVideoQueue();
+            while (frame < images.size() && queue.getCount() < queue.getMax())
+            {
+                queue.addFrame(AV::IO::VideoFrame(static_cast<Math::Frame::Number>(frame), images[frame]));
+                ++frame;
+            }
+            if (frame >= images.size())
+            {
+                queue.setFinished(true);
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    const std::chrono::duration<float> duration = std::chrono::steady_clock::now() - start;
+    result.writeSeconds = duration.count();
+    result.writeAllocationCount = allocationCount - allocationCountStart;
+    result.writeAllocationByteCount = allocationByteCount - allocationByteCountStart;
+}
+
+void Application::_read(const System::File::Info& fileInfo, Result& result)
+{
+    auto io = getSystemT<AV::IO::IOSystem>();
+    const size_t allocationCountStart = allocationCount;
+    const size_t allocationByteCountStart = allocationByteCount;
+    const auto start = std::chrono::steady_clock::now();
+    auto read = io->read(fileInfo);
+    read->setCacheEnabled(false);
+    read->setPlayback(true);
+    size_t frameCount = 0;
+    bool finished = false;
+    while (!finished)
+    {
+        {
+            std::lock_guard<std::mutex> lock(read->getMutex());
+            auto& queue = read->getVideoQueue();
+            while (!queue.isEmpty())
+            {
+                const auto frame = queue.popFrame();
+                if (frame.data)
+                {
+                    result.byteCount += frame.data->getDataByteCount();
+                    ++frameCount;
+                }
+            }
+            finished = queue.isFinished();
+        }
+        if (!finished)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+    const std::chrono::duration<float> duration = std::chrono::steady_clock::now() - start;
+    result.readSeconds = duration.count();
+    result.readAllocationCount = allocationCount - allocationCountStart;
+    result.readAllocationByteCount = allocationByteCount - allocationByteCountStart;
+    if (frameCount != _frameCount)
+    {
+        std::stringstream ss;
+        ss << "Read " << frameCount << " of " << _frameCount << " frames.";
+        throw std::runtime_error(ss.str());
+    }
+}
+
+DJV_MAIN()
+{
+    int r = 1;
+    try
+    {
+        auto args = Application::args(argc, argv);
+        auto app = Application::create(args);
+        if (0 == app->getExitCode())
+        {
+            app->run();
+        }
+        r = app->getExitCode();
+    }
+    catch (const std::exception& e)
+    {
+        std::cout << Core::Error::format(e) << std::endl;
+    }
+    return r;
+}
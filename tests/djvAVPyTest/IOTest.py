@@ -0,0 +1,61 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2020 Darby Johnston
+# All rights reserved.
+
+import djvAVPy as av
+import djvAVPy.Image as i
+import djvAVPy.IO as io
+
+import numpy
+import os
+import tempfile
+import unittest
+
+class IOTest(unittest.TestCase):
+
+    def setUp(self):
+        self.context = av.Context.create("IOTest")
+        av.AVSystem.create(self.context)
+        self.io = io.IOSystem.get(self.context)
+
+    def test_plugins(self):
+        self.assertTrue("PPM" in self.io.getPluginNames())
+        self.assertTrue(".ppm" in self.io.getFileExtensions())
+
+    def test_readWrite(self):
+        imageInfo = i.Info(32, 16, i.Type.RGB_U8)
+        info = io.Info()
+        info.video = [imageInfo]
+        tempDir = tempfile.mkdtemp()
+        fileName = os.path.join(tempDir, "IOTest.1-10.ppm")
+        self.assertTrue(self.io.canWrite(fileName, info))
+
+        write = self.io.write(fileName, info)
+        for frame in range(0, 10):
+            data = i.Data.create(imageInfo)
+            numpy.array(data, copy=False)[...] = frame + 1
+            write.writeFrame(frame, data)
+        write.finish()
+
+        read = self.io.read(fileName)
+        self.assertEqual(read.getInfo().getVideoFrameCount(), 10)
+        frames = []
+        for frame, data in read.readFrames(2, 5):
+            a = numpy.array(data, copy=False)
+            self.assertEqual(a.shape, (16, 32, 3))
+            self.assertTrue((a == frame + 1).all())
+            frames.append(frame)
+        self.assertEqual(frames, [2, 3, 4, 5])
+
+        it = read.readFrames(0, 9)
+        frames = [frame for frame, data in it]
+        self.assertEqual(frames, list(range(0, 10)))
+        with self.assertRaises(StopIteration):
+            next(it)
+
+        for frame in range(1, 11):
+            os.remove(os.path.join(tempDir, "IOTest.%d.ppm" % frame))
+        os.rmdir(tempDir)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,45 @@
+# SPDX-License-Identifier: BSD-3-Clause
+# Copyright (c) 2020 Darby Johnston
+# All rights reserved.
+
+import djvAVPy.Image as i
+
+import numpy
+import unittest
+
+class ImageTest(unittest.TestCase):
+
+    def test_info(self):
+        info = i.Info(64, 32, i.Type.RGB_U8)
+        self.assertEqual(info.size.w, 64)
+        self.assertEqual(info.size.h, 32)
+        self.assertEqual(info.type, i.Type.RGB_U8)
+        self.assertEqual(info.getDataByteCount(), 64 * 32 * 3)
+        self.assertEqual(i.getChannelCount(i.Type.RGBA_F16), 4)
+
+    def test_buffer(self):
+        for t, dtype in [
+            (i.Type.L_U8, numpy.uint8),
+            (i.Type.RGB_U16, numpy.uint16),
+            (i.Type.RGBA_F16, numpy.float16),
+            (i.Type.RGBA_F32, numpy.float32)]:
+            data = i.Data.create(i.Info(16, 8, t))
+            a = numpy.array(data, copy=False)
+            self.assertEqual(a.shape, (8, 16, i.getChannelCount(t)))
+            self.assertEqual(a.dtype, dtype)
+
+            # The array shares the memory with the image.
+            a[...] = 1
+            b = numpy.array(data, copy=False)
+            self.assertTrue((b == 1).all())
+            data.zero()
+            self.assertTrue((a == 0).all())
+
+    def test_u10(self):
+        data = i.Data.create(i.Info(16, 8, i.Type.RGB_U10))
+        a = numpy.array(data, copy=False)
+        self.assertEqual(a.shape, (8, 16))
+        self.assertEqual(a.dtype, numpy.uint32)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -10,6 +10,12 @@
 
 #include <libavutil/error.h>
 
+extern "C"
+{
+#include <libswscale/swscale.h>
+
+} // extern "C"
+
 using namespace djv::Core;
 using namespace djv::AV;
 using namespace djv::AV::IO;
@@ -90,6 +96,39 @@ namespace djv
                 FFmpeg::extractAudio(p, i, 4, out);
             }
             
+            {
+                DJV_ASSERT(Image::Type::RGB_U8 == FFmpeg::toImageType(AV_PIX_FMT_YUV420P));
+                DJV_ASSERT(Image::Type::RGB_U8 == FFmpeg::toImageType(AV_PIX_FMT_YUV422P10));
+                DJV_ASSERT(Image::Type::RGBA_U8 == FFmpeg::toImageType(AV_PIX_FMT_YUVA420P));
+                DJV_ASSERT(Image::Type::RGBA_U8 == FFmpeg::toImageType(AV_PIX_FMT_YUVA444P12));
+                DJV_ASSERT(Image::Type::RGB_U8 == FFmpeg::toImageType(AV_PIX_FMT_RGB24));
+                DJV_ASSERT(Image::Type::RGBA_U8 == FFmpeg::toImageType(AV_PIX_FMT_RGBA));
+                DJV_ASSERT(Image::Type::L_U8 == FFmpeg::toImageType(AV_PIX_FMT_GRAY8));
+                DJV_ASSERT(Image::Type::L_U16 == FFmpeg::toImageType(AV_PIX_FMT_GRAY10));
+                DJV_ASSERT(Image::Type::LA_U8 == FFmpeg::toImageType(AV_PIX_FMT_YA8));
+                DJV_ASSERT(Image::Type::RGBA_U8 == FFmpeg::toImageType(AV_PIX_FMT_NONE));
+                for (const auto i : {
+                    Image::Type::L_U8,
+                    Image::Type::L_U16,
+                    Image::Type::LA_U8,
+                    Image::Type::LA_U16,
+                    Image::Type::RGB_U8,
+                    Image::Type::RGBA_U8 })
+                {
+                    DJV_ASSERT(i == FFmpeg::toImageType(FFmpeg::fromImageType(i)));
+                }
+                DJV_ASSERT(AV_PIX_FMT_RGB48 == FFmpeg::fromImageType(Image::Type::RGB_U16));
+                DJV_ASSERT(AV_PIX_FMT_RGBA64 == FFmpeg::fromImageType(Image::Type::RGBA_U16));
+                DJV_ASSERT(AV_PIX_FMT_NONE == FFmpeg::fromImageType(Image::Type::RGBA_F32));
+            }
+
+            {
+                DJV_ASSERT(SWS_CS_ITU709 == FFmpeg::toSwsColorspace(AVCOL_SPC_BT709, 480));
+                DJV_ASSERT(SWS_CS_BT2020 == FFmpeg::toSwsColorspace(AVCOL_SPC_BT2020_NCL, 2160));
+                DJV_ASSERT(SWS_CS_ITU601 == FFmpeg::toSwsColorspace(AVCOL_SPC_UNSPECIFIED, 480));
+                DJV_ASSERT(SWS_CS_ITU709 == FFmpeg::toSwsColorspace(AVCOL_SPC_UNSPECIFIED, 1080));
+            }
+
             for (const auto i : {
                 AVERROR_EOF,
                 AVERROR_EXIT,
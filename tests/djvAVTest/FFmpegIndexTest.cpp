@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/FFmpegIndexTest.h>
+
+#include <djvAV/FFmpegFunc.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/TextSystem.h>
+
+#include <djvCore/ErrorFunc.h>
+
+#include <limits>
+
+using namespace djv::Core;
+using namespace djv::AV;
+using namespace djv::AV::IO;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        FFmpegIndexTest::FFmpegIndexTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AVTest::FFmpegIndexTest", tempPath, context)
+        {}
+
+        void FFmpegIndexTest::run()
+        {
+            _index();
+            _keyframe();
+            _io();
+        }
+
+        namespace
+        {
+            // Packets in decoding order with two groups of pictures that
+            // have B-frames.
+            std::vector<FFmpeg::IndexPacket> getPackets()
+            {
+                std::vector<FFmpeg::IndexPacket> out;
+                const std::vector<std::pair<int64_t, bool> > data =
+                {
+                    { 0, true }, { 30, false }, { 10, false }, { 20, false },
+                    { 40, true }, { 70, false }, { 50, false }, { 60, false }
+                };
+                for (const auto& i : data)
+                {
+                    FFmpeg::IndexPacket packet;
+                    packet.pts = i.first;
+                    packet.keyframe = i.second;
+                    out.push_back(packet);
+                }
+                return out;
+            }
+
+        } // namespace
+
+        void FFmpegIndexTest::_index()
+        {
+            {
+                const FFmpeg::Index index;
+                DJV_ASSERT(index.isEmpty());
+                DJV_ASSERT(0 == index.getKeyframeCount());
+                FFmpeg::IndexPacket packet;
+                DJV_ASSERT(!index.getKeyframe(0, packet));
+            }
+            {
+                const FFmpeg::Index index("/tmp/a.mov", 1000, 1, getPackets());
+                DJV_ASSERT(!index.isEmpty());
+                DJV_ASSERT("/tmp/a.mov" == index.getFileName());
+                DJV_ASSERT(1000 == index.getFileSize());
+                DJV_ASSERT(1 == index.getFileTime());
+                DJV_ASSERT(8 == index.getPackets().size());
+                DJV_ASSERT(2 == index.getKeyframeCount());
+                for (size_t i = 1; i < index.getPackets().size(); ++i)
+                {
+                    DJV_ASSERT(index.getPackets()[i - 1].pts < index.getPackets()[i].pts);
+                }
+                DJV_ASSERT(index == FFmpeg::Index("/tmp/a.mov", 1000, 1, getPackets()));
+                DJV_ASSERT(!(index == FFmpeg::Index("/tmp/a.mov", 1001, 1, getPackets())));
+                DJV_ASSERT(!(index == FFmpeg::Index("/tmp/b.mov", 1000, 1, getPackets())));
+            }
+            {
+                // The index is only valid for the file it was built from.
+                const System::File::Path path(getTempPath(), "FFmpegIndexTest.mov");
+                {
+                    auto io = System::File::IO::create();
+                    io->open(path.get(), System::File::Mode::Write);
+                    io->write(std::string("FFmpegIndexTest"));
+                }
+                const System::File::Info fileInfo(path);
+                const FFmpeg::Index index(fileInfo.getFileName(), fileInfo.getSize(), fileInfo.getTime(), getPackets());
+                DJV_ASSERT(index.isValid(fileInfo));
+                const System::File::Path path2(getTempPath(), "FFmpegIndexTest2.mov");
+                {
+                    auto io = System::File::IO::create();
+                    io->open(path2.get(), System::File::Mode::Write);
+                    io->write(std::string("FFmpegIndexTest"));
+                }
+                const System::File::Info fileInfo2(path2);
+                DJV_ASSERT(!FFmpeg::Index(
+                    fileInfo.getFileName(),
+                    fileInfo2.getSize(),
+                    fileInfo2.getTime(),
+                    getPackets()).isValid(fileInfo2));
+            }
+        }
+
+        void FFmpegIndexTest::_keyframe()
+        {
+            const FFmpeg::Index index("/tmp/a.mov", 1000, 1, getPackets());
+            FFmpeg::IndexPacket packet;
+            DJV_ASSERT(!index.getKeyframe(-1, packet));
+            DJV_ASSERT(index.getKeyframe(0, packet));
+            DJV_ASSERT(0 == packet.pts);
+            DJV_ASSERT(index.getKeyframe(30, packet));
+            DJV_ASSERT(0 == packet.pts);
+            DJV_ASSERT(index.getKeyframe(40, packet));
+            DJV_ASSERT(40 == packet.pts);
+            DJV_ASSERT(packet.keyframe);
+            DJV_ASSERT(index.getKeyframe(1000, packet));
+            DJV_ASSERT(40 == packet.pts);
+
+            DJV_ASSERT(index.isSameGroup(0, 30));
+            DJV_ASSERT(index.isSameGroup(40, 1000));
+            DJV_ASSERT(!index.isSameGroup(30, 40));
+            DJV_ASSERT(!index.isSameGroup(-1, 0));
+        }
+
+        void FFmpegIndexTest::_io()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto textSystem = context->getSystemT<System::TextSystem>();
+                const FFmpeg::Index index("/tmp/a.mov", 1000, 1, getPackets());
+                const System::File::Path path(getTempPath(), "FFmpegIndexTest.index");
+                {
+                    auto io = System::File::IO::create();
+                    io->open(path.get(), System::File::Mode::Write);
+                    FFmpeg::writeIndex(io, index);
+                }
+                {
+                    auto io = System::File::IO::create();
+                    io->open(path.get(), System::File::Mode::Read);
+                    DJV_ASSERT(index == FFmpeg::readIndex(io, textSystem));
+                }
+
+                try
+                {
+                    auto io = System::File::IO::create();
+                    io->open(path.get(), System::File::Mode::Write);
+                    io->write(std::string("djvFFmpegIndex"));
+                    io->writeU32(0);
+                    io->close();
+                    io->open(path.get(), System::File::Mode::Read);
+                    FFmpeg::readIndex(io, textSystem);
+                    DJV_ASSERT(false);
+                }
+                catch (const std::exception& e)
+                {
+                    _print(Error::format(e.what()));
+                }
+
+                try
+                {
+                    // A packet count that would overflow the size check.
+                    auto io = System::File::IO::create();
+                    io->open(path.get(), System::File::Mode::Write);
+                    io->write(std::string("djvFFmpegIndex"));
+                    io->writeU32(2);
+                    io->writeU32(0);
+                    const uint64_t fileSize = 0;
+                    const int64_t fileTime = 0;
+                    const uint64_t count = std::numeric_limits<uint64_t>::max() / 9 + 1;
+                    io->write(&fileSize, 1, sizeof(uint64_t));
+                    io->write(&fileTime, 1, sizeof(int64_t));
+                    io->write(&count, 1, sizeof(uint64_t));
+                    io->close();
+                    io->open(path.get(), System::File::Mode::Read);
+                    FFmpeg::readIndex(io, textSystem);
+                    DJV_ASSERT(false);
+                }
+                catch (const std::exception& e)
+                {
+                    _print(Error::format(e.what()));
+                }
+            }
+
+            {
+                const System::File::Path directory(getTempPath(), "FFmpegIndex");
+                const System::File::Info a(System::File::Path(getTempPath(), "a.mov"));
+                const System::File::Info b(System::File::Path(getTempPath(), "b.mov"));
+                DJV_ASSERT(FFmpeg::getIndexPath(directory, a) == FFmpeg::getIndexPath(directory, a));
+                DJV_ASSERT(!(FFmpeg::getIndexPath(directory, a) == FFmpeg::getIndexPath(directory, b)));
+            }
+        }
+
+    } // namespace AVTest
+} // namespace djv
+
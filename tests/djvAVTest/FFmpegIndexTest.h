@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AVTest
+    {
+        class FFmpegIndexTest : public Test::ITest
+        {
+        public:
+            FFmpegIndexTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+
+            void run() override;
+
+        private:
+            void _index();
+            void _keyframe();
+            void _io();
+        };
+
+    } // namespace AVTest
+} // namespace djv
+
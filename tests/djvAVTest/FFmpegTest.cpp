@@ -0,0 +1,300 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/FFmpegTest.h>
+
+#include <djvAV/FFmpeg.h>
+#include <djvAV/FFmpegDecoder.h>
+#include <djvAV/FFmpegFunc.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/LogSystem.h>
+#include <djvSystem/ResourceSystem.h>
+#include <djvSystem/TextSystem.h>
+#include <djvSystem/TimerFunc.h>
+
+#include <djvMath/FrameNumberFunc.h>
+
+#include <djvCore/ErrorFunc.h>
+#include <djvCore/Memory.h>
+
+extern "C"
+{
+#include <libavformat/avformat.h>
+
+} // extern "C"
+
+#include <thread>
+
+using namespace djv::Core;
+using namespace djv::AV;
+using namespace djv::AV::IO;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        namespace
+        {
+            const int frameCount = 10;
+            const Math::IntRational speed(24, 1);
+            const Image::Size size(16, 16);
+
+            //! Get the pixel value for a frame of the test movie.
+            uint8_t getPixel(Math::Frame::Number frame)
+            {
+                return static_cast<uint8_t>(frame * 10);
+            }
+
+            //! Write a test movie where the pixels of each frame are set to
+            //! getPixel(). The frames are uncompressed so every frame is a
+            //! keyframe.
+            void writeMovie(const std::string& fileName)
+            {
+                AVFormatContext* avFormatContext = nullptr;
+                AVCodecContext* avCodecContext = nullptr;
+                AVFrame* avFrame = nullptr;
+                AVPacket* avPacket = nullptr;
+                int r = avformat_alloc_output_context2(&avFormatContext, nullptr, "nut", fileName.c_str());
+                AVCodec* avCodec = avcodec_find_encoder(AV_CODEC_ID_RAWVIDEO);
+                AVStream* avStream = nullptr;
+                if (r >= 0 && avCodec)
+                {
+                    avStream = avformat_new_stream(avFormatContext, nullptr);
+                    avCodecContext = avcodec_alloc_context3(avCodec);
+                    avCodecContext->width = size.w;
+                    avCodecContext->height = size.h;
+                    avCodecContext->pix_fmt = AV_PIX_FMT_RGB24;
+                    avCodecContext->time_base.num = speed.getDen();
+                    avCodecContext->time_base.den = speed.getNum();
+                    avStream->time_base = avCodecContext->time_base;
+                    r = avcodec_open2(avCodecContext, avCodec, nullptr);
+                }
+                if (r >= 0 && avStream)
+                {
+                    r = avcodec_parameters_from_context(avStream->codecpar, avCodecContext);
+                }
+                if (r >= 0 && avStream)
+                {
+                    r = avio_open(&avFormatContext->pb, fileName.c_str(), AVIO_FLAG_WRITE);
+                }
+                if (r >= 0 && avStream)
+                {
+                    r = avformat_write_header(avFormatContext, nullptr);
+                }
+                if (r >= 0 && avStream)
+                {
+                    avFrame = av_frame_alloc();
+                    avFrame->format = AV_PIX_FMT_RGB24;
+                    avFrame->width = size.w;
+                    avFrame->height = size.h;
+                    r = av_frame_get_buffer(avFrame, 0);
+                    avPacket = av_packet_alloc();
+                    for (int i = 0; r >= 0 && i <= frameCount; ++i)
+                    {
+                        if (i < frameCount)
+                        {
+                            for (int y = 0; y < size.h; ++y)
+                            {
+                                memset(avFrame->data[0] + y * avFrame->linesize[0], getPixel(i), size.w * 3);
+                            }
+                            avFrame->pts = i;
+                        }
+                        r = avcodec_send_frame(avCodecContext, i < frameCount ? avFrame : nullptr);
+                        while (r >= 0)
+                        {
+                            r = avcodec_receive_packet(avCodecContext, avPacket);
+                            if (r >= 0)
+                            {
+                                av_packet_rescale_ts(avPacket, avCodecContext->time_base, avStream->time_base);
+                                avPacket->stream_index = avStream->index;
+                                r = av_interleaved_write_frame(avFormatContext, avPacket);
+                            }
+                        }
+                        if (AVERROR(EAGAIN) == r || AVERROR_EOF == r)
+                        {
+                            r = 0;
+                        }
+                    }
+                }
+                if (r >= 0 && avStream)
+                {
+                    r = av_write_trailer(avFormatContext);
+                }
+                if (avPacket)
+                {
+                    av_packet_free(&avPacket);
+                }
+                if (avFrame)
+                {
+                    av_frame_free(&avFrame);
+                }
+                if (avCodecContext)
+                {
+                    avcodec_free_context(&avCodecContext);
+                }
+                if (avFormatContext)
+                {
+                    if (avFormatContext->pb)
+                    {
+                        avio_closep(&avFormatContext->pb);
+                    }
+                    avformat_free_context(avFormatContext);
+                }
+                if (r < 0 || !avStream)
+                {
+                    throw std::runtime_error(fileName + ": " + FFmpeg::getErrorString(r));
+                }
+            }
+
+        } // namespace
+
+        FFmpegTest::FFmpegTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AVTest::FFmpegTest", tempPath, context)
+        {}
+
+        void FFmpegTest::run()
+        {
+            _fileName = System::File::Path(getTempPath(), "FFmpegTest.nut").get();
+            try
+            {
+                writeMovie(_fileName);
+                _decoder();
+                _cache();
+            }
+            catch (const std::exception& e)
+            {
+                _print(Error::format(e));
+            }
+        }
+
+        void FFmpegTest::_decoder()
+        {
+            {
+                // Decode all of the frames.
+                auto decoder = FFmpeg::Decoder::create(_fileName, -1, speed, 1);
+                DJV_ASSERT(size == decoder->getInfo().size);
+                DJV_ASSERT(Image::Type::RGB_U8 == decoder->getInfo().type);
+                Math::Frame::Number frame = Math::Frame::invalid;
+                for (int i = 0; i < frameCount; ++i)
+                {
+                    DJV_ASSERT(decoder->decode(frame));
+                    DJV_ASSERT(i == frame);
+                    const auto image = decoder->getImage();
+                    DJV_ASSERT(size == image->getSize());
+                    DJV_ASSERT(getPixel(i) == image->getData()[0]);
+                    DJV_ASSERT(getPixel(i) == image->getData()[image->getDataByteCount() - 1]);
+                }
+                DJV_ASSERT(!decoder->decode(frame));
+
+                // Seek back to a frame, every frame is a keyframe.
+                DJV_ASSERT(decoder->seek(5));
+                DJV_ASSERT(decoder->decode(frame));
+                DJV_ASSERT(5 == frame);
+                DJV_ASSERT(getPixel(5) == decoder->getImage()->getData()[0]);
+            }
+
+            {
+                // Scale and convert the images.
+                auto decoder = FFmpeg::Decoder::create(_fileName, -1, speed, 1, Image::Size(8, 8), Image::Type::L_U8);
+                DJV_ASSERT(Image::Size(8, 8) == decoder->getInfo().size);
+                DJV_ASSERT(Image::Type::L_U8 == decoder->getInfo().type);
+                Math::Frame::Number frame = Math::Frame::invalid;
+                DJV_ASSERT(decoder->decode(frame));
+                const auto image = decoder->getImage();
+                DJV_ASSERT(Image::Size(8, 8) == image->getSize());
+                DJV_ASSERT(Image::Type::L_U8 == image->getType());
+            }
+
+            {
+                // Use the index for the groups of pictures.
+                std::atomic<bool> running(true);
+                const auto index = std::make_shared<FFmpeg::Index>(
+                    FFmpeg::buildIndex(System::File::Info(_fileName), 0, running));
+                DJV_ASSERT(static_cast<size_t>(frameCount) == index->getKeyframeCount());
+                auto decoder = FFmpeg::Decoder::create(_fileName, -1, speed, 1);
+                DJV_ASSERT(!decoder->isSameGroup(1, 1, nullptr));
+                DJV_ASSERT(decoder->isSameGroup(1, 1, index));
+                DJV_ASSERT(!decoder->isSameGroup(1, 2, index));
+                DJV_ASSERT(decoder->seek(7, index));
+                Math::Frame::Number frame = Math::Frame::invalid;
+                DJV_ASSERT(decoder->decode(frame));
+                DJV_ASSERT(7 == frame);
+            }
+
+            try
+            {
+                FFmpeg::Decoder::create(System::File::Path(getTempPath(), "FFmpegTest.none").get(), -1, speed, 1);
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception& e)
+            {
+                _print(Error::format(e));
+            }
+        }
+
+        void FFmpegTest::_cache()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto read = FFmpeg::Read::create(
+                    System::File::Info(_fileName),
+                    ReadOptions(),
+                    FFmpeg::Options(),
+                    context->getSystemT<System::TextSystem>(),
+                    context->getSystemT<System::ResourceSystem>(),
+                    context->getSystemT<System::LogSystem>());
+                const auto info = read->getInfo().get();
+                DJV_ASSERT(1 == info.video.size());
+                DJV_ASSERT(read->hasCache());
+
+                // Wait for the cache thread to decode the frames.
+                auto waitForCache = [read](const Math::Frame::Sequence& value)
+                {
+                    const auto start = std::chrono::steady_clock::now();
+                    while (read->getCachedFrames() != value)
+                    {
+                        const std::chrono::duration<float> duration = std::chrono::steady_clock::now() - start;
+                        if (duration.count() > 10.F)
+                        {
+                            return false;
+                        }
+                        std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                    }
+                    return true;
+                };
+                read->setCacheMaxByteCount(Memory::megabyte);
+                read->setCacheEnabled(true);
+                DJV_ASSERT(waitForCache(Math::Frame::Sequence(0, frameCount - 1)));
+                {
+                    std::stringstream ss;
+                    ss << "Cached frames: " << read->getCachedFrames();
+                    _print(ss.str());
+                }
+
+                // Changing the in/out points evicts the frames outside of
+                // them.
+                read->setInOutPoints(InOutPoints(true, 2, 5));
+                DJV_ASSERT(waitForCache(Math::Frame::Sequence(2, 5)));
+
+                // Decoding past the end of the stream stops the cache thread
+                // at the end, and it starts again when the in/out points
+                // change.
+                read->setInOutPoints(InOutPoints(true, 5, frameCount + 4));
+                DJV_ASSERT(waitForCache(Math::Frame::Sequence(5, frameCount - 1)));
+                read->setInOutPoints(InOutPoints());
+                DJV_ASSERT(waitForCache(Math::Frame::Sequence(0, frameCount - 1)));
+
+                // Disabling the cache clears it.
+                read->setCacheEnabled(false);
+                DJV_ASSERT(waitForCache(Math::Frame::Sequence()));
+            }
+        }
+
+    } // namespace AVTest
+} // namespace djv
+
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AVTest
+    {
+        class FFmpegTest : public Test::ITest
+        {
+        public:
+            FFmpegTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+
+            void run() override;
+
+        private:
+            void _decoder();
+            void _cache();
+
+            std::string _fileName;
+        };
+
+    } // namespace AVTest
+} // namespace djv
+
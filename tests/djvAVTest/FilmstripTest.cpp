@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/FilmstripTest.h>
+
+#include <djvAV/Filmstrip.h>
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/FileIO.h>
+#include <djvSystem/FileInfo.h>
+#include <djvSystem/TextSystem.h>
+
+#include <djvCore/ErrorFunc.h>
+
+#include <limits>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        FilmstripTest::FilmstripTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AVTest::FilmstripTest", tempPath, context)
+        {}
+
+        void FilmstripTest::run()
+        {
+            _io();
+            _errors();
+        }
+
+        void FilmstripTest::_io()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto textSystem = context->getSystemT<System::TextSystem>();
+
+                // Create a movie file and a filmstrip with one image for every
+                // ten frames, each image filled with its index.
+                const System::File::Path moviePath(getTempPath(), "FilmstripTest.mov");
+                {
+                    auto io = System::File::IO::create();
+                    io->open(moviePath.get(), System::File::Mode::Write);
+                    io->write(std::string("FilmstripTest"));
+                }
+                const System::File::Info movieInfo(moviePath);
+                const Image::Info imageInfo(16, 9, Image::Type::RGB_U8);
+                std::vector<std::shared_ptr<Image::Data> > images;
+                for (uint8_t i = 0; i < 5; ++i)
+                {
+                    auto image = Image::Data::create(imageInfo);
+                    memset(image->getData(), i, image->getDataByteCount());
+                    images.push_back(image);
+                }
+                const System::File::Path path(getTempPath(), "FilmstripTest.filmstrip");
+                Filmstrip::write(path.get(), movieInfo, 10, 50, images);
+
+                auto filmstrip = Filmstrip::create(path.get(), textSystem);
+                DJV_ASSERT(movieInfo.getSize() == filmstrip->getFileSize());
+                DJV_ASSERT(movieInfo.getTime() == filmstrip->getFileTime());
+                DJV_ASSERT(filmstrip->isValid(movieInfo));
+                DJV_ASSERT(!filmstrip->isValid(System::File::Info(path)));
+                DJV_ASSERT(imageInfo.size == filmstrip->getImageInfo().size);
+                DJV_ASSERT(imageInfo.type == filmstrip->getImageInfo().type);
+                DJV_ASSERT(10 == filmstrip->getStep());
+                DJV_ASSERT(50 == filmstrip->getFrameCount());
+                DJV_ASSERT(5 == filmstrip->getImageCount());
+                for (const auto& i : std::vector<std::pair<Math::Frame::Index, uint8_t> >({
+                    { -1, 0 }, { 0, 0 }, { 9, 0 }, { 10, 1 }, { 25, 2 }, { 49, 4 }, { 100, 4 } }))
+                {
+                    const auto image = filmstrip->getImage(i.first);
+                    DJV_ASSERT(image);
+                    DJV_ASSERT(i.second == image->getData()[0]);
+                    DJV_ASSERT(i.second == image->getData()[image->getDataByteCount() - 1]);
+                }
+            }
+        }
+
+        void FilmstripTest::_errors()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto textSystem = context->getSystemT<System::TextSystem>();
+                const System::File::Path path(getTempPath(), "FilmstripTest.filmstrip");
+                try
+                {
+                    auto io = System::File::IO::create();
+                    io->open(path.get(), System::File::Mode::Write);
+                    io->write(std::string("djvFilmstrip"));
+                    io->writeU32(0);
+                    io->close();
+                    Filmstrip::create(path.get(), textSystem);
+                    DJV_ASSERT(false);
+                }
+                catch (const std::exception& e)
+                {
+                    _print(Error::format(e.what()));
+                }
+                try
+                {
+                    // The image count overflows the byte count.
+                    const Image::Info imageInfo(16, 9, Image::Type::RGB_U8);
+                    const uint64_t fileSize = 0;
+                    const int64_t fileTime = 0;
+                    const uint16_t size[2] = { imageInfo.size.w, imageInfo.size.h };
+                    const uint64_t step = 1;
+                    const uint64_t frameCount = 1;
+                    const uint64_t imageCount = std::numeric_limits<size_t>::max() / imageInfo.getDataByteCount() + 1;
+                    auto io = System::File::IO::create();
+                    io->open(path.get(), System::File::Mode::Write);
+                    io->write(std::string("djvFilmstrip"));
+                    io->writeU32(1);
+                    io->write(&fileSize, 1, sizeof(uint64_t));
+                    io->write(&fileTime, 1, sizeof(int64_t));
+                    io->writeU16(size, 2);
+                    io->writeU8(static_cast<uint8_t>(imageInfo.type));
+                    io->writeF32(imageInfo.pixelAspectRatio);
+                    io->write(&step, 1, sizeof(uint64_t));
+                    io->write(&frameCount, 1, sizeof(uint64_t));
+                    io->write(&imageCount, 1, sizeof(uint64_t));
+                    std::vector<uint8_t> data(imageInfo.getDataByteCount(), 0);
+                    io->write(data.data(), data.size());
+                    io->close();
+                    Filmstrip::create(path.get(), textSystem);
+                    DJV_ASSERT(false);
+                }
+                catch (const std::exception& e)
+                {
+                    _print(Error::format(e.what()));
+                }
+            }
+        }
+
+    } // namespace AVTest
+} // namespace djv
@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AVTest
+    {
+        class FilmstripTest : public Test::ITest
+        {
+        public:
+            FilmstripTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+
+            void run() override;
+
+        private:
+            void _io();
+            void _errors();
+        };
+
+    } // namespace AVTest
+} // namespace djv
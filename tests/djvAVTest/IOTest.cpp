@@ -4,11 +4,14 @@
 
 #include <djvAVTest/IOTest.h>
 
+#include <djvTestLib/AllocTest.h>
+
 #include <djvAV/IOSystem.h>
 #include <djvAV/PPMFunc.h>
 #include <djvAV/SpeedFunc.h>
 
 #include <djvSystem/Context.h>
+#include <djvSystem/FileIO.h>
 #include <djvSystem/LogSystem.h>
 #include <djvSystem/ResourceSystem.h>
 #include <djvSystem/TextSystem.h>
@@ -17,6 +20,7 @@
 #include <djvMath/FrameNumberFunc.h>
 
 #include <djvCore/ErrorFunc.h>
+#include <djvCore/Memory.h>
 #include <djvCore/StringFunc.h>
 
 using namespace djv::Core;
@@ -47,6 +51,7 @@ namespace djv
             _cache();
             _plugin();
             _io();
+            _sequence();
             _system();
         }
         
@@ -115,6 +120,33 @@ namespace djv
                 queue.setFinished(true);
                 DJV_ASSERT(queue.isFinished());
             }
+
+            {
+                // Adding and removing frames wraps around the queue storage
+                // without allocating memory once it has grown.
+                VideoQueue queue;
+                queue.setMax(3);
+                queue.addFrame(VideoFrame(0, nullptr));
+                queue.addFrame(VideoFrame(1, nullptr));
+                queue.addFrame(VideoFrame(2, nullptr));
+                queue.clearFrames();
+                const size_t allocCount = Test::getAllocCount();
+                Math::Frame::Number frame = 0;
+                for (Math::Frame::Number i = 0; i < 10; ++i)
+                {
+                    queue.addFrame(VideoFrame(i, nullptr));
+                    if (queue.getCount() == queue.getMax())
+                    {
+                        DJV_ASSERT(frame == queue.popFrame().frame);
+                        ++frame;
+                    }
+                }
+                DJV_ASSERT(Test::getAllocCount() == allocCount);
+                DJV_ASSERT(2 == queue.getCount());
+                DJV_ASSERT(8 == queue.popFrame().frame);
+                DJV_ASSERT(9 == queue.popFrame().frame);
+                DJV_ASSERT(queue.isEmpty());
+            }
         }
         
         void IOTest::_audioFrame()
@@ -237,6 +269,72 @@ namespace djv
                     _print(ss.str());
                 }
             }
+
+            {
+                Cache cache;
+                cache.setMax(10);
+                cache.setSequenceSize(10);
+                uint64_t version = cache.getVersion();
+                cache.add(0, Image::Data::create(Image::Info(1, 2, Image::Type::RGB_U8)));
+                DJV_ASSERT(cache.getVersion() != version);
+                version = cache.getVersion();
+                cache.setMax(10);
+                cache.setSequenceSize(10);
+                cache.setCurrentFrame(0);
+                DJV_ASSERT(cache.getVersion() == version);
+
+                // Looking up frames should not allocate memory.
+                std::shared_ptr<Image::Data> image;
+                const size_t allocCount = Test::getAllocCount();
+                for (Math::Frame::Index i = 0; i < 20; ++i)
+                {
+                    cache.contains(i);
+                    cache.get(i, image);
+                }
+                DJV_ASSERT(Test::getAllocCount() == allocCount);
+                DJV_ASSERT(cache.getVersion() == version);
+
+                cache.clear();
+                DJV_ASSERT(cache.getVersion() != version);
+                version = cache.getVersion();
+                cache.clear();
+                DJV_ASSERT(cache.getVersion() == version);
+            }
+
+            {
+                // The cache window wraps around the end of the sequence.
+                Cache cache;
+                cache.setMax(4);
+                cache.setSequenceSize(10);
+                cache.setCurrentFrame(8);
+                DJV_ASSERT(Math::Frame::Sequence(std::vector<Math::Frame::Range>(
+                    { Math::Frame::Range(0, 2), Math::Frame::Range(8, 9) })) == cache.getSequence());
+                cache.setDirection(Direction::Reverse);
+                cache.setCurrentFrame(1);
+                DJV_ASSERT(Math::Frame::Sequence(std::vector<Math::Frame::Range>(
+                    { Math::Frame::Range(0, 1), Math::Frame::Range(7, 9) })) == cache.getSequence());
+                cache.setInOutPoints(InOutPoints(true, 2, 5));
+                DJV_ASSERT(Math::Frame::Sequence(2, 5) == cache.getSequence());
+
+                // Moving the current frame only changes the cache when the
+                // window changes, and does not allocate memory.
+                cache.setInOutPoints(InOutPoints());
+                cache.setDirection(Direction::Forward);
+                for (Math::Frame::Index i = 0; i < 10; ++i)
+                {
+                    cache.setCurrentFrame(i);
+                }
+                const uint64_t version = cache.getVersion();
+                cache.setCurrentFrame(9);
+                DJV_ASSERT(cache.getVersion() == version);
+                const size_t allocCount = Test::getAllocCount();
+                for (Math::Frame::Index i = 0; i < 10; ++i)
+                {
+                    cache.setCurrentFrame(i);
+                }
+                DJV_ASSERT(Test::getAllocCount() == allocCount);
+                DJV_ASSERT(cache.getVersion() != version);
+            }
         }
         
         void IOTest::_plugin()
@@ -437,6 +535,13 @@ namespace djv
                         }
                     }
                 }
+
+                {
+                    const auto info = io->probe(System::File::Info(path));
+                    DJV_ASSERT(1 == info.video.size());
+                    DJV_ASSERT(size == info.video[0].size);
+                    DJV_ASSERT(info == io->probe(System::File::Info(path)));
+                }
             }
             catch (const std::exception& e)
             {
@@ -444,6 +549,103 @@ namespace djv
             }
         }
         
+        void IOTest::_sequence()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto io = context->getSystemT<IOSystem>();
+                const Image::Info imageInfo(16, 16, Image::Type::RGB_U8);
+                const size_t frameCount = 10;
+                const System::File::Info fileInfo(
+                    System::File::Path(getTempPath(), "IOTestSequence.1.ppm"),
+                    System::File::Type::Sequence,
+                    Math::Frame::Sequence(1, static_cast<Math::Frame::Number>(frameCount)),
+                    false);
+                {
+                    Info info;
+                    info.video.push_back(imageInfo);
+                    auto write = io->write(fileInfo, info);
+                    {
+                        std::lock_guard<std::mutex> lock(write->getMutex());
+                        auto& writeQueue = write->getVideoQueue();
+                        writeQueue.setMax(frameCount);
+                        for (size_t i = 0; i < frameCount; ++i)
+                        {
+                            auto image = Image::Data::create(imageInfo);
+                            image->zero();
+                            writeQueue.addFrame(VideoFrame(static_cast<Math::Frame::Number>(i), image));
+                        }
+                        writeQueue.setFinished(true);
+                    }
+                    while (write->isRunning())
+                    {}
+                }
+
+                auto read = io->read(fileInfo);
+                {
+                    std::lock_guard<std::mutex> lock(read->getMutex());
+                    read->getVideoQueue().setMax(2);
+                }
+                read->setCacheMaxByteCount(Memory::megabyte);
+                read->setCacheEnabled(true);
+                read->setLoop(true);
+                read->setPlayback(true);
+                auto popFrames = [read](size_t count)
+                {
+                    size_t out = 0;
+                    const auto start = std::chrono::steady_clock::now();
+                    while (out < count)
+                    {
+                        {
+                            std::lock_guard<std::mutex> lock(read->getMutex());
+                            auto& readQueue = read->getVideoQueue();
+                            while (!readQueue.isEmpty() && out < count)
+                            {
+                                readQueue.popFrame();
+                                ++out;
+                            }
+                        }
+                        const std::chrono::duration<float> duration = std::chrono::steady_clock::now() - start;
+                        if (duration.count() > 10.F)
+                        {
+                            break;
+                        }
+                        std::this_thread::sleep_for(System::getTimerDuration(System::TimerValue::Fast));
+                    }
+                    return out;
+                };
+
+                // Play until all of the frames are cached.
+                const auto start = std::chrono::steady_clock::now();
+                bool cached = false;
+                while (!cached)
+                {
+                    popFrames(1);
+                    cached = read->getCachedFrames().getFrameCount() == frameCount;
+                    const std::chrono::duration<float> duration = std::chrono::steady_clock::now() - start;
+                    if (duration.count() > 10.F)
+                    {
+                        break;
+                    }
+                }
+                DJV_ASSERT(cached);
+                DJV_ASSERT(frameCount * 2 == popFrames(frameCount * 2));
+
+                // Playing back from the cache should not allocate memory in
+                // any of the threads.
+                const size_t allocCount = Test::getGlobalAllocCount();
+                const size_t count = popFrames(frameCount * 10);
+                DJV_ASSERT(Test::getGlobalAllocCount() == allocCount);
+                DJV_ASSERT(frameCount * 10 == count);
+
+                read.reset();
+                for (size_t i = 1; i <= frameCount; ++i)
+                {
+                    std::remove(fileInfo.getFileName(static_cast<Math::Frame::Number>(i)).c_str());
+                }
+            }
+        }
+
         void IOTest::_system()
         {
             if (auto context = getContext().lock())
@@ -515,6 +717,57 @@ namespace djv
                     ss << io->canWrite(System::File::Info(i), Info());
                     _print(ss.str());
                 }
+
+                {
+                    std::stringstream ss;
+                    ss << "Loaded plugins: " << String::joinSet(io->getLoadedPluginNames(), ", ");
+                    _print(ss.str());
+                }
+                DJV_ASSERT(io->getPlugin(PPM::pluginName));
+                DJV_ASSERT(!io->getPlugin("Unknown"));
+
+                {
+                    // Files without an extension are dispatched by the magic
+                    // numbers.
+                    const System::File::Path path(getTempPath(), "sniff");
+                    {
+                        auto fileIO = System::File::IO::create();
+                        fileIO->open(path.get(), System::File::Mode::Write);
+                        const std::string data("P5\n1 1\n255\n\0", 12);
+                        fileIO->write(data.data(), data.size());
+                    }
+                    DJV_ASSERT(io->canRead(System::File::Info(path)));
+                    DJV_ASSERT(io->read(System::File::Info(path)));
+                    DJV_ASSERT(!io->canRead(System::File::Info(System::File::Path(getTempPath(), "sniff.txt"))));
+
+                    // The PNM magic numbers must be followed by whitespace.
+                    const System::File::Path path2(getTempPath(), "sniff2");
+                    {
+                        auto fileIO = System::File::IO::create();
+                        fileIO->open(path2.get(), System::File::Mode::Write);
+                        fileIO->write(std::string("P5text"));
+                    }
+                    DJV_ASSERT(!io->canRead(System::File::Info(path2)));
+                }
+
+                {
+                    // Files are probed in parallel and an error for one file
+                    // does not stop the others.
+                    auto futures = io->probe(std::vector<System::File::Info>({
+                        System::File::Info(System::File::Path(getTempPath(), "sniff")),
+                        System::File::Info(System::File::Path(getTempPath(), "probe.ppm")) }));
+                    DJV_ASSERT(2 == futures.size());
+                    const auto info = futures[0].get();
+                    DJV_ASSERT(1 == info.video.size());
+                    DJV_ASSERT(Image::Size(1, 1) == info.video[0].size);
+                    try
+                    {
+                        futures[1].get();
+                        DJV_ASSERT(false);
+                    }
+                    catch (const std::exception&)
+                    {}
+                }
             }
         }
                 
@@ -36,6 +36,7 @@ namespace djv
                 Image::Type,
                 const Image::Tags&,
                 const std::shared_ptr<AV::IO::IOSystem>&);
+            void _sequence();
             void _system();
         };
         
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/TelemetryFuncTest.h>
+
+#include <djvAV/TelemetryFunc.h>
+
+#include <set>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        TelemetryFuncTest::TelemetryFuncTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AVTest::TelemetryFuncTest", tempPath, context)
+        {}
+
+        void TelemetryFuncTest::run()
+        {
+            _time();
+            _histogram();
+            _stats();
+            _trace();
+        }
+
+        void TelemetryFuncTest::_time()
+        {
+            const Time::Duration a = IO::getThreadCPUTime();
+            volatile size_t sum = 0;
+            for (size_t i = 0; i < 10000000; ++i)
+            {
+                sum = sum + i;
+            }
+            const Time::Duration b = IO::getThreadCPUTime();
+            DJV_ASSERT(b >= a);
+        }
+
+        void TelemetryFuncTest::_histogram()
+        {
+            {
+                const auto histogram = IO::getHistogram({});
+                DJV_ASSERT(0 == histogram.count);
+                DJV_ASSERT(Time::Duration::zero() == histogram.max);
+            }
+            {
+                std::vector<Time::Duration> values;
+                for (int i = 100; i > 0; --i)
+                {
+                    values.push_back(std::chrono::milliseconds(i));
+                }
+                values.push_back(std::chrono::microseconds(500));
+                values.push_back(std::chrono::seconds(10));
+                const auto histogram = IO::getHistogram(values);
+                DJV_ASSERT(102 == histogram.count);
+                DJV_ASSERT(std::chrono::microseconds(500) == histogram.min);
+                DJV_ASSERT(std::chrono::seconds(10) == histogram.max);
+                DJV_ASSERT(std::chrono::milliseconds(50) == histogram.p50);
+                DJV_ASSERT(std::chrono::milliseconds(95) == histogram.p95);
+                size_t count = 0;
+                for (const auto i : histogram.bins)
+                {
+                    count += i;
+                }
+                DJV_ASSERT(histogram.count == count);
+                DJV_ASSERT(1 == histogram.bins[0]);
+                DJV_ASSERT(1 == histogram.bins[1]);
+                DJV_ASSERT(2 == histogram.bins[2]);
+                DJV_ASSERT(1 == histogram.bins.back());
+            }
+        }
+
+        void TelemetryFuncTest::_stats()
+        {
+            const auto t = std::chrono::steady_clock::now();
+            std::vector<IO::FrameTelemetry> frames;
+            for (Math::Frame::Number i = 0; i < 10; ++i)
+            {
+                IO::FrameTelemetry frame;
+                frame.frame = i;
+                frame.request = t;
+                frame.ioStart = t + std::chrono::milliseconds(1);
+                frame.decodeEnd = t + std::chrono::milliseconds(1 + i);
+                frame.enqueue = frame.decodeEnd;
+                frame.present = frame.enqueue + std::chrono::milliseconds(2);
+                frames.push_back(frame);
+            }
+            {
+                IO::FrameTelemetry frame;
+                frame.frame = 10;
+                frame.request = t;
+                frame.enqueue = t;
+                frame.cacheHit = true;
+                frames.push_back(frame);
+            }
+            const auto stats = IO::getStats(frames, 3);
+            DJV_ASSERT(11 == stats.frameCount);
+            DJV_ASSERT(1 == stats.cacheHitCount);
+            DJV_ASSERT(10 == stats.presentCount);
+            DJV_ASSERT(3 == stats.starvationCount);
+            DJV_ASSERT(10 == stats.decode.count);
+            DJV_ASSERT(Time::Duration::zero() == stats.decode.min);
+            DJV_ASSERT(std::chrono::milliseconds(9) == stats.decode.max);
+            DJV_ASSERT(std::chrono::milliseconds(1) == stats.wait.max);
+            DJV_ASSERT(std::chrono::milliseconds(2) == stats.queue.p50);
+        }
+
+        void TelemetryFuncTest::_trace()
+        {
+            const auto t = std::chrono::steady_clock::now();
+            std::vector<IO::FrameTelemetry> frames;
+            for (Math::Frame::Number i = 0; i < 4; ++i)
+            {
+                // Each frame overlaps the next frame.
+                IO::FrameTelemetry frame;
+                frame.frame = i;
+                frame.request = t + std::chrono::milliseconds(i * 10);
+                frame.ioStart = frame.request + std::chrono::milliseconds(1);
+                frame.decodeEnd = frame.request + std::chrono::milliseconds(15);
+                frame.enqueue = frame.decodeEnd;
+                frame.present = frame.enqueue + std::chrono::milliseconds(1);
+                frames.push_back(frame);
+            }
+            const auto events = IO::toTraceEvents(frames, "test");
+            std::vector<System::Trace::Event> frameEvents;
+            for (const auto& i : events)
+            {
+                if ("frame" == i.category)
+                {
+                    frameEvents.push_back(i);
+                }
+            }
+            DJV_ASSERT(4 == frameEvents.size());
+            DJV_ASSERT(16 == events.size());
+            DJV_ASSERT("test 0" == frameEvents[0].name);
+            DJV_ASSERT(frameEvents[0].track != frameEvents[1].track);
+            DJV_ASSERT(frameEvents[1].track != frameEvents[2].track);
+            DJV_ASSERT(frameEvents[0].track == frameEvents[2].track);
+            std::set<size_t> tracks;
+            for (const auto& i : frameEvents)
+            {
+                tracks.insert(i.track);
+            }
+            DJV_ASSERT(2 == tracks.size());
+        }
+
+    } // namespace AVTest
+} // namespace djv
+
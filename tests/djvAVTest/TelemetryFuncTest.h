@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AVTest
+    {
+        class TelemetryFuncTest : public Test::ITest
+        {
+        public:
+            TelemetryFuncTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+
+            void run() override;
+
+        private:
+            void _time();
+            void _histogram();
+            void _stats();
+            void _trace();
+        };
+
+    } // namespace AVTest
+} // namespace djv
+
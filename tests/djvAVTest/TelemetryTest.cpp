@@ -0,0 +1,186 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAVTest/TelemetryTest.h>
+
+#include <djvAV/Telemetry.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace djv::Core;
+using namespace djv::AV;
+
+namespace djv
+{
+    namespace AVTest
+    {
+        TelemetryTest::TelemetryTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AVTest::TelemetryTest", tempPath, context)
+        {}
+
+        void TelemetryTest::run()
+        {
+            _frame();
+            _ring();
+            _present();
+            _starvation();
+            _threads();
+        }
+
+        namespace
+        {
+            IO::FrameTelemetry getFrame(Math::Frame::Number frame, const Time::TimePoint& t)
+            {
+                IO::FrameTelemetry out;
+                out.frame = frame;
+                out.request = t;
+                out.ioStart = t + std::chrono::milliseconds(1);
+                out.decodeEnd = t + std::chrono::milliseconds(5);
+                out.cpuTime = std::chrono::milliseconds(3);
+                out.enqueue = t + std::chrono::milliseconds(6);
+                return out;
+            }
+
+        } // namespace
+
+        void TelemetryTest::_frame()
+        {
+            const auto t = std::chrono::steady_clock::now();
+            auto frame = getFrame(0, t);
+            DJV_ASSERT(std::chrono::milliseconds(1) == frame.getWaitTime());
+            DJV_ASSERT(std::chrono::milliseconds(4) == frame.getDecodeTime());
+            DJV_ASSERT(std::chrono::milliseconds(1) == frame.getIOWaitTime());
+            DJV_ASSERT(std::chrono::milliseconds(6) == frame.getLatency());
+            DJV_ASSERT(Time::Duration::zero() == frame.getQueueTime());
+            frame.present = t + std::chrono::milliseconds(10);
+            DJV_ASSERT(std::chrono::milliseconds(4) == frame.getQueueTime());
+            frame.cpuTime = std::chrono::milliseconds(10);
+            DJV_ASSERT(Time::Duration::zero() == frame.getIOWaitTime());
+        }
+
+        void TelemetryTest::_ring()
+        {
+            {
+                auto telemetry = IO::Telemetry::create(0);
+                DJV_ASSERT(1 == telemetry->getCapacity());
+            }
+            {
+                auto telemetry = IO::Telemetry::create(4);
+                DJV_ASSERT(4 == telemetry->getCapacity());
+                DJV_ASSERT(0 == telemetry->getFrameCount());
+                DJV_ASSERT(telemetry->getFrames().empty());
+
+                const auto t = std::chrono::steady_clock::now();
+                for (Math::Frame::Number i = 0; i < 3; ++i)
+                {
+                    telemetry->addFrame(getFrame(i, t));
+                }
+                auto frames = telemetry->getFrames();
+                DJV_ASSERT(3 == frames.size());
+                for (Math::Frame::Number i = 0; i < 3; ++i)
+                {
+                    DJV_ASSERT(getFrame(i, t) == frames[i]);
+                }
+
+                for (Math::Frame::Number i = 3; i < 10; ++i)
+                {
+                    telemetry->addFrame(getFrame(i, t));
+                }
+                DJV_ASSERT(10 == telemetry->getFrameCount());
+                frames = telemetry->getFrames();
+                DJV_ASSERT(4 == frames.size());
+                for (size_t i = 0; i < frames.size(); ++i)
+                {
+                    DJV_ASSERT(static_cast<Math::Frame::Number>(6 + i) == frames[i].frame);
+                }
+
+                telemetry->clear();
+                DJV_ASSERT(0 == telemetry->getFrameCount());
+                DJV_ASSERT(telemetry->getFrames().empty());
+                telemetry->addFrame(getFrame(10, t));
+                frames = telemetry->getFrames();
+                DJV_ASSERT(1 == frames.size());
+                DJV_ASSERT(10 == frames[0].frame);
+            }
+        }
+
+        void TelemetryTest::_present()
+        {
+            auto telemetry = IO::Telemetry::create(4);
+            const auto t = std::chrono::steady_clock::now();
+            telemetry->addFrame(getFrame(0, t));
+            telemetry->addFrame(getFrame(1, t));
+            telemetry->addFrame(getFrame(0, t));
+
+            const auto present = t + std::chrono::milliseconds(10);
+            telemetry->setPresent(0, present);
+            auto frames = telemetry->getFrames();
+            DJV_ASSERT(Time::TimePoint() == frames[0].present);
+            DJV_ASSERT(Time::TimePoint() == frames[1].present);
+            DJV_ASSERT(present == frames[2].present);
+
+            telemetry->setPresent(0, present + std::chrono::milliseconds(10));
+            frames = telemetry->getFrames();
+            DJV_ASSERT(present == frames[2].present);
+
+            telemetry->setPresent(2, present);
+            frames = telemetry->getFrames();
+            DJV_ASSERT(Time::TimePoint() == frames[1].present);
+        }
+
+        void TelemetryTest::_starvation()
+        {
+            auto telemetry = IO::Telemetry::create();
+            DJV_ASSERT(0 == telemetry->getStarvationCount());
+            telemetry->addStarvation();
+            telemetry->addStarvation();
+            DJV_ASSERT(2 == telemetry->getStarvationCount());
+            telemetry->clear();
+            DJV_ASSERT(0 == telemetry->getStarvationCount());
+        }
+
+        void TelemetryTest::_threads()
+        {
+            auto telemetry = IO::Telemetry::create(16);
+            const auto t = std::chrono::steady_clock::now();
+            const Math::Frame::Number count = 10000;
+            std::atomic<bool> running(true);
+            std::atomic<bool> valid(true);
+            std::thread reader(
+                [telemetry, t, &running, &valid]
+                {
+                    while (running)
+                    {
+                        // Frames that are being overwritten are skipped, the
+                        // rest must be complete and in order.
+                        const auto frames = telemetry->getFrames();
+                        for (size_t i = 0; i < frames.size(); ++i)
+                        {
+                            if (!(getFrame(frames[i].frame, t) == frames[i]) ||
+                                (i > 0 && frames[i].frame <= frames[i - 1].frame))
+                            {
+                                valid = false;
+                            }
+                        }
+                    }
+                });
+            for (Math::Frame::Number i = 0; i < count; ++i)
+            {
+                telemetry->addFrame(getFrame(i, t));
+            }
+            running = false;
+            reader.join();
+            DJV_ASSERT(valid);
+            DJV_ASSERT(static_cast<size_t>(count) == telemetry->getFrameCount());
+            const auto frames = telemetry->getFrames();
+            DJV_ASSERT(16 == frames.size());
+            DJV_ASSERT(count - 1 == frames.back().frame);
+        }
+
+    } // namespace AVTest
+} // namespace djv
+
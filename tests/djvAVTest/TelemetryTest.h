@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AVTest
+    {
+        class TelemetryTest : public Test::ITest
+        {
+        public:
+            TelemetryTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+
+            void run() override;
+
+        private:
+            void _frame();
+            void _ring();
+            void _present();
+            void _starvation();
+            void _threads();
+        };
+
+    } // namespace AVTest
+} // namespace djv
+
@@ -71,6 +71,23 @@ namespace djv
                 system->cancelInfo(infoCancelFuture.uid);
                 system->cancelImage(imageCancelFuture.uid);
 
+                // Request prefetch thumbnails and change their priority.
+                for (const auto& i : {
+                    Image::Size(64, 64),
+                    Image::Size(48, 48) })
+                {
+                    infoFutures.push_back(system->getInfo(fileInfo, ThumbnailPriority::Prefetch));
+                    imageFutures.push_back(system->getImage(fileInfo, i, Image::Type::None, ThumbnailPriority::Prefetch));
+                }
+                system->setPriority(imageFutures.back().uid, ThumbnailPriority::Visible);
+
+                // Request and release thumbnails.
+                for (size_t i = 0; i < 10; ++i)
+                {
+                    system->getInfo(fileInfo, ThumbnailPriority::Prefetch);
+                    system->getImage(fileInfo, Image::Size(24, 24), Image::Type::None, ThumbnailPriority::Prefetch);
+                }
+
                 // Wait for and collect info.
                 std::vector<IO::Info> infos;
                 while (!infoFutures.empty())
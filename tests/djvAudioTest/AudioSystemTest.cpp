@@ -8,6 +8,7 @@
 #include <djvAudio/AudioSystemFunc.h>
 
 #include <djvSystem/Context.h>
+#include <djvSystem/ResourceSystem.h>
 
 #include <djvCore/StringFunc.h>
 
@@ -81,6 +82,19 @@ namespace djv
                         _print("    Native formats: " + String::join(labels, ", "));
                     }
                 }
+
+                {
+                    // Destroy a context while the devices may still be
+                    // probed, without ticking it.
+                    const System::File::Path argv0(
+                        context->getSystemT<System::ResourceSystem>()->getPath(System::File::ResourcePath::Application),
+                        context->getName());
+                    auto context2 = System::Context::create(argv0.get());
+                    auto system2 = AudioSystem::create(context2);
+                    DJV_ASSERT(system2);
+                    system2.reset();
+                    context2.reset();
+                }
             }
         }
 
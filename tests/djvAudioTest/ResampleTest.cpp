@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAudioTest/ResampleTest.h>
+
+#include <djvAudio/Resample.h>
+
+#include <djvMath/Math.h>
+
+#include <cmath>
+#include <sstream>
+
+using namespace djv::Core;
+using namespace djv::Audio;
+
+namespace djv
+{
+    namespace AudioTest
+    {
+        namespace
+        {
+            std::vector<F32_T> createSine(uint8_t channelCount, size_t sampleRate, size_t sampleCount, float frequency)
+            {
+                std::vector<F32_T> out(sampleCount * channelCount);
+                for (size_t i = 0; i < sampleCount; ++i)
+                {
+                    const F32_T v = .5F * std::sin(Math::pi2 * frequency * i / static_cast<float>(sampleRate));
+                    for (uint8_t c = 0; c < channelCount; ++c)
+                    {
+                        out[i * channelCount + c] = v;
+                    }
+                }
+                return out;
+            }
+
+        } // namespace
+
+        ResampleTest::ResampleTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AudioTest::ResampleTest", tempPath, context)
+        {}
+
+        void ResampleTest::run()
+        {
+            _resampler();
+            _rates();
+        }
+
+        void ResampleTest::_resampler()
+        {
+            {
+                Resampler resampler;
+                DJV_ASSERT(0 == resampler.getChannelCount());
+                std::vector<F32_T> out;
+                const F32_T in[] = { 0.F, 0.F };
+                resampler.process(in, 2, out);
+                DJV_ASSERT(out.empty());
+            }
+
+            {
+                Resampler resampler(2, 44100, 48000, 30);
+                DJV_ASSERT(2 == resampler.getChannelCount());
+                DJV_ASSERT(44100 == resampler.getInputRate());
+                DJV_ASSERT(48000 == resampler.getOutputRate());
+                DJV_ASSERT(32 == resampler.getTapCount());
+                DJV_ASSERT(16 == resampler.getLatency());
+
+                // Processing in pieces is the same as processing at once.
+                const auto in = createSine(2, 44100, 4410, 440.F);
+                std::vector<F32_T> out;
+                resampler.process(in.data(), in.size() / 2, out);
+                resampler.reset();
+                std::vector<F32_T> out2;
+                for (size_t i = 0; i < in.size() / 2; i += 100)
+                {
+                    resampler.process(in.data() + i * 2, std::min(static_cast<size_t>(100), in.size() / 2 - i), out2);
+                }
+                DJV_ASSERT(out == out2);
+            }
+        }
+
+        void ResampleTest::_rates()
+        {
+            const std::vector<std::pair<size_t, size_t> > rates =
+            {
+                { 44100, 48000 },
+                { 48000, 44100 },
+                { 48000, 96000 },
+                { 22050, 48000 }
+            };
+            for (const auto& rate : rates)
+            {
+                std::stringstream ss;
+                ss << "rate: " << rate.first << " to " << rate.second;
+                _print(ss.str());
+
+                // The output follows the input with the latency of the filter.
+                const size_t sampleCount = rate.first;
+                const auto in = createSine(1, rate.first, sampleCount, 440.F);
+                Resampler resampler(1, rate.first, rate.second);
+                std::vector<F32_T> out;
+                resampler.process(in.data(), sampleCount, out);
+                const size_t latency = resampler.getLatency() * rate.second / rate.first + 1;
+                DJV_ASSERT(out.size() + latency >= rate.second);
+                DJV_ASSERT(out.size() <= rate.second);
+
+                // Compare with the sine at the output rate, away from the ends.
+                float error = 0.F;
+                for (size_t i = latency; i + latency < out.size(); ++i)
+                {
+                    const float v = .5F * std::sin(Math::pi2 * 440.F * i / static_cast<float>(rate.second));
+                    error = std::max(error, std::abs(out[i] - v));
+                }
+                DJV_ASSERT(error < .001F);
+            }
+        }
+
+    } // namespace AudioTest
+} // namespace djv
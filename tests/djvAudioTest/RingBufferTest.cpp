@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAudioTest/RingBufferTest.h>
+
+#include <djvAudio/RingBuffer.h>
+
+#include <thread>
+
+using namespace djv::Core;
+using namespace djv::Audio;
+
+namespace djv
+{
+    namespace AudioTest
+    {
+        RingBufferTest::RingBufferTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AudioTest::RingBufferTest", tempPath, context)
+        {}
+
+        void RingBufferTest::run()
+        {
+            _ringBuffer();
+            _threads();
+        }
+
+        void RingBufferTest::_ringBuffer()
+        {
+            {
+                RingBuffer buffer;
+                DJV_ASSERT(0 == buffer.getChannelCount());
+                DJV_ASSERT(0 == buffer.getSampleMax());
+                const F32_T in[] = { 0.F, 0.F };
+                F32_T out[] = { 0.F, 0.F };
+                DJV_ASSERT(0 == buffer.write(in, 1));
+                DJV_ASSERT(0 == buffer.read(out, 1));
+            }
+
+            {
+                RingBuffer buffer(2, 4);
+                DJV_ASSERT(2 == buffer.getChannelCount());
+                DJV_ASSERT(4 == buffer.getSampleMax());
+                DJV_ASSERT(0 == buffer.getReadCount());
+                DJV_ASSERT(4 == buffer.getWriteCount());
+
+                const F32_T in[] = { 0.F, 1.F, 2.F, 3.F, 4.F, 5.F, 6.F, 7.F, 8.F, 9.F };
+                DJV_ASSERT(3 == buffer.write(in, 3));
+                DJV_ASSERT(3 == buffer.getReadCount());
+                DJV_ASSERT(1 == buffer.getWriteCount());
+
+                F32_T out[10];
+                DJV_ASSERT(2 == buffer.read(out, 2));
+                DJV_ASSERT(0.F == out[0] && 1.F == out[1] && 2.F == out[2] && 3.F == out[3]);
+
+                // Write past the end of the buffer and wrap around to the
+                // start, the samples that do not fit are not written.
+                DJV_ASSERT(3 == buffer.write(in + 4, 5));
+                DJV_ASSERT(4 == buffer.getReadCount());
+                DJV_ASSERT(4 == buffer.read(out, 10));
+                const F32_T result[] = { 4.F, 5.F, 4.F, 5.F, 6.F, 7.F, 8.F, 9.F };
+                for (size_t i = 0; i < 8; ++i)
+                {
+                    DJV_ASSERT(result[i] == out[i]);
+                }
+                DJV_ASSERT(0 == buffer.read(out, 1));
+
+                DJV_ASSERT(2 == buffer.write(in, 2));
+                buffer.clear();
+                DJV_ASSERT(0 == buffer.getReadCount());
+                DJV_ASSERT(4 == buffer.getWriteCount());
+            }
+        }
+
+        void RingBufferTest::_threads()
+        {
+            // Write increasing values from one thread and check they are read
+            // in order from another.
+            const size_t sampleCount = 100000;
+            RingBuffer buffer(1, 64);
+            std::thread thread(
+                [&buffer, sampleCount]
+                {
+                    F32_T value = 0.F;
+                    size_t count = 0;
+                    while (count < sampleCount)
+                    {
+                        if (buffer.write(&value, 1))
+                        {
+                            value += 1.F;
+                            ++count;
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            size_t count = 0;
+            bool ordered = true;
+            F32_T out[16];
+            while (count < sampleCount)
+            {
+                const size_t read = buffer.read(out, 16);
+                for (size_t i = 0; i < read; ++i)
+                {
+                    ordered &= static_cast<F32_T>(count + i) == out[i];
+                }
+                count += read;
+                if (!read)
+                {
+                    std::this_thread::yield();
+                }
+            }
+            thread.join();
+            DJV_ASSERT(ordered);
+            DJV_ASSERT(0 == buffer.getReadCount());
+        }
+
+    } // namespace AudioTest
+} // namespace djv
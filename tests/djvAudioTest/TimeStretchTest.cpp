@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAudioTest/TimeStretchTest.h>
+
+#include <djvAudio/TimeStretch.h>
+
+#include <djvMath/Math.h>
+
+#include <cmath>
+#include <sstream>
+
+using namespace djv::Core;
+using namespace djv::Audio;
+
+namespace djv
+{
+    namespace AudioTest
+    {
+        namespace
+        {
+            const size_t sampleRate = 44100;
+
+            std::vector<F32_T> createSine(size_t sampleCount, float frequency)
+            {
+                std::vector<F32_T> out(sampleCount * 2);
+                for (size_t i = 0; i < sampleCount; ++i)
+                {
+                    out[i * 2] = .5F * std::sin(Math::pi2 * frequency * i / static_cast<float>(sampleRate));
+                    out[i * 2 + 1] = 0.F;
+                }
+                return out;
+            }
+
+            //! Count the rising zero crossings of the first channel.
+            size_t getCrossings(const std::vector<F32_T>& value)
+            {
+                size_t out = 0;
+                for (size_t i = 2; i < value.size(); i += 2)
+                {
+                    if (value[i - 2] < 0.F && value[i] >= 0.F)
+                    {
+                        ++out;
+                    }
+                }
+                return out;
+            }
+
+        } // namespace
+
+        TimeStretchTest::TimeStretchTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AudioTest::TimeStretchTest", tempPath, context)
+        {}
+
+        void TimeStretchTest::run()
+        {
+            _timeStretch();
+            _speed();
+        }
+
+        void TimeStretchTest::_timeStretch()
+        {
+            {
+                TimeStretch timeStretch;
+                DJV_ASSERT(0 == timeStretch.getChannelCount());
+                DJV_ASSERT(0 == timeStretch.getWindowSize());
+                std::vector<F32_T> out;
+                const F32_T in[] = { 0.F, 0.F };
+                timeStretch.process(in, 1, out);
+                DJV_ASSERT(out.empty());
+            }
+
+            {
+                TimeStretch timeStretch(2, sampleRate);
+                DJV_ASSERT(2 == timeStretch.getChannelCount());
+                DJV_ASSERT(sampleRate == timeStretch.getSampleRate());
+                DJV_ASSERT(timeStretch.getWindowSize() > 0);
+                timeStretch.setSpeed(10.F);
+                DJV_ASSERT(timeStretchSpeedRange.getMax() == timeStretch.getSpeed());
+                timeStretch.setSpeed(0.F);
+                DJV_ASSERT(timeStretchSpeedRange.getMin() == timeStretch.getSpeed());
+            }
+
+            {
+                // At normal speed the output is the same as the input after
+                // the first window fades in.
+                const auto in = createSine(sampleRate, 440.F);
+                TimeStretch timeStretch(2, sampleRate);
+                std::vector<F32_T> out;
+                for (size_t i = 0; i < sampleRate; i += 512)
+                {
+                    timeStretch.process(in.data() + i * 2, std::min(static_cast<size_t>(512), sampleRate - i), out);
+                }
+                float error = 0.F;
+                for (size_t i = timeStretch.getWindowSize() * 2; i < out.size(); ++i)
+                {
+                    error = std::max(error, std::abs(out[i] - in[i]));
+                }
+                DJV_ASSERT(error < .0001F);
+            }
+        }
+
+        void TimeStretchTest::_speed()
+        {
+            const auto in = createSine(sampleRate * 2, 440.F);
+            for (const float speed : { .25F, .5F, 1.5F, 2.F, 4.F })
+            {
+                std::stringstream ss;
+                ss << "speed: " << speed;
+                _print(ss.str());
+
+                TimeStretch timeStretch(2, sampleRate);
+                timeStretch.setSpeed(speed);
+                std::vector<F32_T> out;
+                timeStretch.process(in.data(), in.size() / 2, out);
+
+                // The duration changes with the speed, less the windows that
+                // are waiting for more input.
+                const float expected = in.size() / speed;
+                DJV_ASSERT(out.size() <= expected);
+                DJV_ASSERT(out.size() + timeStretch.getWindowSize() * 2 * 2 / speed >= expected);
+
+                // The pitch does not change.
+                const float seconds = out.size() / 2 / static_cast<float>(sampleRate);
+                const float frequency = getCrossings(out) / seconds;
+                DJV_ASSERT(std::abs(frequency - 440.F) < 5.F);
+            }
+        }
+
+    } // namespace AudioTest
+} // namespace djv
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvAudioTest/WaveformTest.h>
+
+#include <djvAudio/Data.h>
+#include <djvAudio/Waveform.h>
+
+using namespace djv::Core;
+using namespace djv::Audio;
+
+namespace djv
+{
+    namespace AudioTest
+    {
+        WaveformTest::WaveformTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::AudioTest::WaveformTest", tempPath, context)
+        {}
+        
+        void WaveformTest::run()
+        {
+            _waveform();
+            _levels();
+            _samples();
+        }
+        
+        void WaveformTest::_waveform()
+        {
+            {
+                const Waveform waveform;
+                DJV_ASSERT(0 == waveform.getChannelCount());
+                DJV_ASSERT(0 == waveform.getSampleCount());
+                DJV_ASSERT(!waveform.isFinished());
+            }
+            
+            {
+                // Add a ramp from -1 to 1 in 16-bit samples.
+                const Audio::Info info(2, Audio::Type::S16, 44100);
+                auto data = Audio::Data::create(info, 1000);
+                auto p = reinterpret_cast<S16_T*>(data->getData());
+                for (size_t i = 0; i < 1000; ++i, p += 2)
+                {
+                    p[0] = static_cast<S16_T>(S16Range.getMin() + (i * 65535) / 999);
+                    p[1] = 0;
+                }
+                Waveform waveform(2, 44100, 100);
+                waveform.add(data);
+                waveform.finish();
+                DJV_ASSERT(2 == waveform.getChannelCount());
+                DJV_ASSERT(44100 == waveform.getSampleRate());
+                DJV_ASSERT(100 == waveform.getBlockSize());
+                DJV_ASSERT(1000 == waveform.getSampleCount());
+                DJV_ASSERT(waveform.isFinished());
+                const auto& level = waveform.getLevel(0, 0);
+                DJV_ASSERT(10 == level.size());
+                DJV_ASSERT(level[0].min < -.99F);
+                DJV_ASSERT(level[9].max > .99F);
+                DJV_ASSERT(level[0].max < level[1].min);
+                for (const auto& i : waveform.getLevel(0, 1))
+                {
+                    DJV_ASSERT(WaveformSample() == i);
+                }
+
+                // Adding data after finishing is ignored.
+                waveform.add(data);
+                DJV_ASSERT(1000 == waveform.getSampleCount());
+
+                // Data with a different channel count is ignored.
+                Waveform waveform2(1, 44100, 100);
+                waveform2.add(data);
+                DJV_ASSERT(0 == waveform2.getSampleCount());
+            }
+        }
+        
+        void WaveformTest::_levels()
+        {
+            {
+                // A constant signal has the same summary at every level.
+                std::vector<F32_T> data(1050, .5F);
+                Waveform waveform(1, 44100, 10);
+                waveform.add(data.data(), data.size());
+                waveform.finish();
+                DJV_ASSERT(105 == waveform.getLevel(0, 0).size());
+                DJV_ASSERT(waveform.getLevelCount() > 1);
+                DJV_ASSERT(1 == waveform.getLevel(waveform.getLevelCount() - 1, 0).size());
+                for (size_t i = 0; i < waveform.getLevelCount(); ++i)
+                {
+                    DJV_ASSERT(10 << i == waveform.getLevelBlockSize(i));
+                    for (const auto& j : waveform.getLevel(i, 0))
+                    {
+                        DJV_ASSERT(.5F == j.min);
+                        DJV_ASSERT(.5F == j.max);
+                        DJV_ASSERT(std::abs(j.rms - .5F) < .0001F);
+                    }
+                }
+
+                // Restore the waveform from the finest level.
+                const Waveform waveform2(
+                    1,
+                    44100,
+                    10,
+                    waveform.getSampleCount(),
+                    { waveform.getLevel(0, 0) });
+                DJV_ASSERT(waveform == waveform2);
+            }
+        }
+        
+        void WaveformTest::_samples()
+        {
+            {
+                std::vector<F32_T> data(10000);
+                for (size_t i = 0; i < data.size(); ++i)
+                {
+                    data[i] = i < 5120 ? -.25F : .75F;
+                }
+                Waveform waveform(1, 44100, 10);
+                waveform.add(data.data(), data.size());
+                waveform.finish();
+
+                const auto samples = waveform.getSamples(0, Math::SizeTRange(0, 9999), 2);
+                DJV_ASSERT(2 == samples.size());
+                DJV_ASSERT(-.25F == samples[0].min);
+                DJV_ASSERT(-.25F == samples[0].max);
+                DJV_ASSERT(-.25F == samples[1].min);
+                DJV_ASSERT(.75F == samples[1].max);
+
+                const auto samples2 = waveform.getSamples(0, Math::SizeTRange(4000, 5999), 1);
+                DJV_ASSERT(1 == samples2.size());
+                DJV_ASSERT(-.25F == samples2[0].min);
+                DJV_ASSERT(.75F == samples2[0].max);
+
+                // More values than blocks repeat the finest level.
+                const auto samples3 = waveform.getSamples(0, Math::SizeTRange(0, 99), 100);
+                DJV_ASSERT(100 == samples3.size());
+                DJV_ASSERT(-.25F == samples3[99].max);
+
+                DJV_ASSERT(waveform.getSamples(0, Math::SizeTRange(0, 9999), 0).empty());
+                DJV_ASSERT(waveform.getSamples(1, Math::SizeTRange(0, 9999), 10).empty());
+            }
+        }
+        
+    } // namespace AudioTest
+} // namespace djv
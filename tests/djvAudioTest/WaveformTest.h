@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace AudioTest
+    {
+        class WaveformTest : public Test::ITest
+        {
+        public:
+            WaveformTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+            
+        private:
+            void _waveform();
+            void _levels();
+            void _samples();
+        };
+        
+    } // namespace AudioTest
+} // namespace djv
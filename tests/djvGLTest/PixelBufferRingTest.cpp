@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvGLTest/PixelBufferRingTest.h>
+
+#include <djvGL/PixelBufferRing.h>
+#include <djvGL/Texture.h>
+
+#include <djvImage/Data.h>
+
+#include <sstream>
+
+using namespace djv::Core;
+using namespace djv::GL;
+
+namespace djv
+{
+    namespace GLTest
+    {
+        PixelBufferRingTest::PixelBufferRingTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::GLTest::PixelBufferRingTest", tempPath, context)
+        {}
+        
+        void PixelBufferRingTest::run()
+        {
+            auto ring = PixelBufferRing::create(2);
+            DJV_ASSERT(0 == ring->getUploadCount());
+            for (const auto& info : {
+                Image::Info(64, 64, Image::Type::RGBA_U8),
+                Image::Info(1920, 1080, Image::Type::RGB_U10),
+                Image::Info(4096, 2160, Image::Type::RGBA_F16) })
+            {
+                auto texture = Texture::create(info);
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    auto data = Image::Data::create(info);
+                    data->zero();
+                    ring->upload(data, texture);
+                }
+                ring->finish();
+            }
+            ring->finish();
+            DJV_ASSERT(12 == ring->getUploadCount());
+            {
+                std::stringstream ss;
+                ss << "Upload count: " << ring->getUploadCount() << "\n";
+                ss << "Upload byte count: " << ring->getUploadByteCount() << "\n";
+                ss << "Upload time: " << ring->getUploadTime().count() << "us\n";
+                ss << "Stall count: " << ring->getStallCount();
+                _print(ss.str());
+            }
+            ring->resetStats();
+            DJV_ASSERT(0 == ring->getUploadCount());
+            DJV_ASSERT(0 == ring->getUploadByteCount());
+        }
+
+    } // namespace GLTest
+} // namespace djv
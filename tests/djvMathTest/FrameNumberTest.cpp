@@ -88,6 +88,9 @@ namespace djv
                 DJV_ASSERT(sequence.getRanges()[0] == Frame::Range(1, 10));
                 sequence.add(Frame::Range(12, 100));
                 DJV_ASSERT(sequence.getRanges()[0] == Frame::Range(1, 10));
+                sequence.clear();
+                DJV_ASSERT(sequence.getRanges().empty());
+                DJV_ASSERT(!sequence.isValid());
             }
         }
                 
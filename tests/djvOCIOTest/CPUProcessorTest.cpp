@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvOCIOTest/CPUProcessorTest.h>
+
+#include <djvOCIO/CPUProcessor.h>
+#include <djvOCIO/OCIOSystem.h>
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/ResourceSystem.h>
+
+#include <djvCore/RandomFunc.h>
+#include <djvCore/Time.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+using namespace djv::Core;
+using namespace djv::OCIO;
+
+namespace djv
+{
+    namespace OCIOTest
+    {
+        namespace
+        {
+            const std::vector<OCIO::Convert> converts =
+            {
+                OCIO::Convert("lnf", "srgb8"),
+                OCIO::Convert("lg10", "srgb8"),
+                OCIO::Convert("vd8", "lnf")
+            };
+
+            std::vector<float> randomPixels(size_t count)
+            {
+                std::vector<float> out;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    out.push_back(Random::getRandom());
+                    out.push_back(Random::getRandom());
+                    out.push_back(Random::getRandom());
+                    out.push_back(1.F);
+                }
+                return out;
+            }
+
+        } // namespace
+
+        CPUProcessorTest::CPUProcessorTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::OCIOTest::CPUProcessorTest", tempPath, context)
+        {}
+        
+        void CPUProcessorTest::run()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto system = context->getSystemT<OCIO::OCIOSystem>();
+                auto resourceSystem = context->getSystemT<System::ResourceSystem>();
+                OCIO::Config config;
+                config.fileName = System::File::Path(
+                    resourceSystem->getPath(System::File::ResourcePath::Color),
+                    "spi-vfx/config.ocio").get();
+                system->setConfigMode(OCIO::ConfigMode::CmdLine);
+                system->setCmdLineConfig(config);
+
+                _accuracy();
+                _image();
+                _cache();
+                _benchmark();
+
+                system->setConfigMode(OCIO::ConfigMode::None);
+            }
+        }
+
+        void CPUProcessorTest::_accuracy()
+        {
+            for (const auto& convert : converts)
+            {
+                try
+                {
+                    auto lut = OCIO::CPUProcessor::create(convert, OCIO::ProcessorMode::LUT);
+                    auto exact = OCIO::CPUProcessor::create(convert, OCIO::ProcessorMode::Exact);
+                    DJV_ASSERT(convert == lut->getConvert());
+                    DJV_ASSERT(OCIO::ProcessorMode::LUT == lut->getMode());
+                    DJV_ASSERT(OCIO::ProcessorMode::Exact == exact->getMode());
+
+                    const size_t count = 10000;
+                    std::vector<float> a = randomPixels(count);
+                    std::vector<float> b = a;
+                    lut->apply(a.data(), count);
+                    exact->apply(b.data(), count);
+                    float maxError = 0.F;
+                    for (size_t i = 0; i < a.size(); ++i)
+                    {
+                        maxError = std::max(maxError, std::abs(a[i] - b[i]));
+                    }
+                    std::stringstream ss;
+                    ss << convert.input << " -> " << convert.output << " max error: " << maxError;
+                    _print(ss.str());
+                    DJV_ASSERT(maxError < .05F);
+                }
+                catch (const std::exception& e)
+                {
+                    _print(e.what());
+                }
+            }
+        }
+
+        void CPUProcessorTest::_image()
+        {
+            try
+            {
+                auto processor = OCIO::CPUProcessor::create(converts[0]);
+                for (auto type : { Image::Type::RGB_U8, Image::Type::RGBA_F16, Image::Type::RGBA_F32 })
+                {
+                    auto data = Image::Data::create(Image::Info(64, 64, type));
+                    data->zero();
+                    processor->apply(data);
+                    processor->apply(data, 1);
+                }
+                processor->apply(std::shared_ptr<Image::Data>());
+            }
+            catch (const std::exception& e)
+            {
+                _print(e.what());
+            }
+        }
+
+        void CPUProcessorTest::_cache()
+        {
+            if (auto context = getContext().lock())
+            {
+                auto system = context->getSystemT<OCIO::OCIOSystem>();
+                try
+                {
+                    auto a = system->getCPUProcessor(converts[0]);
+                    auto b = system->getCPUProcessor(converts[0]);
+                    DJV_ASSERT(a == b);
+                    auto c = system->getCPUProcessor(converts[0], OCIO::ProcessorMode::Exact);
+                    DJV_ASSERT(a != c);
+                    DJV_ASSERT(system->getCPUProcessorCacheSize() >= 2);
+                }
+                catch (const std::exception& e)
+                {
+                    _print(e.what());
+                }
+            }
+        }
+
+        void CPUProcessorTest::_benchmark()
+        {
+            const Image::Size size(1920, 1080);
+            for (const auto& convert : converts)
+            {
+                for (auto mode : { OCIO::ProcessorMode::LUT, OCIO::ProcessorMode::Exact })
+                {
+                    try
+                    {
+                        auto processor = OCIO::CPUProcessor::create(convert, mode);
+                        auto data = Image::Data::create(Image::Info(size, Image::Type::RGBA_F32));
+                        data->zero();
+                        const auto t0 = std::chrono::steady_clock::now();
+                        const size_t iterations = 10;
+                        for (size_t i = 0; i < iterations; ++i)
+                        {
+                            processor->apply(data);
+                        }
+                        const auto t1 = std::chrono::steady_clock::now();
+                        const std::chrono::duration<float> diff = t1 - t0;
+                        std::stringstream ss;
+                        ss << convert.input << " -> " << convert.output << " ";
+                        ss << (OCIO::ProcessorMode::LUT == mode ? "LUT" : "exact") << ": ";
+                        ss << (size.w * size.h * iterations / diff.count() / 1000000.F) << " Mpixels/s";
+                        _print(ss.str());
+                    }
+                    catch (const std::exception& e)
+                    {
+                        _print(e.what());
+                    }
+                }
+            }
+        }
+        
+    } // namespace OCIOTest
+} // namespace djv
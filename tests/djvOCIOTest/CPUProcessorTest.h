@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace OCIOTest
+    {
+        class CPUProcessorTest : public Test::ITest
+        {
+        public:
+            CPUProcessorTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+            
+        private:
+            void _accuracy();
+            void _image();
+            void _cache();
+            void _benchmark();
+        };
+        
+    } // namespace OCIOTest
+} // namespace djv
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvOCIOTest/LUTFuncTest.h>
+
+#include <djvOCIO/LUT.h>
+#include <djvOCIO/LUTFunc.h>
+
+#include <djvMath/MathFunc.h>
+
+#include <djvCore/RandomFunc.h>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+
+using namespace djv::Core;
+using namespace djv::OCIO;
+
+namespace djv
+{
+    namespace OCIOTest
+    {
+        LUTFuncTest::LUTFuncTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::OCIOTest::LUTFuncTest", tempPath, context)
+        {}
+        
+        void LUTFuncTest::run()
+        {
+            _domain();
+            _lut1D();
+            _lut3D();
+        }
+
+        void LUTFuncTest::_domain()
+        {
+            {
+                const OCIO::Domain domain;
+                DJV_ASSERT(OCIO::Allocation::Uniform == domain.allocation);
+                DJV_ASSERT(fuzzyCompare(domain.toLUT(.5F), .5F));
+                DJV_ASSERT(fuzzyCompare(domain.fromLUT(.5F), .5F));
+            }
+
+            {
+                OCIO::Domain domain;
+                domain.allocation = OCIO::Allocation::LG2;
+                domain.min = -8.F;
+                domain.max = 8.F;
+                for (const float i : { .01F, .18F, 1.F, 10.F })
+                {
+                    DJV_ASSERT(std::abs(domain.fromLUT(domain.toLUT(i)) - i) < .0001F * std::max(i, 1.F));
+                }
+            }
+        }
+        
+        void LUTFuncTest::_lut1D()
+        {
+            OCIO::LUT1D lut(256);
+            float* p = lut.getData();
+            for (size_t i = 0; i < lut.getSize(); ++i, p += 4)
+            {
+                p[0] = 1.F - p[0];
+            }
+            float rgba[] = { .25F, .5F, .75F, .1F };
+            OCIO::applyLUT1D(lut, rgba, 1);
+            DJV_ASSERT(std::abs(rgba[0] - .75F) < .001F);
+            DJV_ASSERT(std::abs(rgba[1] - .5F) < .001F);
+            DJV_ASSERT(std::abs(rgba[2] - .75F) < .001F);
+            DJV_ASSERT(rgba[3] == .1F);
+        }
+
+        void LUTFuncTest::_lut3D()
+        {
+            {
+                // An identity LUT should reproduce the input.
+                const OCIO::LUT3D lut(17);
+                std::vector<float> rgba;
+                for (size_t i = 0; i < 1000; ++i)
+                {
+                    rgba.push_back(Random::getRandom());
+                    rgba.push_back(Random::getRandom());
+                    rgba.push_back(Random::getRandom());
+                    rgba.push_back(Random::getRandom());
+                }
+                std::vector<float> result = rgba;
+                OCIO::applyLUT3D(lut, result.data(), 1000);
+                float maxError = 0.F;
+                for (size_t i = 0; i < rgba.size(); ++i)
+                {
+                    maxError = std::max(maxError, std::abs(result[i] - rgba[i]));
+                }
+                std::stringstream ss;
+                ss << "LUT3D identity max error: " << maxError;
+                _print(ss.str());
+                DJV_ASSERT(maxError < .0001F);
+            }
+
+            {
+                // A channel swapping LUT is linear, so tetrahedral
+                // interpolation should be exact.
+                OCIO::LUT3D lut(5);
+                float* p = lut.getData();
+                const size_t size = lut.getEdgeLen() * lut.getEdgeLen() * lut.getEdgeLen();
+                for (size_t i = 0; i < size; ++i, p += 4)
+                {
+                    std::swap(p[0], p[2]);
+                }
+                float rgba[] = { .1F, .2F, .3F, 1.F, 1.5F, -.5F, .7F, .5F };
+                OCIO::applyLUT3D(lut, rgba, 2);
+                DJV_ASSERT(std::abs(rgba[0] - .3F) < .0001F);
+                DJV_ASSERT(std::abs(rgba[1] - .2F) < .0001F);
+                DJV_ASSERT(std::abs(rgba[2] - .1F) < .0001F);
+                DJV_ASSERT(rgba[3] == 1.F);
+                DJV_ASSERT(std::abs(rgba[4] - .7F) < .0001F);
+                DJV_ASSERT(std::abs(rgba[5] - 0.F) < .0001F);
+                DJV_ASSERT(std::abs(rgba[6] - 1.F) < .0001F);
+                DJV_ASSERT(rgba[7] == .5F);
+            }
+        }
+        
+    } // namespace OCIOTest
+} // namespace djv
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace OCIOTest
+    {
+        class LUTFuncTest : public Test::ITest
+        {
+        public:
+            LUTFuncTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+            
+        private:
+            void _domain();
+            void _lut1D();
+            void _lut3D();
+        };
+        
+    } // namespace OCIOTest
+} // namespace djv
@@ -204,6 +204,17 @@ namespace djv
                     ss << "Text line: " << i.text;
                     _print(ss.str());
                 }
+
+                {
+                    // Measurements are cached so repeated requests are ready
+                    // without waiting on the worker threads.
+                    auto future = system->measure(text, fontInfo);
+                    DJV_ASSERT(future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+                    DJV_ASSERT(measure == future.get());
+                    auto textLinesCached = system->textLines(text, 100, fontInfo).get();
+                    DJV_ASSERT(textLines.size() == textLinesCached.size());
+                    DJV_ASSERT(system->getMeasureCacheSize() > 0);
+                }
                 
                 system->setLCDRendering(true);
                 system->setLCDRendering(true);
@@ -247,6 +258,16 @@ namespace djv
                     ss << "Glyph cache percentage: " << system->getGlyphCachePercentage();
                     _print(ss.str());
                 }
+                {
+                    std::stringstream ss;
+                    ss << "Measure cache size: " << system->getMeasureCacheSize();
+                    _print(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << "Measure cache percentage: " << system->getMeasureCachePercentage();
+                    _print(ss.str());
+                }
             }
         }
 
@@ -133,6 +133,11 @@ namespace djv
                 }
                 render->setFillColor(Image::Color(.6F, 1.F, .4F));
                 render->drawFilledImage(image, glm::vec2(400.f, 500.f));
+                for (size_t i = 0; i < pixelBufferCount + 1; ++i)
+                {
+                    image = Image::Data::create(Image::Info(1024, 1024, Image::Type::RGBA_U8));
+                    render->drawImage(image, glm::vec2(0.f, 0.f), imageOptions);
+                }
                 
                 Font::FontInfo fontInfo(1, 1, 64, dpiDefault);
                 auto fontSystem = context->getSystemT<Font::FontSystem>();
@@ -151,6 +156,14 @@ namespace djv
                 render->popTransform();
                                 
                 render->endFrame();
+
+                // Redraw a damaged region.
+                render->beginFrame(size, Math::BBox2f(100.F, 100.F, 200.F, 100.F));
+                render->setFillColor(Image::Color(1.F, .4F, .6F));
+                render->drawRect(Math::BBox2f(0.F, 0.F, 1280.F, 720.F));
+                render->drawRect(Math::BBox2f(1000.F, 600.F, 100.F, 100.F));
+                render->endFrame();
+                DJV_ASSERT(1 == render->getPrimitivesCount());
                 glBindFramebuffer(GL_FRAMEBUFFER, 0);
                 
                 {
@@ -173,6 +186,21 @@ namespace djv
                     ss << "VBO size: " << render->getVBOSize();
                     _print(ss.str());
                 }
+                {
+                    std::stringstream ss;
+                    ss << "Texture upload count: " << render->getTextureUploadCount();
+                    _print(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << "Texture upload time: " << render->getTextureUploadTime().count() << "us";
+                    _print(ss.str());
+                }
+                {
+                    std::stringstream ss;
+                    ss << "Texture upload stall count: " << render->getTextureUploadStallCount();
+                    _print(ss.str());
+                }
             }
         }
         
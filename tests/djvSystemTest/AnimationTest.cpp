@@ -84,6 +84,28 @@ namespace djv
                 
                 _tickFor(std::chrono::milliseconds(300));
             }
+
+            if (auto context = getContext().lock())
+            {
+                auto system = context->getSystemT<Animation::AnimationSystem>();
+                const bool active = system->hasActiveAnimations();
+                auto animation = Animation::Animation::create(context);
+                DJV_ASSERT(system->hasActiveAnimations() == active);
+                animation->start(
+                    0.F,
+                    1.F,
+                    std::chrono::milliseconds(250),
+                    [](float)
+                    {},
+                    [](float)
+                    {});
+                DJV_ASSERT(system->hasActiveAnimations());
+                const auto now = std::chrono::steady_clock::now();
+                DJV_ASSERT(context->getNextTick() <= std::chrono::steady_clock::now());
+                DJV_ASSERT(context->getNextTick() >= now);
+                animation->stop();
+                DJV_ASSERT(system->hasActiveAnimations() == active);
+            }
         }
         
     } // namespace SystemTest
@@ -9,7 +9,9 @@
 
 #include <djvCore/String.h>
 
+#include <atomic>
 #include <sstream>
+#include <thread>
 
 using namespace djv::Core;
 using namespace djv::System;
@@ -36,6 +38,11 @@ namespace djv
                 ~TestSystem() override
                 {}
 
+                void wake()
+                {
+                    _wake();
+                }
+
                 static std::shared_ptr<TestSystem> create(const std::shared_ptr<Context>& context)
                 {
                     auto out = context->getSystemT<TestSystem>();
@@ -95,6 +102,31 @@ namespace djv
                     _print(ss.str());
                 }
             }
+
+            if (auto context = getContext().lock())
+            {
+                auto wakeCallback = context->getWakeCallback();
+                DJV_ASSERT(wakeCallback);
+                (*wakeCallback)();
+
+                std::atomic<size_t> count(0);
+                wakeCallback->setCallback(
+                    [&count]
+                    {
+                        ++count;
+                    });
+                auto system = TestSystem::create(context);
+                std::thread thread(
+                    [system]
+                    {
+                        system->wake();
+                    });
+                thread.join();
+                DJV_ASSERT(1 == count);
+                wakeCallback->setCallback(nullptr);
+                system->wake();
+                DJV_ASSERT(1 == count);
+            }
         }
         
     } // namespace SystemTest
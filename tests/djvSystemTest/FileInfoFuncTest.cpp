@@ -6,10 +6,15 @@
 
 #include <djvSystem/FileIO.h>
 #include <djvSystem/FileInfoFunc.h>
+#include <djvSystem/PathFunc.h>
 
 #include <djvMath/FrameNumberFunc.h>
 
+#include <djvCore/ErrorFunc.h>
+
+#include <algorithm>
 #include <iomanip>
+#include <mutex>
 
 using namespace djv::Core;
 using namespace djv::System;
@@ -45,6 +50,17 @@ namespace djv
                     File::Mode::Write);
             }
             
+            const File::Path walkPath(getTempPath(), "walk");
+            const File::Path walkSubPath(walkPath, "sub");
+            if (!File::Info(walkSubPath).doesExist())
+            {
+                File::mkdir(walkPath);
+                File::mkdir(walkSubPath);
+            }
+            io->open(
+                File::Path(walkSubPath, _fileName).get(),
+                File::Mode::Write);
+            
             _enum();
             _util();
             _serialize();
@@ -123,6 +139,90 @@ namespace djv
                 const auto info = File::getSequence(path, {});
                 DJV_ASSERT(info.getPath() == path);
             }
+
+            {
+                File::DirectoryListOptions options;
+                options.sequences = true;
+                options.sequenceExtensions.insert(".exr");
+                std::mutex mutex;
+                std::vector<std::string> fileNames;
+                File::directoryWalk(
+                    File::Path(getTempPath()),
+                    options,
+                    4,
+                    [&mutex, &fileNames](const File::Info& value)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        fileNames.push_back(value.getFileName(Math::Frame::invalid, false));
+                    });
+                for (const auto& i : fileNames)
+                {
+                    _print("Directory walk: " + i);
+                }
+                DJV_ASSERT(5 == fileNames.size());
+                DJV_ASSERT(2 == std::count(fileNames.begin(), fileNames.end(), _fileName));
+                DJV_ASSERT(1 == std::count(fileNames.begin(), fileNames.end(), "render.1-100.exr"));
+                DJV_ASSERT(1 == std::count(fileNames.begin(), fileNames.end(), "sub"));
+            }
+
+            try
+            {
+                File::directoryWalk(
+                    File::Path(getTempPath()),
+                    File::DirectoryListOptions(),
+                    4,
+                    [](const File::Info&)
+                    {
+                        throw std::runtime_error("error");
+                    });
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception&)
+            {}
+
+            {
+                // The errors are reported and the walk continues.
+                std::mutex mutex;
+                size_t itemCount = 0;
+                size_t errorCount = 0;
+                File::directoryWalk(
+                    File::Path(getTempPath()),
+                    File::DirectoryListOptions(),
+                    4,
+                    [&mutex, &itemCount](const File::Info&)
+                    {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            ++itemCount;
+                        }
+                        throw std::runtime_error("error");
+                    },
+                    [&mutex, &errorCount](const File::Path&, const std::exception&)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        ++errorCount;
+                    });
+                DJV_ASSERT(itemCount > 0);
+                DJV_ASSERT(itemCount == errorCount);
+            }
+
+            {
+                const File::Path path(getTempPath(), "FileInfoFuncTest.missing");
+                std::vector<File::Path> errors;
+                File::directoryWalk(
+                    path,
+                    File::DirectoryListOptions(),
+                    4,
+                    [](const File::Info&)
+                    {},
+                    [this, &errors](const File::Path& value, const std::exception& e)
+                    {
+                        errors.push_back(value);
+                        _print(Error::format(e.what()));
+                    });
+                DJV_ASSERT(1 == errors.size());
+                DJV_ASSERT(path == errors[0]);
+            }
         }
 
         void FileInfoFuncTest::_serialize()
@@ -4,6 +4,8 @@
 
 #include <djvSystemTest/FileInfoTest.h>
 
+#include <djvTestLib/AllocTest.h>
+
 #include <djvSystem/FileIO.h>
 #include <djvSystem/FileInfo.h>
 
@@ -49,6 +51,7 @@ namespace djv
             _ctor();
             _path();
             _sequences();
+            _nameTemplate();
             _operators();
         }
 
@@ -222,6 +225,59 @@ namespace djv
             }
         }
 
+        void FileInfoTest::_nameTemplate()
+        {
+            {
+                const File::Info info("/tmp/render.0001.exr", false);
+                const File::Info sequence(
+                    File::Path("/tmp/render.0001.exr"),
+                    File::Type::Sequence,
+                    Math::Frame::Sequence(Math::Frame::Range(1, 1000), 4),
+                    false);
+                for (const auto& i : { info, sequence })
+                {
+                    for (bool path : { true, false })
+                    {
+                        const File::NameTemplate nameTemplate = i.getNameTemplate(path);
+                        DJV_ASSERT(nameTemplate == nameTemplate);
+                        std::string fileName;
+                        for (Math::Frame::Number frame : { 1, 10, 999, 1000, 12345, -1 })
+                        {
+                            nameTemplate.getFileName(frame, fileName);
+                            const std::string expected = File::Type::Sequence == i.getType() ?
+                                i.getFileName(frame, path) :
+                                i.getFileName(Math::Frame::invalid, path);
+                            DJV_ASSERT(expected == fileName);
+                        }
+                    }
+                }
+            }
+
+            {
+                const File::Info info(
+                    File::Path("/tmp/render.1.exr"),
+                    File::Type::Sequence,
+                    Math::Frame::Sequence(Math::Frame::Range(1, 1000)),
+                    false);
+                const File::NameTemplate nameTemplate = info.getNameTemplate();
+                DJV_ASSERT("/tmp/render." == nameTemplate.prefix);
+                DJV_ASSERT(0 == nameTemplate.pad);
+                DJV_ASSERT(".exr" == nameTemplate.suffix);
+                DJV_ASSERT(nameTemplate.sequence);
+
+                // Once the string has grown no more memory is allocated.
+                std::string fileName;
+                nameTemplate.getFileName(1000, fileName);
+                const size_t allocCount = Test::getAllocCount();
+                for (Math::Frame::Number i = 1; i <= 1000; ++i)
+                {
+                    nameTemplate.getFileName(i, fileName);
+                }
+                DJV_ASSERT(Test::getAllocCount() == allocCount);
+                DJV_ASSERT("/tmp/render.1000.exr" == fileName);
+            }
+        }
+
         void FileInfoTest::_operators()
         {
             {
@@ -25,6 +25,7 @@ namespace djv
             void _ctor();
             void _path();
             void _sequences();
+            void _nameTemplate();
             void _operators();
 
             std::string _fileName;
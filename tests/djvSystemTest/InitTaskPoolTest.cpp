@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystemTest/InitTaskPoolTest.h>
+
+#include <djvSystem/InitTaskPool.h>
+
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+using namespace djv::Core;
+using namespace djv::System;
+
+namespace djv
+{
+    namespace SystemTest
+    {
+        InitTaskPoolTest::InitTaskPoolTest(
+            const File::Path& tempPath,
+            const std::shared_ptr<Context>& context) :
+            ITest("djv::SystemTest::InitTaskPoolTest", tempPath, context)
+        {}
+        
+        void InitTaskPoolTest::run()
+        {
+            _dependencies();
+            _singleThread();
+            _exception();
+            _destroy();
+        }
+
+        void InitTaskPoolTest::_dependencies()
+        {
+            auto pool = InitTaskPool::create(4);
+            DJV_ASSERT(4 == pool->getThreadCount());
+            std::mutex mutex;
+            std::vector<int> order;
+            auto append = [&mutex, &order](int value)
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                order.push_back(value);
+            };
+            auto a = pool->addTask(
+                [append]
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    append(0);
+                });
+            auto b = pool->addTask(
+                [append]
+                {
+                    append(1);
+                },
+                { a });
+            auto c = pool->addTask(
+                [append]
+                {
+                    append(2);
+                },
+                { a, b });
+            c.wait();
+            DJV_ASSERT(3 == order.size());
+            DJV_ASSERT(0 == order[0]);
+            DJV_ASSERT(1 == order[1]);
+            DJV_ASSERT(2 == order[2]);
+        }
+
+        void InitTaskPoolTest::_singleThread()
+        {
+            // A task that depends on a task added after it must not block
+            // the only thread.
+            auto pool = InitTaskPool::create(0);
+            DJV_ASSERT(1 == pool->getThreadCount());
+            std::atomic<size_t> count(0);
+            std::promise<void> promise;
+            auto a = pool->addTask(
+                [&count]
+                {
+                    ++count;
+                },
+                { promise.get_future().share() });
+            auto b = pool->addTask(
+                [&count]
+                {
+                    ++count;
+                });
+            b.wait();
+            promise.set_value();
+            a.wait();
+            DJV_ASSERT(2 == count);
+        }
+
+        void InitTaskPoolTest::_exception()
+        {
+            auto pool = InitTaskPool::create(2);
+            auto a = pool->addTask(
+                []
+                {
+                    throw std::runtime_error("error");
+                });
+            try
+            {
+                a.get();
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception& e)
+            {
+                _print(e.what());
+            }
+
+            // Dependent tasks still run after a task throws.
+            bool value = false;
+            pool->addTask(
+                [&value]
+                {
+                    value = true;
+                },
+                { a }).wait();
+            DJV_ASSERT(value);
+        }
+
+        void InitTaskPoolTest::_destroy()
+        {
+            std::shared_future<void> future;
+            {
+                auto pool = InitTaskPool::create(1);
+                std::promise<void> promise;
+                future = pool->addTask(
+                    []
+                    {},
+                    { promise.get_future().share() });
+            }
+            future.wait();
+            try
+            {
+                future.get();
+                DJV_ASSERT(false);
+            }
+            catch (const std::future_error& e)
+            {
+                std::stringstream ss;
+                ss << "Discarded task: " << e.what();
+                _print(ss.str());
+            }
+        }
+
+    } // namespace SystemTest
+} // namespace djv
+
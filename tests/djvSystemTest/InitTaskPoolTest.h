@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <djvTestLib/Test.h>
+
+namespace djv
+{
+    namespace SystemTest
+    {
+        class InitTaskPoolTest : public Test::ITest
+        {
+        public:
+            InitTaskPoolTest(
+                const System::File::Path& tempPath,
+                const std::shared_ptr<System::Context>&);
+            
+            void run() override;
+
+        private:
+            void _dependencies();
+            void _singleThread();
+            void _exception();
+            void _destroy();
+        };
+        
+    } // namespace SystemTest
+} // namespace djv
+
@@ -53,6 +53,19 @@ namespace djv
                     out->_init(context);
                     return out;
                 }
+
+                void setUpdateEvents(bool value)
+                {
+                    _setUpdateEvents(value);
+                }
+
+                size_t updateCount = 0;
+
+            protected:
+                void _updateEvent(System::Event::Update&) override
+                {
+                    ++updateCount;
+                }
             };
             
             class TestEventSystem : public Event::IEventSystem
@@ -78,10 +91,24 @@ namespace djv
                     return out;
                 }
             
+                void setRoot(const std::shared_ptr<IObject>& value)
+                {
+                    _root = value;
+                }
+
             protected:
                 void _init(System::Event::Init&) override {}
-                void _update(System::Event::Update&) override {}
+                void _update(System::Event::Update& event) override
+                {
+                    if (_root)
+                    {
+                        _updateRecursive(_root, event);
+                    }
+                }
                 void _hover(System::Event::PointerMove&, std::shared_ptr<IObject>&) override {}
+
+            private:
+                std::shared_ptr<IObject> _root;
             };
         
         } // namespace
@@ -116,6 +143,12 @@ namespace djv
                     child2->setEnabled(false);
                     DJV_ASSERT(!child2->isEnabled());
                     parent->addChild(child2);
+                    parent->setEnabled(false);
+                    DJV_ASSERT(child->isEnabled());
+                    DJV_ASSERT(!child->isEnabled(true));
+                    parent->setEnabled(true);
+                    DJV_ASSERT(child->isEnabled(true));
+                    DJV_ASSERT(!child2->isEnabled(true));
                     child2->moveToFront();
                     child2->moveToBack();
                     
@@ -155,6 +188,50 @@ namespace djv
                     DJV_ASSERT(child->getChildren().size() == 0);
                 }
 
+                {
+                    // Only the objects that enable update events receive them.
+                    auto parent = TestObject::create(context);
+                    auto child = TestObject::create(context);
+                    auto child2 = TestObject::create(context);
+                    auto grandChild = TestObject::create(context);
+                    parent->addChild(child);
+                    parent->addChild(child2);
+                    child2->addChild(grandChild);
+                    system->setRoot(parent);
+
+                    system->tick();
+                    DJV_ASSERT(0 == parent->updateCount);
+                    DJV_ASSERT(0 == child->updateCount);
+                    DJV_ASSERT(0 == child2->updateCount);
+                    DJV_ASSERT(0 == grandChild->updateCount);
+
+                    grandChild->setUpdateEvents(true);
+                    system->tick();
+                    DJV_ASSERT(0 == parent->updateCount);
+                    DJV_ASSERT(0 == child->updateCount);
+                    DJV_ASSERT(0 == child2->updateCount);
+                    DJV_ASSERT(1 == grandChild->updateCount);
+
+                    // Moving the object moves its update events count.
+                    child->addChild(grandChild);
+                    system->tick();
+                    DJV_ASSERT(2 == grandChild->updateCount);
+                    parent->removeChild(child);
+                    system->tick();
+                    DJV_ASSERT(2 == grandChild->updateCount);
+                    parent->addChild(child);
+                    system->tick();
+                    DJV_ASSERT(3 == grandChild->updateCount);
+
+                    grandChild->setUpdateEvents(false);
+                    system->tick();
+                    DJV_ASSERT(0 == parent->updateCount);
+                    DJV_ASSERT(0 == child->updateCount);
+                    DJV_ASSERT(3 == grandChild->updateCount);
+
+                    system->setRoot(nullptr);
+                }
+
                 context->removeSystem(system);
             }
             
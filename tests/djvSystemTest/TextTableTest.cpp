@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystemTest/TextTableTest.h>
+
+#include <djvSystem/File.h>
+#include <djvSystem/TextTable.h>
+
+#include <djvCore/ErrorFunc.h>
+
+#include <sstream>
+
+using namespace djv::Core;
+using namespace djv::System;
+
+namespace djv
+{
+    namespace SystemTest
+    {
+        TextTableTest::TextTableTest(
+            const File::Path& tempPath,
+            const std::shared_ptr<Context>& context) :
+            ITest("djv::SystemTest::TextTableTest", tempPath, context)
+        {}
+        
+        void TextTableTest::run()
+        {
+            for (const size_t count : { 0, 1, 2, 1000 })
+            {
+                std::map<std::string, std::string> text;
+                for (size_t i = 0; i < count; ++i)
+                {
+                    std::stringstream id;
+                    id << "id_" << i;
+                    std::stringstream value;
+                    value << "Text " << i % 10;
+                    text[id.str()] = value.str();
+                }
+                const File::Path path(getTempPath(), "TextTableTest" + textTableExtension);
+                TextTable::write(path, text);
+
+                auto table = TextTable::create(path);
+                DJV_ASSERT(count == table->getCount());
+                for (const auto& i : text)
+                {
+                    const std::string* value = table->getText(i.first);
+                    DJV_ASSERT(value);
+                    DJV_ASSERT(i.second == *value);
+                    DJV_ASSERT(value == table->getText(i.first));
+                }
+                DJV_ASSERT(!table->getText("missing"));
+                if (count > 0)
+                {
+                    const std::string* id = table->getID("Text 0");
+                    DJV_ASSERT(id);
+                    DJV_ASSERT("Text 0" == text[*id]);
+                }
+                DJV_ASSERT(!table->getID("missing"));
+            }
+
+            {
+                DJV_ASSERT("en" == TextTable::getLocale(File::Path("en" + textTableExtension)));
+                DJV_ASSERT("en" == TextTable::getLocale(File::Path("djvUI.en.text")));
+            }
+
+            try
+            {
+                TextTable::create(File::Path(getTempPath(), "missing" + textTableExtension));
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception& e)
+            {
+                _print(Error::format(e));
+            }
+        }
+        
+    } // namespace SystemTest
+} // namespace djv
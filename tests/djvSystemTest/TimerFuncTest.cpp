@@ -29,6 +29,17 @@ namespace djv
                 ss << i;
                 _print("Timer value: " + _getText(ss.str()));
             }
+
+            {
+                const auto t = std::chrono::steady_clock::now();
+                const auto frame = t + std::chrono::microseconds(1000000 / 60);
+                const auto idle = t + std::chrono::milliseconds(1000);
+                DJV_ASSERT(getWakeTime(t, t, 60, std::chrono::milliseconds(1000)) == frame);
+                DJV_ASSERT(getWakeTime(t, t + std::chrono::milliseconds(100), 60, std::chrono::milliseconds(1000)) ==
+                    t + std::chrono::milliseconds(100));
+                DJV_ASSERT(getWakeTime(t, Time::TimePoint::max(), 60, std::chrono::milliseconds(1000)) == idle);
+                DJV_ASSERT(getWakeTime(t, Time::TimePoint::max(), 60, std::chrono::milliseconds(0)) == frame);
+            }
         }
 
     } // namespace SystemTest
@@ -63,6 +63,21 @@ namespace djv
                 timer->stop();
                 DJV_ASSERT(!timer->isActive());
             }
+
+            if (auto context = getContext().lock())
+            {
+                auto system = context->getSystemT<TimerSystem>();
+                const auto nextTimeout = system->getNextTimeout();
+                auto timer = Timer::create(context);
+                timer->start(
+                    std::chrono::milliseconds(1),
+                    [](const std::chrono::steady_clock::time_point&, const Time::Duration&)
+                    {});
+                const auto after = std::chrono::steady_clock::now();
+                DJV_ASSERT(system->getNextTimeout() <= after + std::chrono::milliseconds(1));
+                timer->stop();
+                DJV_ASSERT(system->getNextTimeout() == nextTimeout);
+            }
         }
         
     } // namespace SystemTest
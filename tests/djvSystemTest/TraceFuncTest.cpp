@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystemTest/TraceFuncTest.h>
+
+#include <djvSystem/FileIO.h>
+#include <djvSystem/Path.h>
+#include <djvSystem/TraceFunc.h>
+
+using namespace djv::Core;
+using namespace djv::System;
+
+namespace djv
+{
+    namespace SystemTest
+    {
+        TraceFuncTest::TraceFuncTest(
+            const File::Path& tempPath,
+            const std::shared_ptr<Context>& context) :
+            ITest("djv::SystemTest::TraceFuncTest", tempPath, context)
+        {}
+        
+        void TraceFuncTest::run()
+        {
+            {
+                const std::string json = Trace::toChromeJSON({});
+                _print(json);
+                DJV_ASSERT(json.find("traceEvents") != std::string::npos);
+            }
+            
+            {
+                const auto now = std::chrono::steady_clock::now();
+                const std::vector<Trace::Event> events =
+                {
+                    Trace::Event("A", "test", now, now + std::chrono::milliseconds(2)),
+                    Trace::Event("\"B\"\n", "test", now + std::chrono::milliseconds(1), now + std::chrono::milliseconds(2))
+                };
+                const std::string json = Trace::toChromeJSON(events);
+                _print(json);
+                DJV_ASSERT(json.find("\"name\":\"A\",\"cat\":\"test\",\"ph\":\"X\",\"ts\":0,\"dur\":2000") != std::string::npos);
+                DJV_ASSERT(json.find("\"name\":\"\\\"B\\\"\\n\"") != std::string::npos);
+                DJV_ASSERT(json.find("\"ts\":1000") != std::string::npos);
+
+                const File::Path path(getTempPath(), "TraceFuncTest.json");
+                Trace::writeChromeJSON(path, events);
+                auto io = File::IO::create();
+                io->open(path.get(), File::Mode::Read);
+                DJV_ASSERT(json.size() == io->getSize());
+            }
+        }
+        
+    } // namespace SystemTest
+} // namespace djv
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvSystemTest/TraceTest.h>
+
+#include <djvSystem/Context.h>
+#include <djvSystem/Trace.h>
+
+#include <sstream>
+
+using namespace djv::Core;
+using namespace djv::System;
+
+namespace djv
+{
+    namespace SystemTest
+    {
+        TraceTest::TraceTest(
+            const File::Path& tempPath,
+            const std::shared_ptr<Context>& context) :
+            ITest("djv::SystemTest::TraceTest", tempPath, context)
+        {}
+        
+        void TraceTest::run()
+        {
+            {
+                auto recorder = Trace::Recorder::create();
+                DJV_ASSERT(recorder->getEvents().empty());
+                {
+                    Trace::Scope scope(recorder, "Scope", "test");
+                }
+                const auto now = std::chrono::steady_clock::now();
+                recorder->add(Trace::Event("Event", "test", now, now));
+                const auto events = recorder->getEvents();
+                DJV_ASSERT(2 == events.size());
+                DJV_ASSERT("Scope" == events[0].name);
+                DJV_ASSERT("test" == events[0].category);
+                DJV_ASSERT(events[0].end >= events[0].start);
+                DJV_ASSERT(std::this_thread::get_id() == events[0].thread);
+                recorder->clear();
+                DJV_ASSERT(recorder->getEvents().empty());
+            }
+            
+            {
+                Trace::Scope scope(nullptr, "Scope", "test");
+            }
+            
+            if (auto context = getContext().lock())
+            {
+                for (const auto& i : context->getTrace()->getEvents())
+                {
+                    std::stringstream ss;
+                    ss << i.category << " " << i.name << ": " <<
+                        std::chrono::duration_cast<Time::Duration>(i.end - i.start).count();
+                    _print(ss.str());
+                }
+            }
+        }
+        
+    } // namespace SystemTest
+} // namespace djv
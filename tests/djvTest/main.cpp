@@ -46,12 +46,16 @@
 #include <djvSystemTest/FileInfoTest.h>
 #include <djvSystemTest/IEventSystemTest.h>
 #include <djvSystemTest/ISystemTest.h>
+#include <djvSystemTest/InitTaskPoolTest.h>
 #include <djvSystemTest/LogSystemTest.h>
 #include <djvSystemTest/ObjectTest.h>
 #include <djvSystemTest/PathFuncTest.h>
 #include <djvSystemTest/PathTest.h>
 #include <djvSystemTest/RecentFilesModelTest.h>
 #include <djvSystemTest/TextSystemTest.h>
+#include <djvSystemTest/TextTableTest.h>
+#include <djvSystemTest/TraceFuncTest.h>
+#include <djvSystemTest/TraceTest.h>
 #include <djvSystemTest/TimerFuncTest.h>
 #include <djvSystemTest/TimerTest.h>
 
@@ -70,8 +74,12 @@
 #include <djvAudioTest/DataFuncTest.h>
 #include <djvAudioTest/DataTest.h>
 #include <djvAudioTest/InfoTest.h>
+#include <djvAudioTest/ResampleTest.h>
+#include <djvAudioTest/RingBufferTest.h>
+#include <djvAudioTest/TimeStretchTest.h>
 #include <djvAudioTest/TypeFuncTest.h>
 #include <djvAudioTest/TypeTest.h>
+#include <djvAudioTest/WaveformTest.h>
 
 #include <djvGeomTest/ShapeTest.h>
 #include <djvGeomTest/TriangleMeshFuncTest.h>
@@ -84,11 +92,14 @@
 #include <djvGLTest/MeshTest.h>
 #include <djvGLTest/OffscreenBufferFuncTest.h>
 #include <djvGLTest/OffscreenBufferTest.h>
+#include <djvGLTest/PixelBufferRingTest.h>
 #include <djvGLTest/ShaderTest.h>
 #include <djvGLTest/TextureFuncTest.h>
 #include <djvGLTest/TextureTest.h>
 #include <djvGLTest/TextureAtlasTest.h>
 
+#include <djvOCIOTest/CPUProcessorTest.h>
+#include <djvOCIOTest/LUTFuncTest.h>
 #include <djvOCIOTest/OCIOSystemFuncTest.h>
 #include <djvOCIOTest/OCIOSystemTest.h>
 #include <djvOCIOTest/OCIOTest.h>
@@ -108,13 +119,18 @@
 #include <djvAVTest/AVSystemTest.h>
 #include <djvAVTest/CineonFuncTest.h>
 #include <djvAVTest/DPXFuncTest.h>
+#include <djvAVTest/FilmstripTest.h>
 #include <djvAVTest/IOTest.h>
 #include <djvAVTest/PPMFuncTest.h>
 #include <djvAVTest/SpeedFuncTest.h>
+#include <djvAVTest/TelemetryFuncTest.h>
+#include <djvAVTest/TelemetryTest.h>
 #include <djvAVTest/ThumbnailSystemTest.h>
 #include <djvAVTest/TimeFuncTest.h>
 #if defined(FFmpeg_FOUND)
 #include <djvAVTest/FFmpegFuncTest.h>
+#include <djvAVTest/FFmpegIndexTest.h>
+#include <djvAVTest/FFmpegTest.h>
 #endif // FFmpeg_FOUND
 #if defined(JPEG_FOUND)
 #include <djvAVTest/JPEGFuncTest.h>
@@ -129,6 +145,7 @@
 #include <djvUITest/ActionGroupTest.h>
 #include <djvUITest/ButtonGroupTest.h>
 #include <djvUITest/EnumFuncTest.h>
+#include <djvUITest/IconAtlasTest.h>
 #include <djvUITest/SelectionModelTest.h>
 #include <djvUITest/WidgetTest.h>
 
@@ -214,12 +231,16 @@ int main(int argc, char ** argv)
         tests.emplace_back(new SystemTest::FileInfoTest(tempPath, context));
         tests.emplace_back(new SystemTest::IEventSystemTest(tempPath, context));
         tests.emplace_back(new SystemTest::ISystemTest(tempPath, context));
+        tests.emplace_back(new SystemTest::InitTaskPoolTest(tempPath, context));
         tests.emplace_back(new SystemTest::LogSystemTest(tempPath, context));
         tests.emplace_back(new SystemTest::ObjectTest(tempPath, context));
         tests.emplace_back(new SystemTest::PathFuncTest(tempPath, context));
         tests.emplace_back(new SystemTest::PathTest(tempPath, context));
         tests.emplace_back(new SystemTest::RecentFilesModelTest(tempPath, context));
         tests.emplace_back(new SystemTest::TextSystemTest(tempPath, context));
+        tests.emplace_back(new SystemTest::TextTableTest(tempPath, context));
+        tests.emplace_back(new SystemTest::TraceFuncTest(tempPath, context));
+        tests.emplace_back(new SystemTest::TraceTest(tempPath, context));
         tests.emplace_back(new SystemTest::TimerFuncTest(tempPath, context));
         tests.emplace_back(new SystemTest::TimerTest(tempPath, context));
 
@@ -238,8 +259,12 @@ int main(int argc, char ** argv)
         tests.emplace_back(new AudioTest::DataFuncTest(tempPath, context));
         tests.emplace_back(new AudioTest::DataTest(tempPath, context));
         tests.emplace_back(new AudioTest::InfoTest(tempPath, context));
+        tests.emplace_back(new AudioTest::ResampleTest(tempPath, context));
+        tests.emplace_back(new AudioTest::RingBufferTest(tempPath, context));
+        tests.emplace_back(new AudioTest::TimeStretchTest(tempPath, context));
         tests.emplace_back(new AudioTest::TypeFuncTest(tempPath, context));
         tests.emplace_back(new AudioTest::TypeTest(tempPath, context));
+        tests.emplace_back(new AudioTest::WaveformTest(tempPath, context));
 
         tests.emplace_back(new GeomTest::ShapeTest(tempPath, context));
         tests.emplace_back(new GeomTest::TriangleMeshFuncTest(tempPath, context));
@@ -252,11 +277,14 @@ int main(int argc, char ** argv)
         tests.emplace_back(new GLTest::MeshTest(tempPath, context));
         tests.emplace_back(new GLTest::OffscreenBufferFuncTest(tempPath, context));
         tests.emplace_back(new GLTest::OffscreenBufferTest(tempPath, context));
+        tests.emplace_back(new GLTest::PixelBufferRingTest(tempPath, context));
         tests.emplace_back(new GLTest::ShaderTest(tempPath, context));
         tests.emplace_back(new GLTest::TextureAtlasTest(tempPath, context));
         tests.emplace_back(new GLTest::TextureFuncTest(tempPath, context));
         tests.emplace_back(new GLTest::TextureTest(tempPath, context));
 
+        tests.emplace_back(new OCIOTest::CPUProcessorTest(tempPath, context));
+        tests.emplace_back(new OCIOTest::LUTFuncTest(tempPath, context));
         tests.emplace_back(new OCIOTest::OCIOSystemFuncTest(tempPath, context));
         tests.emplace_back(new OCIOTest::OCIOSystemTest(tempPath, context));
         tests.emplace_back(new OCIOTest::OCIOTest(tempPath, context));
@@ -276,13 +304,18 @@ int main(int argc, char ** argv)
         tests.emplace_back(new AVTest::AVSystemTest(tempPath, context));
         tests.emplace_back(new AVTest::CineonFuncTest(tempPath, context));
         tests.emplace_back(new AVTest::DPXFuncTest(tempPath, context));
+        tests.emplace_back(new AVTest::FilmstripTest(tempPath, context));
         tests.emplace_back(new AVTest::IOTest(tempPath, context));
         tests.emplace_back(new AVTest::PPMFuncTest(tempPath, context));
         tests.emplace_back(new AVTest::SpeedFuncTest(tempPath, context));
+        tests.emplace_back(new AVTest::TelemetryFuncTest(tempPath, context));
+        tests.emplace_back(new AVTest::TelemetryTest(tempPath, context));
         tests.emplace_back(new AVTest::ThumbnailSystemTest(tempPath, context));
         tests.emplace_back(new AVTest::TimeFuncTest(tempPath, context));
 #if defined(FFmpeg_FOUND)
         tests.emplace_back(new AVTest::FFmpegFuncTest(tempPath, context));
+        tests.emplace_back(new AVTest::FFmpegIndexTest(tempPath, context));
+        tests.emplace_back(new AVTest::FFmpegTest(tempPath, context));
 #endif // FFmpeg_FOUND
 #if defined(JPEG_FOUND)
         tests.emplace_back(new AVTest::JPEGFuncTest(tempPath, context));
@@ -297,6 +330,7 @@ int main(int argc, char ** argv)
         tests.emplace_back(new UITest::ActionGroupTest(tempPath, context));
         tests.emplace_back(new UITest::ButtonGroupTest(tempPath, context));
         tests.emplace_back(new UITest::EnumFuncTest(tempPath, context));
+        tests.emplace_back(new UITest::IconAtlasTest(tempPath, context));
         tests.emplace_back(new UITest::SelectionModelTest(tempPath, context));
         tests.emplace_back(new UITest::WidgetTest(tempPath, context));
 
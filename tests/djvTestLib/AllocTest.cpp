@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvTestLib/AllocTest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local size_t allocCount = 0;
+    std::atomic<size_t> globalAllocCount(0);
+
+    void* alloc(size_t size)
+    {
+        ++allocCount;
+        globalAllocCount.fetch_add(1, std::memory_order_relaxed);
+        return std::malloc(size ? size : 1);
+    }
+
+} // namespace
+
+void* operator new(size_t size)
+{
+    if (void* out = alloc(size))
+    {
+        return out;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    if (void* out = alloc(size))
+    {
+        return out;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return alloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return alloc(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    std::free(p);
+}
+
+namespace djv
+{
+    namespace Test
+    {
+        size_t getAllocCount()
+        {
+            return allocCount;
+        }
+
+        size_t getGlobalAllocCount()
+        {
+            return globalAllocCount.load(std::memory_order_relaxed);
+        }
+
+    } // namespace Test
+} // namespace djv
+
@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+
+namespace djv
+{
+    namespace Test
+    {
+        //! Get the number of heap allocations made by the current thread.
+        //!
+        //! The global allocation functions are replaced in the test
+        //! executable to count the allocations.
+        size_t getAllocCount();
+
+        //! Get the number of heap allocations made by all threads.
+        size_t getGlobalAllocCount();
+
+    } // namespace Test
+} // namespace djv
+
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: BSD-3-Clause
+// Copyright (c) 2020 Darby Johnston
+// All rights reserved.
+
+#include <djvUITest/IconAtlasTest.h>
+
+#include <djvUI/IconAtlas.h>
+
+#include <djvImage/Data.h>
+
+#include <djvSystem/File.h>
+
+#include <djvCore/ErrorFunc.h>
+
+#include <cstring>
+
+using namespace djv::Core;
+using namespace djv::UI;
+
+namespace djv
+{
+    namespace UITest
+    {
+        IconAtlasTest::IconAtlasTest(
+            const System::File::Path& tempPath,
+            const std::shared_ptr<System::Context>& context) :
+            ITest("djv::UITest::IconAtlasTest", tempPath, context)
+        {}
+        
+        void IconAtlasTest::run()
+        {
+            std::vector<std::pair<std::string, std::shared_ptr<Image::Data> > > icons;
+            for (const auto& i : {
+                Image::Info(16, 16, Image::Type::RGBA_U8),
+                Image::Info(3, 5, Image::Type::L_U8),
+                Image::Info(7, 3, Image::Type::RGB_U16) })
+            {
+                auto data = Image::Data::create(i);
+                for (size_t j = 0; j < data->getDataByteCount(); ++j)
+                {
+                    data->getData()[j] = static_cast<uint8_t>(j + icons.size());
+                }
+                std::stringstream ss;
+                ss << "icon" << icons.size();
+                icons.push_back(std::make_pair(ss.str(), data));
+            }
+            const System::File::Path path(getTempPath(), "IconAtlasTest" + iconAtlasExtension);
+            IconAtlas::write(path, icons);
+
+            auto atlas = IconAtlas::create(path);
+            DJV_ASSERT(icons.size() == atlas->getNames().size());
+            for (const auto& i : icons)
+            {
+                DJV_ASSERT(atlas->hasIcon(i.first));
+                auto data = atlas->getIcon(i.first);
+                DJV_ASSERT(data);
+                DJV_ASSERT(data->getInfo() == i.second->getInfo());
+                DJV_ASSERT(0 == memcmp(data->getData(), i.second->getData(), data->getDataByteCount()));
+            }
+            DJV_ASSERT(!atlas->hasIcon("missing"));
+            DJV_ASSERT(!atlas->getIcon("missing"));
+
+            try
+            {
+                IconAtlas::create(System::File::Path(getTempPath(), "missing" + iconAtlasExtension));
+                DJV_ASSERT(false);
+            }
+            catch (const std::exception& e)
+            {
+                _print(Error::format(e));
+            }
+        }
+        
+    } // namespace UITest
+} // namespace djv
@@ -128,6 +128,11 @@ namespace djv
                 }
                 ++_tick;
             }
+
+            bool damageReset(const Math::BBox2f& bounds, Math::BBox2f& damage)
+            {
+                return _redrawRequestReset(bounds, damage);
+            }
             
         protected:
             void _hover(const std::shared_ptr<System::IObject>& object, System::Event::PointerMove& event, std::shared_ptr<System::IObject>& hover)
@@ -172,6 +177,60 @@ namespace djv
             System::Event::PointerInfo _pointerInfo;
         };
         
+        namespace
+        {
+            class CountWidget : public Widget
+            {
+                DJV_NON_COPYABLE(CountWidget);
+
+            protected:
+                CountWidget()
+                {}
+
+            public:
+                static std::shared_ptr<CountWidget> create(const std::shared_ptr<System::Context>& context)
+                {
+                    auto out = std::shared_ptr<CountWidget>(new CountWidget);
+                    out->_init(context);
+                    return out;
+                }
+
+                void resizeRequest()
+                {
+                    _resize();
+                }
+
+                void resetCounts()
+                {
+                    preLayoutCount = 0;
+                    layoutCount = 0;
+                    clipCount = 0;
+                }
+
+                size_t preLayoutCount = 0;
+                size_t layoutCount = 0;
+                size_t clipCount = 0;
+
+            protected:
+                void _preLayoutEvent(System::Event::PreLayout&) override
+                {
+                    _setMinimumSize(glm::vec2(100.F, 100.F));
+                    ++preLayoutCount;
+                }
+
+                void _layoutEvent(System::Event::Layout&) override
+                {
+                    ++layoutCount;
+                }
+
+                void _clipEvent(System::Event::Clip&) override
+                {
+                    ++clipCount;
+                }
+            };
+
+        } // namespace
+
         WidgetTest::WidgetTest(
             const System::File::Path& tempPath,
             const std::shared_ptr<System::Context>& context) :
@@ -240,6 +299,85 @@ namespace djv
                     
                 window->close();
             }
+
+            if (auto context = getContext().lock())
+            {
+                // Damaged regions are accumulated into a bounding region,
+                // clipped to the window, and rounded out to whole pixels. The
+                // damage is reset after it is read.
+                auto system = TestEventSystem::create(context);
+                const Math::BBox2f bounds(0.F, 0.F, 100.F, 100.F);
+                Math::BBox2f damage;
+                system->damageReset(bounds, damage);
+                DJV_ASSERT(!system->damageReset(bounds, damage));
+
+                const size_t paintCount = system->getPaintCount();
+                const size_t partialPaintCount = system->getPartialPaintCount();
+                system->redrawRequest(Math::BBox2f(10.F, 10.F, 10.F, 10.F));
+                system->redrawRequest(Math::BBox2f(50.5F, 50.5F, 10.F, 10.F));
+                DJV_ASSERT(system->damageReset(bounds, damage));
+                DJV_ASSERT(damage == Math::BBox2f(glm::vec2(10.F, 10.F), glm::vec2(61.F, 61.F)));
+                DJV_ASSERT(system->getPaintCount() == paintCount + 1);
+                DJV_ASSERT(system->getPartialPaintCount() == partialPaintCount + 1);
+                DJV_ASSERT(!system->damageReset(bounds, damage));
+
+                system->redrawRequest(Math::BBox2f(glm::vec2(-10.F, -10.F), glm::vec2(20.F, 20.F)));
+                DJV_ASSERT(system->damageReset(bounds, damage));
+                DJV_ASSERT(damage == Math::BBox2f(glm::vec2(0.F, 0.F), glm::vec2(20.F, 20.F)));
+
+                system->redrawRequest(Math::BBox2f(200.F, 200.F, 10.F, 10.F));
+                DJV_ASSERT(!system->damageReset(bounds, damage));
+
+                system->redrawRequest(Math::BBox2f(10.F, 10.F, 10.F, 10.F));
+                system->redrawRequest();
+                DJV_ASSERT(system->damageReset(bounds, damage));
+                DJV_ASSERT(damage == bounds);
+                DJV_ASSERT(system->getPartialPaintCount() == partialPaintCount + 2);
+                DJV_ASSERT(100.F == system->getPaintPercentage());
+                DJV_ASSERT(!system->damageReset(bounds, damage));
+            }
+
+            if (auto context = getContext().lock())
+            {
+                // The layout and clip passes only visit the widgets that have
+                // changed and their parents.
+                auto system = TestEventSystem::create(context);
+                auto widget = CountWidget::create(context);
+                auto widget2 = CountWidget::create(context);
+                auto layout = VerticalLayout::create(context);
+                layout->addChild(widget);
+                layout->addChild(widget2);
+                auto window = Window::create(context);
+                window->addChild(layout);
+                window->show();
+
+                _tickFor(std::chrono::milliseconds(100));
+                DJV_ASSERT(widget->preLayoutCount > 0);
+                DJV_ASSERT(widget->layoutCount > 0);
+                DJV_ASSERT(widget->clipCount > 0);
+                DJV_ASSERT(widget2->preLayoutCount > 0);
+
+                widget->resetCounts();
+                widget2->resetCounts();
+                _tickFor(std::chrono::milliseconds(100));
+                DJV_ASSERT(0 == widget->preLayoutCount);
+                DJV_ASSERT(0 == widget->layoutCount);
+                DJV_ASSERT(0 == widget->clipCount);
+                DJV_ASSERT(0 == widget2->preLayoutCount);
+                DJV_ASSERT(0 == widget2->layoutCount);
+                DJV_ASSERT(0 == widget2->clipCount);
+
+                widget->resizeRequest();
+                _tickFor(std::chrono::milliseconds(100));
+                DJV_ASSERT(widget->preLayoutCount > 0);
+                DJV_ASSERT(widget->layoutCount > 0);
+                DJV_ASSERT(widget->clipCount > 0);
+                DJV_ASSERT(0 == widget2->preLayoutCount);
+                DJV_ASSERT(0 == widget2->layoutCount);
+                DJV_ASSERT(0 == widget2->clipCount);
+
+                window->close();
+            }
         }
 
     } // namespace UITest